@@ -606,6 +606,12 @@ static void lvgl_port_flush_callback(lv_display_t *drv, const lv_area_t *area, u
     lvgl_port_display_ctx_t *disp_ctx = (lvgl_port_display_ctx_t *)lv_display_get_driver_data(drv);
     assert(disp_ctx != NULL);
 
+    /* Apply the new rotation only when the first frame rendered with it is sent,
+     * so the frame on the screen doesn't change its orientation before that */
+    if (disp_ctx->current_rotation != lv_display_get_rotation(drv)) {
+        lvgl_port_disp_rotation_update(disp_ctx);
+    }
+
     int offsetx1 = area->x1;
     int offsetx2 = area->x2;
     int offsety1 = area->y1;
@@ -737,16 +743,14 @@ static void lvgl_port_disp_rotation_update(lvgl_port_display_ctx_t *disp_ctx)
         }
         break;
     }
-
-    /* Wake LVGL task, if needed */
-    lvgl_port_task_wake(LVGL_PORT_EVENT_DISPLAY, disp_ctx->disp_drv);
 }
 
 static void lvgl_port_disp_size_update_callback(lv_event_t *e)
 {
     assert(e);
     lvgl_port_display_ctx_t *disp_ctx = (lvgl_port_display_ctx_t *)lv_event_get_user_data(e);
-    lvgl_port_disp_rotation_update(disp_ctx);
+    /* The rotation is applied in the flush callback together with the first new frame */
+    lvgl_port_task_wake(LVGL_PORT_EVENT_DISPLAY, disp_ctx->disp_drv);
 }
 
 static void lvgl_port_display_invalidate_callback(lv_event_t *e)
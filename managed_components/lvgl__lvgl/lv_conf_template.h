@@ -227,6 +227,13 @@
     /** Enable drawing complex gradients in software: linear at an angle, radial or conical */
     #define LV_USE_DRAW_SW_COMPLEX_GRADIENTS    0
 
+    /** Size of the cache for the flattened paths and coverage masks of `lv_draw_vector` in bytes.
+     *  Used only if the vector graphics are rendered without ThorVG.
+     *  Paths which are drawn again with the same scale and rotation are not rasterized again,
+     *  only blended, even if they are moved by whole pixels or their color changes.
+     *  - 0: disables caching */
+    #define LV_DRAW_SW_VECTOR_CACHE_SIZE    0
+
 #endif
 
 /*Use TSi's aka (Think Silicon) NemaGFX */
@@ -518,6 +525,24 @@
 /** Add 2 x 32-bit variables to each `lv_obj_t` to speed up getting style properties */
 #define LV_OBJ_STYLE_CACHE      0
 
+/** Index the children of objects having many children on a grid to find
+ *  the pressed object quickly on dense screens (e.g. large button grids or lists). */
+#define LV_INDEV_HIT_INDEX      0
+
+/** Cache the visible area of the ancestors and whether they are hidden in each object
+ *  to make invalidation independent of the depth of the object in the tree.
+ *  Adds 6 x 32-bit variables and a pointer to each `lv_obj_t` */
+#define LV_OBJ_VISIBILITY_CACHE 0
+
+/** Maximum time in ms spent in each `lv_timer_handler()` call on deleting the objects
+ *  passed to `lv_obj_delete_incremental()` */
+#define LV_OBJ_DELETE_INCREMENTAL_TIME  2
+
+/** Don't refresh the object (layout, children, extra draw size, etc.) when one of its local
+ *  style properties is set, only mark what needs to be refreshed. All the marked objects
+ *  are refreshed once before the next layout update. */
+#define LV_OBJ_STYLE_DEFERRED_REFRESH   0
+
 /** Add `id` field to `lv_obj_t` */
 #define LV_USE_OBJ_ID           0
 
@@ -660,6 +685,10 @@
 /** Enable drawing placeholders when glyph dsc is not found. */
 #define LV_USE_FONT_PLACEHOLDER 1
 
+/** Number of letters cached per text while resolving glyphs from fallback fonts.
+ *  Used only by fonts having a `fallback`. Must be a power of 2. */
+#define LV_FONT_FALLBACK_CACHE_SIZE 32
+
 /*=================
  *  TEXT SETTINGS
  *=================*/
@@ -988,6 +1017,11 @@
     #define LV_TINY_TTF_FILE_SUPPORT 0
     #define LV_TINY_TTF_CACHE_GLYPH_CNT 128
     #define LV_TINY_TTF_CACHE_KERNING_CNT 256
+    /** Size of the glyph bitmap cache shared by all Tiny TTF fonts and sizes [bytes] */
+    #define LV_TINY_TTF_CACHE_BITMAP_SIZE (128 * 1024)
+    /** Gamma applied to the rasterized glyph coverage, in hundredths.
+     *  100: linear coverage (no correction); >100: darker, heavier anti-aliased edges. */
+    #define LV_TINY_TTF_GAMMA 100
 #endif
 
 /** Rlottie library */
@@ -997,7 +1031,8 @@
 #define LV_USE_GLTF  0
 
 /** Enable Vector Graphic APIs
- *  Requires `LV_USE_MATRIX = 1` */
+ *  Requires `LV_USE_MATRIX = 1`
+ *  With the software renderer ThorVG is used if enabled, else a built-in lightweight rasterizer. */
 #define LV_USE_VECTOR_GRAPHIC  0
 
 /** Enable ThorVG (vector graphics library) from the src/libs folder.
@@ -1019,6 +1054,11 @@
 #define LV_USE_SVG 0
 #define LV_USE_SVG_ANIMATION 0
 #define LV_USE_SVG_DEBUG 0
+/** Number of parsed SVG documents to keep, keyed by their source.
+ *  Opening an already parsed SVG again (e.g. the same icon on many images or
+ *  redrawing it with the image cache disabled) shares its render list instead of parsing it again.
+ *  0 to disable. */
+#define LV_SVG_DOC_CACHE_CNT 0
 
 /** FFmpeg library for image decoding and playing videos.
  *  Supports all major image formats so do not enable other image decoder with it. */
@@ -22,6 +22,7 @@ extern "C" {
 #endif
 #include "../misc/lv_anim.h"
 #include "../misc/lv_area.h"
+#include "../misc/lv_array.h"
 #include "../misc/lv_color_op.h"
 #include "../misc/lv_ll.h"
 #include "../misc/lv_log.h"
@@ -31,10 +32,6 @@ extern "C" {
 #include "../others/sysmon/lv_sysmon.h"
 #include "../stdlib/builtin/lv_tlsf.h"
 
-#if LV_USE_FONT_COMPRESSED
-#include "../font/lv_font_fmt_txt_private.h"
-#endif
-
 #include "../tick/lv_tick.h"
 #include "../layouts/lv_layout.h"
 
@@ -98,9 +95,15 @@ typedef struct _lv_global_t {
     uint32_t style_custom_table_size;
     uint32_t style_last_custom_prop_id;
     uint8_t * style_custom_prop_flag_lookup_table;
+#if LV_OBJ_STYLE_DEFERRED_REFRESH
+    lv_array_t style_dirty_objs;        /**< Objects whose local style changes are not refreshed yet*/
+    uint32_t style_dirty_next;          /**< Index of the next object to refresh in `style_dirty_objs`*/
+#endif
 
     lv_ll_t group_ll;
     lv_group_t * group_default;
+    uint32_t group_focusable_gen;       /**< Incremented when the focusability of any object might change*/
+    uint32_t group_spatial_gen;         /**< Incremented when any object might have been moved or resized*/
 
     lv_ll_t indev_ll;
     lv_indev_t * indev_active;
@@ -109,6 +112,13 @@ typedef struct _lv_global_t {
     uint32_t layout_count;
     lv_layout_dsc_t * layout_list;
     bool layout_update_mutex;
+    uint32_t layout_scrollbar_inv_later_cnt;    /**< Number of objects whose scrollbars will be invalidated after the layout update*/
+    lv_timer_t * obj_delete_incremental_timer;
+
+#if LV_OBJ_VISIBILITY_CACHE
+    uint32_t obj_visibility_gen;        /**< Incremented when an object with children is changed*/
+#endif
+    uint32_t obj_watch_inv_cnt;         /**< Number of objects with `watch_inv` set*/
 
     uint32_t memory_zero;
     uint32_t math_rand_seed;
@@ -142,6 +152,9 @@ typedef struct _lv_global_t {
 #if LV_DRAW_SW_COMPLEX
     lv_draw_sw_mask_radius_circle_dsc_arr_t sw_circle_cache;
 #endif
+#if LV_USE_DRAW_SW && LV_USE_VECTOR_GRAPHIC && LV_DRAW_SW_VECTOR_CACHE_SIZE > 0
+    lv_cache_t * sw_vector_cache;
+#endif
 
 #if LV_USE_LOG
     lv_log_print_g_cb_t custom_log_print_cb;
@@ -207,8 +220,13 @@ typedef struct _lv_global_t {
     struct _lv_freetype_context_t * ft_context;
 #endif
 
-#if LV_USE_FONT_COMPRESSED
-    lv_font_fmt_rle_t font_fmt_rle;
+#if LV_USE_TINY_TTF
+    lv_cache_t * tiny_ttf_bitmap_cache;
+    uint32_t tiny_ttf_font_count;
+    uint32_t tiny_ttf_font_id;
+#if LV_TINY_TTF_GAMMA != 100
+    uint8_t tiny_ttf_gamma_table[256];
+#endif
 #endif
 
 #if LV_USE_SPAN != 0
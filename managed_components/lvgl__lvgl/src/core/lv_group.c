@@ -8,15 +8,23 @@
  *********************/
 #include "lv_group_private.h"
 #include "../core/lv_obj_private.h"
+#include "../core/lv_obj_style_private.h"
 #include "../core/lv_global.h"
 #include "../indev/lv_indev.h"
 #include "../misc/lv_types.h"
+#include "../stdlib/lv_string.h"
 
 /*********************
  *      DEFINES
  *********************/
 #define default_group LV_GLOBAL_DEFAULT()->group_default
 #define group_ll_p &(LV_GLOBAL_DEFAULT()->group_ll)
+#define global_focusable_gen LV_GLOBAL_DEFAULT()->group_focusable_gen
+#define global_spatial_gen LV_GLOBAL_DEFAULT()->group_spatial_gen
+
+/*In spatial navigation an offset perpendicular to the direction counts this many times more
+ *than the distance in the direction. This way objects in the same row or column are preferred.*/
+#define SPATIAL_CROSS_WEIGHT    2
 
 /**********************
  *      TYPEDEFS
@@ -25,10 +33,20 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
-static bool focus_next_core(lv_group_t * group, void * (*begin)(const lv_ll_t *),
-                            void * (*move)(const lv_ll_t *, const void *));
+static bool focus_next_core(lv_group_t * group, bool next);
+static bool focus_dir_core(lv_group_t * group, lv_dir_t dir);
+static bool focus_entry(lv_group_t * group, uint32_t idx);
 static void lv_group_refocus(lv_group_t * g);
 static lv_indev_t * get_indev(const lv_group_t * g);
+static inline lv_group_entry_t * get_entry(const lv_group_t * g, uint32_t idx);
+static uint32_t find_entry(const lv_group_t * g, const lv_obj_t * obj);
+static bool obj_is_focusable(const lv_obj_t * obj);
+static void update_focusable(lv_group_t * g);
+static void update_spatial_index(lv_group_t * g);
+static void sort_index(lv_group_t * g, lv_array_t * index, bool by_y);
+static uint32_t find_in_index(const lv_group_t * g, const lv_array_t * index, uint32_t idx, bool by_y);
+static inline bool center_less(lv_point_t a, lv_point_t b, bool by_y);
+static void array_append(lv_array_t * array, const void * element);
 
 /**********************
  *  STATIC VARIABLES
@@ -45,6 +63,8 @@ static lv_indev_t * get_indev(const lv_group_t * g);
 void lv_group_init(void)
 {
     lv_ll_init(group_ll_p, sizeof(lv_group_t));
+    global_focusable_gen = 1;
+    global_spatial_gen = 1;
 }
 
 void lv_group_deinit(void)
@@ -57,15 +77,20 @@ lv_group_t * lv_group_create(void)
     lv_group_t * group = lv_ll_ins_head(group_ll_p);
     LV_ASSERT_MALLOC(group);
     if(group == NULL) return NULL;
-    lv_ll_init(&group->obj_ll, sizeof(lv_obj_t *));
+    lv_array_init(&group->entries, 0, sizeof(lv_group_entry_t));
+    lv_array_init(&group->index_x, 0, sizeof(uint32_t));
+    lv_array_init(&group->index_y, 0, sizeof(uint32_t));
 
-    group->obj_focus      = NULL;
+    group->focus_idx      = LV_GROUP_FOCUS_NONE;
+    group->focusable_gen  = 0;
+    group->spatial_gen    = 0;
     group->frozen         = 0;
     group->focus_cb       = NULL;
     group->edge_cb        = NULL;
     group->editing        = 0;
     group->refocus_policy = LV_GROUP_REFOCUS_POLICY_PREV;
     group->wrap           = 1;
+    group->spatial_nav    = 0;
     group->user_data      = NULL;
 
     return group;
@@ -75,15 +100,17 @@ void lv_group_delete(lv_group_t * group)
 {
     /*Defocus the currently focused object*/
     LV_ASSERT_NULL(group);
-    if(group->obj_focus != NULL) {
-        lv_obj_send_event(*group->obj_focus, LV_EVENT_DEFOCUSED, get_indev(group));
-        lv_obj_invalidate(*group->obj_focus);
+    lv_obj_t * focused = lv_group_get_focused(group);
+    if(focused != NULL) {
+        lv_obj_send_event(focused, LV_EVENT_DEFOCUSED, get_indev(group));
+        lv_obj_invalidate(focused);
     }
 
     /*Remove the objects from the group*/
-    lv_obj_t ** obj;
-    LV_LL_READ(&group->obj_ll, obj) {
-        if((*obj)->spec_attr)(*obj)->spec_attr->group_p = NULL;
+    uint32_t i;
+    for(i = 0; i < lv_array_size(&group->entries); i++) {
+        lv_obj_t * obj = get_entry(group, i)->obj;
+        if(obj->spec_attr) obj->spec_attr->group_p = NULL;
     }
 
     /*Remove the group from any indev devices */
@@ -98,7 +125,9 @@ void lv_group_delete(lv_group_t * group)
     /*If the group is the default group, set the default group as NULL*/
     if(group == lv_group_get_default()) lv_group_set_default(NULL);
 
-    lv_ll_clear(&(group->obj_ll));
+    lv_array_deinit(&group->entries);
+    lv_array_deinit(&group->index_x);
+    lv_array_deinit(&group->index_y);
     lv_ll_remove(group_ll_p, group);
     lv_free(group);
 }
@@ -125,14 +154,23 @@ void lv_group_add_obj(lv_group_t * group, lv_obj_t * obj)
     if(obj->spec_attr == NULL) lv_obj_allocate_spec_attr(obj);
     obj->spec_attr->group_p = group;
 
-    lv_obj_t ** next = lv_ll_ins_tail(&group->obj_ll);
-    LV_ASSERT_MALLOC(next);
-    if(next == NULL) return;
-    *next = obj;
+    lv_group_entry_t entry;
+    lv_memzero(&entry, sizeof(entry));
+    entry.obj = obj;
+    entry.focusable = obj_is_focusable(obj);
+    array_append(&group->entries, &entry);
+
+    /*Keep the spatial index in sync if it's already created.
+     *The new object will be sorted to its place when the index is used next time.*/
+    uint32_t idx = lv_array_size(&group->entries) - 1;
+    if(lv_array_size(&group->index_x) == idx) {
+        array_append(&group->index_x, &idx);
+        array_append(&group->index_y, &idx);
+    }
+    group->spatial_gen = 0;
 
-    /*If the head and the tail is equal then there is only one object in the linked list.
-     *In this case automatically activate it*/
-    if(lv_ll_get_head(&group->obj_ll) == next) {
+    /*If this is the only object in the group then automatically activate it*/
+    if(idx == 0) {
         lv_group_refocus(group);
     }
 
@@ -146,12 +184,18 @@ void lv_group_swap_obj(lv_obj_t * obj1, lv_obj_t * obj2)
     if(g1 != g2) return;
     if(g1 == NULL) return;
 
-    /*Do not add the object twice*/
-    lv_obj_t ** obj_i;
-    LV_LL_READ(&g1->obj_ll, obj_i) {
-        if((*obj_i) == obj1)(*obj_i) = obj2;
-        else if((*obj_i) == obj2)(*obj_i) = obj1;
-    }
+    uint32_t idx1 = find_entry(g1, obj1);
+    uint32_t idx2 = find_entry(g1, obj2);
+    if(idx1 == LV_GROUP_FOCUS_NONE || idx2 == LV_GROUP_FOCUS_NONE) return;
+
+    lv_group_entry_t * e1 = get_entry(g1, idx1);
+    lv_group_entry_t * e2 = get_entry(g1, idx2);
+    lv_group_entry_t tmp = *e1;
+    e1->obj = e2->obj;
+    e1->focusable = e2->focusable;
+    e2->obj = tmp.obj;
+    e2->focusable = tmp.focusable;
+    g1->spatial_gen = 0;    /*The centers belong to the other entry now*/
 
     lv_obj_t * focused = lv_group_get_focused(g1);
     if(focused == obj1) lv_group_focus_obj(obj2);
@@ -167,12 +211,12 @@ void lv_group_remove_obj(lv_obj_t * obj)
     LV_LOG_TRACE("begin");
 
     /*Focus on the next object*/
-    if(g->obj_focus && *g->obj_focus == obj) {
+    if(lv_group_get_focused(g) == obj) {
         if(g->frozen) g->frozen = 0;
 
         /*If this is the only object in the group then focus to nothing.*/
-        if(lv_ll_get_head(&g->obj_ll) == g->obj_focus && lv_ll_get_tail(&g->obj_ll) == g->obj_focus) {
-            lv_obj_send_event(*g->obj_focus, LV_EVENT_DEFOCUSED, get_indev(g));
+        if(lv_array_size(&g->entries) == 1) {
+            lv_obj_send_event(obj, LV_EVENT_DEFOCUSED, get_indev(g));
         }
         /*If there more objects in the group then focus to the next/prev object*/
         else {
@@ -181,21 +225,38 @@ void lv_group_remove_obj(lv_obj_t * obj)
     }
 
     /*If the focuses object is still the same then it was the only object in the group but it will
-     *be deleted. Set the `obj_focus` to NULL to get back to the initial state of the group with
+     *be deleted. Set the `focus_idx` to NONE to get back to the initial state of the group with
      *zero objects*/
-    if(g->obj_focus && *g->obj_focus == obj) {
-        g->obj_focus = NULL;
+    if(lv_group_get_focused(g) == obj) {
+        g->focus_idx = LV_GROUP_FOCUS_NONE;
     }
 
     /*Search the object and remove it from its group*/
-    lv_obj_t ** i;
-    LV_LL_READ(&g->obj_ll, i) {
-        if(*i == obj) {
-            lv_ll_remove(&g->obj_ll, i);
-            lv_free(i);
-            if(obj->spec_attr) obj->spec_attr->group_p = NULL;
-            break;
+    uint32_t idx = find_entry(g, obj);
+    if(idx != LV_GROUP_FOCUS_NONE) {
+        lv_array_remove(&g->entries, idx);
+        if(g->focus_idx != LV_GROUP_FOCUS_NONE && g->focus_idx > idx) g->focus_idx--;
+
+        /*Remove the object from the spatial index too and update the indices after it.
+         *The order of the others doesn't change, so the index remains valid.*/
+        if(lv_array_size(&g->index_x) > 0) {
+            lv_array_t * indices[2] = {&g->index_x, &g->index_y};
+            uint32_t k;
+            for(k = 0; k < 2; k++) {
+                uint32_t * ids = lv_array_front(indices[k]);
+                uint32_t cnt = lv_array_size(indices[k]);
+                uint32_t i;
+                uint32_t j = 0;
+                for(i = 0; i < cnt; i++) {
+                    if(ids[i] == idx) continue;
+                    ids[j] = ids[i] > idx ? ids[i] - 1 : ids[i];
+                    j++;
+                }
+                lv_array_remove(indices[k], cnt - 1);
+            }
         }
+
+        if(obj->spec_attr) obj->spec_attr->group_p = NULL;
     }
     LV_LOG_TRACE("finished");
 }
@@ -205,19 +266,23 @@ void lv_group_remove_all_objs(lv_group_t * group)
     LV_ASSERT_NULL(group);
 
     /*Defocus the currently focused object*/
-    if(group->obj_focus != NULL) {
-        lv_obj_send_event(*group->obj_focus, LV_EVENT_DEFOCUSED, get_indev(group));
-        lv_obj_invalidate(*group->obj_focus);
-        group->obj_focus = NULL;
+    lv_obj_t * focused = lv_group_get_focused(group);
+    if(focused != NULL) {
+        lv_obj_send_event(focused, LV_EVENT_DEFOCUSED, get_indev(group));
+        lv_obj_invalidate(focused);
+        group->focus_idx = LV_GROUP_FOCUS_NONE;
     }
 
     /*Remove the objects from the group*/
-    lv_obj_t ** obj;
-    LV_LL_READ(&group->obj_ll, obj) {
-        if((*obj)->spec_attr)(*obj)->spec_attr->group_p = NULL;
+    uint32_t i;
+    for(i = 0; i < lv_array_size(&group->entries); i++) {
+        lv_obj_t * obj = get_entry(group, i)->obj;
+        if(obj->spec_attr) obj->spec_attr->group_p = NULL;
     }
 
-    lv_ll_clear(&(group->obj_ll));
+    lv_array_clear(&group->entries);
+    lv_array_clear(&group->index_x);
+    lv_array_clear(&group->index_y);
 }
 
 void lv_group_focus_obj(lv_obj_t * obj)
@@ -231,33 +296,31 @@ void lv_group_focus_obj(lv_obj_t * obj)
     /*On defocus edit mode must be leaved*/
     lv_group_set_editing(g, false);
 
-    lv_obj_t ** i;
-    LV_LL_READ(&g->obj_ll, i) {
-        if(*i == obj) {
-            if(g->obj_focus != NULL && obj != *g->obj_focus) {  /*Do not defocus if the same object needs to be focused again*/
-                lv_result_t res = lv_obj_send_event(*g->obj_focus, LV_EVENT_DEFOCUSED, get_indev(g));
-                if(res != LV_RESULT_OK) return;
-                lv_obj_invalidate(*g->obj_focus);
-            }
-
-            g->obj_focus = i;
+    if(find_entry(g, obj) == LV_GROUP_FOCUS_NONE) return;
 
-            if(g->obj_focus != NULL) {
-                if(g->focus_cb) g->focus_cb(g);
-                lv_result_t res = lv_obj_send_event(*g->obj_focus, LV_EVENT_FOCUSED, get_indev(g));
-                if(res != LV_RESULT_OK) return;
-                lv_obj_invalidate(*g->obj_focus);
-            }
-            break;
-        }
+    lv_obj_t * focused = lv_group_get_focused(g);
+    if(focused != NULL && obj != focused) {  /*Do not defocus if the same object needs to be focused again*/
+        lv_result_t res = lv_obj_send_event(focused, LV_EVENT_DEFOCUSED, get_indev(g));
+        if(res != LV_RESULT_OK) return;
+        lv_obj_invalidate(focused);
     }
+
+    /*The event might have changed the group*/
+    uint32_t idx = find_entry(g, obj);
+    if(idx == LV_GROUP_FOCUS_NONE) return;
+    g->focus_idx = idx;
+
+    if(g->focus_cb) g->focus_cb(g);
+    lv_result_t res = lv_obj_send_event(obj, LV_EVENT_FOCUSED, get_indev(g));
+    if(res != LV_RESULT_OK) return;
+    lv_obj_invalidate(obj);
 }
 
 void lv_group_focus_next(lv_group_t * group)
 {
     LV_ASSERT_NULL(group);
 
-    bool focus_changed = focus_next_core(group, lv_ll_get_head, lv_ll_get_next);
+    bool focus_changed = focus_next_core(group, true);
     if(group->edge_cb) {
         if(!focus_changed)
             group->edge_cb(group, true);
@@ -268,13 +331,27 @@ void lv_group_focus_prev(lv_group_t * group)
 {
     LV_ASSERT_NULL(group);
 
-    bool focus_changed = focus_next_core(group, lv_ll_get_tail, lv_ll_get_prev);
+    bool focus_changed = focus_next_core(group, false);
     if(group->edge_cb) {
         if(!focus_changed)
             group->edge_cb(group, false);
     }
 }
 
+void lv_group_focus_dir(lv_group_t * group, lv_dir_t dir)
+{
+    LV_ASSERT_NULL(group);
+
+    bool focus_changed;
+    if(group->focus_idx == LV_GROUP_FOCUS_NONE) focus_changed = focus_next_core(group, true);
+    else focus_changed = focus_dir_core(group, dir);
+
+    if(group->edge_cb) {
+        if(!focus_changed)
+            group->edge_cb(group, dir == LV_DIR_RIGHT || dir == LV_DIR_BOTTOM);
+    }
+}
+
 void lv_group_focus_freeze(lv_group_t * group, bool en)
 {
     LV_ASSERT_NULL(group);
@@ -320,7 +397,7 @@ void lv_group_set_editing(lv_group_t * group, bool edit)
     lv_obj_t * focused = lv_group_get_focused(group);
 
     if(focused) {
-        lv_result_t res = lv_obj_send_event(*group->obj_focus, LV_EVENT_FOCUSED, get_indev(group));
+        lv_result_t res = lv_obj_send_event(focused, LV_EVENT_FOCUSED, get_indev(group));
         if(res != LV_RESULT_OK) return;
 
         lv_obj_invalidate(focused);
@@ -339,12 +416,18 @@ void lv_group_set_wrap(lv_group_t * group, bool en)
     group->wrap = en ? 1 : 0;
 }
 
+void lv_group_set_spatial_nav(lv_group_t * group, bool en)
+{
+    LV_ASSERT_NULL(group);
+    group->spatial_nav = en ? 1 : 0;
+}
+
 lv_obj_t * lv_group_get_focused(const lv_group_t * group)
 {
     if(!group) return NULL;
-    if(group->obj_focus == NULL) return NULL;
+    if(group->focus_idx == LV_GROUP_FOCUS_NONE) return NULL;
 
-    return *group->obj_focus;
+    return get_entry(group, group->focus_idx)->obj;
 }
 
 lv_group_focus_cb_t lv_group_get_focus_cb(const lv_group_t * group)
@@ -371,24 +454,22 @@ bool lv_group_get_wrap(lv_group_t * group)
     return group->wrap;
 }
 
+bool lv_group_get_spatial_nav(const lv_group_t * group)
+{
+    if(!group) return false;
+    return group->spatial_nav;
+}
+
 uint32_t lv_group_get_obj_count(lv_group_t * group)
 {
     LV_ASSERT_NULL(group);
-    return lv_ll_get_len(&group->obj_ll);
+    return lv_array_size(&group->entries);
 }
 
 lv_obj_t * lv_group_get_obj_by_index(lv_group_t * group, uint32_t index)
 {
-    uint32_t len = 0;
-    lv_obj_t ** obj;
-
-    LV_LL_READ(&group->obj_ll, obj) {
-        if(len == index) {
-            return *obj;
-        }
-        len++;
-    }
-    return NULL;
+    if(index >= lv_array_size(&group->entries)) return NULL;
+    return get_entry(group, index)->obj;
 }
 
 uint32_t lv_group_get_count(void)
@@ -410,6 +491,21 @@ lv_group_t  * lv_group_by_index(uint32_t index)
 
     return NULL;
 }
+
+void lv_group_invalidate_focusable_cache(void)
+{
+    global_focusable_gen++;
+    /*0 means "never updated"*/
+    if(global_focusable_gen == 0) global_focusable_gen = 1;
+}
+
+void lv_group_invalidate_spatial_index(void)
+{
+    global_spatial_gen++;
+    /*0 means "never updated"*/
+    if(global_spatial_gen == 0) global_spatial_gen = 1;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -428,80 +524,292 @@ static void lv_group_refocus(lv_group_t * g)
     g->wrap = temp_wrap;
 }
 
-static bool focus_next_core(lv_group_t * group, void * (*begin)(const lv_ll_t *),
-                            void * (*move)(const lv_ll_t *, const void *))
+static bool focus_next_core(lv_group_t * group, bool next)
 {
-    bool focus_changed = false;
-    if(group->frozen) return focus_changed;
+    if(group->frozen) return false;
 
-    lv_obj_t ** obj_next     = group->obj_focus;
-    lv_obj_t ** obj_sentinel = NULL;
-    bool can_move            = true;
-    bool can_begin           = true;
+    uint32_t cnt = lv_array_size(&group->entries);
+    if(cnt == 0) return false;  /*Group is empty*/
 
-    for(;;) {
-        if(obj_next == NULL) {
-            if(group->wrap || obj_sentinel == NULL) {
-                if(!can_begin) return focus_changed;
-                obj_next  = begin(&group->obj_ll);
-                can_move  = false;
-                can_begin = false;
-            }
-            else {
-                /*Currently focused object is the last/first in the group, keep it that way*/
-                return focus_changed;
-            }
+    update_focusable(group);
+
+    /*In spatial navigation go in reading order, else in the order of adding*/
+    const uint32_t * order = NULL;
+    uint32_t start = group->focus_idx;
+    if(group->spatial_nav) {
+        update_spatial_index(group);
+        order = lv_array_front(&group->index_y);
+        if(start != LV_GROUP_FOCUS_NONE) start = find_in_index(group, &group->index_y, start, true);
+    }
+
+    uint32_t pos = start;
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        if(pos == LV_GROUP_FOCUS_NONE) {
+            pos = next ? 0 : cnt - 1;
+        }
+        else if(next) {
+            if(pos + 1 < cnt) pos++;
+            else if(group->wrap) pos = 0;
+            else return false;  /*Currently focused object is the last in the group, keep it that way*/
+        }
+        else {
+            if(pos > 0) pos--;
+            else if(group->wrap) pos = cnt - 1;
+            else return false;  /*Currently focused object is the first in the group, keep it that way*/
         }
 
-        if(obj_sentinel == NULL) {
-            obj_sentinel = obj_next;
-            if(obj_sentinel == NULL) return focus_changed; /*Group is empty*/
+        /*Give up if we walked the entire group and haven't found another focusable object*/
+        if(pos == start) return false;
+
+        uint32_t idx = order ? order[pos] : pos;
+        if(get_entry(group, idx)->focusable) return focus_entry(group, idx);
+    }
+
+    return false;
+}
+
+static bool focus_dir_core(lv_group_t * group, lv_dir_t dir)
+{
+    if(group->frozen) return false;
+    if(dir != LV_DIR_LEFT && dir != LV_DIR_RIGHT && dir != LV_DIR_TOP && dir != LV_DIR_BOTTOM) return false;
+
+    update_focusable(group);
+    update_spatial_index(group);
+
+    bool by_y = dir == LV_DIR_TOP || dir == LV_DIR_BOTTOM;
+    int32_t step = (dir == LV_DIR_RIGHT || dir == LV_DIR_BOTTOM) ? 1 : -1;
+    lv_array_t * index = by_y ? &group->index_y : &group->index_x;
+    const uint32_t * ids = lv_array_front(index);
+    int32_t cnt = (int32_t)lv_array_size(index);
+
+    lv_point_t start = get_entry(group, group->focus_idx)->center;
+    int32_t start_main = by_y ? start.y : start.x;
+    int32_t start_cross = by_y ? start.x : start.y;
+
+    uint32_t best = LV_GROUP_FOCUS_NONE;
+    int32_t best_score = INT32_MAX;
+
+    /*Walk away from the focused object in the index. The distance in the direction only grows,
+     *so stop when it's alone larger than the score of the best candidate.*/
+    int32_t i;
+    for(i = (int32_t)find_in_index(group, index, group->focus_idx, by_y) + step; i >= 0 && i < cnt; i += step) {
+        lv_group_entry_t * e = get_entry(group, ids[i]);
+        int32_t main_dist = LV_ABS((by_y ? e->center.y : e->center.x) - start_main);
+        if(main_dist >= best_score) break;
+        if(main_dist == 0) continue;    /*In the same row/column, not in the direction*/
+        if(!e->focusable) continue;
+
+        int32_t cross_dist = LV_ABS((by_y ? e->center.x : e->center.y) - start_cross);
+        int32_t score = main_dist + SPATIAL_CROSS_WEIGHT * cross_dist;
+        if(score < best_score) {
+            best_score = score;
+            best = ids[i];
         }
+    }
+
+    if(best == LV_GROUP_FOCUS_NONE) return false;
+    return focus_entry(group, best);
+}
+
+/**
+ * Move the focus to an object of the group
+ * @param group     pointer to a group
+ * @param idx       index of the object in `entries`
+ * @return          true: the focus was moved
+ */
+static bool focus_entry(lv_group_t * group, uint32_t idx)
+{
+    lv_obj_t * obj_next = get_entry(group, idx)->obj;
+    lv_obj_t * focused = lv_group_get_focused(group);
+    if(obj_next == focused) return false; /*There's only one visible object and it's already focused*/
 
-        if(can_move) {
-            obj_next = move(&group->obj_ll, obj_next);
+    if(focused) {
+        lv_result_t res = lv_obj_send_event(focused, LV_EVENT_DEFOCUSED, get_indev(group));
+        if(res != LV_RESULT_OK) return false;
+        lv_obj_invalidate(focused);
 
-            /*Give up if we walked the entire list and haven't found another visible object*/
-            if(obj_next == obj_sentinel) return focus_changed;
+        /*The event might have added or removed objects*/
+        if(idx >= lv_array_size(&group->entries) || get_entry(group, idx)->obj != obj_next) {
+            idx = find_entry(group, obj_next);
+            if(idx == LV_GROUP_FOCUS_NONE) return false;
         }
+    }
+
+    group->focus_idx = idx;
+
+    lv_result_t res = lv_obj_send_event(obj_next, LV_EVENT_FOCUSED, get_indev(group));
+    if(res != LV_RESULT_OK) return false;
+
+    lv_obj_invalidate(obj_next);
+
+    if(group->focus_cb) group->focus_cb(group);
+    return true;
+}
+
+static inline lv_group_entry_t * get_entry(const lv_group_t * g, uint32_t idx)
+{
+    return lv_array_at(&g->entries, idx);
+}
+
+/**
+ * Get the index of an object in a group
+ * @param g     pointer to a group
+ * @param obj   pointer to an object
+ * @return      the index in `entries` or `LV_GROUP_FOCUS_NONE` if not found
+ */
+static uint32_t find_entry(const lv_group_t * g, const lv_obj_t * obj)
+{
+    uint32_t cnt = lv_array_size(&g->entries);
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        if(get_entry(g, i)->obj == obj) return i;
+    }
+
+    return LV_GROUP_FOCUS_NONE;
+}
+
+static bool obj_is_focusable(const lv_obj_t * obj)
+{
+    if(lv_obj_has_state(obj, LV_STATE_DISABLED)) return false;
+
+    /*Hidden objects don't receive focus.
+     *If any parent is hidden, the object is also hidden)*/
+    while(obj) {
+        if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return false;
+        obj = lv_obj_get_parent(obj);
+    }
+
+    return true;
+}
+
+/**
+ * Check the disabled state and the hidden flag of the objects again if any of them might have changed.
+ * This way navigating doesn't need to check the parents of all skipped objects.
+ */
+static void update_focusable(lv_group_t * g)
+{
+    if(g->focusable_gen == global_focusable_gen) return;
 
-        can_move = true;
+    uint32_t cnt = lv_array_size(&g->entries);
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        lv_group_entry_t * e = get_entry(g, i);
+        e->focusable = obj_is_focusable(e->obj);
+    }
 
-        if(obj_next == NULL) continue;
-        if(lv_obj_get_state(*obj_next) & LV_STATE_DISABLED) continue;
+    g->focusable_gen = global_focusable_gen;
+}
 
-        /*Hidden objects don't receive focus.
-         *If any parent is hidden, the object is also hidden)*/
-        lv_obj_t * parent = *obj_next;
-        while(parent) {
-            if(lv_obj_has_flag(parent, LV_OBJ_FLAG_HIDDEN)) break;
-            parent = lv_obj_get_parent(parent);
+/**
+ * Create the spatial index or update it with the current position of the objects
+ * if any object might have been moved since the last update.
+ */
+static void update_spatial_index(lv_group_t * g)
+{
+    /*The pending style changes might move the objects too*/
+    lv_obj_refresh_dirty_styles();
+    if(g->spatial_gen == global_spatial_gen) return;
+
+    uint32_t cnt = lv_array_size(&g->entries);
+
+    /*Create the index with the first use*/
+    if(lv_array_size(&g->index_x) != cnt) {
+        lv_array_clear(&g->index_x);
+        lv_array_clear(&g->index_y);
+        lv_array_resize(&g->index_x, cnt);
+        lv_array_resize(&g->index_y, cnt);
+        uint32_t i;
+        for(i = 0; i < cnt; i++) {
+            lv_array_push_back(&g->index_x, &i);
+            lv_array_push_back(&g->index_y, &i);
         }
+    }
 
-        if(parent && lv_obj_has_flag(parent, LV_OBJ_FLAG_HIDDEN)) continue;
+    /*Be sure the objects are at their final position*/
+    if(g->focus_idx != LV_GROUP_FOCUS_NONE) lv_obj_update_layout(get_entry(g, g->focus_idx)->obj);
 
-        /*If we got her a good candidate is found*/
-        break;
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        lv_group_entry_t * e = get_entry(g, i);
+        lv_area_t coords;
+        lv_obj_get_coords(e->obj, &coords);
+        e->center.x = coords.x1 + lv_area_get_width(&coords) / 2;
+        e->center.y = coords.y1 + lv_area_get_height(&coords) / 2;
     }
 
-    if(obj_next == group->obj_focus) return focus_changed; /*There's only one visible object and it's already focused*/
+    sort_index(g, &g->index_x, false);
+    sort_index(g, &g->index_y, true);
+
+    /*After the layout update as it might have moved the objects*/
+    g->spatial_gen = global_spatial_gen;
+}
+
+/**
+ * Sort an index by the centers of the objects.
+ * Typically the objects are moved together (e.g. scrolled) or only a few of them are moved,
+ * so the index is almost sorted and insertion sort repairs it in about linear time.
+ */
+static void sort_index(lv_group_t * g, lv_array_t * index, bool by_y)
+{
+    uint32_t * ids = lv_array_front(index);
+    uint32_t cnt = lv_array_size(index);
+    uint32_t i;
+    for(i = 1; i < cnt; i++) {
+        uint32_t id = ids[i];
+        lv_point_t center = get_entry(g, id)->center;
+        uint32_t j = i;
+        while(j > 0 && center_less(center, get_entry(g, ids[j - 1])->center, by_y)) {
+            ids[j] = ids[j - 1];
+            j--;
+        }
+        ids[j] = id;
+    }
+}
 
-    if(group->obj_focus) {
-        lv_result_t res = lv_obj_send_event(*group->obj_focus, LV_EVENT_DEFOCUSED, get_indev(group));
-        if(res != LV_RESULT_OK) return focus_changed;
-        lv_obj_invalidate(*group->obj_focus);
+/**
+ * Find the position of an object in a sorted index
+ * @param g         pointer to a group
+ * @param index     pointer to `index_x` or `index_y`
+ * @param idx       index of the object in `entries`
+ * @param by_y      true: `index` is sorted by y first
+ * @return          position of `idx` in `index`
+ */
+static uint32_t find_in_index(const lv_group_t * g, const lv_array_t * index, uint32_t idx, bool by_y)
+{
+    const uint32_t * ids = lv_array_front(index);
+    lv_point_t center = get_entry(g, idx)->center;
+
+    /*Find the first object at the same position...*/
+    uint32_t min = 0;
+    uint32_t max = lv_array_size(index);
+    while(min < max) {
+        uint32_t mid = (min + max) / 2;
+        if(center_less(get_entry(g, ids[mid])->center, center, by_y)) min = mid + 1;
+        else max = mid;
     }
 
-    group->obj_focus = obj_next;
+    /*...and look for the object among the objects there*/
+    while(min < lv_array_size(index) && ids[min] != idx) min++;
 
-    lv_result_t res = lv_obj_send_event(*group->obj_focus, LV_EVENT_FOCUSED, get_indev(group));
-    if(res != LV_RESULT_OK) return focus_changed;
+    return min;
+}
 
-    lv_obj_invalidate(*group->obj_focus);
+static inline bool center_less(lv_point_t a, lv_point_t b, bool by_y)
+{
+    if(by_y) return a.y != b.y ? a.y < b.y : a.x < b.x;
+    else return a.x != b.x ? a.x < b.x : a.y < b.y;
+}
 
-    if(group->focus_cb) group->focus_cb(group);
-    focus_changed = true;
-    return focus_changed;
+/**
+ * Add an element to an array growing its capacity exponentially
+ */
+static void array_append(lv_array_t * array, const void * element)
+{
+    if(lv_array_is_full(array)) {
+        lv_array_resize(array, lv_array_capacity(array) * 2 + 4);
+    }
+    lv_array_push_back(array, element);
 }
 
 /**
@@ -17,6 +17,7 @@ extern "C" {
 
 #include "../misc/lv_types.h"
 #include "../misc/lv_ll.h"
+#include "../misc/lv_area.h"
 
 /*********************
  *      DEFINES
@@ -122,6 +123,15 @@ void lv_group_focus_next(lv_group_t * group);
  */
 void lv_group_focus_prev(lv_group_t * group);
 
+/**
+ * Focus on the nearest focusable Widget in a direction on the screen (defocus the current).
+ * Widgets in the same row or column are preferred. If there is no Widget in the given
+ * direction, the focus remains and the edge callback is called.
+ * @param group     pointer to a group
+ * @param dir       `LV_DIR_LEFT/RIGHT/TOP/BOTTOM`
+ */
+void lv_group_focus_dir(lv_group_t * group, lv_dir_t dir);
+
 /**
  * Do not allow changing focus from current Widget.
  * @param group     pointer to a group
@@ -174,6 +184,16 @@ void lv_group_set_editing(lv_group_t * group, bool edit);
  */
 void lv_group_set_wrap(lv_group_t * group, bool en);
 
+/**
+ * Enable spatial navigation. In this mode focusing the next/previous Widget follows the
+ * position of the Widgets' centers on the screen (from top to bottom, and from left to right
+ * if they are at the same height) instead of the order of adding, and the arrow keys of a
+ * keypad move the focus in their direction unless the group is in edit mode.
+ * @param group         pointer to group
+ * @param en            true: enable spatial navigation; false: use the order of adding
+ */
+void lv_group_set_spatial_nav(lv_group_t * group, bool en);
+
 /**
  * Get Widget that has focus, or NULL if there isn't one.
  * @param group         pointer to a group
@@ -209,6 +229,13 @@ bool lv_group_get_editing(const lv_group_t * group);
  */
 bool lv_group_get_wrap(lv_group_t * group);
 
+/**
+ * Get whether spatial navigation is enabled.
+ * @param group         pointer to group
+ * @return              true: spatial navigation is enabled
+ */
+bool lv_group_get_spatial_nav(const lv_group_t * group);
+
 /**
  * Get number of Widgets in group.
  * @param group         pointer to a group
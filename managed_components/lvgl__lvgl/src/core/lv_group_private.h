@@ -15,22 +15,43 @@ extern "C" {
  *********************/
 
 #include "lv_group.h"
+#include "../misc/lv_array.h"
 
 /*********************
  *      DEFINES
  *********************/
 
+/** `focus_idx` of a group without a focused object*/
+#define LV_GROUP_FOCUS_NONE     UINT32_MAX
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+/**
+ * An object of a group with the data cached to navigate quickly
+ */
+typedef struct {
+    lv_obj_t * obj;
+    lv_point_t center;          /**< Center of the object when the spatial index was last updated*/
+    uint8_t focusable : 1;      /**< 1: not disabled and neither the object nor its parents are hidden*/
+} lv_group_entry_t;
+
 /**
  * Groups can be used to logically hold objects so that they can be individually focused.
  * They are NOT for laying out objects on a screen (try layouts for that).
  */
 struct _lv_group_t {
-    lv_ll_t obj_ll;        /**< Linked list to store the objects in the group*/
-    lv_obj_t ** obj_focus; /**< The object in focus*/
+    lv_array_t entries;     /**< The objects of the group as `lv_group_entry_t` in the order of adding*/
+    uint32_t focus_idx;     /**< Index of the focused object in `entries`, `LV_GROUP_FOCUS_NONE` if there is none*/
+    uint32_t focusable_gen; /**< `focusable` of the entries is valid if it equals to the global generation*/
+
+    /*Spatial index: indices of the entries sorted by the coordinates of their center.
+     *They are created when the spatial navigation is used first and after that kept in sync with `entries`.*/
+    lv_array_t index_x;     /**< Sorted by x, then y*/
+    lv_array_t index_y;     /**< Sorted by y, then x (reading order)*/
+    uint32_t spatial_gen;   /**< The centers and the order of the spatial index are valid if it equals to
+                                 the global generation*/
 
     lv_group_focus_cb_t focus_cb;              /**< A function to call when a new object is focused (optional)*/
     lv_group_edge_cb_t  edge_cb;               /**< A function to call when an edge is reached, no more focus
@@ -45,6 +66,8 @@ struct _lv_group_t {
                                    deletion.*/
     uint8_t wrap : 1;           /**< 1: Focus next/prev can wrap at end of list. 0: Focus next/prev stops at end
                                    of list.*/
+    uint8_t spatial_nav : 1;    /**< 1: Focus next/prev follows the position of the objects and
+                                     the arrow keys move the focus*/
 };
 
 
@@ -64,6 +87,18 @@ void lv_group_init(void);
  */
 void lv_group_deinit(void);
 
+/**
+ * Mark the cached focusability of the objects in all groups as outdated.
+ * Needs to be called when the `HIDDEN` flag, the `DISABLED` state or the parent of an object changes.
+ */
+void lv_group_invalidate_focusable_cache(void);
+
+/**
+ * Mark the spatial index of all groups as outdated.
+ * Needs to be called when an object is moved, resized, hidden or gets a new parent.
+ */
+void lv_group_invalidate_spatial_index(void);
+
 /**********************
  *      MACROS
  **********************/
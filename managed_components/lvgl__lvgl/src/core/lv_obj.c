@@ -15,7 +15,7 @@
 #include "../indev/lv_indev.h"
 #include "../indev/lv_indev_private.h"
 #include "lv_refr.h"
-#include "lv_group.h"
+#include "lv_group_private.h"
 #include "../display/lv_display.h"
 #include "../display/lv_display_private.h"
 #include "../themes/lv_theme.h"
@@ -36,6 +36,9 @@
 #define LV_OBJ_DEF_HEIGHT   (LV_DPX(50))
 #define STYLE_TRANSITION_MAX 32
 
+/*Flags changing where the children of an object can be clicked*/
+#define HIT_INDEX_FLAGS (LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING | LV_OBJ_FLAG_OVERFLOW_VISIBLE)
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -264,6 +267,13 @@ void lv_obj_add_flag(lv_obj_t * obj, lv_obj_flag_t f)
 
     obj->flags |= f;
 
+    if(f & HIT_INDEX_FLAGS) lv_indev_hit_index_invalidate(obj->parent);
+    if(f & (LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_OVERFLOW_VISIBLE)) lv_obj_invalidate_visibility_cache(obj);
+    if(f & LV_OBJ_FLAG_HIDDEN) {
+        lv_group_invalidate_focusable_cache();
+        lv_group_invalidate_spatial_index();
+    }
+
     if(f & LV_OBJ_FLAG_HIDDEN) {
         if(lv_obj_has_state(obj, LV_STATE_FOCUSED)) {
             lv_group_t * group = lv_obj_get_group(obj);
@@ -306,6 +316,13 @@ void lv_obj_remove_flag(lv_obj_t * obj, lv_obj_flag_t f)
 
     obj->flags &= (~f);
 
+    if(f & HIT_INDEX_FLAGS) lv_indev_hit_index_invalidate(obj->parent);
+    if(f & (LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_OVERFLOW_VISIBLE)) lv_obj_invalidate_visibility_cache(obj);
+    if(f & LV_OBJ_FLAG_HIDDEN) {
+        lv_group_invalidate_focusable_cache();
+        lv_group_invalidate_spatial_index();
+    }
+
     if(f & LV_OBJ_FLAG_HIDDEN) {
         lv_obj_invalidate(obj);
         lv_obj_mark_layout_as_dirty(lv_obj_get_parent(obj));
@@ -598,10 +615,13 @@ static void lv_obj_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     lv_obj_enable_style_refresh(false); /*No need to refresh the style because the object will be deleted*/
     lv_obj_remove_style_all(obj);
     lv_obj_enable_style_refresh(true);
+    lv_obj_style_clear_dirty(obj);
 
     /*Remove the animations from this object*/
     lv_anim_delete(obj, NULL);
 
+    lv_obj_set_watch_invalidation(obj, false);
+
     /*Delete from the group*/
     lv_group_t * group = lv_obj_get_group(obj);
     if(group) lv_group_remove_obj(obj);
@@ -612,6 +632,8 @@ static void lv_obj_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
             obj->spec_attr->children = NULL;
         }
 
+        lv_indev_hit_index_delete(obj);
+
         lv_event_remove_all(&obj->spec_attr->event_list);
 #if LV_USE_OBJ_NAME
         if(obj->spec_attr->name && !obj->spec_attr->name_static) {
@@ -989,6 +1011,7 @@ static void update_obj_state(lv_obj_t * obj, lv_state_t new_state)
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
     lv_state_t prev_state = obj->state;
+    if((prev_state ^ new_state) & LV_STATE_DISABLED) lv_group_invalidate_focusable_cache();
 
     lv_style_state_cmp_t cmp_res = lv_obj_style_state_compare(obj, prev_state, new_state);
     /*If there is no difference in styles there is nothing else to do*/
@@ -8,9 +8,12 @@
  *********************/
 #include "lv_obj_class_private.h"
 #include "lv_obj_private.h"
+#include "lv_obj_style_private.h"
+#include "lv_group_private.h"
 #include "../themes/lv_theme.h"
 #include "../display/lv_display.h"
 #include "../display/lv_display_private.h"
+#include "../indev/lv_indev_hit_index.h"
 #include "../stdlib/lv_string.h"
 
 /*********************
@@ -30,6 +33,7 @@
  *  STATIC PROTOTYPES
  **********************/
 static void lv_obj_construct(const lv_obj_class_t * class_p, lv_obj_t * obj);
+static void init_obj_finish(lv_obj_t * obj);
 static uint32_t get_instance_size(const lv_obj_class_t * class_p);
 
 /**********************
@@ -96,6 +100,7 @@ lv_obj_t * lv_obj_class_create_obj(const lv_obj_class_t * class_p, lv_obj_t * pa
         parent->spec_attr->children = lv_realloc(parent->spec_attr->children,
                                                  sizeof(lv_obj_t *) * parent->spec_attr->child_cnt);
         parent->spec_attr->children[parent->spec_attr->child_cnt - 1] = obj;
+        lv_indev_hit_index_invalidate(parent);
     }
 
     return obj;
@@ -114,23 +119,45 @@ void lv_obj_class_init_obj(lv_obj_t * obj)
     lv_obj_enable_style_refresh(true);
     lv_obj_refresh_style(obj, LV_PART_ANY, LV_STYLE_PROP_ANY);
 
-    lv_obj_refresh_self_size(obj);
+    init_obj_finish(obj);
+}
 
-    lv_group_t * def_group = lv_group_get_default();
-    if(def_group && lv_obj_is_group_def(obj)) {
-        lv_group_add_obj(def_group, obj);
-    }
+void lv_obj_class_init_obj_from(lv_obj_t * obj, const lv_obj_t * src)
+{
+    if(obj == NULL) return;
 
-    lv_obj_t * parent = lv_obj_get_parent(obj);
-    if(parent) {
-        /*Call the ancestor's event handler to the parent to notify it about the new child.
-         *Also triggers layout update*/
-        lv_obj_send_event(parent, LV_EVENT_CHILD_CHANGED, obj);
-        lv_obj_send_event(parent, LV_EVENT_CHILD_CREATED, obj);
+    lv_obj_mark_layout_as_dirty(obj);
+    lv_obj_enable_style_refresh(false);
 
-        /*Invalidate the area if not screen created*/
-        lv_obj_invalidate(obj);
+    /*Don't apply the theme as the styles of `src` will be used anyway*/
+    lv_obj_construct(obj->class_p, obj);
+
+    /*The constructor might have created children which enable style refresh again*/
+    lv_obj_enable_style_refresh(false);
+    lv_obj_copy_styles(obj, src);
+
+    /*The object is not drawn or laid out yet, so the flags can be simply copied*/
+    obj->flags = src->flags;
+    obj->state = src->state & ~(LV_STATE_FOCUSED | LV_STATE_FOCUS_KEY | LV_STATE_EDITED |
+                                LV_STATE_HOVERED | LV_STATE_PRESSED | LV_STATE_SCROLLED);
+
+    if(src->spec_attr) {
+        lv_obj_allocate_spec_attr(obj);
+        obj->spec_attr->ext_click_pad = src->spec_attr->ext_click_pad;
+        obj->spec_attr->scrollbar_mode = src->spec_attr->scrollbar_mode;
+        obj->spec_attr->scroll_snap_x = src->spec_attr->scroll_snap_x;
+        obj->spec_attr->scroll_snap_y = src->spec_attr->scroll_snap_y;
+        obj->spec_attr->scroll_dir = src->spec_attr->scroll_dir;
     }
+
+    /*The children created by the constructor might be hidden or disabled now*/
+    lv_obj_invalidate_visibility_cache(obj);
+    lv_group_invalidate_focusable_cache();
+
+    lv_obj_enable_style_refresh(true);
+    lv_obj_refresh_style(obj, LV_PART_ANY, LV_STYLE_PROP_ANY);
+
+    init_obj_finish(obj);
 }
 
 void lv_obj_destruct(lv_obj_t * obj)
@@ -192,6 +219,31 @@ static void lv_obj_construct(const lv_obj_class_t * class_p, lv_obj_t * obj)
     if(obj->class_p->constructor_cb) obj->class_p->constructor_cb(class_p, obj);
 }
 
+/**
+ * The common last steps of initializing a new object
+ * @param obj       pointer to the new object
+ */
+static void init_obj_finish(lv_obj_t * obj)
+{
+    lv_obj_refresh_self_size(obj);
+
+    lv_group_t * def_group = lv_group_get_default();
+    if(def_group && lv_obj_is_group_def(obj)) {
+        lv_group_add_obj(def_group, obj);
+    }
+
+    lv_obj_t * parent = lv_obj_get_parent(obj);
+    if(parent) {
+        /*Call the ancestor's event handler to the parent to notify it about the new child.
+         *Also triggers layout update*/
+        lv_obj_send_event(parent, LV_EVENT_CHILD_CHANGED, obj);
+        lv_obj_send_event(parent, LV_EVENT_CHILD_CREATED, obj);
+
+        /*Invalidate the area if not screen created*/
+        lv_obj_invalidate(obj);
+    }
+}
+
 static uint32_t get_instance_size(const lv_obj_class_t * class_p)
 {
     /*Find a base in which instance size is set*/
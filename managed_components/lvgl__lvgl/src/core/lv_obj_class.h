@@ -57,6 +57,15 @@ lv_obj_t * lv_obj_class_create_obj(const lv_obj_class_t * class_p, lv_obj_t * pa
 
 void lv_obj_class_init_obj(lv_obj_t * obj);
 
+/**
+ * Initialize an object created by `lv_obj_class_create_obj` as a copy of an other object
+ * of the same class. The theme is not applied, but the styles, flags, states and scroll settings
+ * of `src` are used instead.
+ * @param obj       pointer to an object created by `lv_obj_class_create_obj`
+ * @param src       pointer to the object to copy
+ */
+void lv_obj_class_init_obj_from(lv_obj_t * obj, const lv_obj_t * src);
+
 bool lv_obj_is_editable(lv_obj_t * obj);
 
 bool lv_obj_is_group_def(lv_obj_t * obj);
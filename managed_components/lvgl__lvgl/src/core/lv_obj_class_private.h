@@ -58,6 +58,9 @@ struct _lv_obj_class_t {
     uint32_t group_def : 2;            /**< Value from ::lv_obj_class_group_def_t*/
     uint32_t instance_size : 16;
     uint32_t theme_inheritable : 1;    /**< Value from ::lv_obj_class_theme_inheritable_t*/
+    uint32_t items_redraw_self : 1;    /**< 1: the widget invalidates its `LV_PART_ITEMS` itself on state change,
+                                        *   so style differences only in the items don't redraw the whole object
+                                        *   unless they change the layout or the extra draw size*/
 };
 
 
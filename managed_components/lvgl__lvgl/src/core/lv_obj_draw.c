@@ -11,6 +11,7 @@
 #include "lv_obj_style.h"
 #include "../display/lv_display.h"
 #include "../indev/lv_indev.h"
+#include "../indev/lv_indev_hit_index.h"
 #include "../stdlib/lv_string.h"
 #include "../draw/lv_draw_arc.h"
 
@@ -375,7 +376,11 @@ void lv_obj_refresh_ext_draw_size(lv_obj_t * obj)
         obj->spec_attr->ext_draw_size = s_new;
     }
 
-    if(s_new != s_old) lv_obj_invalidate(obj);
+    if(s_new != s_old) {
+        lv_obj_invalidate(obj);
+        lv_indev_hit_index_invalidate(obj->parent);
+        lv_obj_invalidate_visibility_cache(obj);
+    }
     LV_PROFILER_DRAW_END;
 }
 
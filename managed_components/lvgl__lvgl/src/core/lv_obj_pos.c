@@ -15,6 +15,8 @@
 #include "../display/lv_display.h"
 #include "../display/lv_display_private.h"
 #include "lv_refr_private.h"
+#include "lv_group_private.h"
+#include "../indev/lv_indev_hit_index.h"
 #include "../core/lv_global.h"
 
 /*********************
@@ -22,6 +24,9 @@
  *********************/
 #define MY_CLASS (&lv_obj_class)
 #define update_layout_mutex LV_GLOBAL_DEFAULT()->layout_update_mutex
+#define scrollbar_inv_later_cnt LV_GLOBAL_DEFAULT()->layout_scrollbar_inv_later_cnt
+#define obj_visibility_gen LV_GLOBAL_DEFAULT()->obj_visibility_gen
+#define obj_watch_inv_cnt LV_GLOBAL_DEFAULT()->obj_watch_inv_cnt
 
 /**********************
  *      TYPEDEFS
@@ -33,8 +38,14 @@
 static int32_t calc_content_width(lv_obj_t * obj);
 static int32_t calc_content_height(lv_obj_t * obj);
 static void layout_update_core(lv_obj_t * obj);
+static void invalidate_parent_scrollbars(lv_obj_t * parent);
+static void invalidate_scrollbars_later_tree(lv_obj_t * obj);
 static void transform_point_array(const lv_obj_t * obj, lv_point_t * p, size_t p_count, bool inv);
-static bool is_transformed(const lv_obj_t * obj);
+#if LV_OBJ_VISIBILITY_CACHE
+    static const lv_obj_visibility_cache_t * get_visibility_cache(const lv_obj_t * obj);
+#else
+    static bool is_transformed(const lv_obj_t * obj);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -175,6 +186,8 @@ bool lv_obj_refr_size(lv_obj_t * obj)
 
     /*Invalidate the original area*/
     lv_obj_invalidate(obj);
+    lv_indev_hit_index_invalidate(parent);
+    lv_group_invalidate_spatial_index();
 
     /*Save the original coordinates*/
     lv_area_t ori;
@@ -188,7 +201,7 @@ bool lv_obj_refr_size(lv_obj_t * obj)
      *surely the scrollbars also changes so invalidate them*/
     bool on1 = lv_area_is_in(&ori, &parent_fit_area, 0);
     if(!on1)
-        lv_obj_scrollbar_invalidate(parent);
+        invalidate_parent_scrollbars(parent);
 
     /*Set the length and height
      *Be sure the content is not scrolled in an invalid position on the new size*/
@@ -199,6 +212,7 @@ bool lv_obj_refr_size(lv_obj_t * obj)
     else {
         obj->coords.x2 = obj->coords.x1 + w - 1;
     }
+    lv_obj_invalidate_visibility_cache(obj);
 
     /*Call the ancestor's event handler to the object with its new coordinates*/
     lv_obj_send_event(obj, LV_EVENT_SIZE_CHANGED, &ori);
@@ -215,7 +229,7 @@ bool lv_obj_refr_size(lv_obj_t * obj)
      *If it wasn't out of the parent but out now, also invalidate the scrollbars*/
     bool on2 = lv_area_is_in(&obj->coords, &parent_fit_area, 0);
     if(on1 || (!on1 && on2))
-        lv_obj_scrollbar_invalidate(parent);
+        invalidate_parent_scrollbars(parent);
 
     lv_obj_refresh_ext_draw_size(obj);
 
@@ -295,6 +309,9 @@ void lv_obj_mark_layout_as_dirty(lv_obj_t * obj)
 {
     obj->layout_inv = 1;
 
+    /*The objects will be moved or resized before they are used next time*/
+    lv_group_invalidate_spatial_index();
+
     /*Mark the screen as dirty too to mark that there is something to do on this screen*/
     lv_obj_t * scr = lv_obj_get_screen(obj);
     scr->scr_layout_inv = 1;
@@ -306,6 +323,9 @@ void lv_obj_mark_layout_as_dirty(lv_obj_t * obj)
 
 void lv_obj_update_layout(const lv_obj_t * obj)
 {
+    /*The style changes might affect the layout*/
+    lv_obj_refresh_dirty_styles();
+
     if(update_layout_mutex) {
         LV_LOG_TRACE("Already running, returning");
         return;
@@ -319,9 +339,23 @@ void lv_obj_update_layout(const lv_obj_t * obj)
         LV_LOG_TRACE("Layout update begin");
         scr->scr_layout_inv = 0;
         layout_update_core(scr);
+        lv_obj_refresh_dirty_styles();
         LV_LOG_TRACE("Layout update end");
     }
 
+    /*The scrollbars of some objects might have been changed after their layout was updated
+     *(e.g. in an event). It's rare, so just search them.*/
+    if(scrollbar_inv_later_cnt) {
+        lv_display_t * disp = lv_display_get_next(NULL);
+        while(disp) {
+            uint32_t i;
+            for(i = 0; i < disp->screen_cnt; i++) {
+                invalidate_scrollbars_later_tree(disp->screens[i]);
+            }
+            disp = lv_display_get_next(disp);
+        }
+    }
+
     update_layout_mutex = false;
     LV_PROFILER_LAYOUT_END;
 }
@@ -736,6 +770,8 @@ void lv_obj_move_to(lv_obj_t * obj, int32_t x, int32_t y)
 
     /*Invalidate the original area*/
     lv_obj_invalidate(obj);
+    lv_indev_hit_index_invalidate(parent);
+    lv_group_invalidate_spatial_index();
 
     /*Save the original coordinates*/
     lv_area_t ori;
@@ -750,7 +786,7 @@ void lv_obj_move_to(lv_obj_t * obj, int32_t x, int32_t y)
         /*If the object is already out of the parent and its position is changes
          *surely the scrollbars also changes so invalidate them*/
         on1 = lv_area_is_in(&ori, &parent_fit_area, 0);
-        if(!on1) lv_obj_scrollbar_invalidate(parent);
+        if(!on1) invalidate_parent_scrollbars(parent);
     }
 
     obj->coords.x1 += diff.x;
@@ -770,7 +806,7 @@ void lv_obj_move_to(lv_obj_t * obj, int32_t x, int32_t y)
      *If it wasn't out of the parent but out now, also invalidate the scrollbars*/
     if(parent) {
         bool on2 = lv_area_is_in(&obj->coords, &parent_fit_area, 0);
-        if(on1 || (!on1 && on2)) lv_obj_scrollbar_invalidate(parent);
+        if(on1 || (!on1 && on2)) invalidate_parent_scrollbars(parent);
     }
 }
 
@@ -778,6 +814,11 @@ void lv_obj_move_children_by(lv_obj_t * obj, int32_t x_diff, int32_t y_diff, boo
 {
     uint32_t i;
     uint32_t child_cnt = lv_obj_get_child_count(obj);
+    if(child_cnt > 0 && (x_diff || y_diff)) {
+        lv_obj_invalidate_visibility_cache(obj);
+        lv_group_invalidate_spatial_index();
+    }
+
     for(i = 0; i < child_cnt; i++) {
         lv_obj_t * child = obj->spec_attr->children[i];
         if(ignore_floating && lv_obj_has_flag(child, LV_OBJ_FLAG_FLOATING)) continue;
@@ -835,6 +876,16 @@ void lv_obj_invalidate_area(const lv_obj_t * obj, const lv_area_t * area)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
+    /*Tell the ancestors that keep a rendered image of their children that it's outdated.
+     *Usually there are no such objects so don't walk the ancestors in vain.*/
+    if(obj_watch_inv_cnt > 0) {
+        const lv_obj_t * parent = obj;
+        while(parent) {
+            if(parent->watch_inv) lv_obj_send_event((lv_obj_t *)parent, LV_EVENT_INVALIDATE_AREA, (void *)area);
+            parent = parent->parent;
+        }
+    }
+
     lv_display_t * disp   = lv_obj_get_display(obj);
     if(!lv_display_is_invalidation_enabled(disp)) return;
 
@@ -859,6 +910,15 @@ void lv_obj_invalidate_area(const lv_obj_t * obj, const lv_area_t * area)
     lv_inv_area(lv_obj_get_display(obj),  &area_tmp);
 }
 
+void lv_obj_set_watch_invalidation(lv_obj_t * obj, bool en)
+{
+    if(obj->watch_inv == en) return;
+
+    obj->watch_inv = en;
+    if(en) obj_watch_inv_cnt++;
+    else obj_watch_inv_cnt--;
+}
+
 void lv_obj_invalidate(const lv_obj_t * obj)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
@@ -879,8 +939,15 @@ bool lv_obj_area_is_visible(const lv_obj_t * obj, lv_area_t * area)
 {
     if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return false;
 
-    /*Invalidate the object only if it belongs to the current or previous or one of the layers'*/
+#if LV_OBJ_VISIBILITY_CACHE
+    const lv_obj_visibility_cache_t * cache = get_visibility_cache(obj);
+    if(cache->hidden || cache->clip_empty) return false;
+    lv_obj_t * obj_scr = cache->screen;
+#else
     lv_obj_t * obj_scr = lv_obj_get_screen(obj);
+#endif
+
+    /*Invalidate the object only if it belongs to the current or previous or one of the layers'*/
     lv_display_t * disp   = lv_obj_get_display(obj_scr);
     if(obj_scr != lv_display_get_screen_active(disp) &&
        obj_scr != lv_display_get_screen_prev(disp) &&
@@ -899,6 +966,14 @@ bool lv_obj_area_is_visible(const lv_obj_t * obj, lv_area_t * area)
     /*The area is not on the object*/
     if(!lv_area_intersect(area, area, &obj_coords)) return false;
 
+#if LV_OBJ_VISIBILITY_CACHE
+    if(cache->transformed || lv_obj_get_layer_type(obj) == LV_LAYER_TYPE_TRANSFORM) {
+        lv_obj_get_transformed_area(obj, area, LV_OBJ_POINT_TRANSFORM_FLAG_RECURSIVE);
+    }
+
+    /*Truncate to the common area of the parents*/
+    return lv_area_intersect(area, area, &cache->clip_area);
+#else
     if(is_transformed(obj)) {
         lv_obj_get_transformed_area(obj, area, LV_OBJ_POINT_TRANSFORM_FLAG_RECURSIVE);
     }
@@ -925,6 +1000,7 @@ bool lv_obj_area_is_visible(const lv_obj_t * obj, lv_area_t * area)
     }
 
     return true;
+#endif
 }
 
 bool lv_obj_is_visible(const lv_obj_t * obj)
@@ -948,6 +1024,7 @@ void lv_obj_set_ext_click_area(lv_obj_t * obj, int32_t size)
 
     lv_obj_allocate_spec_attr(obj);
     obj->spec_attr->ext_click_pad = size;
+    lv_indev_hit_index_invalidate(obj->parent);
 }
 
 void lv_obj_get_click_area(const lv_obj_t * obj, lv_area_t * area)
@@ -1073,10 +1150,73 @@ const lv_matrix_t * lv_obj_get_transform(const lv_obj_t * obj)
     return NULL;
 }
 
+#if LV_OBJ_VISIBILITY_CACHE
+
+void lv_obj_invalidate_visibility_cache(const lv_obj_t * obj)
+{
+    if(obj->spec_attr && obj->spec_attr->child_cnt > 0) {
+        /*The descendants can be anywhere, so make all caches outdated. 0 means "never updated"*/
+        obj_visibility_gen++;
+        if(obj_visibility_gen == 0) obj_visibility_gen = 1;
+    }
+    else {
+        /*Only the cache of this object depends on it*/
+        ((lv_obj_t *)obj)->vis_cache.gen = obj_visibility_gen - 1;
+    }
+}
+
+#endif /*LV_OBJ_VISIBILITY_CACHE*/
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
 
+#if LV_OBJ_VISIBILITY_CACHE
+
+/**
+ * Get the visibility cache of an object and update it from the parent's cache if it's outdated
+ * @param obj       pointer to an object
+ * @return          the up to date cache
+ */
+static const lv_obj_visibility_cache_t * get_visibility_cache(const lv_obj_t * obj)
+{
+    lv_obj_visibility_cache_t * cache = &((lv_obj_t *)obj)->vis_cache;
+    if(cache->gen == obj_visibility_gen) return cache;
+
+    const lv_obj_t * parent = obj->parent;
+    if(parent == NULL) {
+        lv_area_set(&cache->clip_area, LV_COORD_MIN, LV_COORD_MIN, LV_COORD_MAX, LV_COORD_MAX);
+        cache->screen = (lv_obj_t *)obj;
+        cache->hidden = 0;
+        cache->transformed = 0;
+        cache->clip_empty = 0;
+    }
+    else {
+        *cache = *get_visibility_cache(parent);
+        if(lv_obj_has_flag(parent, LV_OBJ_FLAG_HIDDEN)) cache->hidden = 1;
+        if(lv_obj_get_layer_type(parent) == LV_LAYER_TYPE_TRANSFORM) cache->transformed = 1;
+
+        if(!cache->hidden && !cache->clip_empty) {
+            lv_area_t parent_coords = parent->coords;
+            if(lv_obj_has_flag(parent, LV_OBJ_FLAG_OVERFLOW_VISIBLE)) {
+                int32_t parent_ext_size = lv_obj_get_ext_draw_size(parent);
+                lv_area_increase(&parent_coords, parent_ext_size, parent_ext_size);
+            }
+
+            if(cache->transformed) {
+                lv_obj_get_transformed_area(parent, &parent_coords, LV_OBJ_POINT_TRANSFORM_FLAG_RECURSIVE);
+            }
+
+            if(!lv_area_intersect(&cache->clip_area, &cache->clip_area, &parent_coords)) cache->clip_empty = 1;
+        }
+    }
+
+    cache->gen = obj_visibility_gen;
+    return cache;
+}
+
+#else
+
 static bool is_transformed(const lv_obj_t * obj)
 {
     while(obj) {
@@ -1086,6 +1226,8 @@ static bool is_transformed(const lv_obj_t * obj)
     return false;
 }
 
+#endif /*LV_OBJ_VISIBILITY_CACHE*/
+
 static int32_t calc_content_width(lv_obj_t * obj)
 {
     int32_t scroll_x_tmp = lv_obj_get_scroll_x(obj);
@@ -1249,6 +1391,9 @@ static void layout_update_core(lv_obj_t * obj)
 
         if(child_cnt > 0) {
             lv_layout_apply(obj);
+            /*The layouts move the children directly*/
+            lv_indev_hit_index_invalidate(obj);
+            lv_group_invalidate_spatial_index();
         }
     }
 
@@ -1256,6 +1401,46 @@ static void layout_update_core(lv_obj_t * obj)
         obj->readjust_scroll_after_layout = 0;
         lv_obj_readjust_scroll(obj, LV_ANIM_OFF);
     }
+
+    /*All the children are updated, so the scrollbars are final*/
+    if(obj->scrollbar_inv_later) {
+        obj->scrollbar_inv_later = 0;
+        scrollbar_inv_later_cnt--;
+        lv_obj_scrollbar_invalidate(obj);
+    }
+}
+
+/**
+ * Invalidate the scrollbars of the parent of a moved or resized object.
+ * Getting the scrollbars' area needs to check all the children, so during layout update
+ * invalidate them only when the first child is changed and when the layout update of the parent is ready.
+ * @param parent    pointer to the parent of the changed object
+ */
+static void invalidate_parent_scrollbars(lv_obj_t * parent)
+{
+    if(parent->scrollbar_inv_later) return;
+
+    lv_obj_scrollbar_invalidate(parent);
+
+    if(update_layout_mutex) {
+        parent->scrollbar_inv_later = 1;
+        scrollbar_inv_later_cnt++;
+    }
+}
+
+static void invalidate_scrollbars_later_tree(lv_obj_t * obj)
+{
+    if(obj->scrollbar_inv_later) {
+        obj->scrollbar_inv_later = 0;
+        scrollbar_inv_later_cnt--;
+        lv_obj_scrollbar_invalidate(obj);
+    }
+
+    uint32_t i;
+    uint32_t child_cnt = obj->spec_attr ? obj->spec_attr->child_cnt : 0;
+    for(i = 0; i < child_cnt && scrollbar_inv_later_cnt; i++) {
+        invalidate_scrollbars_later_tree(obj->spec_attr->children[i]);
+    }
 }
 
 static void transform_point_array(const lv_obj_t * obj, lv_point_t * p, size_t p_count, bool inv)
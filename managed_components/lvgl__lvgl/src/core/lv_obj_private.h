@@ -39,6 +39,9 @@ struct _lv_obj_spec_attr_t {
     const char * name;              /**< Pointer to the name */
 #endif
     lv_point_t scroll;              /**< The current X/Y scroll offset*/
+#if LV_INDEV_HIT_INDEX
+    lv_indev_hit_index_t * hit_index; /**< Grid of the children to find the clicked one quickly*/
+#endif
 
     int32_t ext_click_pad;          /**< Extra click padding in all direction*/
     int32_t ext_draw_size;          /**< EXTend the size in every direction for drawing.*/
@@ -52,6 +55,22 @@ struct _lv_obj_spec_attr_t {
     uint16_t name_static : 1;        /**< 1: `name` was not dynamically allocated */
 };
 
+#if LV_OBJ_VISIBILITY_CACHE
+/**
+ * What the ancestors of an object tell about its visibility.
+ * It doesn't depend on the object itself so it needs to be updated only
+ * if an ancestor is changed.
+ */
+typedef struct {
+    lv_area_t clip_area;            /**< Intersection of the visible areas of the ancestors*/
+    lv_obj_t * screen;              /**< The screen of the object*/
+    uint32_t gen;                   /**< The cache is valid if it equals to the global visibility generation*/
+    uint8_t hidden : 1;             /**< 1: an ancestor is hidden*/
+    uint8_t transformed : 1;        /**< 1: an ancestor is transformed*/
+    uint8_t clip_empty : 1;         /**< 1: the ancestors have no common area, `clip_area` is invalid*/
+} lv_obj_visibility_cache_t;
+#endif
+
 struct _lv_obj_t {
     const lv_obj_class_t * class_p;
     lv_obj_t * parent;
@@ -66,8 +85,15 @@ struct _lv_obj_t {
     void * id;
 #endif
     lv_area_t coords;
+#if LV_OBJ_VISIBILITY_CACHE
+    lv_obj_visibility_cache_t vis_cache;
+#endif
     lv_obj_flag_t flags;
     uint16_t state;
+#if LV_OBJ_STYLE_DEFERRED_REFRESH
+    uint8_t style_dirty;            /**< `lv_obj_style_dirty_t` flags of the style changes not refreshed yet*/
+    uint32_t style_dirty_idx;       /**< Index in the list of objects to refresh if `style_dirty != 0`*/
+#endif
     uint16_t layout_inv : 1;
     uint16_t readjust_scroll_after_layout : 1;
     uint16_t scr_layout_inv : 1;
@@ -76,12 +102,39 @@ struct _lv_obj_t {
     uint16_t h_layout   : 1;
     uint16_t w_layout   : 1;
     uint16_t is_deleting : 1;
+    uint16_t watch_inv : 1;         /**< Send `LV_EVENT_INVALIDATE_AREA` to the object when it or
+                                     *   any of its children is invalidated, even if it's not visible*/
+    uint16_t scrollbar_inv_later : 1; /**< Invalidate the scrollbars when the layout update is ready*/
 };
 
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
 
+/**
+ * Enable or disable sending `LV_EVENT_INVALIDATE_AREA` to an object
+ * when it or any of its descendants is invalidated.
+ * @param obj       pointer to an object
+ * @param en        true: send the event; false: don't send it
+ */
+void lv_obj_set_watch_invalidation(lv_obj_t * obj, bool en);
+
+#if LV_OBJ_VISIBILITY_CACHE
+
+/**
+ * Mark the cached visibility of an object and its descendants as outdated.
+ * Needs to be called if the coordinates, extra draw size, transformation,
+ * parent or the `HIDDEN` and `OVERFLOW_VISIBLE` flags of an object change.
+ * @param obj       pointer to an object
+ */
+void lv_obj_invalidate_visibility_cache(const lv_obj_t * obj);
+
+#else
+
+#define lv_obj_invalidate_visibility_cache(obj)  LV_UNUSED(obj)
+
+#endif /*LV_OBJ_VISIBILITY_CACHE*/
+
 /**********************
  *      MACROS
  **********************/
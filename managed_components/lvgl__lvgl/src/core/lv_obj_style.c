@@ -10,6 +10,8 @@
 #include "../misc/lv_anim_private.h"
 #include "lv_obj_style_private.h"
 #include "lv_obj_class_private.h"
+#include "lv_obj_draw_private.h"
+#include "../indev/lv_indev_hit_index.h"
 #include "../display/lv_display.h"
 #include "../display/lv_display_private.h"
 #include "../misc/lv_color.h"
@@ -23,6 +25,8 @@
 #define style_trans_ll_p &(LV_GLOBAL_DEFAULT()->style_trans_ll)
 #define _style_custom_prop_flag_lookup_table LV_GLOBAL_DEFAULT()->style_custom_prop_flag_lookup_table
 #define STYLE_PROP_SHIFTED(prop) ((uint32_t)1 << ((prop) >> 3))
+#define style_dirty_objs (&(LV_GLOBAL_DEFAULT()->style_dirty_objs))
+#define style_dirty_next LV_GLOBAL_DEFAULT()->style_dirty_next
 
 /**********************
  *      TYPEDEFS
@@ -49,6 +53,10 @@ static lv_style_res_t get_prop_core(const lv_obj_t * obj, lv_style_selector_t se
                                     lv_style_value_t * v);
 static void report_style_change_core(void * style, lv_obj_t * obj);
 static void refresh_children_style(lv_obj_t * obj);
+#if LV_OBJ_STYLE_DEFERRED_REFRESH
+    static void mark_style_dirty(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop);
+    static void refresh_dirty_style(lv_obj_t * obj, uint32_t dirty);
+#endif
 static bool trans_delete(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, trans_t * tr_limit);
 static void trans_anim_cb(void * _tr, int32_t v);
 static void trans_anim_start_cb(lv_anim_t * a);
@@ -58,6 +66,8 @@ static void full_cache_refresh(lv_obj_t * obj, lv_part_t part);
 static void fade_anim_cb(void * obj, int32_t v);
 static void fade_in_anim_completed(lv_anim_t * a);
 static bool style_has_flag(const lv_style_t * style, uint32_t flag);
+static void update_prop_is_set(lv_obj_t * obj, const lv_style_t * style, lv_part_t part);
+static void copy_local_style(lv_style_t * dst, const lv_style_t * src);
 static lv_style_res_t get_selector_style_prop(const lv_obj_t * obj, lv_style_selector_t selector, lv_style_prop_t prop,
                                               lv_style_value_t * value_act);
 
@@ -76,11 +86,18 @@ static lv_style_res_t get_selector_style_prop(const lv_obj_t * obj, lv_style_sel
 void lv_obj_style_init(void)
 {
     lv_ll_init(style_trans_ll_p, sizeof(trans_t));
+#if LV_OBJ_STYLE_DEFERRED_REFRESH
+    lv_array_init(style_dirty_objs, 8, sizeof(lv_obj_t *));
+    style_dirty_next = 0;
+#endif
 }
 
 void lv_obj_style_deinit(void)
 {
     lv_ll_clear(style_trans_ll_p);
+#if LV_OBJ_STYLE_DEFERRED_REFRESH
+    lv_array_deinit(style_dirty_objs);
+#endif
     if(_style_custom_prop_flag_lookup_table != NULL) {
         lv_free(_style_custom_prop_flag_lookup_table);
         _style_custom_prop_flag_lookup_table = NULL;
@@ -127,23 +144,61 @@ void lv_obj_add_style(lv_obj_t * obj, const lv_style_t * style, lv_style_selecto
     obj->styles[i].style = style;
     obj->styles[i].selector = selector;
 
-#if LV_OBJ_STYLE_CACHE
-    uint32_t * prop_is_set = part == LV_PART_MAIN ? &obj->style_main_prop_is_set : &obj->style_other_prop_is_set;
-    if(lv_style_is_const(style)) {
-        lv_style_const_prop_t * props = style->values_and_props;
-        for(i = 0; props[i].prop != LV_STYLE_PROP_INV; i++) {
-            (*prop_is_set) |= STYLE_PROP_SHIFTED(props[i].prop);
+    update_prop_is_set(obj, style, part);
+
+    lv_obj_refresh_style(obj, selector, LV_STYLE_PROP_ANY);
+}
+
+void lv_obj_add_style_list(lv_obj_t * obj, const lv_obj_style_t * styles, uint32_t cnt)
+{
+    if(cnt == 0) return;
+
+    LV_ASSERT(obj->style_cnt + cnt < 64);
+
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        lv_style_selector_t selector = styles[i].selector;
+        trans_delete(obj, selector, LV_STYLE_PROP_ANY, NULL);
+
+        const lv_style_t * style = styles[i].style;
+        lv_part_t part = lv_obj_style_get_selector_part(selector);
+        if(style && part == LV_PART_MAIN && style_has_flag(style, LV_STYLE_PROP_FLAG_TRANSFORM)) {
+            lv_obj_invalidate(obj);
         }
+
+        /*Not needed for a newly created object as it has no styles yet*/
+        if(obj->style_cnt) lv_obj_remove_style(obj, style, selector);
     }
-    else {
-        lv_style_prop_t * props = (lv_style_prop_t *)style->values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
-        for(i = 0; i < style->prop_cnt; i++) {
-            (*prop_is_set) |= STYLE_PROP_SHIFTED(props[i]);
-        }
+
+    /*Go after the transition and local styles*/
+    uint32_t first;
+    for(first = 0; first < obj->style_cnt; first++) {
+        if(obj->styles[first].is_trans) continue;
+        if(obj->styles[first].is_local) continue;
+        break;
     }
-#endif
 
-    lv_obj_refresh_style(obj, selector, LV_STYLE_PROP_ANY);
+    /*Make room for all the new styles at once*/
+    uint32_t old_cnt = obj->style_cnt;
+    obj->style_cnt += cnt;
+    obj->styles = lv_realloc(obj->styles, obj->style_cnt * sizeof(lv_obj_style_t));
+    LV_ASSERT_MALLOC(obj->styles);
+
+    if(old_cnt > first) {
+        lv_memmove(&obj->styles[first + cnt], &obj->styles[first], (old_cnt - first) * sizeof(lv_obj_style_t));
+    }
+
+    /*The last added style has the highest precedence so it goes to the front*/
+    for(i = 0; i < cnt; i++) {
+        lv_obj_style_t * obj_style = &obj->styles[first + cnt - 1 - i];
+        lv_memzero(obj_style, sizeof(lv_obj_style_t));
+        obj_style->style = styles[i].style;
+        obj_style->selector = styles[i].selector;
+
+        update_prop_is_set(obj, styles[i].style, lv_obj_style_get_selector_part(styles[i].selector));
+    }
+
+    lv_obj_refresh_style(obj, LV_PART_ANY, LV_STYLE_PROP_ANY);
 }
 
 bool lv_obj_replace_style(lv_obj_t * obj, const lv_style_t * old_style, const lv_style_t * new_style,
@@ -250,6 +305,55 @@ void lv_obj_remove_style_all(lv_obj_t * obj)
     lv_obj_remove_style(obj, NULL, LV_PART_ANY | LV_STATE_ANY);
 }
 
+void lv_obj_copy_styles(lv_obj_t * obj, const lv_obj_t * src)
+{
+    lv_obj_remove_style_all(obj);
+
+    uint32_t cnt = 0;
+    uint32_t i;
+    for(i = 0; i < src->style_cnt; i++) {
+        if(!src->styles[i].is_trans) cnt++;
+    }
+    if(cnt == 0) return;
+
+    obj->styles = lv_malloc(cnt * sizeof(lv_obj_style_t));
+    LV_ASSERT_MALLOC(obj->styles);
+    if(obj->styles == NULL) return;
+
+    uint32_t j = 0;
+    for(i = 0; i < src->style_cnt; i++) {
+        if(src->styles[i].is_trans) continue;
+
+        obj->styles[j] = src->styles[i];
+        if(src->styles[i].is_local) {
+            lv_style_t * style = lv_malloc_zeroed(sizeof(lv_style_t));
+            LV_ASSERT_MALLOC(style);
+            if(style == NULL) {
+                /*Free the local styles copied so far and leave the object without styles*/
+                uint32_t k;
+                for(k = 0; k < j; k++) {
+                    if(!obj->styles[k].is_local) continue;
+                    lv_style_reset((lv_style_t *)obj->styles[k].style);
+                    lv_free((lv_style_t *)obj->styles[k].style);
+                }
+                lv_free(obj->styles);
+                obj->styles = NULL;
+                return;
+            }
+            lv_style_init(style);
+            copy_local_style(style, src->styles[i].style);
+            obj->styles[j].style = style;
+        }
+        j++;
+    }
+    obj->style_cnt = cnt;
+
+#if LV_OBJ_STYLE_CACHE
+    obj->style_main_prop_is_set = src->style_main_prop_is_set;
+    obj->style_other_prop_is_set = src->style_other_prop_is_set;
+#endif
+}
+
 void lv_obj_report_style_change(lv_style_t * style)
 {
     if(!style_refr) return;
@@ -298,6 +402,12 @@ void lv_obj_refresh_style(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop)
         lv_obj_update_layer_type(obj);
     }
 
+    /*The pivot is not a layer property but it changes the transformation*/
+    if((part == LV_PART_ANY || part == LV_PART_MAIN) &&
+       (prop == LV_STYLE_TRANSFORM_PIVOT_X || prop == LV_STYLE_TRANSFORM_PIVOT_Y)) {
+        lv_obj_invalidate_visibility_cache(obj);
+    }
+
     if(prop == LV_STYLE_PROP_ANY || is_ext_draw) {
         lv_obj_refresh_ext_draw_size(obj);
     }
@@ -348,6 +458,51 @@ void lv_obj_enable_style_refresh(bool en)
     style_refr = en;
 }
 
+void lv_obj_refresh_dirty_styles(void)
+{
+#if LV_OBJ_STYLE_DEFERRED_REFRESH
+    if(lv_array_is_empty(style_dirty_objs)) return;
+
+    LV_PROFILER_STYLE_BEGIN;
+
+    /*The events might mark more objects or call this function again, so always
+     *take the next object from the global index*/
+    while(style_dirty_next < lv_array_size(style_dirty_objs)) {
+        lv_obj_t * obj = *(lv_obj_t **)lv_array_at(style_dirty_objs, style_dirty_next);
+        style_dirty_next++;
+
+        uint32_t dirty = obj->style_dirty;
+        obj->style_dirty = 0;
+        refresh_dirty_style(obj, dirty);
+    }
+
+    lv_array_clear(style_dirty_objs);
+    style_dirty_next = 0;
+
+    LV_PROFILER_STYLE_END;
+#endif
+}
+
+void lv_obj_style_clear_dirty(lv_obj_t * obj)
+{
+#if LV_OBJ_STYLE_DEFERRED_REFRESH
+    if(obj->style_dirty == 0) return;
+    obj->style_dirty = 0;
+
+    /*A marked object is always after the already refreshed ones, so the last one can
+     *be moved to its place without affecting the running refresh*/
+    uint32_t last_idx = lv_array_size(style_dirty_objs) - 1;
+    if(obj->style_dirty_idx != last_idx) {
+        lv_obj_t * last = *(lv_obj_t **)lv_array_at(style_dirty_objs, last_idx);
+        lv_array_assign(style_dirty_objs, obj->style_dirty_idx, &last);
+        last->style_dirty_idx = obj->style_dirty_idx;
+    }
+    lv_array_remove(style_dirty_objs, last_idx);
+#else
+    LV_UNUSED(obj);
+#endif
+}
+
 lv_style_value_t lv_obj_get_style_prop(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop)
 {
     LV_ASSERT_NULL(obj)
@@ -400,7 +555,11 @@ void lv_obj_set_local_style_prop(lv_obj_t * obj, lv_style_prop_t prop, lv_style_
     }
 #endif
 
+#if LV_OBJ_STYLE_DEFERRED_REFRESH
+    mark_style_dirty(obj, lv_obj_style_get_selector_part(selector), prop);
+#else
     lv_obj_refresh_style(obj, selector, prop);
+#endif
     LV_PROFILER_STYLE_END;
 }
 
@@ -524,6 +683,10 @@ lv_style_state_cmp_t lv_obj_style_state_compare(lv_obj_t * obj, lv_state_t state
     for(i = 0; i < obj->style_cnt; i++) {
         if(obj->styles[i].is_trans) continue;
 
+        /*The widget redraws the changed items itself, but the extra draw size still needs to be refreshed*/
+        bool redraw_self = obj->class_p->items_redraw_self &&
+                           lv_obj_style_get_selector_part(obj->styles[i].selector) == LV_PART_ITEMS;
+
         lv_state_t state_act = lv_obj_style_get_selector_state(obj->styles[i].selector);
         /*The style is valid for a state but not the other*/
         bool valid1 = state_act & (~state1) ? false : true;
@@ -569,7 +732,7 @@ lv_style_state_cmp_t lv_obj_style_state_compare(lv_obj_t * obj, lv_state_t state
             else if(lv_style_get_prop(style, LV_STYLE_SHADOW_OFFSET_Y, &v)) res = LV_STYLE_STATE_CMP_DIFF_DRAW_PAD;
             else if(lv_style_get_prop(style, LV_STYLE_SHADOW_SPREAD, &v)) res = LV_STYLE_STATE_CMP_DIFF_DRAW_PAD;
             else if(lv_style_get_prop(style, LV_STYLE_LINE_WIDTH, &v)) res = LV_STYLE_STATE_CMP_DIFF_DRAW_PAD;
-            else if(res == LV_STYLE_STATE_CMP_SAME) res = LV_STYLE_STATE_CMP_DIFF_REDRAW;
+            else if(res == LV_STYLE_STATE_CMP_SAME && !redraw_self) res = LV_STYLE_STATE_CMP_DIFF_REDRAW;
         }
     }
 
@@ -660,11 +823,22 @@ lv_opa_t lv_obj_get_style_opa_recursive(const lv_obj_t * obj, lv_part_t part)
 void lv_obj_update_layer_type(lv_obj_t * obj)
 {
     lv_layer_type_t layer_type = calculate_layer_type(obj);
+
+    /*Transformed children are not indexed*/
+    if((layer_type == LV_LAYER_TYPE_TRANSFORM) != (lv_obj_get_layer_type(obj) == LV_LAYER_TYPE_TRANSFORM)) {
+        lv_indev_hit_index_invalidate(obj->parent);
+    }
+
+    /*The transformation of the object might be changed too*/
+    bool transformed = layer_type == LV_LAYER_TYPE_TRANSFORM || lv_obj_get_layer_type(obj) == LV_LAYER_TYPE_TRANSFORM;
+
     if(obj->spec_attr) obj->spec_attr->layer_type = layer_type;
     else if(layer_type != LV_LAYER_TYPE_NONE) {
         lv_obj_allocate_spec_attr(obj);
         obj->spec_attr->layer_type = layer_type;
     }
+
+    if(transformed) lv_obj_invalidate_visibility_cache(obj);
 }
 
 lv_color32_t lv_obj_style_apply_recolor(const lv_obj_t * obj, lv_part_t part, lv_color32_t color)
@@ -856,6 +1030,90 @@ static void report_style_change_core(void * style, lv_obj_t * obj)
     }
 }
 
+#if LV_OBJ_STYLE_DEFERRED_REFRESH
+
+/**
+ * Do the cheap part of `lv_obj_refresh_style` now and remember the rest for `lv_obj_refresh_dirty_styles`
+ * @param obj       the object whose local style property has changed
+ * @param part      the part of the property
+ * @param prop      the changed property
+ */
+static void mark_style_dirty(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop)
+{
+    if(!style_refr) return;
+
+    uint32_t prop_flags = lv_style_prop_lookup_flags(prop);
+    bool is_main = part == LV_PART_ANY || part == LV_PART_MAIN;
+    uint32_t dirty = 0;
+
+    if(prop_flags & LV_STYLE_PROP_FLAG_LAYOUT_UPDATE) {
+        dirty |= is_main ? LV_OBJ_STYLE_DIRTY_LAYOUT_MAIN : LV_OBJ_STYLE_DIRTY_LAYOUT_OTHER;
+    }
+    if(is_main && (prop_flags & LV_STYLE_PROP_FLAG_LAYER_UPDATE)) {
+        dirty |= LV_OBJ_STYLE_DIRTY_LAYER;
+    }
+    if(is_main && (prop == LV_STYLE_TRANSFORM_PIVOT_X || prop == LV_STYLE_TRANSFORM_PIVOT_Y)) {
+        dirty |= LV_OBJ_STYLE_DIRTY_PIVOT;
+    }
+    if(prop_flags & LV_STYLE_PROP_FLAG_EXT_DRAW_UPDATE) {
+        dirty |= LV_OBJ_STYLE_DIRTY_EXT_DRAW;
+    }
+    if((prop_flags & LV_STYLE_PROP_FLAG_INHERITABLE) &&
+       (prop_flags & (LV_STYLE_PROP_FLAG_EXT_DRAW_UPDATE | LV_STYLE_PROP_FLAG_LAYOUT_UPDATE)) &&
+       part != LV_PART_SCROLLBAR) {
+        dirty |= LV_OBJ_STYLE_DIRTY_CHILDREN;
+    }
+
+    /*Invalidate the current area before it's changed. If the object is already marked
+     *it was already invalidated.*/
+    if(obj->style_dirty == 0) lv_obj_invalidate(obj);
+
+    /*E.g. only a color has changed so invalidation was enough*/
+    if(dirty == 0) return;
+
+    if(obj->style_dirty == 0) {
+        lv_array_t * objs = style_dirty_objs;
+        if(lv_array_is_full(objs)) {
+            lv_array_resize(objs, lv_array_capacity(objs) * 2);
+        }
+        obj->style_dirty_idx = lv_array_size(objs);
+        lv_array_push_back(objs, &obj);
+    }
+
+    obj->style_dirty |= dirty | LV_OBJ_STYLE_DIRTY_QUEUED;
+}
+
+/**
+ * The same as `lv_obj_refresh_style` but only with the steps required by the marked changes
+ * @param obj       the object to refresh
+ * @param dirty     OR-ed `lv_obj_style_dirty_t` values
+ */
+static void refresh_dirty_style(lv_obj_t * obj, uint32_t dirty)
+{
+    if(dirty & LV_OBJ_STYLE_DIRTY_LAYOUT_MAIN ||
+       ((dirty & LV_OBJ_STYLE_DIRTY_LAYOUT_OTHER) &&
+        (lv_obj_get_style_height(obj, LV_PART_MAIN) == LV_SIZE_CONTENT ||
+         lv_obj_get_style_width(obj, LV_PART_MAIN) == LV_SIZE_CONTENT))) {
+        lv_obj_send_event(obj, LV_EVENT_STYLE_CHANGED, NULL);
+        lv_obj_mark_layout_as_dirty(obj);
+    }
+
+    if(dirty & LV_OBJ_STYLE_DIRTY_LAYOUT_MAIN) {
+        lv_obj_t * parent = lv_obj_get_parent(obj);
+        if(parent) lv_obj_mark_layout_as_dirty(parent);
+    }
+
+    if(dirty & LV_OBJ_STYLE_DIRTY_LAYER) lv_obj_update_layer_type(obj);
+    if(dirty & LV_OBJ_STYLE_DIRTY_PIVOT) lv_obj_invalidate_visibility_cache(obj);
+    if(dirty & LV_OBJ_STYLE_DIRTY_EXT_DRAW) lv_obj_refresh_ext_draw_size(obj);
+
+    lv_obj_invalidate(obj);
+
+    if(dirty & LV_OBJ_STYLE_DIRTY_CHILDREN) refresh_children_style(obj);
+}
+
+#endif /*LV_OBJ_STYLE_DEFERRED_REFRESH*/
+
 /**
  * Recursively refresh the style of the children. Go deeper until a not NULL style is found
  * because the NULL styles are inherited from the parent
@@ -1123,6 +1381,30 @@ static void fade_in_anim_completed(lv_anim_t * a)
     lv_obj_remove_local_style_prop(a->var, LV_STYLE_OPA, 0);
 }
 
+/**
+ * Copy a local style into an initialized empty style.
+ * Local styles are never constant, so the properties and values can be copied in one step
+ * instead of setting them one by one.
+ * @param dst       the destination style
+ * @param src       the local style to copy
+ */
+static void copy_local_style(lv_style_t * dst, const lv_style_t * src)
+{
+    if(lv_style_is_const(src) || src->prop_cnt == 0) {
+        lv_style_copy(dst, src);
+        return;
+    }
+
+    size_t size = src->prop_cnt * (sizeof(lv_style_value_t) + sizeof(lv_style_prop_t));
+    dst->values_and_props = lv_malloc(size);
+    LV_ASSERT_MALLOC(dst->values_and_props);
+    if(dst->values_and_props == NULL) return;
+
+    lv_memcpy(dst->values_and_props, src->values_and_props, size);
+    dst->prop_cnt = src->prop_cnt;
+    dst->has_group = src->has_group;
+}
+
 static bool style_has_flag(const lv_style_t * style, uint32_t flag)
 {
     if(lv_style_is_const(style)) {
@@ -1146,6 +1428,30 @@ static bool style_has_flag(const lv_style_t * style, uint32_t flag)
     return false;
 }
 
+static void update_prop_is_set(lv_obj_t * obj, const lv_style_t * style, lv_part_t part)
+{
+#if LV_OBJ_STYLE_CACHE
+    uint32_t * prop_is_set = part == LV_PART_MAIN ? &obj->style_main_prop_is_set : &obj->style_other_prop_is_set;
+    uint32_t i;
+    if(lv_style_is_const(style)) {
+        lv_style_const_prop_t * props = style->values_and_props;
+        for(i = 0; props[i].prop != LV_STYLE_PROP_INV; i++) {
+            (*prop_is_set) |= STYLE_PROP_SHIFTED(props[i].prop);
+        }
+    }
+    else {
+        lv_style_prop_t * props = (lv_style_prop_t *)style->values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
+        for(i = 0; i < style->prop_cnt; i++) {
+            (*prop_is_set) |= STYLE_PROP_SHIFTED(props[i]);
+        }
+    }
+#else
+    LV_UNUSED(obj);
+    LV_UNUSED(style);
+    LV_UNUSED(part);
+#endif
+}
+
 static lv_style_res_t get_selector_style_prop(const lv_obj_t * obj, lv_style_selector_t selector, lv_style_prop_t prop,
                                               lv_style_value_t * value_act)
 {
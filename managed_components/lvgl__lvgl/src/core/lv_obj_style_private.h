@@ -32,6 +32,21 @@ struct _lv_obj_style_t {
     uint32_t is_disabled : 1;
 };
 
+#if LV_OBJ_STYLE_DEFERRED_REFRESH
+/**
+ * What needs to be refreshed because of the changed local style properties of an object
+ */
+typedef enum {
+    LV_OBJ_STYLE_DIRTY_QUEUED       = 0x01,     /**< The object is in the list of objects to refresh*/
+    LV_OBJ_STYLE_DIRTY_LAYOUT_MAIN  = 0x02,     /**< A layout property of the main part has changed*/
+    LV_OBJ_STYLE_DIRTY_LAYOUT_OTHER = 0x04,     /**< A layout property of an other part has changed*/
+    LV_OBJ_STYLE_DIRTY_EXT_DRAW     = 0x08,
+    LV_OBJ_STYLE_DIRTY_LAYER        = 0x10,
+    LV_OBJ_STYLE_DIRTY_PIVOT        = 0x20,
+    LV_OBJ_STYLE_DIRTY_CHILDREN     = 0x40,     /**< An inherited property affecting the children has changed*/
+} lv_obj_style_dirty_t;
+#endif
+
 struct _lv_obj_style_transition_dsc_t {
     uint16_t time;
     uint16_t delay;
@@ -85,6 +100,38 @@ lv_style_state_cmp_t lv_obj_style_state_compare(lv_obj_t * obj, lv_state_t state
  */
 void lv_obj_update_layer_type(lv_obj_t * obj);
 
+/**
+ * Replace the styles of an object with the styles of an other object.
+ * The normal styles are shared, the local styles are copied and transitions are skipped.
+ * The styles are not refreshed, it needs to be done by the caller.
+ * @param obj       the object whose styles should be replaced
+ * @param src       the object to copy the styles from
+ */
+void lv_obj_copy_styles(lv_obj_t * obj, const lv_obj_t * src);
+
+/**
+ * Add several styles to an object at once, e.g. the styles of a theme.
+ * It has the same effect as calling `lv_obj_add_style` for each element of `styles` in order,
+ * but the style array is reallocated and the object is refreshed only once.
+ * @param obj       the object to add the styles to
+ * @param styles    the styles and their selectors. `is_local`, `is_trans` and `is_disabled` are ignored.
+ *                  The same style with the same selector shouldn't be in the list twice.
+ * @param cnt       number of elements in `styles`
+ */
+void lv_obj_add_style_list(lv_obj_t * obj, const lv_obj_style_t * styles, uint32_t cnt);
+
+/**
+ * Refresh the objects whose local style properties were changed since the last call.
+ * Called by `lv_obj_update_layout`. Does nothing if `LV_OBJ_STYLE_DEFERRED_REFRESH` is disabled.
+ */
+void lv_obj_refresh_dirty_styles(void);
+
+/**
+ * Forget the not refreshed style changes of an object, e.g. because it's being deleted
+ * @param obj       pointer to an object
+ */
+void lv_obj_style_clear_dirty(lv_obj_t * obj);
+
 /**********************
  *      MACROS
  **********************/
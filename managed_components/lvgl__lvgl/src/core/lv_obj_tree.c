@@ -15,12 +15,14 @@
 #include "../misc/lv_anim_private.h"
 #include "../misc/lv_async.h"
 #include "../core/lv_global.h"
+#include "lv_group_private.h"
 
 /*********************
  *      DEFINES
  *********************/
 #define MY_CLASS (&lv_obj_class)
 #define disp_ll_p &(LV_GLOBAL_DEFAULT()->disp_ll)
+#define delete_incremental_timer LV_GLOBAL_DEFAULT()->obj_delete_incremental_timer
 
 #define OBJ_DUMP_STRING_LEN 128
 #define LV_OBJ_NAME_MAX_LEN 128
@@ -34,9 +36,19 @@
  **********************/
 static void lv_obj_delete_async_cb(void * obj);
 static void obj_delete_core(lv_obj_t * obj);
+static bool obj_delete_begin(lv_obj_t * obj);
+static void obj_delete_end(lv_obj_t * obj);
+static void delete_queue_add(lv_obj_t * queue, lv_obj_t * parent, uint32_t idx, uint32_t cnt);
+static void delete_anims_tree(lv_obj_t * obj);
+static void delete_queue_step(lv_obj_t * queue);
+static void delete_queue_delete_event_cb(lv_event_t * e);
+static void delete_incremental_timer_cb(lv_timer_t * t);
+static bool is_in_tree(const lv_obj_t * root, const lv_obj_t * obj);
 static lv_obj_tree_walk_res_t walk_core(lv_obj_t * obj, lv_obj_tree_walk_cb_t cb, void * user_data);
 static void dump_tree_core(lv_obj_t * obj, int32_t depth);
 static lv_obj_t * lv_obj_get_first_not_deleting_child(lv_obj_t * obj);
+static lv_obj_t * clone_core(const lv_obj_t * src, lv_obj_t * parent);
+static bool is_constructor_child(const lv_obj_t * copy, uint32_t ctor_cnt, const lv_obj_t * src, uint32_t idx);
 #if LV_USE_OBJ_NAME
     static lv_obj_t * find_by_name_direct(const lv_obj_t * parent, const char * name, size_t len);
 #endif /*LV_USE_OBJ_NAME*/
@@ -91,6 +103,66 @@ void lv_obj_delete(lv_obj_t * obj)
     LV_LOG_TRACE("finished (delete %p)", (void *)obj);
 }
 
+void lv_obj_delete_incremental(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    if(obj->is_deleting) return;
+
+    lv_display_t * disp = lv_obj_get_display(obj);
+    if(disp == NULL) return;
+
+    /*Already queued?*/
+    if(disp->delete_queue && lv_obj_get_screen(obj) == disp->delete_queue) return;
+
+    if(disp->delete_queue == NULL) {
+        lv_display_t * disp_def = lv_display_get_default();
+        lv_display_set_default(disp);
+        disp->delete_queue = lv_obj_create(NULL);
+        lv_display_set_default(disp_def);
+        if(disp->delete_queue == NULL) {
+            lv_obj_delete(obj);
+            return;
+        }
+
+        lv_obj_remove_style_all(disp->delete_queue);
+        lv_obj_add_flag(disp->delete_queue, LV_OBJ_FLAG_HIDDEN);
+        lv_obj_add_event_cb(disp->delete_queue, delete_queue_delete_event_cb, LV_EVENT_DELETE, NULL);
+    }
+
+    if(obj->parent == NULL) {
+        /*Screens can't be moved, so queue only their children and delete the empty screen*/
+        uint32_t child_cnt = lv_obj_get_child_count(obj);
+        if(child_cnt) delete_queue_add(disp->delete_queue, obj, 0, child_cnt);
+        lv_obj_delete(obj);
+    }
+    else {
+        delete_queue_add(disp->delete_queue, obj->parent, lv_obj_get_index(obj), 1);
+    }
+
+    if(delete_incremental_timer == NULL) {
+        delete_incremental_timer = lv_timer_create(delete_incremental_timer_cb, 0, NULL);
+        LV_ASSERT_MALLOC(delete_incremental_timer);
+        if(delete_incremental_timer == NULL) {
+            lv_obj_delete_incremental_flush();
+            return;
+        }
+    }
+    lv_timer_resume(delete_incremental_timer);
+}
+
+void lv_obj_delete_incremental_flush(void)
+{
+    lv_display_t * disp = lv_display_get_next(NULL);
+    while(disp) {
+        /*The queued objects are deleted in the `LV_EVENT_DELETE` of the queue*/
+        if(disp->delete_queue) lv_obj_delete(disp->delete_queue);
+        disp = lv_display_get_next(disp);
+    }
+
+    if(delete_incremental_timer) lv_timer_pause(delete_incremental_timer);
+}
+
 void lv_obj_clean(lv_obj_t * obj)
 {
     LV_LOG_TRACE("begin (clean %p)", (void *)obj);
@@ -191,6 +263,12 @@ void lv_obj_set_parent(lv_obj_t * obj, lv_obj_t * parent)
 
     obj->parent = parent;
 
+    lv_indev_hit_index_invalidate(old_parent);
+    lv_indev_hit_index_invalidate(parent);
+    lv_obj_invalidate_visibility_cache(obj);
+    lv_group_invalidate_focusable_cache();
+    lv_group_invalidate_spatial_index();
+
     /*Notify the original parent because one of its children is lost*/
     lv_obj_scrollbar_invalidate(old_parent);
     lv_obj_send_event(old_parent, LV_EVENT_CHILD_CHANGED, obj);
@@ -250,6 +328,7 @@ void lv_obj_move_to_index(lv_obj_t * obj, int32_t index)
     }
 
     parent->spec_attr->children[index] = obj;
+    lv_indev_hit_index_invalidate(parent);
     lv_obj_send_event(parent, LV_EVENT_CHILD_CHANGED, NULL);
     lv_obj_invalidate(parent);
 }
@@ -274,6 +353,11 @@ void lv_obj_swap(lv_obj_t * obj1, lv_obj_t * obj2)
     parent2->spec_attr->children[index2] = obj1;
     obj1->parent = parent2;
 
+    lv_indev_hit_index_invalidate(parent);
+    lv_indev_hit_index_invalidate(parent2);
+    lv_obj_invalidate_visibility_cache(obj1);
+    lv_obj_invalidate_visibility_cache(obj2);
+
     lv_obj_send_event(parent, LV_EVENT_CHILD_CHANGED, obj2);
     lv_obj_send_event(parent, LV_EVENT_CHILD_CREATED, obj2);
     lv_obj_send_event(parent2, LV_EVENT_CHILD_CHANGED, obj1);
@@ -287,6 +371,27 @@ void lv_obj_swap(lv_obj_t * obj1, lv_obj_t * obj2)
     lv_group_swap_obj(obj1, obj2);
 }
 
+lv_obj_t * lv_obj_clone(const lv_obj_t * src, lv_obj_t * parent)
+{
+    LV_ASSERT_OBJ(src, MY_CLASS);
+
+    return clone_core(src, parent);
+}
+
+uint32_t lv_obj_clone_multiple(const lv_obj_t * src, lv_obj_t * parent, uint32_t cnt, lv_obj_t ** clones)
+{
+    LV_ASSERT_OBJ(src, MY_CLASS);
+
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        lv_obj_t * obj = clone_core(src, parent);
+        if(obj == NULL) break;
+        if(clones) clones[i] = obj;
+    }
+
+    return i;
+}
+
 lv_obj_t * lv_obj_get_screen(const lv_obj_t * obj)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
@@ -670,25 +775,46 @@ static void obj_delete_core(lv_obj_t * obj)
     if(obj->is_deleting)
         return;
 
+    if(!obj_delete_begin(obj)) return;
+
+    /*Recursively delete the children*/
+    lv_obj_t * child = lv_obj_get_child(obj, 0);
+    while(child) {
+        obj_delete_core(child);
+        child = lv_obj_get_child(obj, 0);
+    }
+
+    obj_delete_end(obj);
+}
+
+/**
+ * Start deleting an object: notify it and remove its event callbacks.
+ * @param obj       pointer to an object
+ * @return          false if the deletion was stopped in `LV_EVENT_DELETE`
+ */
+static bool obj_delete_begin(lv_obj_t * obj)
+{
     obj->is_deleting = true;
 
     /*Let the user free the resources used in `LV_EVENT_DELETE`*/
     lv_result_t res = lv_obj_send_event(obj, LV_EVENT_DELETE, NULL);
     if(res == LV_RESULT_INVALID) {
         obj->is_deleting = false;
-        return;
+        return false;
     }
 
     /*Clean registered event_cb*/
     if(obj->spec_attr) lv_event_remove_all(&(obj->spec_attr->event_list));
 
-    /*Recursively delete the children*/
-    lv_obj_t * child = lv_obj_get_child(obj, 0);
-    while(child) {
-        obj_delete_core(child);
-        child = lv_obj_get_child(obj, 0);
-    }
+    return true;
+}
 
+/**
+ * Finish deleting an object whose children are already deleted
+ * @param obj       pointer to an object
+ */
+static void obj_delete_end(lv_obj_t * obj)
+{
     lv_group_t * group = lv_obj_get_group(obj);
 
     /*Reset all input devices if the object to delete is used*/
@@ -746,14 +872,237 @@ static void obj_delete_core(lv_obj_t * obj)
             obj->parent->spec_attr->children[i] = obj->parent->spec_attr->children[i + 1];
         }
         obj->parent->spec_attr->child_cnt--;
+        lv_indev_hit_index_invalidate(obj->parent);
         obj->parent->spec_attr->children = lv_realloc(obj->parent->spec_attr->children,
                                                       obj->parent->spec_attr->child_cnt * sizeof(lv_obj_t *));
     }
 
+    /*Deleted during layout update (e.g. in an event) before the scrollbars were invalidated*/
+    if(obj->scrollbar_inv_later) LV_GLOBAL_DEFAULT()->layout_scrollbar_inv_later_cnt--;
+
     /*Free the object itself*/
     lv_free(obj);
 }
 
+static lv_obj_t * clone_core(const lv_obj_t * src, lv_obj_t * parent)
+{
+    /*Get it before creating the copy as `parent` might be `src` or its descendant*/
+    uint32_t child_cnt = lv_obj_get_child_count(src);
+
+    lv_obj_t * obj = lv_obj_class_create_obj(src->class_p, parent);
+    LV_ASSERT_MALLOC(obj);
+    if(obj == NULL) return NULL;
+    lv_obj_class_init_obj_from(obj, src);
+
+    /*The children created by the constructor are already there, copy only the others.
+     *`lv_obj_move_to_index` might have moved them, so find them by their class.*/
+    uint32_t ctor_cnt = lv_obj_get_child_count(obj);
+    uint32_t matched_cnt = 0;
+    uint32_t i;
+    for(i = 0; i < child_cnt; i++) {
+        if(is_constructor_child(obj, ctor_cnt, src, i)) matched_cnt++;
+        else clone_core(src->spec_attr->children[i], obj);
+    }
+
+    if(matched_cnt != ctor_cnt) {
+        LV_LOG_WARN("The children of the copy created by the constructor of %s don't match the original",
+                    src->class_p->name ? src->class_p->name : "the widget");
+    }
+
+    return obj;
+}
+
+/**
+ * Check if a child of the original object corresponds to a child created by the constructor of the copy.
+ * The children of the same class are matched in their order.
+ * @param copy      the new object
+ * @param ctor_cnt  number of children created by the constructor of `copy`
+ * @param src       the original object
+ * @param idx       index of the child in `src`
+ * @return          true: the child was created by the constructor
+ */
+static bool is_constructor_child(const lv_obj_t * copy, uint32_t ctor_cnt, const lv_obj_t * src, uint32_t idx)
+{
+    const lv_obj_class_t * class_p = src->spec_attr->children[idx]->class_p;
+    uint32_t class_cnt = 0;
+    uint32_t i;
+    for(i = 0; i < ctor_cnt; i++) {
+        if(copy->spec_attr->children[i]->class_p == class_p) class_cnt++;
+    }
+    if(class_cnt == 0) return false;
+
+    /*Only the first `class_cnt` children of this class were created by the constructor*/
+    uint32_t rank = 0;
+    for(i = 0; i < idx && rank < class_cnt; i++) {
+        if(src->spec_attr->children[i]->class_p == class_p) rank++;
+    }
+
+    return rank < class_cnt;
+}
+
+/**
+ * Move some children of an object to the queue of the incrementally deleted objects in one step.
+ * The moved objects get no events and their animations are deleted, so they don't run
+ * while the objects are waiting in the queue.
+ * @param queue     the hidden screen holding the objects to delete
+ * @param parent    the current parent of the objects
+ * @param idx       index of the first child to queue
+ * @param cnt       number of children to queue from `idx`
+ */
+static void delete_queue_add(lv_obj_t * queue, lv_obj_t * parent, uint32_t idx, uint32_t cnt)
+{
+    lv_obj_t ** children = parent->spec_attr->children;
+    uint32_t i;
+    for(i = idx; i < idx + cnt; i++) {
+        lv_obj_t * obj = children[i];
+
+        /*Release the input devices if they use the object or any of its children*/
+        lv_indev_t * indev = lv_indev_get_next(NULL);
+        while(indev) {
+            lv_indev_type_t indev_type = lv_indev_get_type(indev);
+            if(indev_type == LV_INDEV_TYPE_POINTER || indev_type == LV_INDEV_TYPE_BUTTON) {
+                if(is_in_tree(obj, indev->pointer.act_obj)) obj_indev_reset(indev, indev->pointer.act_obj);
+                if(is_in_tree(obj, indev->pointer.last_obj)) obj_indev_reset(indev, indev->pointer.last_obj);
+                if(is_in_tree(obj, indev->pointer.scroll_obj)) obj_indev_reset(indev, indev->pointer.scroll_obj);
+                if(is_in_tree(obj, indev->pointer.last_pressed)) indev->pointer.last_pressed = NULL;
+                if(is_in_tree(obj, indev->pointer.last_hovered)) indev->pointer.last_hovered = NULL;
+            }
+            indev = lv_indev_get_next(indev);
+        }
+
+        lv_obj_invalidate(obj);
+        delete_anims_tree(obj);
+    }
+
+    /*Append the objects to the children of the queue...*/
+    lv_obj_allocate_spec_attr(queue);
+    uint32_t queue_cnt = queue->spec_attr->child_cnt;
+    queue->spec_attr->children = lv_realloc(queue->spec_attr->children, (queue_cnt + cnt) * sizeof(lv_obj_t *));
+    lv_memcpy(&queue->spec_attr->children[queue_cnt], &children[idx], cnt * sizeof(lv_obj_t *));
+    queue->spec_attr->child_cnt += cnt;
+    for(i = queue_cnt; i < queue_cnt + cnt; i++) {
+        queue->spec_attr->children[i]->parent = queue;
+        lv_obj_invalidate_visibility_cache(queue->spec_attr->children[i]);
+    }
+
+    /*...and remove them from the parent*/
+    uint32_t parent_cnt = parent->spec_attr->child_cnt - cnt;
+    lv_memmove(&children[idx], &children[idx + cnt], (parent_cnt - idx) * sizeof(lv_obj_t *));
+    parent->spec_attr->child_cnt = parent_cnt;
+    if(parent_cnt) {
+        parent->spec_attr->children = lv_realloc(children, parent_cnt * sizeof(lv_obj_t *));
+    }
+    else {
+        lv_free(children);
+        parent->spec_attr->children = NULL;
+    }
+
+    lv_indev_hit_index_invalidate(parent);
+    lv_group_invalidate_focusable_cache();
+    lv_group_invalidate_spatial_index();
+
+    /*The children of the hidden queue can't be focused, so move the focus away*/
+    lv_group_t * group;
+    LV_LL_READ(&LV_GLOBAL_DEFAULT()->group_ll, group) {
+        lv_obj_t * focused = lv_group_get_focused(group);
+        if(is_in_tree(queue, focused)) {
+            lv_group_focus_next(group);
+        }
+    }
+
+    /*For the parent the children are deleted*/
+    lv_obj_scrollbar_invalidate(parent);
+    lv_obj_send_event(parent, LV_EVENT_CHILD_CHANGED, NULL);
+    lv_obj_send_event(parent, LV_EVENT_CHILD_DELETED, NULL);
+}
+
+/**
+ * Delete the animations of an object and all of its descendants
+ * @param obj       pointer to an object
+ */
+static void delete_anims_tree(lv_obj_t * obj)
+{
+    lv_anim_delete(obj, NULL);
+
+    uint32_t i;
+    uint32_t child_cnt = lv_obj_get_child_count(obj);
+    for(i = 0; i < child_cnt; i++) {
+        delete_anims_tree(obj->spec_attr->children[i]);
+    }
+}
+
+/**
+ * Delete one object from the queue. Go down on the first children until an object without
+ * children is found and delete it. `LV_EVENT_DELETE` is sent to the objects on the way
+ * the first time, so the order of the events is the same as in `lv_obj_delete()`.
+ * @param queue     the hidden screen holding the objects to delete
+ */
+static void delete_queue_step(lv_obj_t * queue)
+{
+    lv_obj_t * obj = lv_obj_get_child(queue, 0);
+    while(obj) {
+        if(!obj->is_deleting) {
+            if(!obj_delete_begin(obj)) return;
+        }
+
+        lv_obj_t * child = lv_obj_get_child(obj, 0);
+        if(child == NULL) break;
+        obj = child;
+    }
+
+    if(obj) obj_delete_end(obj);
+}
+
+static void delete_queue_delete_event_cb(lv_event_t * e)
+{
+    lv_obj_t * queue = lv_event_get_current_target(e);
+    while(lv_obj_get_child_count(queue)) {
+        delete_queue_step(queue);
+    }
+
+    lv_display_t * disp = lv_obj_get_display(queue);
+    if(disp) disp->delete_queue = NULL;
+}
+
+static void delete_incremental_timer_cb(lv_timer_t * t)
+{
+    uint32_t start = lv_tick_get();
+    bool pending = false;
+    bool first = true;
+
+    lv_display_t * disp = lv_display_get_next(NULL);
+    while(disp) {
+        while(disp->delete_queue) {
+            if(lv_obj_get_child_count(disp->delete_queue) == 0) {
+                lv_obj_delete(disp->delete_queue);
+                break;
+            }
+
+            /*Delete at least one object in each call*/
+            if(!first && lv_tick_elaps(start) >= LV_OBJ_DELETE_INCREMENTAL_TIME) {
+                pending = true;
+                break;
+            }
+
+            delete_queue_step(disp->delete_queue);
+            first = false;
+        }
+        disp = lv_display_get_next(disp);
+    }
+
+    if(!pending) lv_timer_pause(t);
+}
+
+static bool is_in_tree(const lv_obj_t * root, const lv_obj_t * obj)
+{
+    while(obj) {
+        if(obj == root) return true;
+        obj = obj->parent;
+    }
+
+    return false;
+}
+
 static lv_obj_tree_walk_res_t walk_core(lv_obj_t * obj, lv_obj_tree_walk_cb_t cb, void * user_data)
 {
     lv_obj_tree_walk_res_t res = LV_OBJ_TREE_WALK_NEXT;
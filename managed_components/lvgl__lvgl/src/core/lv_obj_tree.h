@@ -45,6 +45,24 @@ typedef lv_obj_tree_walk_res_t (*lv_obj_tree_walk_cb_t)(lv_obj_t *, void *);
  */
 void lv_obj_delete(lv_obj_t * obj);
 
+/**
+ * Delete an object and all of its children in small steps.
+ * The object is detached from its parent immediately and moved to a hidden screen,
+ * so it's not visible and can't be clicked or focused anymore. The animations of the objects
+ * are deleted immediately and no events are sent to them on the move. The objects are deleted
+ * later in `lv_timer_handler()` spending at most `LV_OBJ_DELETE_INCREMENTAL_TIME` ms
+ * in each call. Useful to delete large screens without a visible hitch.
+ * `LV_EVENT_DELETE` is sent to each object right before its children are deleted.
+ * @param obj       pointer to an object. If it's a screen its children are deleted in steps
+ *                  and the screen itself is deleted immediately.
+ */
+void lv_obj_delete_incremental(lv_obj_t * obj);
+
+/**
+ * Delete all the objects passed to `lv_obj_delete_incremental()` which are not deleted yet.
+ */
+void lv_obj_delete_incremental_flush(void);
+
 /**
  * Delete all children of an object.
  * Also remove the objects from their group and remove all animations (if any).
@@ -100,6 +118,34 @@ void lv_obj_swap(lv_obj_t * obj1, lv_obj_t * obj2);
  */
 void lv_obj_move_to_index(lv_obj_t * obj, int32_t index);
 
+/**
+ * Create a copy of an object and its children.
+ * The styles, flags, states and scroll settings are copied. The normal styles are shared
+ * with `src`, the local styles are copied. The theme is not applied on the copies,
+ * so it's much faster than creating the same objects and setting their properties again.
+ * @param src       pointer to the object to copy
+ * @param parent    pointer to the parent of the copy
+ * @return          pointer to the new object
+ * @note            The event callbacks, the user data, the group membership and the widget
+ *                  specific data (e.g. the text of a label) are not copied.
+ * @note            The children created by the widget's constructor are not copied
+ *                  but created again by the constructor. They are found among the children
+ *                  of `src` by their class, so they can be moved with `lv_obj_move_to_index`
+ *                  unless they are moved behind other children of the same class.
+ */
+lv_obj_t * lv_obj_clone(const lv_obj_t * src, lv_obj_t * parent);
+
+/**
+ * Create several copies of an object and its children in one step.
+ * The same as calling `lv_obj_clone` `cnt` times. It stops at the first failed copy.
+ * @param src       pointer to the object to copy
+ * @param parent    pointer to the parent of the copies
+ * @param cnt       number of copies to create
+ * @param clones    array with `cnt` elements to store the new objects. Can be `NULL`.
+ * @return          number of copies created successfully
+ */
+uint32_t lv_obj_clone_multiple(const lv_obj_t * src, lv_obj_t * parent, uint32_t cnt, lv_obj_t ** clones);
+
 /**
  * Get the screen of an object
  * @param obj       pointer to an object
@@ -719,6 +719,18 @@ static void refr_sync_areas(void)
     }
 
     lv_area_t disp_area = {0, 0, (int32_t)hor_res - 1, (int32_t)ver_res - 1};
+    /*After a rotation the off screen buffers might still have the shape of the previous orientation.
+     *They are reshaped for rendering anyway, so do it before copying into them.*/
+    if(!lv_ll_is_empty(&disp_refr->sync_areas)) {
+        const lv_image_header_t * header = &on_screen->header;
+        if(off_screen->header.w != header->w || off_screen->header.h != header->h) {
+            lv_draw_buf_reshape(off_screen, header->cf, header->w, header->h, header->stride);
+        }
+        if(off_screen2 != on_screen && (off_screen2->header.w != header->w || off_screen2->header.h != header->h)) {
+            lv_draw_buf_reshape(off_screen2, header->cf, header->w, header->h, header->stride);
+        }
+    }
+
     /*Copy sync areas (if any remaining)*/
     for(sync_area = lv_ll_get_head(&disp_refr->sync_areas); sync_area != NULL;
         sync_area = lv_ll_get_next(&disp_refr->sync_areas, sync_area)) {
@@ -23,6 +23,11 @@
     #include "../draw/sw/lv_draw_sw.h"
 #endif
 
+#if LV_USE_IMAGE
+    #include "../widgets/image/lv_image.h"
+    #include "../misc/cache/instance/lv_image_cache.h"
+#endif
+
 /*********************
  *      DEFINES
  *********************/
@@ -37,6 +42,13 @@
  *  STATIC PROTOTYPES
  **********************/
 static lv_obj_tree_walk_res_t invalidate_layout_cb(lv_obj_t * obj, void * user_data);
+#if LV_USE_DRAW_SW && LV_USE_IMAGE
+    static lv_draw_buf_t * rotation_snapshot_create(lv_display_t * disp, lv_display_rotation_t rotation);
+    static void rotation_snapshot_show(lv_display_t * disp, lv_draw_buf_t * snapshot, uint32_t time);
+    static void rotation_snapshot_opa_anim(void * obj, int32_t v);
+    static void rotation_snapshot_anim_completed(lv_anim_t * a);
+    static void rotation_snapshot_delete_cb(lv_event_t * e);
+#endif
 static void update_resolution(lv_display_t * disp);
 static void scr_load_internal(lv_obj_t * scr);
 static void scr_load_anim_start(lv_anim_t * a);
@@ -940,6 +952,29 @@ void lv_display_set_rotation(lv_display_t * disp, lv_display_rotation_t rotation
     update_resolution(disp);
 }
 
+void lv_display_set_rotation_anim(lv_display_t * disp, lv_display_rotation_t rotation, uint32_t time)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return;
+
+#if LV_USE_DRAW_SW && LV_USE_IMAGE
+    /*Take the snapshot first as the last frame might contain the snapshot of an earlier rotation too*/
+    lv_draw_buf_t * snapshot = NULL;
+    if(time > 0 && rotation != (lv_display_rotation_t)disp->rotation) {
+        snapshot = rotation_snapshot_create(disp, rotation);
+    }
+
+    if(disp->rotation_snapshot) lv_obj_delete(disp->rotation_snapshot);
+
+    lv_display_set_rotation(disp, rotation);
+
+    if(snapshot) rotation_snapshot_show(disp, snapshot, time);
+#else
+    LV_UNUSED(time);
+    lv_display_set_rotation(disp, rotation);
+#endif
+}
+
 lv_display_rotation_t lv_display_get_rotation(lv_display_t * disp)
 {
     if(disp == NULL) disp = lv_display_get_default();
@@ -1268,12 +1303,30 @@ static void update_resolution(lv_display_t * disp)
     lv_area_set_height(&disp->bottom_layer->coords, ver_res);
     lv_obj_send_event(disp->bottom_layer, LV_EVENT_SIZE_CHANGED, &prev_coords);
 
+    /*The children are clipped to the new size of the screens and layers*/
+    for(i = 0; i < disp->screen_cnt; i++) {
+        lv_obj_invalidate_visibility_cache(disp->screens[i]);
+    }
+    lv_obj_invalidate_visibility_cache(disp->top_layer);
+    lv_obj_invalidate_visibility_cache(disp->sys_layer);
+    lv_obj_invalidate_visibility_cache(disp->bottom_layer);
+
     lv_memzero(disp->inv_areas, sizeof(disp->inv_areas));
     lv_memzero(disp->inv_area_joined, sizeof(disp->inv_area_joined));
     disp->inv_p = 0;
     lv_obj_invalidate(disp->sys_layer);
 
-    lv_obj_tree_walk(NULL, invalidate_layout_cb, NULL);
+    /*The whole screen will be redrawn so the old double buffer sync areas are not required*/
+    lv_ll_clear(&disp->sync_areas);
+
+    /*Only the objects of this display are affected. Mark them directly instead of
+     *`lv_obj_mark_layout_as_dirty` to not look up the screen and display for each object.
+     *The layouts are recalculated together in the next refresh.*/
+    for(i = 0; i < disp->screen_cnt; i++) {
+        lv_obj_tree_walk(disp->screens[i], invalidate_layout_cb, NULL);
+        disp->screens[i]->scr_layout_inv = 1;
+    }
+    lv_display_send_event(disp, LV_EVENT_REFR_REQUEST, NULL);
 
     lv_display_send_event(disp, LV_EVENT_RESOLUTION_CHANGED, NULL);
 }
@@ -1281,10 +1334,113 @@ static void update_resolution(lv_display_t * disp)
 static lv_obj_tree_walk_res_t invalidate_layout_cb(lv_obj_t * obj, void * user_data)
 {
     LV_UNUSED(user_data);
-    lv_obj_mark_layout_as_dirty(obj);
+    obj->layout_inv = 1;
     return LV_OBJ_TREE_WALK_NEXT;
 }
 
+#if LV_USE_DRAW_SW && LV_USE_IMAGE
+
+/**
+ * Copy the last flushed frame into a new buffer rotated to the new orientation.
+ * @param disp      pointer to a display
+ * @param rotation  the new rotation
+ * @return          the rotated snapshot or NULL if the last frame is not available
+ */
+static lv_draw_buf_t * rotation_snapshot_create(lv_display_t * disp, lv_display_rotation_t rotation)
+{
+    /*Only the screen sized buffers contain the whole frame*/
+    if(disp->render_mode == LV_DISPLAY_RENDER_MODE_PARTIAL) return NULL;
+
+    /*With matrix rotation the buffers are not in the orientation of the screens*/
+    if(disp->matrix_rotation) return NULL;
+
+    /*The buffer flushed last. With 2 or 3 buffers it's the one before the active buffer*/
+    lv_draw_buf_t * on_screen;
+    if(!lv_display_is_double_buffered(disp)) on_screen = disp->buf_act;
+    else if(disp->buf_act == disp->buf_1) on_screen = disp->buf_3 ? disp->buf_3 : disp->buf_2;
+    else if(disp->buf_act == disp->buf_2) on_screen = disp->buf_1;
+    else on_screen = disp->buf_2;
+
+    if(on_screen == NULL || on_screen->data == NULL) return NULL;
+
+    /*Not rendered with the current resolution yet (e.g. rotated twice without a refresh)*/
+    int32_t w = on_screen->header.w;
+    int32_t h = on_screen->header.h;
+    if(w != lv_display_get_horizontal_resolution(disp) || h != lv_display_get_vertical_resolution(disp)) return NULL;
+
+    lv_color_format_t cf = on_screen->header.cf;
+    if(cf != LV_COLOR_FORMAT_RGB565 && cf != LV_COLOR_FORMAT_RGB888 &&
+       cf != LV_COLOR_FORMAT_XRGB8888 && cf != LV_COLOR_FORMAT_ARGB8888) {
+        return NULL;
+    }
+
+    /*The physical orientation of the pixels shouldn't change, so
+     *rotate back by the new rotation and forward by the current one*/
+    lv_display_rotation_t delta = (lv_display_rotation_t)((disp->rotation + 4 - rotation) % 4);
+    bool swap_xy = delta == LV_DISPLAY_ROTATION_90 || delta == LV_DISPLAY_ROTATION_270;
+
+    lv_draw_buf_t * snapshot = lv_draw_buf_create(swap_xy ? h : w, swap_xy ? w : h, cf, LV_STRIDE_AUTO);
+    if(snapshot == NULL) {
+        LV_LOG_WARN("Not enough memory for the rotation snapshot");
+        return NULL;
+    }
+
+    lv_draw_sw_rotate(on_screen->data, snapshot->data, w, h, on_screen->header.stride, snapshot->header.stride,
+                      delta, cf);
+
+    return snapshot;
+}
+
+/**
+ * Show the snapshot on the system layer and fade it out
+ * @param disp      pointer to a display
+ * @param snapshot  the rotated snapshot. It's freed when the image is deleted.
+ * @param time      time of the cross-fade
+ */
+static void rotation_snapshot_show(lv_display_t * disp, lv_draw_buf_t * snapshot, uint32_t time)
+{
+    lv_obj_t * img = lv_image_create(disp->sys_layer);
+    lv_obj_remove_flag(img, LV_OBJ_FLAG_CLICKABLE);
+    lv_image_set_src(img, snapshot);
+    lv_obj_set_pos(img, 0, 0);
+    lv_obj_add_event_cb(img, rotation_snapshot_delete_cb, LV_EVENT_DELETE, disp);
+    disp->rotation_snapshot = img;
+
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, img);
+    lv_anim_set_values(&a, LV_OPA_COVER, LV_OPA_TRANSP);
+    lv_anim_set_duration(&a, time);
+    lv_anim_set_exec_cb(&a, rotation_snapshot_opa_anim);
+    lv_anim_set_completed_cb(&a, rotation_snapshot_anim_completed);
+    lv_anim_set_path_cb(&a, lv_anim_path_ease_out);
+    lv_anim_start(&a);
+}
+
+static void rotation_snapshot_opa_anim(void * obj, int32_t v)
+{
+    lv_obj_set_style_image_opa(obj, v, 0);
+}
+
+static void rotation_snapshot_anim_completed(lv_anim_t * a)
+{
+    lv_obj_delete(a->var);
+}
+
+static void rotation_snapshot_delete_cb(lv_event_t * e)
+{
+    lv_obj_t * img = lv_event_get_target(e);
+    lv_display_t * disp = lv_event_get_user_data(e);
+
+    lv_draw_buf_t * snapshot = (lv_draw_buf_t *)lv_image_get_src(img);
+    lv_image_cache_drop(snapshot);
+    lv_draw_buf_destroy(snapshot);
+
+    if(disp->rotation_snapshot == img) disp->rotation_snapshot = NULL;
+}
+
+#endif /*LV_USE_DRAW_SW && LV_USE_IMAGE*/
+
 static void scr_load_internal(lv_obj_t * scr)
 {
     /*scr must not be NULL, but d->act_scr might be*/
@@ -158,6 +158,19 @@ void lv_display_set_offset(lv_display_t * disp, int32_t x, int32_t y);
  */
 void lv_display_set_rotation(lv_display_t * disp, lv_display_rotation_t rotation);
 
+/**
+ * Set the rotation of this display without a visible jump or tear.
+ * The last flushed frame is rotated to the new orientation and shown on the system layer,
+ * so the first frame rendered with the new rotation looks the same as the old one.
+ * After that the snapshot fades out in `time` milliseconds while the new layout is visible under it.
+ * It works only in `LV_DISPLAY_RENDER_MODE_DIRECT` and `LV_DISPLAY_RENDER_MODE_FULL`
+ * with a software rotated color format. Else it works like `lv_display_set_rotation`.
+ * @param disp      pointer to a display (NULL to use the default display)
+ * @param rotation  `LV_DISPLAY_ROTATION_0/90/180/270`
+ * @param time      time of the cross-fade in milliseconds (0: no cross-fade)
+ */
+void lv_display_set_rotation_anim(lv_display_t * disp, lv_display_rotation_t rotation, uint32_t time);
+
 /**
  * Use matrix rotation for the display. This function is depended on `LV_DRAW_TRANSFORM_USE_MATRIX`
  * @param disp      pointer to a display (NULL to use the default display)
@@ -131,6 +131,7 @@ struct _lv_display_t {
     lv_obj_t * bottom_layer;/**< @see lv_display_get_layer_bottom*/
     lv_obj_t * prev_scr;    /**< Previous screen. Used during screen animations*/
     lv_obj_t * scr_to_load; /**< The screen prepared to load in lv_screen_load_anim*/
+    lv_obj_t * delete_queue;/**< Hidden screen holding the objects passed to `lv_obj_delete_incremental`*/
     uint32_t screen_cnt;
     uint8_t draw_prev_over_act  : 1;/** 1: Draw previous screen over active screen*/
     uint8_t del_prev  : 1;  /** 1: Automatically delete the previous screen when the screen load animation is ready*/
@@ -149,6 +150,9 @@ struct _lv_display_t {
 
     uint32_t matrix_rotation : 1; /**< 1: Use matrix for display rotation*/
 
+    /** Image showing the last frame of the previous rotation. Used in `lv_display_set_rotation_anim`*/
+    lv_obj_t * rotation_snapshot;
+
     lv_theme_t * theme;     /**< The theme assigned to the screen*/
 
     /** A timer which periodically checks the dirty areas and refreshes them*/
@@ -215,6 +215,15 @@ void lv_draw_label_iterate_characters(lv_draw_task_t * t, const lv_draw_label_ds
 
     lv_bidi_calculate_align(&align, &base_dir, dsc->text);
 
+    /*The letters are measured for line breaking and aligning before drawing them,
+     *so remember which font of the fallback chain has them*/
+    lv_font_fallback_cache_t fallback_cache;
+    lv_font_fallback_cache_t * fallback_cache_p = dsc->fallback_cache;
+    if(fallback_cache_p == NULL && font->fallback) {
+        lv_font_fallback_cache_init(&fallback_cache, font);
+        fallback_cache_p = &fallback_cache;
+    }
+
     if((dsc->flag & LV_TEXT_FLAG_EXPAND) == 0) {
         /*Normally use the label's width as width*/
         w = lv_area_get_width(coords);
@@ -231,6 +240,7 @@ void lv_draw_label_iterate_characters(lv_draw_task_t * t, const lv_draw_label_ds
             attributes.line_space = dsc->line_space;
             attributes.max_width = LV_COORD_MAX;
             attributes.text_flags = dsc->flag;
+            attributes.fallback_cache = fallback_cache_p;
 
             lv_point_t p;
             lv_text_get_size_attributes(&p, dsc->text, dsc->font, &attributes);
@@ -275,6 +285,7 @@ void lv_draw_label_iterate_characters(lv_draw_task_t * t, const lv_draw_label_ds
     attributes.letter_space = dsc->letter_space;
     attributes.text_flags = dsc->flag;
     attributes.max_width = w;
+    attributes.fallback_cache = fallback_cache_p;
 
     uint32_t line_end = line_start + lv_text_get_next_line(&dsc->text[line_start], remaining_len, font, NULL, &attributes);
 
@@ -353,17 +364,31 @@ void lv_draw_label_iterate_characters(lv_draw_task_t * t, const lv_draw_label_ds
         next_char_offset = 0;
 #if LV_USE_BIDI
         size_t bidi_size = line_end - line_start;
-        char * bidi_txt = lv_malloc(bidi_size + 1);
-        LV_ASSERT_MALLOC(bidi_txt);
-
-        /**
-          * has_bided = 1: already executed lv_bidi_process_paragraph.
-          * has_bided = 0: has not been executed lv_bidi_process_paragraph.*/
-        if(dsc->has_bided) {
-            lv_memcpy(bidi_txt, &dsc->text[line_start], bidi_size);
+        const lv_bidi_text_line_t * bidi_line = NULL;
+        uint32_t visual_char_id = 0;
+        const char * bidi_txt;
+        char * bidi_txt_buf = NULL;
+
+        /*Use the processed line if it was stored by the widget*/
+        if(dsc->bidi_text) bidi_line = lv_bidi_text_find_line(dsc->bidi_text, line_start, line_end);
+
+        if(bidi_line) {
+            bidi_txt = lv_bidi_text_get_line_text(dsc->bidi_text, bidi_line, dsc->text);
         }
         else {
-            lv_bidi_process_paragraph(dsc->text + line_start, bidi_txt, bidi_size, base_dir, NULL, 0);
+            bidi_txt_buf = lv_malloc(bidi_size + 1);
+            LV_ASSERT_MALLOC(bidi_txt_buf);
+
+            /**
+              * has_bided = 1: already executed lv_bidi_process_paragraph.
+              * has_bided = 0: has not been executed lv_bidi_process_paragraph.*/
+            if(dsc->has_bided) {
+                lv_memcpy(bidi_txt_buf, &dsc->text[line_start], bidi_size);
+            }
+            else {
+                lv_bidi_process_paragraph(dsc->text + line_start, bidi_txt_buf, bidi_size, base_dir, NULL, 0);
+            }
+            bidi_txt = bidi_txt_buf;
         }
 #else
         const char * bidi_txt = dsc->text + line_start;
@@ -375,7 +400,11 @@ void lv_draw_label_iterate_characters(lv_draw_task_t * t, const lv_draw_label_ds
             /* Check if the text selection is enabled */
             if(sel_start != LV_DRAW_LABEL_NO_TXT_SEL && sel_end != LV_DRAW_LABEL_NO_TXT_SEL) {
 #if LV_USE_BIDI
-                if(dsc->has_bided) {
+                if(bidi_line) {
+                    logical_char_pos = bidi_line->char_start +
+                                       lv_bidi_text_get_logical_pos(dsc->bidi_text, bidi_line, visual_char_id, NULL);
+                }
+                else if(dsc->has_bided) {
                     logical_char_pos = lv_text_encoded_get_char_id(dsc->text, line_start + next_char_offset);
                 }
                 else {
@@ -391,6 +420,9 @@ void lv_draw_label_iterate_characters(lv_draw_task_t * t, const lv_draw_label_ds
             uint32_t letter;
             uint32_t letter_next;
             lv_text_encoded_letter_next_2(bidi_txt, &letter, &letter_next, &next_char_offset);
+#if LV_USE_BIDI
+            visual_char_id++;
+#endif
 
             /* If recolor is enabled */
             if((dsc->flag & LV_TEXT_FLAG_RECOLOR) != 0) {
@@ -466,7 +498,7 @@ void lv_draw_label_iterate_characters(lv_draw_task_t * t, const lv_draw_label_ds
                 logical_char_pos -= (LABEL_RECOLOR_PAR_LENGTH + 1);
             }
 
-            lv_font_get_glyph_dsc(font, &glyph_dsc, letter, letter_next);
+            lv_font_get_glyph_dsc_cached(font, fallback_cache_p, &glyph_dsc, letter, letter_next);
             letter_w = lv_text_is_marker(letter) ? 0 : glyph_dsc.adv_w;
 
             /*Always set the bg_coordinates for placeholder drawing*/
@@ -520,14 +552,14 @@ void lv_draw_label_iterate_characters(lv_draw_task_t * t, const lv_draw_label_ds
         }
 
 #if LV_USE_BIDI
-        lv_free(bidi_txt);
-        bidi_txt = NULL;
+        lv_free(bidi_txt_buf);
 #endif
 
         lv_text_attributes_t text_attributes = {0};
         text_attributes.letter_space = dsc->letter_space;
         text_attributes.text_flags = dsc->flag;
         text_attributes.max_width = w;
+        text_attributes.fallback_cache = fallback_cache_p;
 
         /*Go to next line*/
         remaining_len -= line_end - line_start;
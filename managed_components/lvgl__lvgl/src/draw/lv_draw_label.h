@@ -107,6 +107,14 @@ typedef struct {
     /**Pointer to an externally stored struct where some data can be cached to speed up rendering*/
     lv_draw_label_hint_t * hint;
 
+    /**Pointer to an externally stored cache of the fonts resolved from the fallback chain of `font`,
+     * e.g. stored by the label. If NULL a temporary cache is used while drawing the text.*/
+    lv_font_fallback_cache_t * fallback_cache;
+
+    /**The text already processed by Bidi, e.g. stored by the label.
+     * The lines are processed again only if they are broken differently.*/
+    const lv_bidi_text_t * bidi_text;
+
     /* Properties of the letter outlines */
     lv_color_t outline_stroke_color;
     int32_t outline_stroke_width;
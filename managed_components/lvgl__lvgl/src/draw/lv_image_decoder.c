@@ -249,6 +249,11 @@ void lv_image_decoder_set_close_cb(lv_image_decoder_t * decoder, lv_image_decode
     decoder->close_cb = close_cb;
 }
 
+void lv_image_decoder_set_drop_cache_cb(lv_image_decoder_t * decoder, lv_image_decoder_drop_cache_f_t drop_cache_cb)
+{
+    decoder->drop_cache_cb = drop_cache_cb;
+}
+
 lv_cache_entry_t * lv_image_decoder_add_to_cache(lv_image_decoder_t * decoder,
                                                  lv_image_cache_data_t * search_key,
                                                  const lv_draw_buf_t * decoded, void * user_data)
@@ -75,6 +75,13 @@ typedef lv_result_t (*lv_image_decoder_get_area_cb_t)(lv_image_decoder_t * decod
  */
 typedef void (*lv_image_decoder_close_f_t)(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc);
 
+/**
+ * Drop the data which the decoder caches itself besides the image cache. Called by `lv_image_cache_drop`.
+ * @param decoder pointer to the decoder the function associated with
+ * @param src the image source whose data should be dropped or NULL to drop everything
+ */
+typedef void (*lv_image_decoder_drop_cache_f_t)(lv_image_decoder_t * decoder, const void * src);
+
 /**
  * Custom drawing functions for special image formats.
  * @param layer pointer to a layer
@@ -179,6 +186,13 @@ void lv_image_decoder_set_get_area_cb(lv_image_decoder_t * decoder, lv_image_dec
  */
 void lv_image_decoder_set_close_cb(lv_image_decoder_t * decoder, lv_image_decoder_close_f_t close_cb);
 
+/**
+ * Set a callback to drop the data which the decoder caches itself, e.g. parsed documents.
+ * @param decoder pointer to an image decoder
+ * @param drop_cache_cb a function to drop the cached data of a source
+ */
+void lv_image_decoder_set_drop_cache_cb(lv_image_decoder_t * decoder, lv_image_decoder_drop_cache_f_t drop_cache_cb);
+
 lv_cache_entry_t * lv_image_decoder_add_to_cache(lv_image_decoder_t * decoder,
                                                  lv_image_cache_data_t * search_key,
                                                  const lv_draw_buf_t * decoded, void * user_data);
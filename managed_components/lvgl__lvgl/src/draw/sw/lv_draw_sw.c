@@ -100,6 +100,10 @@ void lv_draw_sw_init(void)
     }
 #endif
 
+#if LV_USE_VECTOR_GRAPHIC && LV_DRAW_SW_VECTOR_CACHE_SIZE > 0
+    lv_draw_sw_vector_native_cache_init();
+#endif
+
 #if LV_USE_VECTOR_GRAPHIC && LV_USE_THORVG
     if(LV_DRAW_SW_DRAW_UNIT_CNT > 1) {
         tvg_engine_init(TVG_ENGINE_SW, LV_DRAW_SW_DRAW_UNIT_CNT);
@@ -118,6 +122,10 @@ void lv_draw_sw_deinit(void)
     tvg_engine_term(TVG_ENGINE_SW);
 #endif
 
+#if LV_USE_VECTOR_GRAPHIC && LV_DRAW_SW_VECTOR_CACHE_SIZE > 0
+    lv_draw_sw_vector_native_cache_deinit();
+#endif
+
 #if LV_DRAW_SW_COMPLEX == 1
     lv_draw_sw_mask_deinit();
 #endif
@@ -418,9 +426,13 @@ static void execute_drawing(lv_draw_task_t * t)
         case LV_DRAW_TASK_TYPE_MASK_RECTANGLE:
             lv_draw_sw_mask_rect(t, t->draw_dsc);
             break;
-#if LV_USE_VECTOR_GRAPHIC && LV_USE_THORVG
+#if LV_USE_VECTOR_GRAPHIC
         case LV_DRAW_TASK_TYPE_VECTOR:
+#if LV_USE_THORVG
             lv_draw_sw_vector(t, t->draw_dsc);
+#else
+            lv_draw_sw_vector_native(t, t->draw_dsc);
+#endif
             break;
 #endif
         default:
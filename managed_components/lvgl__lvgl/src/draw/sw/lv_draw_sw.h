@@ -154,6 +154,32 @@ void lv_draw_sw_transform(const lv_area_t * dest_area, const void * src_buf,
 void lv_draw_sw_vector(lv_draw_task_t * t, lv_draw_vector_dsc_t * dsc);
 #endif
 
+#if LV_USE_VECTOR_GRAPHIC
+/**
+ * Draw vector graphics with the built-in lightweight rasterizer.
+ * It's used instead of `lv_draw_sw_vector` if ThorVG is not enabled.
+ * @param t             pointer to a draw task
+ * @param dsc           the draw descriptor
+ */
+void lv_draw_sw_vector_native(lv_draw_task_t * t, lv_draw_vector_dsc_t * dsc);
+
+/**
+ * Create the cache of the flattened paths and coverage masks of the built-in rasterizer.
+ * Called from `lv_draw_sw_init` if `LV_DRAW_SW_VECTOR_CACHE_SIZE > 0`.
+ */
+void lv_draw_sw_vector_native_cache_init(void);
+
+/**
+ * Delete the cache of the built-in rasterizer
+ */
+void lv_draw_sw_vector_native_cache_deinit(void);
+
+/**
+ * Drop all the cached paths and masks of the built-in rasterizer to free the memory
+ */
+void lv_draw_sw_vector_native_cache_drop_all(void);
+#endif
+
 /**
  * Register a custom blend handler for a color format.
  * Handler will be called when blending a color or an
@@ -64,14 +64,53 @@
     #define LV_DRAW_SW_ROTATE270_L8(...) LV_RESULT_INVALID
 #endif
 
+/*The 90 and 270 degree rotations are done in square blocks with this size (in pixels)
+ *to read and write only a few cache lines while a block is rotated*/
+#ifndef LV_DRAW_SW_ROTATE_BLOCK_SIZE
+    #define LV_DRAW_SW_ROTATE_BLOCK_SIZE 32
+#endif
+
+/*Read 4 RGB888 pixels from 3 words to `px[0..3]` and write them back (little endian only)*/
+#define UNPACK_RGB888_4PX(src, px)                                  \
+    do {                                                            \
+        const uint32_t * _s = (const uint32_t *)(src);              \
+        uint32_t _w0 = _s[0];                                       \
+        uint32_t _w1 = _s[1];                                       \
+        uint32_t _w2 = _s[2];                                       \
+        (px)[0] = _w0 & 0xffffff;                                   \
+        (px)[1] = (_w0 >> 24) | ((_w1 & 0xffff) << 8);              \
+        (px)[2] = (_w1 >> 16) | ((_w2 & 0xff) << 16);               \
+        (px)[3] = _w2 >> 8;                                         \
+    } while(0)
+
+#define PACK_RGB888_4PX(dst, px0, px1, px2, px3)                    \
+    do {                                                            \
+        uint32_t * _d = (uint32_t *)(dst);                          \
+        _d[0] = (px0) | ((px1) << 24);                              \
+        _d[1] = ((px1) >> 8) | ((px2) << 16);                       \
+        _d[2] = ((px2) >> 16) | ((px3) << 8);                       \
+    } while(0)
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+/**
+ * Rotate a block which is small enough to be rotated in the cache
+ */
+typedef void (*rotate_block_cb_t)(const uint8_t * src, uint8_t * dst, int32_t src_width, int32_t src_height,
+                                  int32_t src_stride, int32_t dst_stride);
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 
+static void rotate90_blocks(const uint8_t * src, uint8_t * dst, int32_t src_width, int32_t src_height,
+                            int32_t src_stride, int32_t dst_stride, uint32_t px_size, rotate_block_cb_t block_cb);
+static void rotate270_blocks(const uint8_t * src, uint8_t * dst, int32_t src_width, int32_t src_height,
+                             int32_t src_stride, int32_t dst_stride, uint32_t px_size, rotate_block_cb_t block_cb);
+static inline bool is_word_aligned(const void * src, const void * dst, int32_t src_stride, int32_t dst_stride);
+
 #if LV_DRAW_SW_SUPPORT_ARGB8888 || LV_DRAW_SW_SUPPORT_XRGB8888
 static void rotate90_argb8888(const uint32_t * src, uint32_t * dst, int32_t src_width, int32_t src_height,
                               int32_t src_stride,
@@ -81,6 +120,10 @@ static void rotate180_argb8888(const uint32_t * src, uint32_t * dst, int32_t wid
 static void rotate270_argb8888(const uint32_t * src, uint32_t * dst, int32_t src_width, int32_t src_height,
                                int32_t src_stride,
                                int32_t dst_stride);
+static void rotate90_argb8888_block(const uint8_t * src, uint8_t * dst, int32_t src_width, int32_t src_height,
+                                    int32_t src_stride, int32_t dst_stride);
+static void rotate270_argb8888_block(const uint8_t * src, uint8_t * dst, int32_t src_width, int32_t src_height,
+                                     int32_t src_stride, int32_t dst_stride);
 #endif
 #if LV_DRAW_SW_SUPPORT_RGB888
 static void rotate90_rgb888(const uint8_t * src, uint8_t * dst, int32_t src_width, int32_t src_height,
@@ -90,6 +133,13 @@ static void rotate180_rgb888(const uint8_t * src, uint8_t * dst, int32_t width,
                              int32_t dest_stride);
 static void rotate270_rgb888(const uint8_t * src, uint8_t * dst, int32_t width, int32_t height, int32_t src_stride,
                              int32_t dst_stride);
+static void rotate90_rgb888_block(const uint8_t * src, uint8_t * dst, int32_t src_width, int32_t src_height,
+                                  int32_t src_stride, int32_t dst_stride);
+static void rotate270_rgb888_block(const uint8_t * src, uint8_t * dst, int32_t src_width, int32_t src_height,
+                                   int32_t src_stride, int32_t dst_stride);
+#if LV_BIG_ENDIAN_SYSTEM == 0
+static inline void rotate_4x4_rgb888(const uint8_t * src[4], uint8_t * dst[4]);
+#endif
 #endif
 #if LV_DRAW_SW_SUPPORT_RGB565
 static void rotate90_rgb565(const uint16_t * src, uint16_t * dst, int32_t src_width, int32_t src_height,
@@ -100,6 +150,10 @@ static void rotate180_rgb565(const uint16_t * src, uint16_t * dst, int32_t width
 static void rotate270_rgb565(const uint16_t * src, uint16_t * dst, int32_t src_width, int32_t src_height,
                              int32_t src_stride,
                              int32_t dst_stride);
+static void rotate90_rgb565_block(const uint8_t * src, uint8_t * dst, int32_t src_width, int32_t src_height,
+                                  int32_t src_stride, int32_t dst_stride);
+static void rotate270_rgb565_block(const uint8_t * src, uint8_t * dst, int32_t src_width, int32_t src_height,
+                                   int32_t src_stride, int32_t dst_stride);
 #endif
 
 #if LV_DRAW_SW_SUPPORT_L8
@@ -112,6 +166,10 @@ static void rotate180_l8(const uint8_t * src, uint8_t * dst, int32_t width, int3
 static void rotate270_l8(const uint8_t * src, uint8_t * dst, int32_t src_width, int32_t src_height,
                          int32_t src_stride,
                          int32_t dst_stride);
+static void rotate90_l8_block(const uint8_t * src, uint8_t * dst, int32_t src_width, int32_t src_height,
+                              int32_t src_stride, int32_t dst_stride);
+static void rotate270_l8_block(const uint8_t * src, uint8_t * dst, int32_t src_width, int32_t src_height,
+                               int32_t src_stride, int32_t dst_stride);
 #endif
 
 /**********************
@@ -347,6 +405,55 @@ void lv_draw_sw_rotate(const void * src, void * dest, int32_t src_width, int32_t
  *   STATIC FUNCTIONS
  **********************/
 
+/**
+ * Rotate an image by 90 degrees in blocks. The rotation of a block is the same as rotating
+ * a small image, so the block rotation callbacks work like the rotation of the whole image.
+ * @param src           pointer to the source buffer
+ * @param dst           pointer to the destination buffer
+ * @param src_width     width of the source image
+ * @param src_height    height of the source image
+ * @param src_stride    stride of the source in bytes
+ * @param dst_stride    stride of the destination in bytes
+ * @param px_size       size of a pixel in bytes
+ * @param block_cb      function to rotate a block
+ */
+static void rotate90_blocks(const uint8_t * src, uint8_t * dst, int32_t src_width, int32_t src_height,
+                            int32_t src_stride, int32_t dst_stride, uint32_t px_size, rotate_block_cb_t block_cb)
+{
+    for(int32_t y = 0; y < src_height; y += LV_DRAW_SW_ROTATE_BLOCK_SIZE) {
+        int32_t block_h = LV_MIN(LV_DRAW_SW_ROTATE_BLOCK_SIZE, src_height - y);
+        for(int32_t x = 0; x < src_width; x += LV_DRAW_SW_ROTATE_BLOCK_SIZE) {
+            int32_t block_w = LV_MIN(LV_DRAW_SW_ROTATE_BLOCK_SIZE, src_width - x);
+            block_cb(src + y * src_stride + x * px_size,
+                     dst + (src_width - x - block_w) * dst_stride + y * px_size,
+                     block_w, block_h, src_stride, dst_stride);
+        }
+    }
+}
+
+/**
+ * Rotate an image by 270 degrees in blocks.
+ * @see rotate90_blocks
+ */
+static void rotate270_blocks(const uint8_t * src, uint8_t * dst, int32_t src_width, int32_t src_height,
+                             int32_t src_stride, int32_t dst_stride, uint32_t px_size, rotate_block_cb_t block_cb)
+{
+    for(int32_t y = 0; y < src_height; y += LV_DRAW_SW_ROTATE_BLOCK_SIZE) {
+        int32_t block_h = LV_MIN(LV_DRAW_SW_ROTATE_BLOCK_SIZE, src_height - y);
+        for(int32_t x = 0; x < src_width; x += LV_DRAW_SW_ROTATE_BLOCK_SIZE) {
+            int32_t block_w = LV_MIN(LV_DRAW_SW_ROTATE_BLOCK_SIZE, src_width - x);
+            block_cb(src + y * src_stride + x * px_size,
+                     dst + x * dst_stride + (src_height - y - block_h) * px_size,
+                     block_w, block_h, src_stride, dst_stride);
+        }
+    }
+}
+
+static inline bool is_word_aligned(const void * src, const void * dst, int32_t src_stride, int32_t dst_stride)
+{
+    return (((lv_uintptr_t)src | (lv_uintptr_t)dst | (lv_uintptr_t)src_stride | (lv_uintptr_t)dst_stride) & 0x3) == 0;
+}
+
 #if LV_DRAW_SW_SUPPORT_ARGB8888 || LV_DRAW_SW_SUPPORT_XRGB8888
 
 static void rotate270_argb8888(const uint32_t * src, uint32_t * dst, int32_t src_width, int32_t src_height,
@@ -357,6 +464,16 @@ static void rotate270_argb8888(const uint32_t * src, uint32_t * dst, int32_t src
         return ;
     }
 
+    rotate270_blocks((const uint8_t *)src, (uint8_t *)dst, src_width, src_height, src_stride, dst_stride,
+                     sizeof(uint32_t), rotate270_argb8888_block);
+}
+
+static void rotate270_argb8888_block(const uint8_t * src8, uint8_t * dst8, int32_t src_width, int32_t src_height,
+                                     int32_t src_stride, int32_t dst_stride)
+{
+    const uint32_t * src = (const uint32_t *)src8;
+    uint32_t * dst = (uint32_t *)dst8;
+
     src_stride /= sizeof(uint32_t);
     dst_stride /= sizeof(uint32_t);
 
@@ -397,6 +514,16 @@ static void rotate90_argb8888(const uint32_t * src, uint32_t * dst, int32_t src_
         return ;
     }
 
+    rotate90_blocks((const uint8_t *)src, (uint8_t *)dst, src_width, src_height, src_stride, dst_stride,
+                    sizeof(uint32_t), rotate90_argb8888_block);
+}
+
+static void rotate90_argb8888_block(const uint8_t * src8, uint8_t * dst8, int32_t src_width, int32_t src_height,
+                                    int32_t src_stride, int32_t dst_stride)
+{
+    const uint32_t * src = (const uint32_t *)src8;
+    uint32_t * dst = (uint32_t *)dst8;
+
     src_stride /= sizeof(uint32_t);
     dst_stride /= sizeof(uint32_t);
 
@@ -422,7 +549,46 @@ static void rotate90_rgb888(const uint8_t * src, uint8_t * dst, int32_t src_widt
         return ;
     }
 
-    for(int32_t x = 0; x < src_width; ++x) {
+    rotate90_blocks(src, dst, src_width, src_height, src_stride, dst_stride, 3, rotate90_rgb888_block);
+}
+
+static void rotate90_rgb888_block(const uint8_t * src, uint8_t * dst, int32_t src_width, int32_t src_height,
+                                  int32_t src_stride, int32_t dst_stride)
+{
+    int32_t x_start = 0;
+
+#if LV_BIG_ENDIAN_SYSTEM == 0
+    /*Rotate 4x4 pixels with 32-bit loads and stores if possible*/
+    if(is_word_aligned(src, dst, src_stride, dst_stride)) {
+        int32_t w4 = src_width & ~0x3;
+        int32_t h4 = src_height & ~0x3;
+        for(int32_t x = 0; x < w4; x += 4) {
+            for(int32_t y = 0; y < h4; y += 4) {
+                const uint8_t * src_rows[4];
+                uint8_t * dst_rows[4];
+                for(int32_t i = 0; i < 4; i++) {
+                    src_rows[i] = src + (y + i) * src_stride + x * 3;
+                    dst_rows[i] = dst + (src_width - x - i - 1) * dst_stride + y * 3;
+                }
+                rotate_4x4_rgb888(src_rows, dst_rows);
+            }
+        }
+
+        /*Rotate the remaining rows and columns pixel by pixel*/
+        for(int32_t x = 0; x < w4; ++x) {
+            for(int32_t y = h4; y < src_height; ++y) {
+                int32_t srcIndex = y * src_stride + x * 3;
+                int32_t dstIndex = (src_width - x - 1) * dst_stride + y * 3;
+                dst[dstIndex] = src[srcIndex];
+                dst[dstIndex + 1] = src[srcIndex + 1];
+                dst[dstIndex + 2] = src[srcIndex + 2];
+            }
+        }
+        x_start = w4;
+    }
+#endif
+
+    for(int32_t x = x_start; x < src_width; ++x) {
         for(int32_t y = 0; y < src_height; ++y) {
             int32_t srcIndex = y * src_stride + x * 3;
             int32_t dstIndex = (src_width - x - 1) * dst_stride + y * 3;
@@ -458,10 +624,50 @@ static void rotate270_rgb888(const uint8_t * src, uint8_t * dst, int32_t width,
         return ;
     }
 
-    for(int32_t x = 0; x < width; ++x) {
-        for(int32_t y = 0; y < height; ++y) {
+    rotate270_blocks(src, dst, width, height, src_stride, dst_stride, 3, rotate270_rgb888_block);
+}
+
+static void rotate270_rgb888_block(const uint8_t * src, uint8_t * dst, int32_t src_width, int32_t src_height,
+                                   int32_t src_stride, int32_t dst_stride)
+{
+    int32_t x_start = 0;
+
+#if LV_BIG_ENDIAN_SYSTEM == 0
+    /*Rotate 4x4 pixels with 32-bit loads and stores if possible.
+     *The destination columns are aligned from the first column*/
+    if(is_word_aligned(src, dst, src_stride, dst_stride)) {
+        int32_t w4 = src_width & ~0x3;
+        int32_t h4 = src_height & ~0x3;
+        for(int32_t x = 0; x < w4; x += 4) {
+            for(int32_t dst_x = 0; dst_x < h4; dst_x += 4) {
+                const uint8_t * src_rows[4];
+                uint8_t * dst_rows[4];
+                for(int32_t i = 0; i < 4; i++) {
+                    src_rows[i] = src + (src_height - dst_x - i - 1) * src_stride + x * 3;
+                    dst_rows[i] = dst + (x + i) * dst_stride + dst_x * 3;
+                }
+                rotate_4x4_rgb888(src_rows, dst_rows);
+            }
+
+            /*The remaining columns of the destination*/
+            for(int32_t i = 0; i < 4; i++) {
+                for(int32_t dst_x = h4; dst_x < src_height; dst_x++) {
+                    int32_t srcIndex = (src_height - dst_x - 1) * src_stride + (x + i) * 3;
+                    int32_t dstIndex = (x + i) * dst_stride + dst_x * 3;
+                    dst[dstIndex] = src[srcIndex];
+                    dst[dstIndex + 1] = src[srcIndex + 1];
+                    dst[dstIndex + 2] = src[srcIndex + 2];
+                }
+            }
+        }
+        x_start = w4;
+    }
+#endif
+
+    for(int32_t x = x_start; x < src_width; ++x) {
+        for(int32_t y = 0; y < src_height; ++y) {
             int32_t srcIndex = y * src_stride + x * 3;
-            int32_t dstIndex = x * dst_stride + (height - y - 1) * 3;
+            int32_t dstIndex = x * dst_stride + (src_height - y - 1) * 3;
             dst[dstIndex] = src[srcIndex];       /*Red*/
             dst[dstIndex + 1] = src[srcIndex + 1]; /*Green*/
             dst[dstIndex + 2] = src[srcIndex + 2]; /*Blue*/
@@ -469,6 +675,31 @@ static void rotate270_rgb888(const uint8_t * src, uint8_t * dst, int32_t width,
     }
 }
 
+#if LV_BIG_ENDIAN_SYSTEM == 0
+/**
+ * Transpose 4x4 RGB888 pixels: the i-th pixel of the j-th source row will be
+ * the j-th pixel of the i-th destination row.
+ * 4 pixels are stored in 3 words, so the pixels are read and written with 32-bit access.
+ * @param src       pointer to 4 word aligned source rows
+ * @param dst       pointer to 4 word aligned destination rows
+ */
+static inline void rotate_4x4_rgb888(const uint8_t * src[4], uint8_t * dst[4])
+{
+    /*Unpack the 4 pixels of each source row from 3 words*/
+    uint32_t px[4][4];
+    UNPACK_RGB888_4PX(src[0], px[0]);
+    UNPACK_RGB888_4PX(src[1], px[1]);
+    UNPACK_RGB888_4PX(src[2], px[2]);
+    UNPACK_RGB888_4PX(src[3], px[3]);
+
+    /*Pack the i-th pixel of the source rows to the i-th destination row*/
+    PACK_RGB888_4PX(dst[0], px[0][0], px[1][0], px[2][0], px[3][0]);
+    PACK_RGB888_4PX(dst[1], px[0][1], px[1][1], px[2][1], px[3][1]);
+    PACK_RGB888_4PX(dst[2], px[0][2], px[1][2], px[2][2], px[3][2]);
+    PACK_RGB888_4PX(dst[3], px[0][3], px[1][3], px[2][3], px[3][3]);
+}
+#endif
+
 #endif
 
 #if LV_DRAW_SW_SUPPORT_RGB565
@@ -481,10 +712,50 @@ static void rotate270_rgb565(const uint16_t * src, uint16_t * dst, int32_t src_w
         return ;
     }
 
+    rotate270_blocks((const uint8_t *)src, (uint8_t *)dst, src_width, src_height, src_stride, dst_stride,
+                     sizeof(uint16_t), rotate270_rgb565_block);
+}
+
+static void rotate270_rgb565_block(const uint8_t * src8, uint8_t * dst8, int32_t src_width, int32_t src_height,
+                                   int32_t src_stride, int32_t dst_stride)
+{
+    int32_t x_start = 0;
+
+#if LV_BIG_ENDIAN_SYSTEM == 0
+    /*Rotate 2x2 pixels with 32-bit loads and stores if possible.
+     *The destination columns are aligned from the first column*/
+    if(is_word_aligned(src8, dst8, src_stride, dst_stride)) {
+        int32_t w2 = src_width & ~0x1;
+        int32_t h2 = src_height & ~0x1;
+        for(int32_t x = 0; x < w2; x += 2) {
+            uint32_t * d0 = (uint32_t *)(dst8 + x * dst_stride);
+            uint32_t * d1 = (uint32_t *)(dst8 + (x + 1) * dst_stride);
+            const uint8_t * s = src8 + (src_height - 1) * src_stride + x * sizeof(uint16_t);
+            for(int32_t dst_x = 0; dst_x < h2; dst_x += 2) {
+                uint32_t a = *(const uint32_t *)s;
+                uint32_t b = *(const uint32_t *)(s - src_stride);
+                d0[dst_x / 2] = (a & 0xffff) | (b << 16);
+                d1[dst_x / 2] = (a >> 16) | (b & 0xffff0000);
+                s -= 2 * src_stride;
+            }
+
+            if(h2 != src_height) {
+                const uint16_t * s16 = (const uint16_t *)(src8 + x * sizeof(uint16_t));
+                ((uint16_t *)d0)[h2] = s16[0];
+                ((uint16_t *)d1)[h2] = s16[1];
+            }
+        }
+        x_start = w2;
+    }
+#endif
+
+    const uint16_t * src = (const uint16_t *)src8;
+    uint16_t * dst = (uint16_t *)dst8;
+
     src_stride /= sizeof(uint16_t);
     dst_stride /= sizeof(uint16_t);
 
-    for(int32_t x = 0; x < src_width; ++x) {
+    for(int32_t x = x_start; x < src_width; ++x) {
         int32_t dstIndex = x * dst_stride;
         int32_t srcIndex = x;
         for(int32_t y = 0; y < src_height; ++y) {
@@ -521,10 +792,49 @@ static void rotate90_rgb565(const uint16_t * src, uint16_t * dst, int32_t src_wi
         return ;
     }
 
+    rotate90_blocks((const uint8_t *)src, (uint8_t *)dst, src_width, src_height, src_stride, dst_stride,
+                    sizeof(uint16_t), rotate90_rgb565_block);
+}
+
+static void rotate90_rgb565_block(const uint8_t * src8, uint8_t * dst8, int32_t src_width, int32_t src_height,
+                                  int32_t src_stride, int32_t dst_stride)
+{
+    int32_t x_start = 0;
+
+#if LV_BIG_ENDIAN_SYSTEM == 0
+    /*Rotate 2x2 pixels with 32-bit loads and stores if possible*/
+    if(is_word_aligned(src8, dst8, src_stride, dst_stride)) {
+        int32_t w2 = src_width & ~0x1;
+        int32_t h2 = src_height & ~0x1;
+        for(int32_t x = 0; x < w2; x += 2) {
+            uint32_t * d0 = (uint32_t *)(dst8 + (src_width - x - 1) * dst_stride);
+            uint32_t * d1 = (uint32_t *)(dst8 + (src_width - x - 2) * dst_stride);
+            const uint8_t * s = src8 + x * sizeof(uint16_t);
+            for(int32_t y = 0; y < h2; y += 2) {
+                uint32_t a = *(const uint32_t *)s;
+                uint32_t b = *(const uint32_t *)(s + src_stride);
+                d0[y / 2] = (a & 0xffff) | (b << 16);
+                d1[y / 2] = (a >> 16) | (b & 0xffff0000);
+                s += 2 * src_stride;
+            }
+
+            if(h2 != src_height) {
+                const uint16_t * s16 = (const uint16_t *)(src8 + h2 * src_stride + x * sizeof(uint16_t));
+                ((uint16_t *)d0)[h2] = s16[0];
+                ((uint16_t *)d1)[h2] = s16[1];
+            }
+        }
+        x_start = w2;
+    }
+#endif
+
+    const uint16_t * src = (const uint16_t *)src8;
+    uint16_t * dst = (uint16_t *)dst8;
+
     src_stride /= sizeof(uint16_t);
     dst_stride /= sizeof(uint16_t);
 
-    for(int32_t x = 0; x < src_width; ++x) {
+    for(int32_t x = x_start; x < src_width; ++x) {
         int32_t dstIndex = (src_width - x - 1);
         int32_t srcIndex = x;
         for(int32_t y = 0; y < src_height; ++y) {
@@ -547,6 +857,12 @@ static void rotate90_l8(const uint8_t * src, uint8_t * dst, int32_t src_width, i
         return ;
     }
 
+    rotate90_blocks(src, dst, src_width, src_height, src_stride, dst_stride, 1, rotate90_l8_block);
+}
+
+static void rotate90_l8_block(const uint8_t * src, uint8_t * dst, int32_t src_width, int32_t src_height,
+                              int32_t src_stride, int32_t dst_stride)
+{
     for(int32_t x = 0; x < src_width; ++x) {
         int32_t dstIndex = (src_width - x - 1);
         int32_t srcIndex = x;
@@ -581,6 +897,12 @@ static void rotate270_l8(const uint8_t * src, uint8_t * dst, int32_t src_width,
         return ;
     }
 
+    rotate270_blocks(src, dst, src_width, src_height, src_stride, dst_stride, 1, rotate270_l8_block);
+}
+
+static void rotate270_l8_block(const uint8_t * src, uint8_t * dst, int32_t src_width, int32_t src_height,
+                               int32_t src_stride, int32_t dst_stride)
+{
     for(int32_t x = 0; x < src_width; ++x) {
         int32_t dstIndex = x * dst_stride;
         int32_t srcIndex = x;
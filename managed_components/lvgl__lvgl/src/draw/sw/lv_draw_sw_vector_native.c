@@ -0,0 +1,1754 @@
+/**
+ * @file lv_draw_sw_vector_native.c
+ *
+ * A compact vector rasterizer for `lv_draw_vector` which is used when ThorVG is not enabled.
+ * The paths are flattened to polylines, the strokes are converted to polygons and
+ * the polygons are rasterized with exact area coverage (analytic anti-aliasing)
+ * in horizontal bands. The coverage of each band is used as a mask to blend
+ * the paint (color, gradient or image) with the existing blend functions.
+ *
+ * If `LV_DRAW_SW_VECTOR_CACHE_SIZE > 0` the edges or the coverage mask of each shape
+ * are cached. The key is the content of the path, the stroke parameters and the
+ * transformation except the whole pixel part of the translation, so moved or
+ * recolored shapes are only blended again.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_image_decoder_private.h"
+#include "../lv_draw_vector_private.h"
+#include "../lv_draw_private.h"
+#include "lv_draw_sw.h"
+
+#if LV_USE_DRAW_SW && LV_USE_VECTOR_GRAPHIC
+
+#include "../../stdlib/lv_string.h"
+#include "../../misc/lv_area_private.h"
+#include "../../core/lv_global.h"
+#include "blend/lv_draw_sw_blend_private.h"
+#include <math.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*Max. distance of the flattened curves from the real ones in pixels*/
+#define FLATTEN_TOLERANCE_HIGH      0.1f
+#define FLATTEN_TOLERANCE_MEDIUM    0.25f
+#define FLATTEN_TOLERANCE_LOW       0.5f
+
+/*Limit the number of subdivisions of a curve to 2^10 segments*/
+#define SUBDIVIDE_MAX_DEPTH         10
+
+/*Number of coverage cells (floats) in a band. The band height is adjusted to the width*/
+#define BAND_CELL_CNT               4096
+
+#define CIRCLE_SEG_MIN              8
+#define CIRCLE_SEG_MAX              128
+
+#define MATH_PI                     3.14159265358979323846f
+
+#if LV_DRAW_SW_VECTOR_CACHE_SIZE > 0
+#define vector_cache                LV_GLOBAL_DEFAULT()->sw_vector_cache
+
+/*Larger shapes are cached as edges as their mask would evict too many other shapes*/
+#define CACHE_MASK_MAX_SIZE         (LV_DRAW_SW_VECTOR_CACHE_SIZE / 4)
+
+/*The cached edges are not clipped, so use a clip area which is larger than any display*/
+#define CACHE_COORD_MAX             (1 << 20)
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    uint32_t start;     /**< Index of the first point in `points`*/
+    uint32_t cnt;       /**< Number of points*/
+    bool closed;
+} contour_t;
+
+/**
+ * Flattened path: the points of all contours and the description of the contours
+ */
+typedef struct {
+    lv_array_t points;      /**< lv_fpoint_t*/
+    lv_array_t contours;    /**< contour_t*/
+} polyline_t;
+
+/**
+ * A line of a polygon in absolute coordinates with y0 < y1.
+ * `dir` is +1 or -1 depending on the original direction of the line.
+ */
+typedef struct {
+    float x0;
+    float y0;
+    float x1;
+    float y1;
+    float dir;
+} edge_t;
+
+typedef struct {
+    lv_vector_draw_style_t style;
+    lv_blend_mode_t blend_mode;
+    lv_color32_t color;
+    lv_opa_t opa;                       /**< Overall opacity including the opacity of the color*/
+    const lv_vector_gradient_t * grad;
+    lv_matrix_t inv;                    /**< Maps the absolute coordinates to the gradient's or image's space*/
+    lv_color32_t lut[256];              /**< Precalculated colors of the gradient*/
+    const lv_draw_buf_t * img;
+} paint_t;
+
+typedef struct {
+    lv_draw_task_t * t;
+    lv_area_t clip;                     /**< Drawing is limited to this area (absolute coordinates)*/
+    lv_matrix_t matrix;                 /**< Path to absolute coordinates*/
+    float tolerance;                    /**< Flattening tolerance in the path's space*/
+    float scale;                        /**< Approximate scale of the matrix*/
+    polyline_t path;
+    polyline_t dash;
+    lv_array_t edges;                   /**< edge_t*/
+    float bbox_y1;                      /**< Vertical bounding box of the edges*/
+    float bbox_y2;
+    float bbox_x1;
+    float bbox_x2;
+
+    bool flattened;                     /**< `path` is up to date*/
+
+    float * cells;
+    uint32_t cells_size;
+    lv_opa_t * mask;
+    uint32_t * colors;
+
+    uint8_t * key;                      /**< Buffer to build the key of the cache*/
+    uint32_t key_size;
+    uint32_t key_capacity;
+} native_ctx_t;
+
+#if LV_DRAW_SW_VECTOR_CACHE_SIZE > 0
+/**
+ * Fixed size part of the cache key. It's followed by the ops, points and dash pattern.
+ */
+typedef struct {
+    float m[2][2];                      /**< Scale, rotation and skew of the transformation*/
+    float tx;                           /**< Fractional part of the translation*/
+    float ty;
+    float width;                        /**< Stroke parameters, zero for fills*/
+    uint32_t op_cnt;
+    uint32_t point_cnt;
+    uint32_t dash_cnt;
+    uint16_t miter_limit;
+    uint8_t quality;
+    uint8_t stroke;
+    uint8_t fill_rule;
+    uint8_t cap;
+    uint8_t join;
+} cache_key_header_t;
+
+typedef struct {
+    lv_cache_slot_size_t slot;
+    uint32_t hash;
+    uint32_t key_size;
+    uint8_t * key;
+    lv_area_t area;                     /**< Covered area relative to the whole pixel part of the translation*/
+    lv_opa_t * mask;                    /**< Coverage of `area` or NULL if `edges` are stored*/
+    edge_t * edges;                     /**< Edges of large shapes relative to the same origin as `area`*/
+    uint32_t edge_cnt;
+    bool even_odd;
+} cache_item_t;
+#endif
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static void task_draw_cb(void * ctx, const lv_vector_path_t * path, const lv_vector_path_ctx_t * dsc);
+static void shape_draw(native_ctx_t * ctx, const lv_vector_path_t * path, const lv_vector_path_ctx_t * dsc,
+                       bool stroke, const paint_t * paint);
+static void clear_area(native_ctx_t * ctx, const lv_vector_path_ctx_t * dsc);
+static bool array_push(lv_array_t * array, const void * element);
+
+static void polyline_reset(polyline_t * pl);
+static void polyline_begin(polyline_t * pl, float x, float y);
+static void polyline_add(polyline_t * pl, float x, float y);
+static void polyline_close(polyline_t * pl);
+static void flatten_path(native_ctx_t * ctx, const lv_vector_path_t * path);
+static void path_flatten(native_ctx_t * ctx, const lv_vector_path_t * path);
+static void flatten_quad(polyline_t * pl, float x0, float y0, float x1, float y1, float x2, float y2,
+                         float tol2, int32_t depth);
+static void flatten_cubic(polyline_t * pl, float x0, float y0, float x1, float y1, float x2, float y2,
+                          float x3, float y3, float tol2, int32_t depth);
+
+static void edges_reset(native_ctx_t * ctx);
+static void edge_add(native_ctx_t * ctx, float x0, float y0, float x1, float y1);
+static void polygon_add(native_ctx_t * ctx, const lv_fpoint_t * points, uint32_t cnt, bool path_space);
+static void fill_edges_add(native_ctx_t * ctx);
+
+static void stroke_add(native_ctx_t * ctx, const lv_vector_stroke_dsc_t * dsc);
+static void stroke_contour(native_ctx_t * ctx, const lv_fpoint_t * pts, uint32_t cnt, bool closed,
+                           const lv_vector_stroke_dsc_t * dsc);
+static void dash_path(native_ctx_t * ctx, const lv_vector_stroke_dsc_t * dsc);
+static void circle_add(native_ctx_t * ctx, float cx, float cy, float r);
+
+static bool paint_init(native_ctx_t * ctx, paint_t * paint, lv_vector_draw_style_t style, lv_color32_t color,
+                       lv_opa_t opa, const lv_vector_gradient_t * grad, const lv_matrix_t * grad_matrix,
+                       lv_vector_blend_t blend_mode);
+static void paint_span(const paint_t * paint, uint32_t * dest, const lv_opa_t * mask, int32_t x, int32_t y,
+                       int32_t len);
+
+static inline bool paint_needs_colors(const paint_t * paint);
+
+static bool buffers_alloc(native_ctx_t * ctx, uint32_t cells_size);
+static void rasterize(native_ctx_t * ctx, bool even_odd, const paint_t * paint);
+static void coverage_band(native_ctx_t * ctx, const lv_area_t * area, int32_t band_y, int32_t rows, bool even_odd,
+                          lv_opa_t * mask, int32_t mask_stride, int32_t * min_x, int32_t * max_x);
+static void accumulate_edge(float * cells, int32_t stride, int32_t rows, const edge_t * e, float ox, float oy);
+
+#if LV_DRAW_SW_VECTOR_CACHE_SIZE > 0
+static bool cached_shape_draw(native_ctx_t * ctx, const lv_vector_path_t * path, const lv_vector_path_ctx_t * dsc,
+                              bool stroke, const paint_t * paint);
+static bool cache_key_build(native_ctx_t * ctx, const lv_vector_path_t * path, const lv_vector_path_ctx_t * dsc,
+                            bool stroke, float tx, float ty);
+static bool cache_key_append(native_ctx_t * ctx, const void * data, uint32_t size);
+static bool cache_item_init(native_ctx_t * ctx, const lv_vector_path_t * path, const lv_vector_path_ctx_t * dsc,
+                            bool stroke, float tx, float ty, cache_item_t * item);
+static void cache_item_draw(native_ctx_t * ctx, const cache_item_t * item, int32_t ox, int32_t oy,
+                            const paint_t * paint);
+static bool cache_create_cb(cache_item_t * item, void * user_data);
+static void cache_free_cb(cache_item_t * item, void * user_data);
+static lv_cache_compare_res_t cache_compare_cb(const cache_item_t * lhs, const cache_item_t * rhs);
+static uint32_t fnv_1a_hash(const void * src, uint32_t len);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#define TRANSFORM_X(mx, x, y) ((mx)->m[0][0] * (x) + (mx)->m[0][1] * (y) + (mx)->m[0][2])
+#define TRANSFORM_Y(mx, x, y) ((mx)->m[1][0] * (x) + (mx)->m[1][1] * (y) + (mx)->m[1][2])
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_draw_sw_vector_native(lv_draw_task_t * t, lv_draw_vector_dsc_t * dsc)
+{
+    if(dsc->task_list == NULL) return;
+
+    lv_layer_t * layer = dsc->base.layer;
+    if(layer->draw_buf == NULL) return;
+
+    LV_PROFILER_DRAW_BEGIN;
+
+    native_ctx_t ctx;
+    lv_memzero(&ctx, sizeof(ctx));
+    ctx.t = t;
+    lv_array_init(&ctx.path.points, 64, sizeof(lv_fpoint_t));
+    lv_array_init(&ctx.path.contours, 4, sizeof(contour_t));
+    lv_array_init(&ctx.dash.points, 64, sizeof(lv_fpoint_t));
+    lv_array_init(&ctx.dash.contours, 4, sizeof(contour_t));
+    lv_array_init(&ctx.edges, 64, sizeof(edge_t));
+
+    lv_vector_for_each_destroy_tasks(dsc->task_list, task_draw_cb, &ctx);
+    dsc->task_list = NULL;
+
+    lv_array_deinit(&ctx.path.points);
+    lv_array_deinit(&ctx.path.contours);
+    lv_array_deinit(&ctx.dash.points);
+    lv_array_deinit(&ctx.dash.contours);
+    lv_array_deinit(&ctx.edges);
+    lv_free(ctx.cells);
+    lv_free(ctx.mask);
+    lv_free(ctx.colors);
+    lv_free(ctx.key);
+
+    LV_PROFILER_DRAW_END;
+}
+
+void lv_draw_sw_vector_native_cache_init(void)
+{
+#if LV_DRAW_SW_VECTOR_CACHE_SIZE > 0
+    if(vector_cache) return;
+
+    const lv_cache_ops_t ops = {
+        .compare_cb = (lv_cache_compare_cb_t)cache_compare_cb,
+        .create_cb = (lv_cache_create_cb_t)cache_create_cb,
+        .free_cb = (lv_cache_free_cb_t)cache_free_cb,
+    };
+
+    vector_cache = lv_cache_create(&lv_cache_class_lru_rb_size, sizeof(cache_item_t), LV_DRAW_SW_VECTOR_CACHE_SIZE,
+                                   ops);
+    lv_cache_set_name(vector_cache, "SW_VECTOR");
+#endif
+}
+
+void lv_draw_sw_vector_native_cache_deinit(void)
+{
+#if LV_DRAW_SW_VECTOR_CACHE_SIZE > 0
+    if(vector_cache == NULL) return;
+
+    lv_cache_destroy(vector_cache, NULL);
+    vector_cache = NULL;
+#endif
+}
+
+void lv_draw_sw_vector_native_cache_drop_all(void)
+{
+#if LV_DRAW_SW_VECTOR_CACHE_SIZE > 0
+    if(vector_cache) lv_cache_drop_all(vector_cache, NULL);
+#endif
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void task_draw_cb(void * user_data, const lv_vector_path_t * path, const lv_vector_path_ctx_t * dsc)
+{
+    native_ctx_t * ctx = user_data;
+
+    if(!lv_area_intersect(&ctx->clip, &ctx->t->clip_area, &dsc->scissor_area)) return;
+
+    if(path == NULL) {
+        clear_area(ctx, dsc);
+        return;
+    }
+
+    ctx->matrix = dsc->matrix;
+    const lv_matrix_t * m = &ctx->matrix;
+    float sx = m->m[0][0] * m->m[0][0] + m->m[1][0] * m->m[1][0];
+    float sy = m->m[0][1] * m->m[0][1] + m->m[1][1] * m->m[1][1];
+    ctx->scale = sqrtf(LV_MAX(sx, sy));
+    if(ctx->scale < 1e-6f) return;
+
+    float tolerance;
+    switch(path->quality) {
+        case LV_VECTOR_PATH_QUALITY_HIGH:
+            tolerance = FLATTEN_TOLERANCE_HIGH;
+            break;
+        case LV_VECTOR_PATH_QUALITY_LOW:
+            tolerance = FLATTEN_TOLERANCE_LOW;
+            break;
+        default:
+            tolerance = FLATTEN_TOLERANCE_MEDIUM;
+            break;
+    }
+    ctx->tolerance = tolerance / ctx->scale;
+    ctx->flattened = false;
+    if(lv_array_is_empty(&path->ops)) return;
+
+    paint_t paint;
+    const lv_vector_fill_dsc_t * fill = &dsc->fill_dsc;
+    if(fill->style == LV_VECTOR_DRAW_STYLE_PATTERN) {
+        /*The image is opened here to keep it alive while the path is rasterized*/
+        lv_image_decoder_dsc_t decoder_dsc;
+        lv_image_decoder_args_t args = { 0 };
+        lv_opa_t opa = LV_OPA_MIX3(fill->opa, fill->img_dsc.opa, ctx->t->opa);
+        if(opa > LV_OPA_MIN && lv_image_decoder_open(&decoder_dsc, fill->img_dsc.src, &args) == LV_RESULT_OK) {
+            if(decoder_dsc.decoded && decoder_dsc.decoded->header.cf == LV_COLOR_FORMAT_ARGB8888) {
+                lv_matrix_t imx = dsc->matrix;
+                path_flatten(ctx, path);
+                if(fill->fill_units == LV_VECTOR_FILL_UNITS_OBJECT_BOUNDING_BOX && !lv_array_is_empty(&ctx->path.points)) {
+                    /*Convert to the bounding box of the path*/
+                    const lv_fpoint_t * pts = lv_array_front(&ctx->path.points);
+                    float min_x = pts[0].x;
+                    float min_y = pts[0].y;
+                    uint32_t i;
+                    uint32_t cnt = lv_array_size(&ctx->path.points);
+                    for(i = 1; i < cnt; i++) {
+                        min_x = LV_MIN(min_x, pts[i].x);
+                        min_y = LV_MIN(min_y, pts[i].y);
+                    }
+                    lv_matrix_translate(&imx, min_x, min_y);
+                }
+                lv_matrix_multiply(&imx, &fill->matrix);
+
+                lv_memzero(&paint, sizeof(paint));
+                paint.style = LV_VECTOR_DRAW_STYLE_PATTERN;
+                paint.blend_mode = LV_BLEND_MODE_NORMAL;
+                paint.opa = opa;
+                paint.img = decoder_dsc.decoded;
+                if(lv_matrix_inverse(&paint.inv, &imx)) {
+                    shape_draw(ctx, path, dsc, false, &paint);
+                }
+            }
+            else {
+                LV_LOG_WARN("Only ARGB8888 images are supported as pattern");
+            }
+            lv_image_decoder_close(&decoder_dsc);
+        }
+    }
+    else if(paint_init(ctx, &paint, fill->style, fill->color, fill->opa, &fill->gradient, &fill->matrix,
+                       dsc->blend_mode)) {
+        shape_draw(ctx, path, dsc, false, &paint);
+    }
+
+    const lv_vector_stroke_dsc_t * stroke = &dsc->stroke_dsc;
+    if(stroke->width > 0.0f &&
+       paint_init(ctx, &paint, stroke->style, stroke->color, stroke->opa, &stroke->gradient, &stroke->matrix,
+                  dsc->blend_mode)) {
+        shape_draw(ctx, path, dsc, true, &paint);
+    }
+}
+
+/**
+ * Rasterize the filled or stroked path with a paint
+ */
+static void shape_draw(native_ctx_t * ctx, const lv_vector_path_t * path, const lv_vector_path_ctx_t * dsc,
+                       bool stroke, const paint_t * paint)
+{
+#if LV_DRAW_SW_VECTOR_CACHE_SIZE > 0
+    if(vector_cache && cached_shape_draw(ctx, path, dsc, stroke, paint)) return;
+#endif
+
+    path_flatten(ctx, path);
+    edges_reset(ctx);
+    if(stroke) stroke_add(ctx, &dsc->stroke_dsc);
+    else fill_edges_add(ctx);
+    rasterize(ctx, !stroke && dsc->fill_dsc.fill_rule == LV_VECTOR_FILL_EVENODD, paint);
+}
+
+static void clear_area(native_ctx_t * ctx, const lv_vector_path_ctx_t * dsc)
+{
+    const lv_color32_t * c = &dsc->fill_dsc.color;
+
+    lv_draw_sw_blend_dsc_t blend_dsc;
+    lv_memzero(&blend_dsc, sizeof(blend_dsc));
+    blend_dsc.blend_area = &ctx->clip;
+    blend_dsc.color = lv_color_make(c->red, c->green, c->blue);
+    blend_dsc.opa = LV_OPA_MIX3(c->alpha, dsc->fill_dsc.opa, ctx->t->opa);
+    blend_dsc.blend_mode = LV_BLEND_MODE_NORMAL;
+    lv_draw_sw_blend(ctx->t, &blend_dsc);
+}
+
+/**
+ * Push an element and double the capacity when the array is full
+ * to avoid reallocating the array for every few elements.
+ */
+static bool array_push(lv_array_t * array, const void * element)
+{
+    if(lv_array_is_full(array)) {
+        if(!lv_array_resize(array, lv_array_capacity(array) * 2)) return false;
+    }
+    return lv_array_push_back(array, element) == LV_RESULT_OK;
+}
+
+/*---------------------
+ * Flattening
+ *--------------------*/
+
+static void polyline_reset(polyline_t * pl)
+{
+    lv_array_clear(&pl->points);
+    lv_array_clear(&pl->contours);
+}
+
+static void polyline_begin(polyline_t * pl, float x, float y)
+{
+    /*Replace the previous contour if it has only its start point*/
+    contour_t * c = lv_array_back(&pl->contours);
+    if(c && c->cnt == 1 && !c->closed) {
+        lv_fpoint_t * p = lv_array_at(&pl->points, c->start);
+        p->x = x;
+        p->y = y;
+        return;
+    }
+
+    contour_t new_c = {lv_array_size(&pl->points), 1, false};
+    lv_fpoint_t p = {x, y};
+    if(!array_push(&pl->points, &p)) return;
+    array_push(&pl->contours, &new_c);
+}
+
+static void polyline_add(polyline_t * pl, float x, float y)
+{
+    contour_t * c = lv_array_back(&pl->contours);
+    if(c == NULL) return;
+
+    /*Skip the repeated points as they have no direction*/
+    lv_fpoint_t * last = lv_array_back(&pl->points);
+    if(last->x == x && last->y == y) return;
+
+    lv_fpoint_t p = {x, y};
+    if(!array_push(&pl->points, &p)) return;
+    c->cnt++;
+}
+
+static void polyline_close(polyline_t * pl)
+{
+    contour_t * c = lv_array_back(&pl->contours);
+    if(c == NULL) return;
+
+    /*The closing line is implicit*/
+    lv_fpoint_t * first = lv_array_at(&pl->points, c->start);
+    lv_fpoint_t * last = lv_array_back(&pl->points);
+    if(c->cnt > 1 && first->x == last->x && first->y == last->y) {
+        lv_array_remove(&pl->points, lv_array_size(&pl->points) - 1);
+        c->cnt--;
+    }
+    c->closed = true;
+}
+
+static void flatten_path(native_ctx_t * ctx, const lv_vector_path_t * path)
+{
+    polyline_t * pl = &ctx->path;
+    polyline_reset(pl);
+
+    float tol2 = ctx->tolerance * ctx->tolerance;
+    const lv_vector_path_op_t * ops = lv_array_front(&path->ops);
+    const lv_fpoint_t * pts = lv_array_front(&path->points);
+    uint32_t op_cnt = lv_array_size(&path->ops);
+    uint32_t pidx = 0;
+    lv_fpoint_t cur = {0, 0};
+    lv_fpoint_t start = {0, 0};
+    bool in_contour = false;
+
+    uint32_t i;
+    for(i = 0; i < op_cnt; i++) {
+        if(ops[i] != LV_VECTOR_PATH_OP_MOVE_TO && ops[i] != LV_VECTOR_PATH_OP_CLOSE && !in_contour) {
+            /*Drawing after close continues from the start of the previous contour*/
+            polyline_begin(pl, cur.x, cur.y);
+            start = cur;
+            in_contour = true;
+        }
+
+        switch(ops[i]) {
+            case LV_VECTOR_PATH_OP_MOVE_TO:
+                cur = pts[pidx];
+                start = cur;
+                polyline_begin(pl, cur.x, cur.y);
+                in_contour = true;
+                pidx += 1;
+                break;
+            case LV_VECTOR_PATH_OP_LINE_TO:
+                cur = pts[pidx];
+                polyline_add(pl, cur.x, cur.y);
+                pidx += 1;
+                break;
+            case LV_VECTOR_PATH_OP_QUAD_TO:
+                flatten_quad(pl, cur.x, cur.y, pts[pidx].x, pts[pidx].y, pts[pidx + 1].x, pts[pidx + 1].y, tol2, 0);
+                cur = pts[pidx + 1];
+                pidx += 2;
+                break;
+            case LV_VECTOR_PATH_OP_CUBIC_TO:
+                flatten_cubic(pl, cur.x, cur.y, pts[pidx].x, pts[pidx].y, pts[pidx + 1].x, pts[pidx + 1].y,
+                              pts[pidx + 2].x, pts[pidx + 2].y, tol2, 0);
+                cur = pts[pidx + 2];
+                pidx += 3;
+                break;
+            case LV_VECTOR_PATH_OP_CLOSE:
+                if(in_contour) polyline_close(pl);
+                cur = start;
+                in_contour = false;
+                break;
+        }
+    }
+}
+
+/**
+ * Flatten the path only once for the fill and the stroke and only if it's not cached
+ */
+static void path_flatten(native_ctx_t * ctx, const lv_vector_path_t * path)
+{
+    if(ctx->flattened) return;
+
+    flatten_path(ctx, path);
+    ctx->flattened = true;
+}
+
+/**
+ * Subdivide the curve until the control point is closer to the chord than the tolerance
+ */
+static void flatten_quad(polyline_t * pl, float x0, float y0, float x1, float y1, float x2, float y2,
+                         float tol2, int32_t depth)
+{
+    float dx = x2 - x0;
+    float dy = y2 - y0;
+    float len2 = dx * dx + dy * dy;
+    bool flat;
+    if(len2 < tol2) {
+        float ex = x1 - x0;
+        float ey = y1 - y0;
+        flat = ex * ex + ey * ey <= tol2;
+    }
+    else {
+        /*Twice the distance of the control point is the max. deviation of the curve*/
+        float d = (x1 - x2) * dy - (y1 - y2) * dx;
+        flat = d * d <= 4.0f * tol2 * len2;
+    }
+
+    if(flat || depth >= SUBDIVIDE_MAX_DEPTH) {
+        polyline_add(pl, x2, y2);
+        return;
+    }
+
+    float x01 = (x0 + x1) * 0.5f;
+    float y01 = (y0 + y1) * 0.5f;
+    float x12 = (x1 + x2) * 0.5f;
+    float y12 = (y1 + y2) * 0.5f;
+    float xm = (x01 + x12) * 0.5f;
+    float ym = (y01 + y12) * 0.5f;
+
+    flatten_quad(pl, x0, y0, x01, y01, xm, ym, tol2, depth + 1);
+    flatten_quad(pl, xm, ym, x12, y12, x2, y2, tol2, depth + 1);
+}
+
+/**
+ * Subdivide the curve until the control points are closer to the chord than the tolerance
+ */
+static void flatten_cubic(polyline_t * pl, float x0, float y0, float x1, float y1, float x2, float y2,
+                          float x3, float y3, float tol2, int32_t depth)
+{
+    float dx = x3 - x0;
+    float dy = y3 - y0;
+    float len2 = dx * dx + dy * dy;
+    bool flat;
+    if(len2 < tol2) {
+        /*Closed loops: check the distance of the control points from the start point*/
+        float ax = x1 - x0;
+        float ay = y1 - y0;
+        float bx = x2 - x0;
+        float by = y2 - y0;
+        flat = ax * ax + ay * ay <= tol2 && bx * bx + by * by <= tol2;
+    }
+    else {
+        float d1 = LV_ABS((x1 - x3) * dy - (y1 - y3) * dx);
+        float d2 = LV_ABS((x2 - x3) * dy - (y2 - y3) * dx);
+        flat = (d1 + d2) * (d1 + d2) <= tol2 * len2;
+    }
+
+    if(flat || depth >= SUBDIVIDE_MAX_DEPTH) {
+        polyline_add(pl, x3, y3);
+        return;
+    }
+
+    float x01 = (x0 + x1) * 0.5f;
+    float y01 = (y0 + y1) * 0.5f;
+    float x12 = (x1 + x2) * 0.5f;
+    float y12 = (y1 + y2) * 0.5f;
+    float x23 = (x2 + x3) * 0.5f;
+    float y23 = (y2 + y3) * 0.5f;
+    float xa = (x01 + x12) * 0.5f;
+    float ya = (y01 + y12) * 0.5f;
+    float xb = (x12 + x23) * 0.5f;
+    float yb = (y12 + y23) * 0.5f;
+    float xm = (xa + xb) * 0.5f;
+    float ym = (ya + yb) * 0.5f;
+
+    flatten_cubic(pl, x0, y0, x01, y01, xa, ya, xm, ym, tol2, depth + 1);
+    flatten_cubic(pl, xm, ym, xb, yb, x23, y23, x3, y3, tol2, depth + 1);
+}
+
+/*---------------------
+ * Edges
+ *--------------------*/
+
+static void edges_reset(native_ctx_t * ctx)
+{
+    lv_array_clear(&ctx->edges);
+    ctx->bbox_x1 = (float)ctx->clip.x2 + 1;
+    ctx->bbox_x2 = (float)ctx->clip.x1;
+    ctx->bbox_y1 = (float)ctx->clip.y2 + 1;
+    ctx->bbox_y2 = (float)ctx->clip.y1;
+}
+
+/**
+ * Add a line in absolute coordinates.
+ * The parts right to the clip area are dropped as they can't change the coverage of
+ * the visible pixels and the parts left to the clip area are moved to its left edge.
+ */
+static void edge_add(native_ctx_t * ctx, float x0, float y0, float x1, float y1)
+{
+    if(y0 == y1) return;
+
+    edge_t e;
+    e.dir = 1.0f;
+    if(y0 > y1) {
+        float tmp;
+        tmp = x0;
+        x0 = x1;
+        x1 = tmp;
+        tmp = y0;
+        y0 = y1;
+        y1 = tmp;
+        e.dir = -1.0f;
+    }
+
+    float top = (float)ctx->clip.y1;
+    float bottom = (float)ctx->clip.y2 + 1;
+    if(y1 <= top || y0 >= bottom) return;
+
+    float left = (float)ctx->clip.x1;
+    float right = (float)ctx->clip.x2 + 1;
+    if(x0 > right || x1 > right) {
+        /*The area left to this edge can be covered up to the right side*/
+        ctx->bbox_x2 = right;
+        if(x0 >= right && x1 >= right) return;
+
+        /*Keep only the part left to `right`*/
+        float yr = y0 + (right - x0) * (y1 - y0) / (x1 - x0);
+        if(x0 > right) {
+            x0 = right;
+            y0 = yr;
+        }
+        else {
+            x1 = right;
+            y1 = yr;
+        }
+        if(y0 >= y1) return;
+    }
+
+    if(x0 < left || x1 < left) {
+        if(x0 <= left && x1 <= left) {
+            x0 = left;
+            x1 = left;
+        }
+        else {
+            /*Split at `left` and make the left part vertical*/
+            float yl = y0 + (left - x0) * (y1 - y0) / (x1 - x0);
+            edge_t v;
+            v.dir = e.dir;
+            v.x0 = left;
+            v.x1 = left;
+            if(x0 < left) {
+                v.y0 = y0;
+                v.y1 = yl;
+                x0 = left;
+                y0 = yl;
+            }
+            else {
+                v.y0 = yl;
+                v.y1 = y1;
+                x1 = left;
+                y1 = yl;
+            }
+            if(v.y0 < v.y1) array_push(&ctx->edges, &v);
+            if(y0 >= y1) return;
+        }
+    }
+
+    e.x0 = x0;
+    e.y0 = y0;
+    e.x1 = x1;
+    e.y1 = y1;
+    array_push(&ctx->edges, &e);
+
+    ctx->bbox_x1 = LV_MIN3(ctx->bbox_x1, x0, x1);
+    ctx->bbox_x2 = LV_MAX3(ctx->bbox_x2, x0, x1);
+    ctx->bbox_y1 = LV_MIN(ctx->bbox_y1, y0);
+    ctx->bbox_y2 = LV_MAX(ctx->bbox_y2, y1);
+}
+
+/**
+ * Add a closed polygon. If `path_space` is true the points are transformed to absolute coordinates
+ * and the polygon is turned to positive orientation so that the overlapping parts of a stroke
+ * add up instead of cancelling each other.
+ */
+static void polygon_add(native_ctx_t * ctx, const lv_fpoint_t * points, uint32_t cnt, bool path_space)
+{
+    if(cnt < 2) return;
+
+    const lv_matrix_t * m = &ctx->matrix;
+    bool reverse = false;
+    if(path_space) {
+        float area = 0;
+        uint32_t i;
+        for(i = 0; i < cnt; i++) {
+            const lv_fpoint_t * a = &points[i];
+            const lv_fpoint_t * b = &points[(i + 1) % cnt];
+            area += a->x * b->y - b->x * a->y;
+        }
+        float det = m->m[0][0] * m->m[1][1] - m->m[0][1] * m->m[1][0];
+        if(area * det == 0.0f) return;
+        reverse = area * det < 0.0f;
+    }
+
+    float px = TRANSFORM_X(m, points[cnt - 1].x, points[cnt - 1].y);
+    float py = TRANSFORM_Y(m, points[cnt - 1].x, points[cnt - 1].y);
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        float x = TRANSFORM_X(m, points[i].x, points[i].y);
+        float y = TRANSFORM_Y(m, points[i].x, points[i].y);
+        if(reverse) edge_add(ctx, x, y, px, py);
+        else edge_add(ctx, px, py, x, y);
+        px = x;
+        py = y;
+    }
+}
+
+static void fill_edges_add(native_ctx_t * ctx)
+{
+    const lv_fpoint_t * pts = lv_array_front(&ctx->path.points);
+    const contour_t * contours = lv_array_front(&ctx->path.contours);
+    uint32_t cnt = lv_array_size(&ctx->path.contours);
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        /*All contours are closed for filling*/
+        polygon_add(ctx, &pts[contours[i].start], contours[i].cnt, false);
+    }
+}
+
+/*---------------------
+ * Stroking
+ *--------------------*/
+
+static void stroke_add(native_ctx_t * ctx, const lv_vector_stroke_dsc_t * dsc)
+{
+    polyline_t * pl = &ctx->path;
+    if(!lv_array_is_empty(&dsc->dash_pattern)) {
+        dash_path(ctx, dsc);
+        pl = &ctx->dash;
+    }
+
+    const lv_fpoint_t * pts = lv_array_front(&pl->points);
+    const contour_t * contours = lv_array_front(&pl->contours);
+    uint32_t cnt = lv_array_size(&pl->contours);
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        stroke_contour(ctx, &pts[contours[i].start], contours[i].cnt, contours[i].closed, dsc);
+    }
+}
+
+static void stroke_contour(native_ctx_t * ctx, const lv_fpoint_t * pts, uint32_t cnt, bool closed,
+                           const lv_vector_stroke_dsc_t * dsc)
+{
+    float hw = dsc->width * 0.5f;
+    lv_fpoint_t poly[4];
+
+    if(cnt == 1) {
+        /*Zero length: only the caps are visible*/
+        if(dsc->cap == LV_VECTOR_STROKE_CAP_ROUND) {
+            circle_add(ctx, pts[0].x, pts[0].y, hw);
+        }
+        else if(dsc->cap == LV_VECTOR_STROKE_CAP_SQUARE) {
+            poly[0] = (lv_fpoint_t) {
+                pts[0].x - hw, pts[0].y - hw
+            };
+            poly[1] = (lv_fpoint_t) {
+                pts[0].x + hw, pts[0].y - hw
+            };
+            poly[2] = (lv_fpoint_t) {
+                pts[0].x + hw, pts[0].y + hw
+            };
+            poly[3] = (lv_fpoint_t) {
+                pts[0].x - hw, pts[0].y + hw
+            };
+            polygon_add(ctx, poly, 4, true);
+        }
+        return;
+    }
+
+    if(closed && cnt == 2) closed = false;
+    uint32_t seg_cnt = closed ? cnt : cnt - 1;
+    float prev_dx = 0;
+    float prev_dy = 0;
+    float first_dx = 0;
+    float first_dy = 0;
+
+    uint32_t i;
+    for(i = 0; i < seg_cnt; i++) {
+        const lv_fpoint_t * a = &pts[i];
+        const lv_fpoint_t * b = &pts[(i + 1) % cnt];
+        float dx = b->x - a->x;
+        float dy = b->y - a->y;
+        float len = sqrtf(dx * dx + dy * dy);
+        dx /= len;
+        dy /= len;
+        float nx = -dy * hw;
+        float ny = dx * hw;
+
+        poly[0] = (lv_fpoint_t) {
+            a->x + nx, a->y + ny
+        };
+        poly[1] = (lv_fpoint_t) {
+            b->x + nx, b->y + ny
+        };
+        poly[2] = (lv_fpoint_t) {
+            b->x - nx, b->y - ny
+        };
+        poly[3] = (lv_fpoint_t) {
+            a->x - nx, a->y - ny
+        };
+        polygon_add(ctx, poly, 4, true);
+
+        if(i == 0) {
+            first_dx = dx;
+            first_dy = dy;
+        }
+        else {
+            /*Join with the previous segment at `a`*/
+            float cross = prev_dx * dy - prev_dy * dx;
+            float dot = prev_dx * dx + prev_dy * dy;
+            if(LV_ABS(cross) > 1e-6f || dot < 0.0f) {
+                if(dsc->join == LV_VECTOR_STROKE_JOIN_ROUND) {
+                    circle_add(ctx, a->x, a->y, hw);
+                }
+                else {
+                    /*The outer side of the turn*/
+                    float s = cross > 0.0f ? -1.0f : 1.0f;
+                    float n0x = -prev_dy * hw * s;
+                    float n0y = prev_dx * hw * s;
+                    float n1x = nx * s;
+                    float n1y = ny * s;
+                    poly[0] = *a;
+                    poly[1] = (lv_fpoint_t) {
+                        a->x + n0x, a->y + n0y
+                    };
+                    uint32_t poly_cnt = 3;
+                    /*The ratio of the miter length and the stroke width is 1 / cos(turn angle / 2)*/
+                    float cos2 = (1.0f + dot) * 0.5f;
+                    if(dsc->join == LV_VECTOR_STROKE_JOIN_MITER && cos2 > 1e-6f &&
+                       1.0f / cos2 <= (float)dsc->miter_limit * dsc->miter_limit) {
+                        float k = 1.0f / (1.0f + dot);
+                        poly[2] = (lv_fpoint_t) {
+                            a->x + (n0x + n1x) * k, a->y + (n0y + n1y) * k
+                        };
+                        poly_cnt = 4;
+                    }
+                    poly[poly_cnt - 1] = (lv_fpoint_t) {
+                        a->x + n1x, a->y + n1y
+                    };
+                    polygon_add(ctx, poly, poly_cnt, true);
+                }
+            }
+        }
+        prev_dx = dx;
+        prev_dy = dy;
+    }
+
+    if(closed) {
+        /*Join the last and the first segments. Reuse the code above by stroking a 2 segment polyline*/
+        lv_fpoint_t join_pts[3] = {pts[cnt - 1], pts[0], pts[1]};
+        lv_vector_stroke_dsc_t join_dsc = *dsc;
+        join_dsc.cap = LV_VECTOR_STROKE_CAP_BUTT;
+        stroke_contour(ctx, join_pts, 3, false, &join_dsc);
+        return;
+    }
+
+    if(dsc->cap == LV_VECTOR_STROKE_CAP_BUTT) return;
+
+    /*Caps at the start and at the end pointing outward*/
+    const lv_fpoint_t * ends[2] = {&pts[0], &pts[cnt - 1]};
+    float dirs[2][2] = {{-first_dx, -first_dy}, {prev_dx, prev_dy}};
+    for(i = 0; i < 2; i++) {
+        const lv_fpoint_t * p = ends[i];
+        if(dsc->cap == LV_VECTOR_STROKE_CAP_ROUND) {
+            circle_add(ctx, p->x, p->y, hw);
+        }
+        else {
+            float dx = dirs[i][0] * hw;
+            float dy = dirs[i][1] * hw;
+            poly[0] = (lv_fpoint_t) {
+                p->x - dy, p->y + dx
+            };
+            poly[1] = (lv_fpoint_t) {
+                p->x - dy + dx, p->y + dx + dy
+            };
+            poly[2] = (lv_fpoint_t) {
+                p->x + dy + dx, p->y - dx + dy
+            };
+            poly[3] = (lv_fpoint_t) {
+                p->x + dy, p->y - dx
+            };
+            polygon_add(ctx, poly, 4, true);
+        }
+    }
+}
+
+/**
+ * Split the contours of the path to dashes in `ctx->dash`
+ */
+static void dash_path(native_ctx_t * ctx, const lv_vector_stroke_dsc_t * dsc)
+{
+    polyline_t * out = &ctx->dash;
+    polyline_reset(out);
+
+    const float * pattern = lv_array_front(&dsc->dash_pattern);
+    uint32_t pattern_cnt = lv_array_size(&dsc->dash_pattern);
+    float total = 0;
+    uint32_t i;
+    for(i = 0; i < pattern_cnt; i++) {
+        if(pattern[i] < 0.0f) return;
+        total += pattern[i];
+    }
+    /*Odd number of values are repeated to get an even number*/
+    if(pattern_cnt & 1) total *= 2;
+    if(total <= 0.0f) return;
+
+    const lv_fpoint_t * pts = lv_array_front(&ctx->path.points);
+    const contour_t * contours = lv_array_front(&ctx->path.contours);
+    uint32_t contour_cnt = lv_array_size(&ctx->path.contours);
+    uint32_t period = (pattern_cnt & 1) ? pattern_cnt * 2 : pattern_cnt;
+
+    uint32_t c;
+    for(c = 0; c < contour_cnt; c++) {
+        const lv_fpoint_t * cpts = &pts[contours[c].start];
+        uint32_t cnt = contours[c].cnt;
+        uint32_t seg_cnt = contours[c].closed ? cnt : cnt - 1;
+
+        /*Each contour starts with the first dash*/
+        uint32_t idx = 0;
+        float remaining = pattern[0];
+        bool on = true;
+        polyline_begin(out, cpts[0].x, cpts[0].y);
+
+        for(i = 0; i < seg_cnt; i++) {
+            const lv_fpoint_t * a = &cpts[i];
+            const lv_fpoint_t * b = &cpts[(i + 1) % cnt];
+            float dx = b->x - a->x;
+            float dy = b->y - a->y;
+            float len = sqrtf(dx * dx + dy * dy);
+            float pos = 0;
+            while(len - pos > remaining) {
+                pos += remaining;
+                float x = a->x + dx * (pos / len);
+                float y = a->y + dy * (pos / len);
+                if(on) polyline_add(out, x, y);
+                else polyline_begin(out, x, y);
+                on = !on;
+                idx = (idx + 1) % period;
+                remaining = pattern[idx % pattern_cnt];
+            }
+            remaining -= len - pos;
+            if(on) polyline_add(out, b->x, b->y);
+        }
+
+        /*Drop the started but empty dash*/
+        if(!on) {
+            contour_t * last = lv_array_back(&out->contours);
+            if(last && last->cnt == 1) {
+                lv_array_remove(&out->points, last->start);
+                lv_array_remove(&out->contours, lv_array_size(&out->contours) - 1);
+            }
+        }
+    }
+}
+
+static void circle_add(native_ctx_t * ctx, float cx, float cy, float r)
+{
+    lv_fpoint_t poly[CIRCLE_SEG_MAX];
+
+    /*Choose the number of segments to keep the error below the tolerance*/
+    float r_abs = r * ctx->scale;
+    float tol = ctx->tolerance * ctx->scale;
+    int32_t seg_cnt = CIRCLE_SEG_MIN;
+    if(r_abs > tol) {
+        float a = acosf(1.0f - tol / r_abs);
+        if(a > 0.0f) seg_cnt = (int32_t)ceilf(MATH_PI / a);
+    }
+    seg_cnt = LV_CLAMP(CIRCLE_SEG_MIN, seg_cnt, CIRCLE_SEG_MAX);
+
+    /*Rotate a vector to avoid calculating sin and cos for all points*/
+    float step = 2.0f * MATH_PI / (float)seg_cnt;
+    float cs = cosf(step);
+    float sn = sinf(step);
+    float x = r;
+    float y = 0;
+    int32_t i;
+    for(i = 0; i < seg_cnt; i++) {
+        poly[i].x = cx + x;
+        poly[i].y = cy + y;
+        float nx = x * cs - y * sn;
+        y = x * sn + y * cs;
+        x = nx;
+    }
+    polygon_add(ctx, poly, seg_cnt, true);
+}
+
+/*---------------------
+ * Paint
+ *--------------------*/
+
+static bool paint_init(native_ctx_t * ctx, paint_t * paint, lv_vector_draw_style_t style, lv_color32_t color,
+                       lv_opa_t opa, const lv_vector_gradient_t * grad, const lv_matrix_t * grad_matrix,
+                       lv_vector_blend_t blend_mode)
+{
+    paint->style = style;
+    paint->grad = NULL;
+    paint->img = NULL;
+
+    switch(blend_mode) {
+        case LV_VECTOR_BLEND_ADDITIVE:
+            paint->blend_mode = LV_BLEND_MODE_ADDITIVE;
+            break;
+        case LV_VECTOR_BLEND_SUBTRACTIVE:
+            paint->blend_mode = LV_BLEND_MODE_SUBTRACTIVE;
+            break;
+        case LV_VECTOR_BLEND_MULTIPLY:
+            paint->blend_mode = LV_BLEND_MODE_MULTIPLY;
+            break;
+        default:
+            paint->blend_mode = LV_BLEND_MODE_NORMAL;
+            break;
+    }
+
+    if(style == LV_VECTOR_DRAW_STYLE_SOLID) {
+        paint->color = color;
+        paint->opa = LV_OPA_MIX3(color.alpha, opa, ctx->t->opa);
+        return paint->opa > LV_OPA_MIN;
+    }
+
+    if(style != LV_VECTOR_DRAW_STYLE_GRADIENT || grad->stops_count == 0) return false;
+
+    paint->opa = LV_OPA_MIX2(opa, ctx->t->opa);
+    if(paint->opa <= LV_OPA_MIN) return false;
+
+    /*The gradient is defined in the path's space transformed by its own matrix*/
+    lv_matrix_t m = ctx->matrix;
+    lv_matrix_multiply(&m, grad_matrix);
+    if(!lv_matrix_inverse(&paint->inv, &m)) return false;
+    paint->grad = grad;
+
+    const lv_grad_stop_t * stops = grad->stops;
+    uint32_t stop_cnt = grad->stops_count;
+    uint32_t s = 0;
+    uint32_t i;
+    for(i = 0; i < 256; i++) {
+        while(s < stop_cnt && stops[s].frac < i) s++;
+        lv_color32_t * c = &paint->lut[i];
+        if(s == 0 || s == stop_cnt) {
+            const lv_grad_stop_t * stop = &stops[s == 0 ? 0 : stop_cnt - 1];
+            *c = lv_color_to_32(stop->color, stop->opa);
+        }
+        else {
+            const lv_grad_stop_t * s0 = &stops[s - 1];
+            const lv_grad_stop_t * s1 = &stops[s];
+            int32_t range = s1->frac - s0->frac;
+            lv_opa_t mix = range ? (lv_opa_t)(((i - s0->frac) * 255) / range) : 255;
+            lv_color_t mixed = lv_color_mix(s1->color, s0->color, mix);
+            *c = lv_color_to_32(mixed, (lv_opa_t)LV_UDIV255(s1->opa * mix + s0->opa * (255 - mix)));
+        }
+    }
+
+    return true;
+}
+
+static inline float grad_spread(float v, lv_vector_gradient_spread_t spread)
+{
+    switch(spread) {
+        case LV_VECTOR_GRADIENT_SPREAD_REPEAT:
+            return v - floorf(v);
+        case LV_VECTOR_GRADIENT_SPREAD_REFLECT:
+            v = LV_ABS(v);
+            v = v - 2.0f * floorf(v * 0.5f);
+            return v > 1.0f ? 2.0f - v : v;
+        default:
+            return LV_CLAMP(0.0f, v, 1.0f);
+    }
+}
+
+/**
+ * Render the paint as ARGB8888 pixels for the non-transparent pixels of the mask
+ */
+static void paint_span(const paint_t * paint, uint32_t * dest, const lv_opa_t * mask, int32_t x, int32_t y,
+                       int32_t len)
+{
+    const lv_matrix_t * inv = &paint->inv;
+    /*Map the center of the pixels*/
+    float px = (float)x + 0.5f;
+    float py = (float)y + 0.5f;
+    float gx = TRANSFORM_X(inv, px, py);
+    float gy = TRANSFORM_Y(inv, px, py);
+    float gdx = inv->m[0][0];
+    float gdy = inv->m[1][0];
+    int32_t i;
+
+    if(paint->style == LV_VECTOR_DRAW_STYLE_SOLID) {
+        uint32_t c = *((const uint32_t *)&paint->color) | 0xff000000;
+        for(i = 0; i < len; i++) dest[i] = c;
+    }
+    else if(paint->style == LV_VECTOR_DRAW_STYLE_PATTERN) {
+        const lv_draw_buf_t * img = paint->img;
+        int32_t w = img->header.w;
+        int32_t h = img->header.h;
+        for(i = 0; i < len; i++) {
+            if(mask[i] == 0) continue;
+            float fx = gx + gdx * (float)i;
+            float fy = gy + gdy * (float)i;
+            int32_t ix = (int32_t)floorf(fx);
+            int32_t iy = (int32_t)floorf(fy);
+            if(ix < 0 || iy < 0 || ix >= w || iy >= h) dest[i] = 0;
+            else dest[i] = *(const uint32_t *)(img->data + iy * img->header.stride + ix * 4);
+        }
+    }
+    else {
+        const lv_vector_gradient_t * grad = paint->grad;
+        const uint32_t * lut = (const uint32_t *)paint->lut;
+        if(grad->style == LV_VECTOR_GRADIENT_STYLE_RADIAL) {
+            float inv_r = grad->cr > 0.0f ? 1.0f / grad->cr : 0.0f;
+            gx -= grad->cx;
+            gy -= grad->cy;
+            for(i = 0; i < len; i++) {
+                if(mask[i] == 0) continue;
+                float fx = gx + gdx * (float)i;
+                float fy = gy + gdy * (float)i;
+                float v = grad_spread(sqrtf(fx * fx + fy * fy) * inv_r, grad->spread);
+                dest[i] = lut[(int32_t)(v * 255.0f + 0.5f)];
+            }
+        }
+        else {
+            /*The position along the gradient changes linearly*/
+            float vx = grad->x2 - grad->x1;
+            float vy = grad->y2 - grad->y1;
+            float len2 = vx * vx + vy * vy;
+            if(len2 > 0.0f) {
+                vx /= len2;
+                vy /= len2;
+            }
+            float v = (gx - grad->x1) * vx + (gy - grad->y1) * vy;
+            float dv = gdx * vx + gdy * vy;
+            for(i = 0; i < len; i++) {
+                if(mask[i] == 0) continue;
+                float sv = grad_spread(v + dv * (float)i, grad->spread);
+                dest[i] = lut[(int32_t)(sv * 255.0f + 0.5f)];
+            }
+        }
+    }
+}
+
+/*---------------------
+ * Rasterization
+ *--------------------*/
+
+static inline bool paint_needs_colors(const paint_t * paint)
+{
+    /*Solid colors with normal blending are blended as color fill, the rest as image*/
+    return paint->style != LV_VECTOR_DRAW_STYLE_SOLID || paint->blend_mode != LV_BLEND_MODE_NORMAL;
+}
+
+/**
+ * Make sure that the coverage cells, the mask and the color buffers have at least `cells_size` elements
+ */
+static bool buffers_alloc(native_ctx_t * ctx, uint32_t cells_size)
+{
+    if(cells_size <= ctx->cells_size) return true;
+
+    lv_free(ctx->cells);
+    lv_free(ctx->mask);
+    lv_free(ctx->colors);
+    ctx->cells = lv_zalloc(cells_size * sizeof(float));
+    ctx->mask = lv_malloc(cells_size);
+    ctx->colors = lv_malloc(cells_size * sizeof(uint32_t));
+    if(ctx->cells == NULL || ctx->mask == NULL || ctx->colors == NULL) {
+        LV_LOG_WARN("Couldn't allocate the rasterizer's buffers");
+        lv_free(ctx->cells);
+        lv_free(ctx->mask);
+        lv_free(ctx->colors);
+        ctx->cells = NULL;
+        ctx->mask = NULL;
+        ctx->colors = NULL;
+        ctx->cells_size = 0;
+        return false;
+    }
+    ctx->cells_size = cells_size;
+    return true;
+}
+
+static void rasterize(native_ctx_t * ctx, bool even_odd, const paint_t * paint)
+{
+    if(lv_array_is_empty(&ctx->edges)) return;
+
+    lv_area_t area;
+    area.x1 = LV_MAX(ctx->clip.x1, (int32_t)floorf(ctx->bbox_x1));
+    area.x2 = LV_MIN(ctx->clip.x2, (int32_t)ceilf(ctx->bbox_x2));
+    area.y1 = LV_MAX(ctx->clip.y1, (int32_t)floorf(ctx->bbox_y1));
+    area.y2 = LV_MIN(ctx->clip.y2, (int32_t)ceilf(ctx->bbox_y2) - 1);
+    if(area.x1 > area.x2 || area.y1 > area.y2) return;
+
+    /*Allocate the buffers for the widest band. Two extra cells take the coverage right to the area*/
+    int32_t w = lv_area_get_width(&area);
+    int32_t stride = w + 2;
+    int32_t band_h = LV_CLAMP(1, BAND_CELL_CNT / stride, lv_area_get_height(&area));
+    if(!buffers_alloc(ctx, (uint32_t)(stride * band_h))) return;
+
+    bool use_colors = paint_needs_colors(paint);
+
+    lv_draw_sw_blend_dsc_t blend_dsc;
+    lv_memzero(&blend_dsc, sizeof(blend_dsc));
+    blend_dsc.opa = paint->opa;
+    blend_dsc.color = lv_color_make(paint->color.red, paint->color.green, paint->color.blue);
+    blend_dsc.blend_mode = paint->blend_mode;
+    blend_dsc.mask_buf = ctx->mask;
+    blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
+    blend_dsc.mask_stride = w;
+    if(use_colors) {
+        blend_dsc.src_buf = ctx->colors;
+        blend_dsc.src_stride = w * 4;
+        blend_dsc.src_color_format = LV_COLOR_FORMAT_ARGB8888;
+    }
+
+    int32_t band_y;
+    for(band_y = area.y1; band_y <= area.y2; band_y += band_h) {
+        int32_t rows = LV_MIN(band_h, area.y2 - band_y + 1);
+        int32_t min_x;
+        int32_t max_x;
+        coverage_band(ctx, &area, band_y, rows, even_odd, ctx->mask, w, &min_x, &max_x);
+        if(max_x < min_x) continue;
+
+        lv_area_t band_area = {area.x1, band_y, area.x2, band_y + rows - 1};
+        lv_area_t blend_area = {area.x1 + min_x, band_y, area.x1 + max_x, band_y + rows - 1};
+
+        if(use_colors) {
+            int32_t r;
+            for(r = 0; r < rows; r++) {
+                paint_span(paint, &ctx->colors[r * w + min_x], &ctx->mask[r * w + min_x],
+                           area.x1 + min_x, band_y + r, max_x - min_x + 1);
+            }
+            blend_dsc.src_area = &band_area;
+        }
+
+        blend_dsc.blend_area = &blend_area;
+        blend_dsc.mask_area = &band_area;
+        lv_draw_sw_blend(ctx->t, &blend_dsc);
+    }
+}
+
+/**
+ * Calculate the coverage of some rows of an area from the edges.
+ * `ctx->cells` needs to have `(width of area + 2) * rows` elements.
+ * @param ctx           the rasterizer's context with the edges
+ * @param area          the area to rasterize (absolute coordinates)
+ * @param band_y        y coordinate of the first row of the band
+ * @param rows          number of rows in the band
+ * @param even_odd      true: use the even-odd fill rule; false: non-zero
+ * @param mask          store the coverage of the first row here
+ * @param mask_stride   distance between the rows in `mask`
+ * @param min_x         store the first column with non-zero coverage here (relative to the area)
+ * @param max_x         store the last column with non-zero coverage here (relative to the area)
+ */
+static void coverage_band(native_ctx_t * ctx, const lv_area_t * area, int32_t band_y, int32_t rows, bool even_odd,
+                          lv_opa_t * mask, int32_t mask_stride, int32_t * min_x, int32_t * max_x)
+{
+    const edge_t * edges = lv_array_front(&ctx->edges);
+    uint32_t edge_cnt = lv_array_size(&ctx->edges);
+    float * cells = ctx->cells;
+    int32_t w = lv_area_get_width(area);
+    int32_t stride = w + 2;
+    float band_top = (float)band_y;
+    float band_bottom = (float)(band_y + rows);
+
+    uint32_t e;
+    for(e = 0; e < edge_cnt; e++) {
+        if(edges[e].y1 <= band_top || edges[e].y0 >= band_bottom) continue;
+        accumulate_edge(cells, stride, rows, &edges[e], (float)area->x1, band_top);
+    }
+
+    /*Sum the cells to get the coverage and clear them for the next band*/
+    int32_t band_min_x = w;
+    int32_t band_max_x = -1;
+    int32_t r;
+    for(r = 0; r < rows; r++) {
+        float * row_cells = &cells[r * stride];
+        lv_opa_t * row_mask = &mask[r * mask_stride];
+        float acc = 0;
+        int32_t x;
+        for(x = 0; x < w; x++) {
+            acc += row_cells[x];
+            row_cells[x] = 0;
+            float a = acc < 0.0f ? -acc : acc;
+            if(even_odd) {
+                a = a - 2.0f * floorf(a * 0.5f);
+                if(a > 1.0f) a = 2.0f - a;
+            }
+            else if(a > 1.0f) a = 1.0f;
+
+            lv_opa_t v = (lv_opa_t)(a * 255.0f + 0.5f);
+            row_mask[x] = v;
+            if(v) {
+                if(x < band_min_x) band_min_x = x;
+                if(x > band_max_x) band_max_x = x;
+            }
+        }
+        row_cells[w] = 0;
+        row_cells[w + 1] = 0;
+    }
+
+    *min_x = band_min_x;
+    *max_x = band_max_x;
+}
+
+/**
+ * Add the signed area covered by an edge to the cells of a band.
+ * Summing the cells from left to right gives the coverage of each pixel.
+ * @param cells     the cells of the band
+ * @param stride    number of cells in a row
+ * @param rows      number of rows in the band
+ * @param e         the edge in absolute coordinates
+ * @param ox        x coordinate of the first cell
+ * @param oy        y coordinate of the first row
+ */
+static void accumulate_edge(float * cells, int32_t stride, int32_t rows, const edge_t * e, float ox, float oy)
+{
+    float x0 = e->x0 - ox;
+    float y0 = e->y0 - oy;
+    float x1 = e->x1 - ox;
+    float y1 = e->y1 - oy;
+    float max_x = (float)(stride - 2);
+    float dxdy = (x1 - x0) / (y1 - y0);
+
+    float x = x0;
+    if(y0 < 0.0f) {
+        x -= y0 * dxdy;
+        y0 = 0.0f;
+    }
+    if(y1 > (float)rows) y1 = (float)rows;
+
+    int32_t y_end = (int32_t)ceilf(y1);
+    int32_t y;
+    for(y = (int32_t)y0; y < y_end; y++) {
+        float * row = &cells[y * stride];
+        float dy = LV_MIN((float)(y + 1), y1) - LV_MAX((float)y, y0);
+        float x_next = x + dxdy * dy;
+        float d = dy * e->dir;
+        float xa = LV_CLAMP(0.0f, LV_MIN(x, x_next), max_x);
+        float xb = LV_CLAMP(0.0f, LV_MAX(x, x_next), max_x);
+        float xa_floor = floorf(xa);
+        int32_t xa_i = (int32_t)xa_floor;
+        float xb_ceil = ceilf(xb);
+        int32_t xb_i = (int32_t)xb_ceil;
+
+        if(xb_i <= xa_i + 1) {
+            /*Inside one pixel: split by the average x position*/
+            float xm = 0.5f * (xa + xb) - xa_floor;
+            row[xa_i] += d - d * xm;
+            row[xa_i + 1] += d * xm;
+        }
+        else {
+            /*Spans more pixels: trapezoids in the middle and triangles at the ends*/
+            float s = 1.0f / (xb - xa);
+            float xa_f = xa - xa_floor;
+            float a0 = 0.5f * s * (1.0f - xa_f) * (1.0f - xa_f);
+            float xb_f = xb - xb_ceil + 1.0f;
+            float am = 0.5f * s * xb_f * xb_f;
+            row[xa_i] += d * a0;
+            if(xb_i == xa_i + 2) {
+                row[xa_i + 1] += d * (1.0f - a0 - am);
+            }
+            else {
+                float a1 = s * (1.5f - xa_f);
+                row[xa_i + 1] += d * (a1 - a0);
+                int32_t xi;
+                for(xi = xa_i + 2; xi < xb_i - 1; xi++) {
+                    row[xi] += d * s;
+                }
+                float a2 = a1 + (float)(xb_i - xa_i - 3) * s;
+                row[xb_i - 1] += d * (1.0f - a2 - am);
+            }
+            row[xb_i] += d * am;
+        }
+        x = x_next;
+    }
+}
+
+#if LV_DRAW_SW_VECTOR_CACHE_SIZE > 0
+
+/*---------------------
+ * Cache
+ *--------------------*/
+
+/**
+ * Draw a shape from the cache. On a cache miss the shape is rasterized and added to the cache.
+ * @return false if the shape couldn't be cached and it should be drawn normally
+ */
+static bool cached_shape_draw(native_ctx_t * ctx, const lv_vector_path_t * path, const lv_vector_path_ctx_t * dsc,
+                              bool stroke, const paint_t * paint)
+{
+    /*Moving by whole pixels doesn't change the coverage, only the fractional part is the part of the key*/
+    float tx = floorf(ctx->matrix.m[0][2]);
+    float ty = floorf(ctx->matrix.m[1][2]);
+    if(LV_ABS(tx) > CACHE_COORD_MAX || LV_ABS(ty) > CACHE_COORD_MAX) return false;
+    if(!cache_key_build(ctx, path, dsc, stroke, ctx->matrix.m[0][2] - tx, ctx->matrix.m[1][2] - ty)) return false;
+
+    cache_item_t item;
+    lv_memzero(&item, sizeof(item));
+    item.key = ctx->key;
+    item.key_size = ctx->key_size;
+    item.hash = fnv_1a_hash(ctx->key, ctx->key_size);
+
+    lv_cache_entry_t * entry = lv_cache_acquire(vector_cache, &item, NULL);
+    if(entry == NULL) {
+        if(!cache_item_init(ctx, path, dsc, stroke, tx, ty, &item)) return false;
+
+        /*Don't let a single shape evict most of the others*/
+        if(item.slot.size <= LV_DRAW_SW_VECTOR_CACHE_SIZE / 2) {
+            /*Returns the existing entry if an other draw unit has added the same shape meanwhile*/
+            entry = lv_cache_acquire_or_create(vector_cache, &item, NULL);
+        }
+
+        if(entry == NULL) {
+            cache_item_draw(ctx, &item, (int32_t)tx, (int32_t)ty, paint);
+            cache_free_cb(&item, NULL);
+            return true;
+        }
+
+        const cache_item_t * cached = lv_cache_entry_get_data(entry);
+        if(cached->key != item.key) cache_free_cb(&item, NULL);
+    }
+
+    cache_item_draw(ctx, lv_cache_entry_get_data(entry), (int32_t)tx, (int32_t)ty, paint);
+    lv_cache_release(vector_cache, entry, NULL);
+    return true;
+}
+
+/**
+ * Serialize everything which affects the coverage of a shape into `ctx->key`
+ */
+static bool cache_key_build(native_ctx_t * ctx, const lv_vector_path_t * path, const lv_vector_path_ctx_t * dsc,
+                            bool stroke, float tx, float ty)
+{
+    const lv_vector_stroke_dsc_t * stroke_dsc = &dsc->stroke_dsc;
+
+    cache_key_header_t header;
+    lv_memzero(&header, sizeof(header));
+    header.m[0][0] = ctx->matrix.m[0][0];
+    header.m[0][1] = ctx->matrix.m[0][1];
+    header.m[1][0] = ctx->matrix.m[1][0];
+    header.m[1][1] = ctx->matrix.m[1][1];
+    header.tx = tx;
+    header.ty = ty;
+    header.op_cnt = lv_array_size(&path->ops);
+    header.point_cnt = lv_array_size(&path->points);
+    header.quality = (uint8_t)path->quality;
+    header.stroke = stroke;
+    if(stroke) {
+        header.width = stroke_dsc->width;
+        header.dash_cnt = lv_array_size(&stroke_dsc->dash_pattern);
+        header.miter_limit = stroke_dsc->miter_limit;
+        header.cap = (uint8_t)stroke_dsc->cap;
+        header.join = (uint8_t)stroke_dsc->join;
+    }
+    else {
+        header.fill_rule = (uint8_t)dsc->fill_dsc.fill_rule;
+    }
+
+    ctx->key_size = 0;
+    return cache_key_append(ctx, &header, sizeof(header)) &&
+           cache_key_append(ctx, lv_array_front(&path->ops), header.op_cnt * sizeof(lv_vector_path_op_t)) &&
+           cache_key_append(ctx, lv_array_front(&path->points), header.point_cnt * sizeof(lv_fpoint_t)) &&
+           cache_key_append(ctx, lv_array_front(&stroke_dsc->dash_pattern), header.dash_cnt * sizeof(float));
+}
+
+static bool cache_key_append(native_ctx_t * ctx, const void * data, uint32_t size)
+{
+    if(size == 0) return true;
+
+    if(ctx->key_size + size > ctx->key_capacity) {
+        uint32_t capacity = LV_MAX(ctx->key_capacity * 2, ctx->key_size + size);
+        uint8_t * key = lv_realloc(ctx->key, capacity);
+        if(key == NULL) return false;
+        ctx->key = key;
+        ctx->key_capacity = capacity;
+    }
+
+    lv_memcpy(ctx->key + ctx->key_size, data, size);
+    ctx->key_size += size;
+    return true;
+}
+
+/**
+ * Rasterize a shape for the cache without clipping and at the fractional part of the translation.
+ * Small shapes are stored as coverage mask, large ones as edges.
+ * @param tx        the whole pixel part of the translation (removed from the matrix)
+ * @param ty        the whole pixel part of the translation (removed from the matrix)
+ * @param item      initialized with the search key, the rest of the fields are filled here
+ * @return          false on memory allocation error
+ */
+static bool cache_item_init(native_ctx_t * ctx, const lv_vector_path_t * path, const lv_vector_path_ctx_t * dsc,
+                            bool stroke, float tx, float ty, cache_item_t * item)
+{
+    path_flatten(ctx, path);
+
+    lv_matrix_t matrix = ctx->matrix;
+    lv_area_t clip = ctx->clip;
+    ctx->matrix.m[0][2] -= tx;
+    ctx->matrix.m[1][2] -= ty;
+    lv_area_set(&ctx->clip, -CACHE_COORD_MAX, -CACHE_COORD_MAX, CACHE_COORD_MAX, CACHE_COORD_MAX);
+    edges_reset(ctx);
+    if(stroke) stroke_add(ctx, &dsc->stroke_dsc);
+    else fill_edges_add(ctx);
+    ctx->matrix = matrix;
+    ctx->clip = clip;
+
+    item->even_odd = !stroke && dsc->fill_dsc.fill_rule == LV_VECTOR_FILL_EVENODD;
+    lv_area_set(&item->area, 0, 0, -1, -1);
+
+    uint32_t edge_cnt = lv_array_size(&ctx->edges);
+    uint32_t mask_size = 0;
+    if(edge_cnt) {
+        item->area.x1 = (int32_t)floorf(ctx->bbox_x1);
+        item->area.x2 = (int32_t)ceilf(ctx->bbox_x2);
+        item->area.y1 = (int32_t)floorf(ctx->bbox_y1);
+        item->area.y2 = (int32_t)ceilf(ctx->bbox_y2) - 1;
+        mask_size = lv_area_get_size(&item->area);
+    }
+
+    uint8_t * key = lv_malloc(item->key_size);
+    if(key == NULL) return false;
+    lv_memcpy(key, item->key, item->key_size);
+    item->key = key;
+
+    if(edge_cnt && mask_size <= CACHE_MASK_MAX_SIZE) {
+        int32_t w = lv_area_get_width(&item->area);
+        int32_t h = lv_area_get_height(&item->area);
+        int32_t stride = w + 2;
+        int32_t band_h = LV_CLAMP(1, BAND_CELL_CNT / stride, h);
+        item->mask = lv_malloc(mask_size);
+        if(item->mask == NULL || !buffers_alloc(ctx, (uint32_t)(stride * band_h))) {
+            cache_free_cb(item, NULL);
+            return false;
+        }
+
+        int32_t band_y;
+        for(band_y = item->area.y1; band_y <= item->area.y2; band_y += band_h) {
+            int32_t rows = LV_MIN(band_h, item->area.y2 - band_y + 1);
+            int32_t min_x;
+            int32_t max_x;
+            coverage_band(ctx, &item->area, band_y, rows, item->even_odd,
+                          &item->mask[(band_y - item->area.y1) * w], w, &min_x, &max_x);
+        }
+    }
+    else if(edge_cnt) {
+        mask_size = 0;
+        item->edges = lv_malloc(edge_cnt * sizeof(edge_t));
+        if(item->edges == NULL) {
+            cache_free_cb(item, NULL);
+            return false;
+        }
+        lv_memcpy(item->edges, lv_array_front(&ctx->edges), edge_cnt * sizeof(edge_t));
+        item->edge_cnt = edge_cnt;
+    }
+
+    item->slot.size = sizeof(cache_item_t) + item->key_size + mask_size + item->edge_cnt * sizeof(edge_t);
+    return true;
+}
+
+/**
+ * Draw a cached shape moved by whole pixels
+ */
+static void cache_item_draw(native_ctx_t * ctx, const cache_item_t * item, int32_t ox, int32_t oy,
+                            const paint_t * paint)
+{
+    if(item->edges) {
+        /*Add the edges again to clip them*/
+        edges_reset(ctx);
+        float fx = (float)ox;
+        float fy = (float)oy;
+        uint32_t i;
+        for(i = 0; i < item->edge_cnt; i++) {
+            const edge_t * e = &item->edges[i];
+            if(e->dir > 0.0f) edge_add(ctx, e->x0 + fx, e->y0 + fy, e->x1 + fx, e->y1 + fy);
+            else edge_add(ctx, e->x1 + fx, e->y1 + fy, e->x0 + fx, e->y0 + fy);
+        }
+        rasterize(ctx, item->even_odd, paint);
+        return;
+    }
+
+    if(item->mask == NULL) return;
+
+    lv_area_t mask_area = item->area;
+    lv_area_move(&mask_area, ox, oy);
+    lv_area_t area;
+    if(!lv_area_intersect(&area, &mask_area, &ctx->clip)) return;
+
+    int32_t mask_w = lv_area_get_width(&mask_area);
+
+    lv_draw_sw_blend_dsc_t blend_dsc;
+    lv_memzero(&blend_dsc, sizeof(blend_dsc));
+    blend_dsc.opa = paint->opa;
+    blend_dsc.color = lv_color_make(paint->color.red, paint->color.green, paint->color.blue);
+    blend_dsc.blend_mode = paint->blend_mode;
+    blend_dsc.mask_buf = item->mask;
+    blend_dsc.mask_res = LV_DRAW_SW_MASK_RES_CHANGED;
+    blend_dsc.mask_area = &mask_area;
+    blend_dsc.mask_stride = mask_w;
+
+    if(!paint_needs_colors(paint)) {
+        blend_dsc.blend_area = &area;
+        lv_draw_sw_blend(ctx->t, &blend_dsc);
+        return;
+    }
+
+    /*Render the paint in bands*/
+    int32_t w = lv_area_get_width(&area);
+    int32_t band_h = LV_CLAMP(1, BAND_CELL_CNT / w, lv_area_get_height(&area));
+    if(!buffers_alloc(ctx, (uint32_t)(w * band_h))) return;
+
+    blend_dsc.src_buf = ctx->colors;
+    blend_dsc.src_stride = w * 4;
+    blend_dsc.src_color_format = LV_COLOR_FORMAT_ARGB8888;
+
+    int32_t band_y;
+    for(band_y = area.y1; band_y <= area.y2; band_y += band_h) {
+        int32_t rows = LV_MIN(band_h, area.y2 - band_y + 1);
+        int32_t r;
+        for(r = 0; r < rows; r++) {
+            const lv_opa_t * mask = &item->mask[(band_y + r - mask_area.y1) * mask_w + area.x1 - mask_area.x1];
+            paint_span(paint, &ctx->colors[r * w], mask, area.x1, band_y + r, w);
+        }
+
+        lv_area_t band_area = {area.x1, band_y, area.x2, band_y + rows - 1};
+        blend_dsc.blend_area = &band_area;
+        blend_dsc.src_area = &band_area;
+        lv_draw_sw_blend(ctx->t, &blend_dsc);
+    }
+}
+
+static bool cache_create_cb(cache_item_t * item, void * user_data)
+{
+    /*The data is created before adding the item to be able to set its size*/
+    LV_UNUSED(item);
+    LV_UNUSED(user_data);
+    return true;
+}
+
+static void cache_free_cb(cache_item_t * item, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_free(item->key);
+    lv_free(item->mask);
+    lv_free(item->edges);
+    item->key = NULL;
+    item->mask = NULL;
+    item->edges = NULL;
+    item->edge_cnt = 0;
+}
+
+static lv_cache_compare_res_t cache_compare_cb(const cache_item_t * lhs, const cache_item_t * rhs)
+{
+    if(lhs->hash != rhs->hash) {
+        return lhs->hash > rhs->hash ? 1 : -1;
+    }
+
+    if(lhs->key_size != rhs->key_size) {
+        return lhs->key_size > rhs->key_size ? 1 : -1;
+    }
+
+    int cmp_res = lv_memcmp(lhs->key, rhs->key, lhs->key_size);
+    if(cmp_res != 0) {
+        return cmp_res > 0 ? 1 : -1;
+    }
+
+    return 0;
+}
+
+static uint32_t fnv_1a_hash(const void * src, uint32_t len)
+{
+    const uint8_t * data = src;
+    uint32_t hash = 2166136261u;
+    uint32_t i;
+    for(i = 0; i < len; i++) {
+        hash ^= data[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+#endif /*LV_DRAW_SW_VECTOR_CACHE_SIZE > 0*/
+
+#endif /*LV_USE_DRAW_SW && LV_USE_VECTOR_GRAPHIC*/
@@ -13,6 +13,21 @@
 #include "../stdlib/lv_string.h"
 #include "lv_binfont_loader.h"
 
+/*********************
+ *      DEFINES
+ *********************/
+#define MAPPED_MAGIC            "LVFM"
+#define MAPPED_VERSION          1
+#define MAPPED_ALIGN            4       /*Alignment of all tables in the mapped format*/
+#define MAPPED_GLYPH_DSC_SMALL  8       /*Size of a glyph descriptor if `LV_FONT_FMT_TXT_LARGE == 0`*/
+#define MAPPED_GLYPH_DSC_LARGE  16      /*Size of a glyph descriptor if `LV_FONT_FMT_TXT_LARGE == 1`*/
+
+#if LV_FONT_FMT_TXT_LARGE == 0
+    #define MAPPED_GLYPH_DSC_SIZE   MAPPED_GLYPH_DSC_SMALL
+#else
+    #define MAPPED_GLYPH_DSC_SIZE   MAPPED_GLYPH_DSC_LARGE
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -59,12 +74,95 @@ typedef struct cmap_table_bin {
     uint8_t padding;
 } cmap_table_bin_t;
 
+/** Data of the loaded font which is not stored in `lv_font_fmt_txt_dsc_t`*/
+typedef struct {
+    uint32_t glyph_cnt;     /**< Length of `glyph_dsc` and the kern class mappings*/
+    uint32_t bitmap_size;   /**< Size of `glyph_bitmap` in bytes*/
+} binfont_info_t;
+
+/*
+ * The mapped format is used directly from the memory, so all its tables are aligned to `MAPPED_ALIGN`
+ * and are stored in the same format as in `lv_font_fmt_txt_dsc_t`. The offsets are measured from the
+ * beginning of the file and 0 means the table doesn't exist.
+ */
+typedef struct {
+    char magic[4];
+    uint16_t version;
+    uint16_t glyph_dsc_size;    /**< `MAPPED_GLYPH_DSC_SMALL` or `MAPPED_GLYPH_DSC_LARGE`*/
+    uint32_t file_size;
+    int16_t line_height;
+    int16_t base_line;
+    int8_t underline_position;
+    int8_t underline_thickness;
+    uint8_t subpx;
+    uint8_t bpp;
+    uint8_t bitmap_format;
+    uint8_t stride;
+    uint8_t kern_classes;
+    uint8_t reserved;
+    uint16_t kern_scale;
+    uint16_t cmap_num;
+    uint32_t glyph_cnt;
+    uint32_t glyph_dsc_ofs;
+    uint32_t glyph_bitmap_ofs;
+    uint32_t glyph_bitmap_size;
+    uint32_t cmaps_ofs;         /**< `cmap_num` times `mapped_cmap_t`*/
+    uint32_t kern_ofs;          /**< `mapped_kern_t`*/
+} mapped_header_t;
+
+typedef struct {
+    uint32_t range_start;
+    uint16_t range_length;
+    uint16_t glyph_id_start;
+    uint16_t list_length;
+    uint8_t type;
+    uint8_t reserved;
+    uint32_t unicode_list_ofs;
+    uint32_t glyph_id_ofs_list_ofs;
+} mapped_cmap_t;
+
+typedef struct {
+    uint32_t pair_cnt;                  /**< Only for kern pairs*/
+    uint8_t glyph_ids_size;             /**< Only for kern pairs*/
+    uint8_t left_class_cnt;             /**< Only for kern classes*/
+    uint8_t right_class_cnt;            /**< Only for kern classes*/
+    uint8_t reserved;
+    uint32_t values_ofs;                /**< `values` or `class_pair_values`*/
+    uint32_t glyph_ids_ofs;             /**< Only for kern pairs*/
+    uint32_t left_class_mapping_ofs;    /**< Only for kern classes*/
+    uint32_t right_class_mapping_ofs;   /**< Only for kern classes*/
+} mapped_kern_t;
+
+/*
+ * A font created from a mapped file. Only the descriptors are allocated (in one block)
+ * and they point into the file. `cmaps` and, if the glyph descriptors of the file can't
+ * be used directly, a copy of `glyph_dsc` follow this struct in the same block.
+ */
+typedef struct {
+    lv_font_t font;
+    lv_font_fmt_txt_dsc_t font_dsc;
+    union {
+        lv_font_fmt_txt_kern_pair_t pairs;
+        lv_font_fmt_txt_kern_classes_t classes;
+    } kern;
+} binfont_mapped_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static bit_iterator_t init_bit_iterator(lv_fs_file_t * fp);
-static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font);
-int32_t load_kern(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, uint8_t format, uint32_t start);
+static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font, binfont_info_t * info);
+static lv_font_t * load_font_file(const char * path, binfont_info_t * info);
+static uint32_t write_mapped(const lv_font_t * font, const binfont_info_t * info, uint8_t * out);
+static void write_glyph_dsc(uint8_t * out, const lv_font_fmt_txt_glyph_dsc_t * gdsc);
+static bool read_glyph_dsc(const uint8_t * in, uint32_t dsc_size, lv_font_fmt_txt_glyph_dsc_t * gdsc);
+static bool glyph_dsc_layout_matches(uint32_t dsc_size);
+static bool mapped_range_is_valid(uint32_t file_size, uint32_t ofs, uint32_t size);
+static bool mapped_cmap_is_valid(const uint8_t * map, uint32_t file_size, const mapped_cmap_t * mc, uint32_t glyph_cnt);
+static bool mapped_glyph_dsc_is_valid(const uint8_t * in, uint32_t dsc_size, uint32_t bitmap_size);
+static void mapped_release_glyph(const lv_font_t * font, lv_font_glyph_dsc_t * g_dsc);
+int32_t load_kern(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, uint8_t format, uint32_t start,
+                  uint32_t glyph_cnt);
 
 static int read_bits_signed(bit_iterator_t * it, int n_bits, lv_fs_res_t * res);
 static unsigned int read_bits(bit_iterator_t * it, int n_bits, lv_fs_res_t * res);
@@ -97,27 +195,8 @@ lv_font_t * lv_binfont_create(const char * path)
 {
     LV_ASSERT_NULL(path);
 
-    lv_fs_file_t file;
-    lv_fs_res_t fs_res = lv_fs_open(&file, path, LV_FS_MODE_RD);
-    if(fs_res != LV_FS_RES_OK) return NULL;
-
-    lv_font_t * font = lv_malloc_zeroed(sizeof(lv_font_t));
-    LV_ASSERT_MALLOC(font);
-
-    if(!lvgl_load_font(&file, font)) {
-        LV_LOG_WARN("Error loading font file: %s", path);
-        /*
-        * When `lvgl_load_font` fails it can leak some pointers.
-        * All non-null pointers can be assumed as allocated and
-        * `lv_binfont_destroy` should free them correctly.
-        */
-        lv_binfont_destroy(font);
-        font = NULL;
-    }
-
-    lv_fs_close(&file);
-
-    return font;
+    binfont_info_t info;
+    return load_font_file(path, &info);
 }
 
 #if LV_USE_FS_MEMFS
@@ -130,6 +209,188 @@ lv_font_t * lv_binfont_create_from_buffer(void * buffer, uint32_t size)
 }
 #endif
 
+lv_font_t * lv_binfont_create_from_mapped(const void * data, uint32_t size)
+{
+    LV_ASSERT_NULL(data);
+
+    const uint8_t * map = data;
+    const mapped_header_t * header = data;
+
+    if((lv_uintptr_t)map % MAPPED_ALIGN != 0) {
+        LV_LOG_WARN("The font data has to be aligned to %d bytes", MAPPED_ALIGN);
+        return NULL;
+    }
+
+    if(size < sizeof(mapped_header_t) || lv_memcmp(header->magic, MAPPED_MAGIC, 4) != 0 ||
+       header->version != MAPPED_VERSION) {
+        LV_LOG_WARN("Not a mapped binary font");
+        return NULL;
+    }
+
+    uint32_t file_size = header->file_size;
+    uint32_t glyph_cnt = header->glyph_cnt;
+    uint32_t dsc_size = header->glyph_dsc_size;
+    if(file_size > size ||
+       (dsc_size != MAPPED_GLYPH_DSC_SMALL && dsc_size != MAPPED_GLYPH_DSC_LARGE) ||
+       glyph_cnt > UINT32_MAX / dsc_size ||
+       !mapped_range_is_valid(file_size, header->glyph_dsc_ofs, glyph_cnt * dsc_size) ||
+       !mapped_range_is_valid(file_size, header->glyph_bitmap_ofs, header->glyph_bitmap_size) ||
+       !mapped_range_is_valid(file_size, header->cmaps_ofs, header->cmap_num * sizeof(mapped_cmap_t))) {
+        LV_LOG_WARN("Invalid mapped binary font");
+        return NULL;
+    }
+
+    const mapped_cmap_t * mapped_cmaps = (const mapped_cmap_t *)(map + header->cmaps_ofs);
+    uint32_t i;
+    for(i = 0; i < header->cmap_num; i++) {
+        if(!mapped_cmap_is_valid(map, file_size, &mapped_cmaps[i], glyph_cnt)) {
+            LV_LOG_WARN("Invalid cmap in mapped binary font");
+            return NULL;
+        }
+    }
+
+    for(i = 0; i < glyph_cnt; i++) {
+        if(!mapped_glyph_dsc_is_valid(map + header->glyph_dsc_ofs + i * dsc_size, dsc_size, header->glyph_bitmap_size)) {
+            LV_LOG_WARN("Invalid glyph in mapped binary font");
+            return NULL;
+        }
+    }
+
+    const mapped_kern_t * mapped_kern = NULL;
+    if(header->kern_ofs) {
+        if(!mapped_range_is_valid(file_size, header->kern_ofs, sizeof(mapped_kern_t))) {
+            LV_LOG_WARN("Invalid kerning in mapped binary font");
+            return NULL;
+        }
+
+        mapped_kern = (const mapped_kern_t *)(map + header->kern_ofs);
+        bool valid;
+        if(header->kern_classes) {
+            valid = mapped_range_is_valid(file_size, mapped_kern->values_ofs,
+                                          mapped_kern->left_class_cnt * mapped_kern->right_class_cnt) &&
+                    mapped_range_is_valid(file_size, mapped_kern->left_class_mapping_ofs, glyph_cnt) &&
+                    mapped_range_is_valid(file_size, mapped_kern->right_class_mapping_ofs, glyph_cnt);
+        }
+        else {
+            uint32_t id_size = mapped_kern->glyph_ids_size == 0 ? sizeof(uint8_t) : sizeof(uint16_t);
+            valid = mapped_kern->glyph_ids_size <= 1 &&
+                    mapped_kern->pair_cnt <= UINT32_MAX / (2 * sizeof(uint16_t)) &&
+                    mapped_range_is_valid(file_size, mapped_kern->values_ofs, mapped_kern->pair_cnt) &&
+                    mapped_range_is_valid(file_size, mapped_kern->glyph_ids_ofs, mapped_kern->pair_cnt * 2 * id_size);
+        }
+
+        if(!valid) {
+            LV_LOG_WARN("Invalid kerning in mapped binary font");
+            return NULL;
+        }
+    }
+
+    /*The layout of the glyph descriptors depends on `LV_FONT_FMT_TXT_LARGE` and the compiler.
+     *If it's different in the file the descriptors are copied*/
+    bool copy_glyph_dsc = !glyph_dsc_layout_matches(dsc_size);
+
+    size_t cmaps_size = header->cmap_num * sizeof(lv_font_fmt_txt_cmap_t);
+    size_t block_size = sizeof(binfont_mapped_t) + cmaps_size;
+    if(copy_glyph_dsc) block_size += glyph_cnt * sizeof(lv_font_fmt_txt_glyph_dsc_t);
+
+    binfont_mapped_t * mapped = lv_malloc_zeroed(block_size);
+    LV_ASSERT_MALLOC(mapped);
+    if(mapped == NULL) return NULL;
+
+    lv_font_fmt_txt_cmap_t * cmaps = (lv_font_fmt_txt_cmap_t *)(mapped + 1);
+    for(i = 0; i < header->cmap_num; i++) {
+        const mapped_cmap_t * mc = &mapped_cmaps[i];
+        cmaps[i].range_start = mc->range_start;
+        cmaps[i].range_length = mc->range_length;
+        cmaps[i].glyph_id_start = mc->glyph_id_start;
+        cmaps[i].list_length = mc->list_length;
+        cmaps[i].type = (lv_font_fmt_txt_cmap_type_t)mc->type;
+        if(mc->unicode_list_ofs) cmaps[i].unicode_list = (const uint16_t *)(map + mc->unicode_list_ofs);
+        if(mc->glyph_id_ofs_list_ofs) cmaps[i].glyph_id_ofs_list = map + mc->glyph_id_ofs_list_ofs;
+    }
+
+    lv_font_fmt_txt_dsc_t * font_dsc = &mapped->font_dsc;
+    if(copy_glyph_dsc) {
+        lv_font_fmt_txt_glyph_dsc_t * glyph_dsc = (lv_font_fmt_txt_glyph_dsc_t *)((uint8_t *)cmaps + cmaps_size);
+        const uint8_t * in = map + header->glyph_dsc_ofs;
+        for(i = 0; i < glyph_cnt; i++) {
+            if(!read_glyph_dsc(in + i * dsc_size, dsc_size, &glyph_dsc[i])) {
+                LV_LOG_WARN("The glyphs of the mapped binary font require LV_FONT_FMT_TXT_LARGE");
+                lv_free(mapped);
+                return NULL;
+            }
+        }
+        font_dsc->glyph_dsc = glyph_dsc;
+    }
+    else {
+        font_dsc->glyph_dsc = (const lv_font_fmt_txt_glyph_dsc_t *)(map + header->glyph_dsc_ofs);
+    }
+
+    if(mapped_kern && header->kern_classes) {
+        lv_font_fmt_txt_kern_classes_t * kern_classes = &mapped->kern.classes;
+        kern_classes->class_pair_values = (const int8_t *)(map + mapped_kern->values_ofs);
+        kern_classes->left_class_mapping = map + mapped_kern->left_class_mapping_ofs;
+        kern_classes->right_class_mapping = map + mapped_kern->right_class_mapping_ofs;
+        kern_classes->left_class_cnt = mapped_kern->left_class_cnt;
+        kern_classes->right_class_cnt = mapped_kern->right_class_cnt;
+        font_dsc->kern_dsc = kern_classes;
+    }
+    else if(mapped_kern) {
+        lv_font_fmt_txt_kern_pair_t * kern_pairs = &mapped->kern.pairs;
+        kern_pairs->glyph_ids = map + mapped_kern->glyph_ids_ofs;
+        kern_pairs->values = (const int8_t *)(map + mapped_kern->values_ofs);
+        kern_pairs->pair_cnt = mapped_kern->pair_cnt;
+        kern_pairs->glyph_ids_size = mapped_kern->glyph_ids_size;
+        font_dsc->kern_dsc = kern_pairs;
+    }
+
+    font_dsc->glyph_bitmap = map + header->glyph_bitmap_ofs;
+    font_dsc->cmaps = cmaps;
+    font_dsc->kern_scale = header->kern_scale;
+    font_dsc->cmap_num = header->cmap_num;
+    font_dsc->bpp = header->bpp;
+    font_dsc->kern_classes = header->kern_classes;
+    font_dsc->bitmap_format = header->bitmap_format;
+    font_dsc->stride = header->stride;
+
+    lv_font_t * font = &mapped->font;
+    font->get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt;
+    font->get_glyph_bitmap = lv_font_get_bitmap_fmt_txt;
+    font->release_glyph = mapped_release_glyph;     /*Also marks the font as mapped for `lv_binfont_destroy`*/
+    font->line_height = header->line_height;
+    font->base_line = header->base_line;
+    font->subpx = header->subpx;
+    font->underline_position = header->underline_position;
+    font->underline_thickness = header->underline_thickness;
+    font->dsc = font_dsc;
+
+    return font;
+}
+
+uint8_t * lv_binfont_convert_to_mapped(const char * path, uint32_t * size)
+{
+    LV_ASSERT_NULL(path);
+    LV_ASSERT_NULL(size);
+
+    *size = 0;
+
+    binfont_info_t info;
+    lv_font_t * font = load_font_file(path, &info);
+    if(font == NULL) return NULL;
+
+    uint32_t mapped_size = write_mapped(font, &info, NULL);
+    uint8_t * mapped = lv_malloc_zeroed(mapped_size);
+    LV_ASSERT_MALLOC(mapped);
+    if(mapped) {
+        write_mapped(font, &info, mapped);
+        *size = mapped_size;
+    }
+
+    lv_binfont_destroy(font);
+
+    return mapped;
+}
+
 void lv_binfont_destroy(lv_font_t * font)
 {
     if(font == NULL) return;
@@ -137,6 +398,12 @@ void lv_binfont_destroy(lv_font_t * font)
     const lv_font_fmt_txt_dsc_t * dsc = font->dsc;
     if(dsc == NULL) return;
 
+    /*Fonts created from mapped files are allocated in one block*/
+    if(font->release_glyph == mapped_release_glyph) {
+        lv_free(font);
+        return;
+    }
+
     if(dsc->kern_classes == 0) {
         const lv_font_fmt_txt_kern_pair_t * kern_dsc = dsc->kern_dsc;
         if(NULL != kern_dsc) {
@@ -328,7 +595,8 @@ static int32_t load_cmaps(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, u
 }
 
 static int32_t load_glyph(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
-                          uint32_t start, uint32_t * glyph_offset, uint32_t loca_count, font_header_bin_t * header)
+                          uint32_t start, uint32_t * glyph_offset, uint32_t loca_count, font_header_bin_t * header,
+                          uint32_t * bitmap_size)
 {
     int32_t glyph_length = read_label(fp, start, "glyf");
     if(glyph_length < 0) {
@@ -410,6 +678,7 @@ static int32_t load_glyph(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
     LV_ASSERT_MALLOC(glyph_bmp);
 
     font_dsc->glyph_bitmap = glyph_bmp;
+    *bitmap_size = cur_bmp_size;
 
     cur_bmp_size = 0;
 
@@ -473,7 +742,7 @@ static int32_t load_glyph(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc,
  * `lv_binfont_destroy` will assume that all non-null pointers are allocated and
  * should be freed.
  */
-static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font)
+static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font, binfont_info_t * info)
 {
     lv_font_fmt_txt_dsc_t * font_dsc = (lv_font_fmt_txt_dsc_t *)
                                        lv_malloc(sizeof(lv_font_fmt_txt_dsc_t));
@@ -524,6 +793,8 @@ static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font)
         return false;
     }
 
+    info->glyph_cnt = loca_count;
+
     bool failed = false;
     uint32_t * glyph_offset = lv_malloc(sizeof(uint32_t) * (loca_count + 1));
 
@@ -555,7 +826,7 @@ static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font)
     /*glyph*/
     uint32_t glyph_start = loca_start + loca_length;
     int32_t glyph_length = load_glyph(
-                               fp, font_dsc, glyph_start, glyph_offset, loca_count, &font_header);
+                               fp, font_dsc, glyph_start, glyph_offset, loca_count, &font_header, &info->bitmap_size);
 
     lv_free(glyph_offset);
 
@@ -573,12 +844,13 @@ static bool lvgl_load_font(lv_fs_file_t * fp, lv_font_t * font)
 
     uint32_t kern_start = glyph_start + glyph_length;
 
-    int32_t kern_length = load_kern(fp, font_dsc, font_header.glyph_id_format, kern_start);
+    int32_t kern_length = load_kern(fp, font_dsc, font_header.glyph_id_format, kern_start, loca_count);
 
     return kern_length >= 0;
 }
 
-int32_t load_kern(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, uint8_t format, uint32_t start)
+int32_t load_kern(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, uint8_t format, uint32_t start,
+                  uint32_t glyph_cnt)
 {
     int32_t kern_length = read_label(fp, start, "kern");
     if(kern_length < 0) {
@@ -628,6 +900,16 @@ int32_t load_kern(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, uint8_t f
         if(lv_fs_read(fp, values, glyph_entries, NULL) != LV_FS_RES_OK) {
             return -1;
         }
+
+        /*Binary searching the pairs is slow for long texts, so use classes if possible*/
+        lv_font_fmt_txt_kern_classes_t * kern_classes = lv_font_fmt_txt_kern_pairs_to_classes(kern_pair, glyph_cnt);
+        if(kern_classes) {
+            lv_free(glyph_ids);
+            lv_free(values);
+            lv_free(kern_pair);
+            font_dsc->kern_dsc = kern_classes;
+            font_dsc->kern_classes = 1;
+        }
     }
     else if(3 == kern_format_type) { /*array M*N of classes*/
 
@@ -650,8 +932,10 @@ int32_t load_kern(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, uint8_t f
 
         int kern_values_length = sizeof(int8_t) * kern_table_rows * kern_table_cols;
 
-        uint8_t * kern_left = lv_malloc(kern_class_mapping_length);
-        uint8_t * kern_right = lv_malloc(kern_class_mapping_length);
+        /*The mappings are indexed by glyph ids so make sure all glyphs are mapped*/
+        uint32_t mapping_size = LV_MAX(kern_class_mapping_length, glyph_cnt);
+        uint8_t * kern_left = lv_malloc_zeroed(mapping_size);
+        uint8_t * kern_right = lv_malloc_zeroed(mapping_size);
         int8_t * kern_values = lv_malloc(kern_values_length);
 
         kern_classes->left_class_mapping  = kern_left;
@@ -674,6 +958,345 @@ int32_t load_kern(lv_fs_file_t * fp, lv_font_fmt_txt_dsc_t * font_dsc, uint8_t f
     return kern_length;
 }
 
+static lv_font_t * load_font_file(const char * path, binfont_info_t * info)
+{
+    lv_fs_file_t file;
+    lv_fs_res_t fs_res = lv_fs_open(&file, path, LV_FS_MODE_RD);
+    if(fs_res != LV_FS_RES_OK) return NULL;
+
+    lv_font_t * font = lv_malloc_zeroed(sizeof(lv_font_t));
+    LV_ASSERT_MALLOC(font);
+
+    lv_memzero(info, sizeof(binfont_info_t));
+    if(!lvgl_load_font(&file, font, info)) {
+        LV_LOG_WARN("Error loading font file: %s", path);
+        /*
+        * When `lvgl_load_font` fails it can leak some pointers.
+        * All non-null pointers can be assumed as allocated and
+        * `lv_binfont_destroy` should free them correctly.
+        */
+        lv_binfont_destroy(font);
+        font = NULL;
+    }
+
+    lv_fs_close(&file);
+
+    return font;
+}
+
+/**
+ * Copy a table to the mapped format
+ * @param out       the mapped font or NULL to only calculate the size
+ * @param pos       the end of the last table. Updated to the end of this table.
+ * @param data      the table to copy
+ * @param size      size of the table in bytes
+ * @return          offset of the table
+ */
+static uint32_t write_mapped_table(uint8_t * out, uint32_t * pos, const void * data, uint32_t size)
+{
+    uint32_t ofs = LV_ALIGN_UP(*pos, MAPPED_ALIGN);
+    if(out && size) lv_memcpy(out + ofs, data, size);
+    *pos = ofs + size;
+    return ofs;
+}
+
+/**
+ * Convert a loaded binary font to the mapped format
+ * @param font      the font to convert
+ * @param info      the font's data not stored in the font
+ * @param out       buffer to write the mapped font or NULL to only calculate the size
+ * @return          size of the mapped font in bytes
+ */
+static uint32_t write_mapped(const lv_font_t * font, const binfont_info_t * info, uint8_t * out)
+{
+    const lv_font_fmt_txt_dsc_t * font_dsc = font->dsc;
+    mapped_header_t header;
+    lv_memzero(&header, sizeof(header));
+
+    uint32_t pos = sizeof(mapped_header_t);
+    uint32_t i;
+
+    header.glyph_dsc_ofs = write_mapped_table(NULL, &pos, NULL, info->glyph_cnt * MAPPED_GLYPH_DSC_SIZE);
+    if(out) {
+        for(i = 0; i < info->glyph_cnt; i++) {
+            write_glyph_dsc(out + header.glyph_dsc_ofs + i * MAPPED_GLYPH_DSC_SIZE, &font_dsc->glyph_dsc[i]);
+        }
+    }
+
+    header.cmaps_ofs = write_mapped_table(NULL, &pos, NULL, font_dsc->cmap_num * sizeof(mapped_cmap_t));
+    for(i = 0; i < font_dsc->cmap_num; i++) {
+        const lv_font_fmt_txt_cmap_t * cmap = &font_dsc->cmaps[i];
+        mapped_cmap_t mc;
+        lv_memzero(&mc, sizeof(mc));
+        mc.range_start = cmap->range_start;
+        mc.range_length = cmap->range_length;
+        mc.glyph_id_start = cmap->glyph_id_start;
+        mc.list_length = cmap->list_length;
+        mc.type = (uint8_t)cmap->type;
+
+        if(cmap->unicode_list) {
+            mc.unicode_list_ofs = write_mapped_table(out, &pos, cmap->unicode_list,
+                                                     cmap->list_length * sizeof(uint16_t));
+        }
+
+        if(cmap->glyph_id_ofs_list) {
+            uint32_t id_size = cmap->type == LV_FONT_FMT_TXT_CMAP_SPARSE_FULL ? sizeof(uint16_t) : sizeof(uint8_t);
+            mc.glyph_id_ofs_list_ofs = write_mapped_table(out, &pos, cmap->glyph_id_ofs_list,
+                                                          cmap->list_length * id_size);
+        }
+
+        if(out) lv_memcpy(out + header.cmaps_ofs + i * sizeof(mapped_cmap_t), &mc, sizeof(mc));
+    }
+
+    if(font_dsc->kern_dsc) {
+        mapped_kern_t mk;
+        lv_memzero(&mk, sizeof(mk));
+        header.kern_ofs = write_mapped_table(NULL, &pos, NULL, sizeof(mapped_kern_t));
+
+        if(font_dsc->kern_classes) {
+            const lv_font_fmt_txt_kern_classes_t * kern_classes = font_dsc->kern_dsc;
+            mk.left_class_cnt = kern_classes->left_class_cnt;
+            mk.right_class_cnt = kern_classes->right_class_cnt;
+            mk.values_ofs = write_mapped_table(out, &pos, kern_classes->class_pair_values,
+                                               kern_classes->left_class_cnt * kern_classes->right_class_cnt);
+            mk.left_class_mapping_ofs = write_mapped_table(out, &pos, kern_classes->left_class_mapping, info->glyph_cnt);
+            mk.right_class_mapping_ofs = write_mapped_table(out, &pos, kern_classes->right_class_mapping,
+                                                            info->glyph_cnt);
+        }
+        else {
+            const lv_font_fmt_txt_kern_pair_t * kern_pairs = font_dsc->kern_dsc;
+            uint32_t id_size = kern_pairs->glyph_ids_size == 0 ? sizeof(uint8_t) : sizeof(uint16_t);
+            mk.pair_cnt = kern_pairs->pair_cnt;
+            mk.glyph_ids_size = kern_pairs->glyph_ids_size;
+            mk.values_ofs = write_mapped_table(out, &pos, kern_pairs->values, kern_pairs->pair_cnt);
+            mk.glyph_ids_ofs = write_mapped_table(out, &pos, kern_pairs->glyph_ids, kern_pairs->pair_cnt * 2 * id_size);
+        }
+
+        if(out) lv_memcpy(out + header.kern_ofs, &mk, sizeof(mk));
+    }
+
+    /*The bitmaps are the largest so put them to the end*/
+    header.glyph_bitmap_ofs = write_mapped_table(out, &pos, font_dsc->glyph_bitmap, info->bitmap_size);
+    header.glyph_bitmap_size = info->bitmap_size;
+
+    pos = LV_ALIGN_UP(pos, MAPPED_ALIGN);
+
+    lv_memcpy(header.magic, MAPPED_MAGIC, 4);
+    header.version = MAPPED_VERSION;
+    header.glyph_dsc_size = MAPPED_GLYPH_DSC_SIZE;
+    header.file_size = pos;
+    header.line_height = (int16_t)font->line_height;
+    header.base_line = (int16_t)font->base_line;
+    header.underline_position = font->underline_position;
+    header.underline_thickness = font->underline_thickness;
+    header.subpx = font->subpx;
+    header.bpp = font_dsc->bpp;
+    header.bitmap_format = font_dsc->bitmap_format;
+    header.stride = font_dsc->stride;
+    header.kern_classes = font_dsc->kern_classes;
+    header.kern_scale = font_dsc->kern_scale;
+    header.cmap_num = font_dsc->cmap_num;
+    header.glyph_cnt = info->glyph_cnt;
+
+    if(out) lv_memcpy(out, &header, sizeof(header));
+
+    return pos;
+}
+
+/**
+ * Write a glyph descriptor in the format of the mapped font of the current `LV_FONT_FMT_TXT_LARGE` setting
+ * @param out       buffer with `MAPPED_GLYPH_DSC_SIZE` bytes
+ * @param gdsc      the glyph descriptor to write
+ */
+static void write_glyph_dsc(uint8_t * out, const lv_font_fmt_txt_glyph_dsc_t * gdsc)
+{
+#if LV_FONT_FMT_TXT_LARGE == 0
+    uint32_t index_and_adv = (uint32_t)gdsc->bitmap_index | ((uint32_t)gdsc->adv_w << 20);
+    lv_memcpy(out, &index_and_adv, 4);
+    out[4] = gdsc->box_w;
+    out[5] = gdsc->box_h;
+    out[6] = (uint8_t)gdsc->ofs_x;
+    out[7] = (uint8_t)gdsc->ofs_y;
+#else
+    uint32_t index = gdsc->bitmap_index;
+    uint32_t adv_w = gdsc->adv_w;
+    uint16_t box[2] = {gdsc->box_w, gdsc->box_h};
+    int16_t ofs[2] = {gdsc->ofs_x, gdsc->ofs_y};
+    lv_memcpy(out, &index, 4);
+    lv_memcpy(out + 4, &adv_w, 4);
+    lv_memcpy(out + 8, box, 4);
+    lv_memcpy(out + 12, ofs, 4);
+#endif
+}
+
+/**
+ * Read a glyph descriptor of a mapped font
+ * @param in        the glyph descriptor in the mapped font
+ * @param dsc_size  `MAPPED_GLYPH_DSC_SMALL` or `MAPPED_GLYPH_DSC_LARGE`
+ * @param gdsc      store the result here
+ * @return          false: the values don't fit into `lv_font_fmt_txt_glyph_dsc_t`
+ */
+static bool read_glyph_dsc(const uint8_t * in, uint32_t dsc_size, lv_font_fmt_txt_glyph_dsc_t * gdsc)
+{
+    uint32_t index;
+    uint32_t adv_w;
+    int32_t box_w;
+    int32_t box_h;
+    int32_t ofs_x;
+    int32_t ofs_y;
+
+    if(dsc_size == MAPPED_GLYPH_DSC_SMALL) {
+        uint32_t index_and_adv;
+        lv_memcpy(&index_and_adv, in, 4);
+        index = index_and_adv & 0xFFFFF;
+        adv_w = index_and_adv >> 20;
+        box_w = in[4];
+        box_h = in[5];
+        ofs_x = (int8_t)in[6];
+        ofs_y = (int8_t)in[7];
+    }
+    else {
+        uint16_t box[2];
+        int16_t ofs[2];
+        lv_memcpy(&index, in, 4);
+        lv_memcpy(&adv_w, in + 4, 4);
+        lv_memcpy(box, in + 8, 4);
+        lv_memcpy(ofs, in + 12, 4);
+        box_w = box[0];
+        box_h = box[1];
+        ofs_x = ofs[0];
+        ofs_y = ofs[1];
+    }
+
+    gdsc->bitmap_index = index;
+    gdsc->adv_w = adv_w;
+    gdsc->box_w = box_w;
+    gdsc->box_h = box_h;
+    gdsc->ofs_x = ofs_x;
+    gdsc->ofs_y = ofs_y;
+
+    return (uint32_t)gdsc->bitmap_index == index && (uint32_t)gdsc->adv_w == adv_w &&
+           gdsc->box_w == box_w && gdsc->box_h == box_h && gdsc->ofs_x == ofs_x && gdsc->ofs_y == ofs_y;
+}
+
+/**
+ * Check if the glyph descriptors of a mapped font can be used directly
+ * @param dsc_size  size of the glyph descriptors in the mapped font
+ * @return          true: `lv_font_fmt_txt_glyph_dsc_t` has the same layout
+ */
+static bool glyph_dsc_layout_matches(uint32_t dsc_size)
+{
+    if(dsc_size != MAPPED_GLYPH_DSC_SIZE || dsc_size != sizeof(lv_font_fmt_txt_glyph_dsc_t)) return false;
+
+    /*The order of the bit fields depends on the compiler so compare with a written descriptor*/
+    lv_font_fmt_txt_glyph_dsc_t probe;
+    lv_memzero(&probe, sizeof(probe));
+    probe.bitmap_index = 1;
+    probe.adv_w = 2;
+    probe.box_w = 3;
+    probe.box_h = 4;
+    probe.ofs_x = -5;
+    probe.ofs_y = 6;
+
+    uint8_t buf[MAPPED_GLYPH_DSC_SIZE];
+    write_glyph_dsc(buf, &probe);
+    return lv_memcmp(buf, &probe, sizeof(probe)) == 0;
+}
+
+static bool mapped_range_is_valid(uint32_t file_size, uint32_t ofs, uint32_t size)
+{
+    return ofs % MAPPED_ALIGN == 0 && ofs <= file_size && size <= file_size - ofs;
+}
+
+/**
+ * Check if a character map of a mapped font is inside the file and refers only to existing glyphs
+ * @param map           the mapped font
+ * @param file_size     size of the mapped font
+ * @param mc            the character map to check
+ * @param glyph_cnt     number of glyphs in the font
+ * @return              true: the character map can be used
+ */
+static bool mapped_cmap_is_valid(const uint8_t * map, uint32_t file_size, const mapped_cmap_t * mc, uint32_t glyph_cnt)
+{
+    /*The glyph IDs are `glyph_id_start` + an offset which has to be less than this*/
+    uint32_t id_max = mc->glyph_id_start < glyph_cnt ? glyph_cnt - mc->glyph_id_start : 0;
+    uint32_t i;
+
+    switch(mc->type) {
+        case LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY:
+            return mc->range_length <= id_max;
+
+        case LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL: {
+                /*Indexed by the offset of the character from `range_start`*/
+                if(mc->glyph_id_ofs_list_ofs == 0 ||
+                   !mapped_range_is_valid(file_size, mc->glyph_id_ofs_list_ofs, mc->range_length)) return false;
+
+                const uint8_t * ids = map + mc->glyph_id_ofs_list_ofs;
+                for(i = 0; i < mc->range_length; i++) {
+                    if(ids[i] >= id_max) return false;
+                }
+                return true;
+            }
+
+        case LV_FONT_FMT_TXT_CMAP_SPARSE_TINY:
+            return mc->unicode_list_ofs != 0 && mc->list_length <= id_max &&
+                   mapped_range_is_valid(file_size, mc->unicode_list_ofs, mc->list_length * sizeof(uint16_t));
+
+        case LV_FONT_FMT_TXT_CMAP_SPARSE_FULL: {
+                if(mc->unicode_list_ofs == 0 || mc->glyph_id_ofs_list_ofs == 0 ||
+                   !mapped_range_is_valid(file_size, mc->unicode_list_ofs, mc->list_length * sizeof(uint16_t)) ||
+                   !mapped_range_is_valid(file_size, mc->glyph_id_ofs_list_ofs, mc->list_length * sizeof(uint16_t))) {
+                    return false;
+                }
+
+                const uint16_t * ids = (const uint16_t *)(map + mc->glyph_id_ofs_list_ofs);
+                for(i = 0; i < mc->list_length; i++) {
+                    if(ids[i] >= id_max) return false;
+                }
+                return true;
+            }
+
+        default:
+            return false;
+    }
+}
+
+/**
+ * Check if the bitmap of a glyph of a mapped font starts inside the bitmap table
+ * @param in            the glyph descriptor in the mapped font
+ * @param dsc_size      size of the glyph descriptors in the mapped font
+ * @param bitmap_size   size of the bitmap table in bytes
+ * @return              true: the glyph can be used
+ */
+static bool mapped_glyph_dsc_is_valid(const uint8_t * in, uint32_t dsc_size, uint32_t bitmap_size)
+{
+    uint32_t index;
+    bool empty;
+    lv_memcpy(&index, in, 4);
+    if(dsc_size == MAPPED_GLYPH_DSC_SMALL) {
+        index &= 0xFFFFF;
+        empty = in[4] == 0 || in[5] == 0;
+    }
+    else {
+        uint16_t box[2];
+        lv_memcpy(box, in + 8, 4);
+        empty = box[0] == 0 || box[1] == 0;
+    }
+
+    /*Glyphs without a bitmap (e.g. space) can point to the end of the table*/
+    return empty ? index <= bitmap_size : index < bitmap_size;
+}
+
+/**
+ * The glyphs of mapped fonts don't need to be released. It's set only to recognize
+ * the fonts created by `lv_binfont_create_from_mapped`.
+ */
+static void mapped_release_glyph(const lv_font_t * font, lv_font_glyph_dsc_t * g_dsc)
+{
+    LV_UNUSED(font);
+    LV_UNUSED(g_dsc);
+}
+
 static lv_font_t * binfont_font_create_cb(const lv_font_info_t * info, const void * src)
 {
     const lv_binfont_font_src_t * font_src = src;
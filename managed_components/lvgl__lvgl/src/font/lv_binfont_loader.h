@@ -55,7 +55,31 @@ lv_font_t * lv_binfont_create_from_buffer(void * buffer, uint32_t size);
 #endif
 
 /**
- * Frees the memory allocated by the `lv_binfont_create()` function
+ * Create a font from a binary font converted by `lv_binfont_convert_to_mapped()`
+ * without copying its data. The glyphs, bitmaps, character maps and kerning values are used
+ * directly from the memory, e.g. from a memory mapped flash partition or file.
+ * Only a few hundred bytes are allocated for the descriptors.
+ * @param data          address of the mapped font, aligned to 4 bytes. It has to remain valid
+ *                      until the font is destroyed.
+ * @param size          size of the mapped font in bytes
+ * @return              pointer to the created font or NULL on error
+ */
+lv_font_t * lv_binfont_create_from_mapped(const void * data, uint32_t size);
+
+/**
+ * Convert a binary font file to a format which can be used directly from the memory
+ * by `lv_binfont_create_from_mapped()`. Write the result to a file or flash partition
+ * to use it later.
+ * @param path          path to the binary font file
+ * @param size          store the size of the converted font here
+ * @return              the converted font allocated with `lv_malloc()` or NULL on error.
+ *                      Free it with `lv_free()`.
+ */
+uint8_t * lv_binfont_convert_to_mapped(const char * path, uint32_t * size);
+
+/**
+ * Frees the memory allocated by the `lv_binfont_create()`, `lv_binfont_create_from_buffer()`
+ * or `lv_binfont_create_from_mapped()` function
  * @param font          lv_font_t object created by the lv_binfont_create function
  */
 void lv_binfont_destroy(lv_font_t * font);
@@ -17,6 +17,9 @@
 /*********************
  *      DEFINES
  *********************/
+#if LV_FONT_FALLBACK_CACHE_SIZE <= 0 || (LV_FONT_FALLBACK_CACHE_SIZE & (LV_FONT_FALLBACK_CACHE_SIZE - 1)) != 0
+    #error "LV_FONT_FALLBACK_CACHE_SIZE must be a power of 2"
+#endif
 
 /**********************
  *      TYPEDEFS
@@ -25,6 +28,7 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static void set_missing_glyph_dsc(const lv_font_t * font_p, lv_font_glyph_dsc_t * dsc_out);
 
 /**********************
  *  STATIC VARIABLES
@@ -132,23 +136,60 @@ bool lv_font_get_glyph_dsc(const lv_font_t * font_p, lv_font_glyph_dsc_t * dsc_o
     }
 #endif
 
-#if LV_USE_FONT_PLACEHOLDER
-    dsc_out->box_w = font_p->line_height / 2;
-    dsc_out->adv_w = dsc_out->box_w + 2;
-#else
-    dsc_out->box_w = 0;
-    dsc_out->adv_w = 0;
-#endif
+    set_missing_glyph_dsc(font_p, dsc_out);
+    return false;
+}
 
-    dsc_out->stride = 0;
-    dsc_out->resolved_font = NULL;
-    dsc_out->box_h = font_p->line_height;
-    dsc_out->ofs_x = 0;
-    dsc_out->ofs_y = 0;
-    dsc_out->format = LV_FONT_GLYPH_FORMAT_A1;
-    dsc_out->is_placeholder = true;
+void lv_font_fallback_cache_init(lv_font_fallback_cache_t * cache, const lv_font_t * font)
+{
+    LV_ASSERT_NULL(cache);
 
-    return false;
+    cache->font = font;
+    lv_memset(cache->letters, 0xFF, sizeof(cache->letters));    /*UINT32_MAX marks the unused entries*/
+}
+
+bool lv_font_get_glyph_dsc_cached(const lv_font_t * font_p, lv_font_fallback_cache_t * cache,
+                                  lv_font_glyph_dsc_t * dsc_out, uint32_t letter, uint32_t letter_next)
+{
+    LV_ASSERT_NULL(dsc_out);
+    LV_ASSERT_NULL(font_p);
+
+    /*Without fallback there is nothing to skip*/
+    if(cache == NULL || font_p->fallback == NULL) {
+        return lv_font_get_glyph_dsc(font_p, dsc_out, letter, letter_next);
+    }
+
+    if(cache->font != font_p) lv_font_fallback_cache_init(cache, font_p);
+
+    uint32_t slot = letter & (LV_FONT_FALLBACK_CACHE_SIZE - 1);
+    if(cache->letters[slot] == letter) {
+        const lv_font_t * f = cache->resolved[slot];
+        if(f == NULL) {
+            lv_memzero(dsc_out, sizeof(lv_font_glyph_dsc_t));
+            set_missing_glyph_dsc(font_p, dsc_out);
+            return false;
+        }
+
+        /*The kerning is enabled by the first font of the chain as in lv_font_get_glyph_dsc()*/
+        lv_memzero(dsc_out, sizeof(lv_font_glyph_dsc_t));
+        if(f->get_glyph_dsc(f, dsc_out, letter, font_p->kerning != LV_FONT_KERNING_NONE ? letter_next : 0)) {
+            dsc_out->resolved_font = f;
+            return true;
+        }
+
+        /*The font doesn't have the glyph anymore, resolve it again*/
+    }
+
+    bool found = lv_font_get_glyph_dsc(font_p, dsc_out, letter, letter_next);
+
+    /*The letters of the first font are found without walking the chain,
+     *so keep the slots for the others*/
+    if(!found || dsc_out->resolved_font != font_p) {
+        cache->letters[slot] = letter;
+        cache->resolved[slot] = found ? dsc_out->resolved_font : NULL;
+    }
+
+    return found;
 }
 
 uint16_t lv_font_get_glyph_width(const lv_font_t * font, uint32_t letter, uint32_t letter_next)
@@ -163,6 +204,19 @@ uint16_t lv_font_get_glyph_width(const lv_font_t * font, uint32_t letter, uint32
     return g.adv_w;
 }
 
+uint16_t lv_font_get_glyph_width_cached(const lv_font_t * font, lv_font_fallback_cache_t * cache, uint32_t letter,
+                                        uint32_t letter_next)
+{
+    lv_font_glyph_dsc_t g;
+
+    /*Return zero if letter is marker*/
+    if(lv_text_is_marker(letter)) return 0;
+
+    lv_font_get_glyph_dsc_cached(font, cache, &g, letter, letter_next);
+
+    return g.adv_w;
+}
+
 void lv_font_set_kerning(lv_font_t * font, lv_font_kerning_t kerning)
 {
     LV_ASSERT_NULL(font);
@@ -202,3 +256,22 @@ bool lv_font_has_static_bitmap(const lv_font_t * font)
 /**********************
  *   STATIC FUNCTIONS
  **********************/
+
+static void set_missing_glyph_dsc(const lv_font_t * font_p, lv_font_glyph_dsc_t * dsc_out)
+{
+#if LV_USE_FONT_PLACEHOLDER
+    dsc_out->box_w = font_p->line_height / 2;
+    dsc_out->adv_w = dsc_out->box_w + 2;
+#else
+    dsc_out->box_w = 0;
+    dsc_out->adv_w = 0;
+#endif
+
+    dsc_out->stride = 0;
+    dsc_out->resolved_font = NULL;
+    dsc_out->box_h = font_p->line_height;
+    dsc_out->ofs_x = 0;
+    dsc_out->ofs_y = 0;
+    dsc_out->format = LV_FONT_GLYPH_FORMAT_A1;
+    dsc_out->is_placeholder = true;
+}
@@ -117,6 +117,14 @@ struct _lv_font_t {
     void * user_data;               /**< Custom user data for font.*/
 };
 
+/** Cache of the fonts resolved from a fallback chain, indexed by the letters.
+ *  Meant to be used while processing a text, e.g. measuring and drawing a label.*/
+typedef struct {
+    const lv_font_t * font;     /**< The first font of the fallback chain the letters were resolved for*/
+    uint32_t letters[LV_FONT_FALLBACK_CACHE_SIZE];          /**< The cached letters. `UINT32_MAX` if not used*/
+    const lv_font_t * resolved[LV_FONT_FALLBACK_CACHE_SIZE]; /**< The font having the letter or NULL if missing*/
+} lv_font_fallback_cache_t;
+
 struct _lv_font_class_t {
     lv_font_t * (*create_cb)(const lv_font_info_t * info, const void * src); /**< Font creation callback function*/
     void (*delete_cb)(lv_font_t * font);    /**< Font deletion callback function*/
@@ -172,6 +180,29 @@ const void * lv_font_get_glyph_static_bitmap(lv_font_glyph_dsc_t * g_dsc);
  */
 bool lv_font_get_glyph_dsc(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t letter,
                            uint32_t letter_next);
+/**
+ * Initialize or invalidate a fallback cache.
+ * Needs to be called again if the fallback chain of `font` has changed.
+ * @param cache         pointer to a fallback cache
+ * @param font          the first font of the fallback chain
+ */
+void lv_font_fallback_cache_init(lv_font_fallback_cache_t * cache, const lv_font_t * font);
+
+/**
+ * Get the descriptor of a glyph and remember which font of the fallback chain has it.
+ * Looking up the same letter again skips the fonts of the chain not having it.
+ * @param font          pointer to font
+ * @param cache         pointer to a fallback cache. The cache is reinitialized if it was used with
+ *                      an other font. If NULL or `font` has no fallback it works as lv_font_get_glyph_dsc()
+ * @param dsc_out       store the result descriptor here
+ * @param letter        a UNICODE letter code
+ * @param letter_next   the next letter after `letter`. Used for kerning
+ * @return true: descriptor is successfully loaded into `dsc_out`.
+ *         false: the letter was not found, no data is loaded to `dsc_out`
+ */
+bool lv_font_get_glyph_dsc_cached(const lv_font_t * font, lv_font_fallback_cache_t * cache,
+                                  lv_font_glyph_dsc_t * dsc_out, uint32_t letter, uint32_t letter_next);
+
 /**
  * Release the bitmap of a font.
  * @note You must call lv_font_get_glyph_dsc() to get `g_dsc` (lv_font_glyph_dsc_t) before you can call this function.
@@ -188,6 +219,17 @@ void lv_font_glyph_release_draw_data(lv_font_glyph_dsc_t * g_dsc);
  */
 uint16_t lv_font_get_glyph_width(const lv_font_t * font, uint32_t letter, uint32_t letter_next);
 
+/**
+ * Get the width of a glyph with kerning using a fallback cache
+ * @param font          pointer to a font
+ * @param cache         pointer to a fallback cache. Can be NULL.
+ * @param letter        a UNICODE letter
+ * @param letter_next   the next letter after `letter`. Used for kerning
+ * @return the width of the glyph
+ */
+uint16_t lv_font_get_glyph_width_cached(const lv_font_t * font, lv_font_fallback_cache_t * cache, uint32_t letter,
+                                        uint32_t letter_next);
+
 /**
  * Get the line height of a font. All characters fit into this height
  * @param font      pointer to a font
@@ -18,17 +18,10 @@
 /*********************
  *      DEFINES
  *********************/
-#if LV_USE_FONT_COMPRESSED
-    #define font_rle LV_GLOBAL_DEFAULT()->font_fmt_rle
-#endif /*LV_USE_FONT_COMPRESSED*/
 
 /**********************
  *      TYPEDEFS
  **********************/
-typedef struct {
-    uint32_t gid_left;
-    uint32_t gid_right;
-} kern_pair_ref_t;
 
 /**********************
  *  STATIC PROTOTYPES
@@ -36,15 +29,16 @@ typedef struct {
 static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter);
 static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t gid_right);
 static int unicode_list_compare(const void * ref, const void * element);
-static int kern_pair_8_compare(const void * ref, const void * element);
-static int kern_pair_16_compare(const void * ref, const void * element);
+static inline uint32_t kern_pair_get_left(const lv_font_fmt_txt_kern_pair_t * kdsc, uint32_t i);
+static inline uint32_t kern_pair_get_right(const lv_font_fmt_txt_kern_pair_t * kdsc, uint32_t i);
+static bool kern_rows_equal(const lv_font_fmt_txt_kern_pair_t * kdsc, uint32_t a_start, uint32_t b_start,
+                            uint32_t len);
 
 #if LV_USE_FONT_COMPRESSED
     static void decompress(const uint8_t * in, uint8_t * out, int32_t w, int32_t h, uint8_t bpp, bool prefilter);
-    static inline void decompress_line(uint8_t * out, int32_t w);
-    static inline uint8_t get_bits(const uint8_t * in, uint32_t bit_pos, uint8_t len);
-    static inline void rle_init(const uint8_t * in,  uint8_t bpp);
-    static inline uint8_t rle_next(void);
+    static inline uint8_t get_bits(lv_font_fmt_rle_t * rle, uint8_t len);
+    static inline void rle_init(lv_font_fmt_rle_t * rle, const uint8_t * in,  uint8_t bpp);
+    static inline uint8_t rle_next(lv_font_fmt_rle_t * rle);
 #endif /*LV_USE_FONT_COMPRESSED*/
 
 static lv_font_t * builtin_font_create_cb(const lv_font_info_t * info, const void * src);
@@ -276,6 +270,160 @@ bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t *
     return true;
 }
 
+lv_font_fmt_txt_kern_classes_t * lv_font_fmt_txt_kern_pairs_to_classes(const lv_font_fmt_txt_kern_pair_t * kdsc,
+                                                                        uint32_t glyph_cnt)
+{
+    if(kdsc == NULL || kdsc->pair_cnt == 0 || glyph_cnt == 0) return NULL;
+    if(kdsc->glyph_ids_size > 1) return NULL;
+
+    uint32_t pair_cnt = kdsc->pair_cnt;
+    uint32_t pair_size = kdsc->glyph_ids_size == 0 ? 3 : 5;
+
+    uint8_t * left_map = lv_malloc_zeroed(glyph_cnt);
+    uint8_t * right_map = lv_malloc_zeroed(glyph_cnt);
+    uint32_t * col_hash = lv_malloc_zeroed(glyph_cnt * sizeof(uint32_t));
+    uint32_t * col_cnt = lv_malloc_zeroed(glyph_cnt * sizeof(uint32_t));
+    /*Start and length of the row representing a left class and the glyph representing a right class*/
+    uint32_t * left_row_start = lv_malloc(255 * sizeof(uint32_t));
+    uint32_t * left_row_len = lv_malloc(255 * sizeof(uint32_t));
+    uint32_t * right_rep = lv_malloc(255 * sizeof(uint32_t));
+    uint32_t * left_glyph_cnt = lv_malloc_zeroed(255 * sizeof(uint32_t));
+    uint32_t * right_glyph_cnt = lv_malloc_zeroed(255 * sizeof(uint32_t));
+    int8_t * class_values = NULL;
+    lv_font_fmt_txt_kern_classes_t * classes = NULL;
+    bool ok = false;
+    uint32_t left_cnt = 0;
+    uint32_t right_cnt = 0;
+    uint32_t class_pair_cnt = 0;
+    uint32_t i;
+    uint32_t c;
+
+    if(left_map == NULL || right_map == NULL || col_hash == NULL || col_cnt == NULL ||
+       left_row_start == NULL || left_row_len == NULL || right_rep == NULL ||
+       left_glyph_cnt == NULL || right_glyph_cnt == NULL) {
+        goto cleanup;
+    }
+
+    /*1. Left glyphs with identical rows (same right glyphs with the same values) share a class.
+     *The pairs are sorted by the left glyph so a row is a continuous range*/
+    i = 0;
+    while(i < pair_cnt) {
+        uint32_t gid_left = kern_pair_get_left(kdsc, i);
+        if(gid_left >= glyph_cnt || left_map[gid_left] != 0) goto cleanup;
+
+        uint32_t len = 1;
+        while(i + len < pair_cnt && kern_pair_get_left(kdsc, i + len) == gid_left) len++;
+
+        for(c = 0; c < left_cnt; c++) {
+            if(left_row_len[c] == len && kern_rows_equal(kdsc, left_row_start[c], i, len)) break;
+        }
+
+        if(c == left_cnt) {
+            if(left_cnt == 255) goto cleanup;
+            left_row_start[c] = i;
+            left_row_len[c] = len;
+            left_cnt++;
+        }
+
+        left_map[gid_left] = (uint8_t)(c + 1);
+        left_glyph_cnt[c]++;
+        i += len;
+    }
+
+    /*2. Right glyphs with the same column (values per left class) share a class.
+     *Compare the columns by their hash and verify the result later*/
+    for(c = 0; c < left_cnt; c++) {
+        for(i = left_row_start[c]; i < left_row_start[c] + left_row_len[c]; i++) {
+            uint32_t gid_right = kern_pair_get_right(kdsc, i);
+            int8_t v = kdsc->values[i];
+            if(gid_right >= glyph_cnt || v == 0) goto cleanup;
+
+            uint32_t h = col_cnt[gid_right] == 0 ? 2166136261u : col_hash[gid_right];
+            h = (h ^ c) * 16777619u;
+            h = (h ^ (uint8_t)v) * 16777619u;
+            col_hash[gid_right] = h;
+            col_cnt[gid_right]++;
+        }
+    }
+
+    for(i = 0; i < glyph_cnt; i++) {
+        if(col_cnt[i] == 0) continue;
+
+        for(c = 0; c < right_cnt; c++) {
+            uint32_t rep = right_rep[c];
+            if(col_hash[rep] == col_hash[i] && col_cnt[rep] == col_cnt[i]) break;
+        }
+
+        if(c == right_cnt) {
+            if(right_cnt == 255) goto cleanup;
+            right_rep[c] = i;
+            right_cnt++;
+        }
+
+        right_map[i] = (uint8_t)(c + 1);
+        right_glyph_cnt[c]++;
+    }
+
+    /*Don't convert if the class table would be much larger than the pairs*/
+    if(2 * glyph_cnt + left_cnt * right_cnt > 2 * pair_cnt * pair_size) goto cleanup;
+
+    /*3. Fill the class table from the representative rows*/
+    class_values = lv_malloc_zeroed(left_cnt * right_cnt);
+    if(class_values == NULL) goto cleanup;
+
+    for(c = 0; c < left_cnt; c++) {
+        for(i = left_row_start[c]; i < left_row_start[c] + left_row_len[c]; i++) {
+            uint32_t rc = right_map[kern_pair_get_right(kdsc, i)] - 1;
+            class_values[c * right_cnt + rc] = kdsc->values[i];
+        }
+    }
+
+    /*4. Every pair has to be found in the class table...*/
+    for(i = 0; i < pair_cnt; i++) {
+        uint32_t gid_right = kern_pair_get_right(kdsc, i);
+        if(gid_right >= glyph_cnt || right_map[gid_right] == 0) goto cleanup;
+
+        uint32_t lc = left_map[kern_pair_get_left(kdsc, i)] - 1;
+        uint32_t rc = right_map[gid_right] - 1;
+        if(class_values[lc * right_cnt + rc] != kdsc->values[i]) goto cleanup;
+    }
+
+    /*5. ...and the class table can't describe more pairs than the original list*/
+    for(c = 0; c < left_cnt; c++) {
+        uint32_t rc;
+        for(rc = 0; rc < right_cnt; rc++) {
+            if(class_values[c * right_cnt + rc] != 0) class_pair_cnt += left_glyph_cnt[c] * right_glyph_cnt[rc];
+        }
+    }
+    if(class_pair_cnt != pair_cnt) goto cleanup;
+
+    classes = lv_malloc(sizeof(lv_font_fmt_txt_kern_classes_t));
+    if(classes == NULL) goto cleanup;
+
+    classes->class_pair_values = class_values;
+    classes->left_class_mapping = left_map;
+    classes->right_class_mapping = right_map;
+    classes->left_class_cnt = (uint8_t)left_cnt;
+    classes->right_class_cnt = (uint8_t)right_cnt;
+    ok = true;
+
+cleanup:
+    if(!ok) {
+        lv_free(class_values);
+        lv_free(left_map);
+        lv_free(right_map);
+    }
+    lv_free(col_hash);
+    lv_free(col_cnt);
+    lv_free(left_row_start);
+    lv_free(left_row_len);
+    lv_free(right_rep);
+    lv_free(left_glyph_cnt);
+    lv_free(right_glyph_cnt);
+
+    return classes;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -342,35 +490,36 @@ static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t
     if(fdsc->kern_classes == 0) {
         /*Kern pairs*/
         const lv_font_fmt_txt_kern_pair_t * kdsc = fdsc->kern_dsc;
+
+        /*The pairs are ordered left_id first, then right_id secondly,
+         *so search for the id pair as a single number with binary search.*/
+        uint32_t key;
         if(kdsc->glyph_ids_size == 0) {
-            /*Use binary search to find the kern value.
-             *The pairs are ordered left_id first, then right_id secondly.*/
-            const uint16_t * g_ids = kdsc->glyph_ids;
-            kern_pair_ref_t g_id_both = {gid_left, gid_right};
-            uint16_t * kid_p = lv_utils_bsearch(&g_id_both, g_ids, kdsc->pair_cnt, 2, kern_pair_8_compare);
-
-            /*If the `g_id_both` were found get its index from the pointer*/
-            if(kid_p) {
-                lv_uintptr_t ofs = kid_p - g_ids;
-                value = kdsc->values[ofs];
-            }
+            if(gid_left > 0xFF || gid_right > 0xFF) return 0;
+            key = (gid_left << 8) | gid_right;
         }
         else if(kdsc->glyph_ids_size == 1) {
-            /*Use binary search to find the kern value.
-             *The pairs are ordered left_id first, then right_id secondly.*/
-            const uint32_t * g_ids = kdsc->glyph_ids;
-            kern_pair_ref_t g_id_both = {gid_left, gid_right};
-            uint32_t * kid_p = lv_utils_bsearch(&g_id_both, g_ids, kdsc->pair_cnt, 4, kern_pair_16_compare);
-
-            /*If the `g_id_both` were found get its index from the pointer*/
-            if(kid_p) {
-                lv_uintptr_t ofs = kid_p - g_ids;
-                value = kdsc->values[ofs];
-            }
-
+            if(gid_left > 0xFFFF || gid_right > 0xFFFF) return 0;
+            key = (gid_left << 16) | gid_right;
         }
         else {
             /*Invalid value*/
+            return 0;
+        }
+
+        uint32_t shift = kdsc->glyph_ids_size == 0 ? 8 : 16;
+        uint32_t low = 0;
+        uint32_t high = kdsc->pair_cnt;
+        while(low < high) {
+            uint32_t mid = (low + high) >> 1;
+            uint32_t mid_key = (kern_pair_get_left(kdsc, mid) << shift) | kern_pair_get_right(kdsc, mid);
+            if(mid_key == key) {
+                value = kdsc->values[mid];
+                break;
+            }
+
+            if(mid_key < key) low = mid + 1;
+            else high = mid;
         }
     }
     else {
@@ -389,24 +538,35 @@ static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t
     return value;
 }
 
-static int kern_pair_8_compare(const void * ref, const void * element)
+static inline uint32_t kern_pair_get_left(const lv_font_fmt_txt_kern_pair_t * kdsc, uint32_t i)
 {
-    const kern_pair_ref_t * ref8_p = ref;
-    const uint8_t * element8_p = element;
-
-    /*If the MSB is different it will matter. If not return the diff. of the LSB*/
-    if(ref8_p->gid_left != element8_p[0]) return ref8_p->gid_left - element8_p[0];
-    else return ref8_p->gid_right - element8_p[1];
+    if(kdsc->glyph_ids_size == 0) return ((const uint8_t *)kdsc->glyph_ids)[i * 2];
+    else return ((const uint16_t *)kdsc->glyph_ids)[i * 2];
 }
 
-static int kern_pair_16_compare(const void * ref, const void * element)
+static inline uint32_t kern_pair_get_right(const lv_font_fmt_txt_kern_pair_t * kdsc, uint32_t i)
 {
-    const kern_pair_ref_t * ref16_p = ref;
-    const uint16_t * element16_p = element;
+    if(kdsc->glyph_ids_size == 0) return ((const uint8_t *)kdsc->glyph_ids)[i * 2 + 1];
+    else return ((const uint16_t *)kdsc->glyph_ids)[i * 2 + 1];
+}
 
-    /*If the MSB is different it will matter. If not return the diff. of the LSB*/
-    if(ref16_p->gid_left != element16_p[0]) return ref16_p->gid_left - element16_p[0];
-    else return ref16_p->gid_right - element16_p[1];
+/**
+ * Check if two kerning rows have the same right glyphs with the same values
+ * @param kdsc      the kerning pairs
+ * @param a_start   index of the first pair of one row
+ * @param b_start   index of the first pair of the other row
+ * @param len       number of pairs in the rows
+ * @return          true: the rows are equal
+ */
+static bool kern_rows_equal(const lv_font_fmt_txt_kern_pair_t * kdsc, uint32_t a_start, uint32_t b_start,
+                            uint32_t len)
+{
+    uint32_t i;
+    for(i = 0; i < len; i++) {
+        if(kern_pair_get_right(kdsc, a_start + i) != kern_pair_get_right(kdsc, b_start + i)) return false;
+        if(kdsc->values[a_start + i] != kdsc->values[b_start + i]) return false;
+    }
+    return true;
 }
 
 #if LV_USE_FONT_COMPRESSED
@@ -437,156 +597,109 @@ static void decompress(const uint8_t * in, uint8_t * out, int32_t w, int32_t h,
             return;
     }
 
-    rle_init(in, bpp);
-
-    uint8_t * line_buf1 = lv_malloc(w);
-
-    uint8_t * line_buf2 = NULL;
-
-    if(prefilter) {
-        line_buf2 = lv_malloc(w);
-    }
-
-    decompress_line(line_buf1, w);
+    lv_font_fmt_rle_t rle;
+    rle_init(&rle, in, bpp);
 
     int32_t y;
     int32_t x;
     uint32_t stride = lv_draw_buf_width_to_stride(w, LV_COLOR_FORMAT_A8);
 
-    for(x = 0; x < w; x++) {
-        out[x] = opa_table[line_buf1[x]];
-    }
-    out += stride;
-
-    for(y = 1; y < h; y++) {
-        if(prefilter) {
-            decompress_line(line_buf2, w);
-
+    if(!prefilter) {
+        for(y = 0; y < h; y++) {
             for(x = 0; x < w; x++) {
-                line_buf1[x] = line_buf2[x] ^ line_buf1[x];
-                out[x] = opa_table[line_buf1[x]];
+                out[x] = opa_table[rle_next(&rle)];
             }
+            out += stride;
         }
-        else {
-            decompress_line(line_buf1, w);
+        return;
+    }
 
-            for(x = 0; x < w; x++) {
-                out[x] = opa_table[line_buf1[x]];
-            }
-        }
-        out += stride;
+    /*The lines are XORed with the line above. Keep the raw values in the output
+     *until the next line is decoded and convert them to opacity only then.*/
+    for(x = 0; x < w; x++) {
+        out[x] = rle_next(&rle);
     }
 
-    lv_free(line_buf1);
-    lv_free(line_buf2);
-}
+    for(y = 1; y < h; y++) {
+        uint8_t * out_prev = out;
+        out += stride;
+        for(x = 0; x < w; x++) {
+            uint8_t v = rle_next(&rle) ^ out_prev[x];
+            out[x] = v;
+            out_prev[x] = opa_table[out_prev[x]];
+        }
+    }
 
-/**
- * Decompress one line. Store one pixel per byte
- * @param out output buffer
- * @param w width of the line in pixel count
- */
-static inline void decompress_line(uint8_t * out, int32_t w)
-{
-    int32_t i;
-    for(i = 0; i < w; i++) {
-        out[i] = rle_next();
+    for(x = 0; x < w; x++) {
+        out[x] = opa_table[out[x]];
     }
 }
 
 /**
- * Read bits from an input buffer. The read can cross byte boundary.
- * @param in the input buffer to read from.
- * @param bit_pos index of the first bit to read.
+ * Read bits from the input. The bits are loaded into a 32-bit buffer
+ * one byte at a time only when needed, so the read never goes beyond the glyph's data.
+ * @param rle the decoder's state
  * @param len number of bits to read (must be <= 8).
  * @return the read bits
  */
-static inline uint8_t get_bits(const uint8_t * in, uint32_t bit_pos, uint8_t len)
+static inline uint8_t get_bits(lv_font_fmt_rle_t * rle, uint8_t len)
 {
-    uint8_t bit_mask;
-    switch(len) {
-        case 1:
-            bit_mask = 0x1;
-            break;
-        case 2:
-            bit_mask = 0x3;
-            break;
-        case 3:
-            bit_mask = 0x7;
-            break;
-        case 4:
-            bit_mask = 0xF;
-            break;
-        case 8:
-            bit_mask = 0xFF;
-            break;
-        default:
-            bit_mask = (uint16_t)((uint16_t) 1 << len) - 1;
+    if(rle->bit_cnt < len) {
+        rle->bit_buf |= (uint32_t)(*rle->in) << (24 - rle->bit_cnt);
+        rle->in++;
+        rle->bit_cnt += 8;
     }
 
-    uint32_t byte_pos = bit_pos >> 3;
-    bit_pos = bit_pos & 0x7;
-
-    if(bit_pos + len >= 8) {
-        uint16_t in16 = (in[byte_pos] << 8) + in[byte_pos + 1];
-        return (in16 >> (16 - bit_pos - len)) & bit_mask;
-    }
-    else {
-        return (in[byte_pos] >> (8 - bit_pos - len)) & bit_mask;
-    }
+    uint8_t ret = (uint8_t)(rle->bit_buf >> (32 - len));
+    rle->bit_buf <<= len;
+    rle->bit_cnt -= len;
+    return ret;
 }
 
-static inline void rle_init(const uint8_t * in,  uint8_t bpp)
+static inline void rle_init(lv_font_fmt_rle_t * rle, const uint8_t * in,  uint8_t bpp)
 {
-    lv_font_fmt_rle_t * rle = &font_rle;
     rle->in = in;
+    rle->bit_buf = 0;
+    rle->bit_cnt = 0;
     rle->bpp = bpp;
     rle->state = RLE_STATE_SINGLE;
-    rle->rdp = 0;
-    rle->prev_v = 0;
+    rle->prev_v = 0xFF; /*Not a valid pixel value so the first pixel can't be a repeated one*/
     rle->count = 0;
 }
 
-static inline uint8_t rle_next(void)
+static inline uint8_t rle_next(lv_font_fmt_rle_t * rle)
 {
-    uint8_t v = 0;
     uint8_t ret = 0;
-    lv_font_fmt_rle_t * rle = &font_rle;
 
     if(rle->state == RLE_STATE_SINGLE) {
-        ret = get_bits(rle->in, rle->rdp, rle->bpp);
-        if(rle->rdp != 0 && rle->prev_v == ret) {
+        ret = get_bits(rle, rle->bpp);
+        if(rle->prev_v == ret) {
             rle->count = 0;
             rle->state = RLE_STATE_REPEATED;
         }
 
         rle->prev_v = ret;
-        rle->rdp += rle->bpp;
     }
     else if(rle->state == RLE_STATE_REPEATED) {
-        v = get_bits(rle->in, rle->rdp, 1);
+        uint8_t v = get_bits(rle, 1);
         rle->count++;
-        rle->rdp += 1;
         if(v == 1) {
             ret = rle->prev_v;
             if(rle->count == 11) {
-                rle->count = get_bits(rle->in, rle->rdp, 6);
-                rle->rdp += 6;
+                rle->count = get_bits(rle, 6);
                 if(rle->count != 0) {
                     rle->state = RLE_STATE_COUNTER;
                 }
                 else {
-                    ret = get_bits(rle->in, rle->rdp, rle->bpp);
+                    ret = get_bits(rle, rle->bpp);
                     rle->prev_v = ret;
-                    rle->rdp += rle->bpp;
                     rle->state = RLE_STATE_SINGLE;
                 }
             }
         }
         else {
-            ret = get_bits(rle->in, rle->rdp, rle->bpp);
+            ret = get_bits(rle, rle->bpp);
             rle->prev_v = ret;
-            rle->rdp += rle->bpp;
             rle->state = RLE_STATE_SINGLE;
         }
 
@@ -595,9 +708,8 @@ static inline uint8_t rle_next(void)
         ret = rle->prev_v;
         rle->count--;
         if(rle->count == 0) {
-            ret = get_bits(rle->in, rle->rdp, rle->bpp);
+            ret = get_bits(rle, rle->bpp);
             rle->prev_v = ret;
-            rle->rdp += rle->bpp;
             rle->state = RLE_STATE_SINGLE;
         }
     }
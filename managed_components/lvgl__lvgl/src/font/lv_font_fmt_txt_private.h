@@ -31,9 +31,11 @@ typedef enum {
     RLE_STATE_COUNTER,
 } lv_font_fmt_rle_state_t;
 
+/** State of the RLE decoder. It's owned by the caller so glyphs can be decoded in parallel.*/
 typedef struct {
-    uint32_t rdp;
-    const uint8_t * in;
+    const uint8_t * in;     /**< The next byte to load into `bit_buf`*/
+    uint32_t bit_buf;       /**< The bits loaded but not read yet aligned to the MSB*/
+    uint8_t bit_cnt;        /**< Number of valid bits in `bit_buf`*/
     uint8_t bpp;
     uint8_t prev_v;
     uint8_t count;
@@ -45,6 +47,17 @@ typedef struct {
  * GLOBAL PROTOTYPES
  **********************/
 
+/**
+ * Convert a sorted kerning pair list to class based kerning to look up the values in constant time.
+ * Left glyphs with the same kerning row and right glyphs with the same kerning column get the same class.
+ * @param kdsc          the kerning pairs to convert
+ * @param glyph_cnt     number of glyphs in the font, i.e. the length of the class mapping arrays
+ * @return              an `lv_malloc`ed class descriptor whose arrays are `lv_malloc`ed too,
+ *                      or NULL if the pairs can't be converted without loss or would need much more memory
+ */
+lv_font_fmt_txt_kern_classes_t * lv_font_fmt_txt_kern_pairs_to_classes(const lv_font_fmt_txt_kern_pair_t * kdsc,
+                                                                        uint32_t glyph_cnt);
+
 /**********************
  *      MACROS
  **********************/
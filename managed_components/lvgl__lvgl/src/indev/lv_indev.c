@@ -13,6 +13,7 @@
  ********************/
 #include "lv_indev_scroll.h"
 #include "lv_indev_gesture.h"
+#include "lv_indev_hit_index.h"
 #include "../display/lv_display_private.h"
 #include "../core/lv_global.h"
 #include "../core/lv_obj_private.h"
@@ -75,10 +76,12 @@ static void indev_proc_release(lv_indev_t * indev);
 static lv_result_t indev_proc_short_click(lv_indev_t * indev);
 static void indev_proc_pointer_diff(lv_indev_t * indev);
 static lv_obj_t * pointer_search_obj(lv_display_t * disp, lv_point_t * p);
+static lv_obj_t * search_children(lv_obj_t * obj, lv_point_t * point);
 static void indev_proc_reset_query_handler(lv_indev_t * indev);
 static void indev_click_focus(lv_indev_t * indev);
 static void indev_gesture(lv_indev_t * indev);
 static bool indev_reset_check(lv_indev_t * indev);
+static lv_dir_t get_spatial_nav_dir(const lv_group_t * g, uint32_t key);
 static void indev_read_core(lv_indev_t * indev, lv_indev_data_t * data);
 static void indev_reset_core(lv_indev_t * indev, lv_obj_t * obj);
 static lv_result_t send_event(lv_event_code_t code, void * param);
@@ -606,15 +609,9 @@ lv_obj_t * lv_indev_search_obj(lv_obj_t * obj, lv_point_t * point)
         lv_area_increase(&obj_coords, ext_draw_size, ext_draw_size);
     }
     if(lv_area_is_point_on(&obj_coords, &p_trans, 0)) {
-        int32_t i;
-        uint32_t child_cnt = lv_obj_get_child_count(obj);
-
         /*If a child matches use it*/
-        for(i = child_cnt - 1; i >= 0; i--) {
-            lv_obj_t * child = obj->spec_attr->children[i];
-            found_p = lv_indev_search_obj(child, &p_trans);
-            if(found_p) return found_p;
-        }
+        found_p = search_children(obj, &p_trans);
+        if(found_p) return found_p;
     }
 
     /*If not return earlier for a clicked child and this obj's hittest was ok use it
@@ -797,6 +794,11 @@ static void indev_keypad_proc(lv_indev_t * i, lv_indev_data_t * data)
             lv_group_focus_prev(g);
             if(indev_reset_check(i)) return;
         }
+        /*Move the focus in the direction of the arrow in spatial navigation*/
+        else if(get_spatial_nav_dir(g, data->key) != LV_DIR_NONE) {
+            lv_group_focus_dir(g, get_spatial_nav_dir(g, data->key));
+            if(indev_reset_check(i)) return;
+        }
         else if(is_enabled) {
             /*Simulate a press on the object if ENTER was pressed*/
             if(data->key == LV_KEY_ENTER) {
@@ -859,6 +861,11 @@ static void indev_keypad_proc(lv_indev_t * i, lv_indev_data_t * data)
                 lv_group_focus_prev(g);
                 if(indev_reset_check(i)) return;
             }
+            /*Move the focus in the direction of the arrow again*/
+            else if(get_spatial_nav_dir(g, data->key) != LV_DIR_NONE) {
+                lv_group_focus_dir(g, get_spatial_nav_dir(g, data->key));
+                if(indev_reset_check(i)) return;
+            }
             /*Just send other keys again to the object (e.g. 'A' or `LV_GROUP_KEY_RIGHT)*/
             else {
                 lv_group_send_data(g, data->key);
@@ -1610,6 +1617,59 @@ static lv_obj_t * pointer_search_obj(lv_display_t * disp, lv_point_t * p)
     return indev_obj_act;
 }
 
+/**
+ * Search the children of an object from the top to the bottom.
+ * @param obj       pointer to an object
+ * @param point     the point in the coordinate system of the children
+ * @return          the found object or NULL
+ */
+static lv_obj_t * search_children(lv_obj_t * obj, lv_point_t * point)
+{
+    lv_obj_t * found_p;
+    int32_t i = (int32_t)lv_obj_get_child_count(obj) - 1;
+
+#if LV_INDEV_HIT_INDEX
+    lv_indev_hit_index_result_t res;
+    /*The index stores the children on 16 bits*/
+    if(i + 1 >= LV_INDEV_HIT_INDEX_MIN_CHILDREN && i < UINT16_MAX && lv_indev_hit_index_query(obj, point, &res)) {
+        /*Check only the children which can be on the point.
+         *Merge the two increasing lists to go from the top to the bottom.*/
+        int32_t cell_i = (int32_t)res.cell_cnt - 1;
+        int32_t always_i = (int32_t)res.always_cnt - 1;
+        while(cell_i >= 0 || always_i >= 0) {
+            if(always_i < 0 || (cell_i >= 0 && res.cell_items[cell_i] > res.always_items[always_i])) {
+                i = res.cell_items[cell_i];
+                cell_i--;
+            }
+            else {
+                i = res.always_items[always_i];
+                always_i--;
+            }
+
+            found_p = lv_indev_search_obj(obj->spec_attr->children[i], point);
+            if(found_p) return found_p;
+
+            /*If the children were changed in the meantime (e.g. in an event)
+             *continue with the remaining children without the index*/
+            if(!lv_indev_hit_index_is_valid(obj)) {
+                i = LV_MIN(i - 1, (int32_t)lv_obj_get_child_count(obj) - 1);
+                break;
+            }
+        }
+
+        if(lv_indev_hit_index_is_valid(obj)) return NULL;
+    }
+#endif
+
+    for(; i >= 0; i--) {
+        lv_obj_t * child = obj->spec_attr->children[i];
+        found_p = lv_indev_search_obj(child, point);
+        if(found_p) return found_p;
+    }
+
+    return NULL;
+}
+
 /**
  * Process a new point from LV_INDEV_TYPE_BUTTON input device
  * @param i pointer to an input device
@@ -1778,6 +1838,31 @@ static bool indev_reset_check(lv_indev_t * indev)
     return indev->reset_query;
 }
 
+/**
+ * Get the direction in which a key should move the focus
+ * @param g         the group of the indev
+ * @param key       the pressed key
+ * @return          the direction for the arrow keys in spatial navigation and navigate mode,
+ *                  else `LV_DIR_NONE` to send the key to the focused object
+ */
+static lv_dir_t get_spatial_nav_dir(const lv_group_t * g, uint32_t key)
+{
+    if(!lv_group_get_spatial_nav(g) || lv_group_get_editing(g)) return LV_DIR_NONE;
+
+    switch(key) {
+        case LV_KEY_LEFT:
+            return LV_DIR_LEFT;
+        case LV_KEY_RIGHT:
+            return LV_DIR_RIGHT;
+        case LV_KEY_UP:
+            return LV_DIR_TOP;
+        case LV_KEY_DOWN:
+            return LV_DIR_BOTTOM;
+        default:
+            return LV_DIR_NONE;
+    }
+}
+
 /**
  * Checks if the stop_processing_query flag has been set. If so, do not send any events to the object
  * @param indev pointer to an input device
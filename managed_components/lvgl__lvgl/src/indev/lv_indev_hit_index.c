@@ -0,0 +1,314 @@
+/**
+ * @file lv_indev_hit_index.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../core/lv_obj_private.h"
+#include "../core/lv_obj_draw_private.h"
+#include "../misc/lv_area_private.h"
+#include "lv_indev_hit_index.h"
+
+#if LV_INDEV_HIT_INDEX
+
+#include "../stdlib/lv_mem.h"
+#include "../misc/lv_math.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+/*Children covering more cells than this are checked always instead of adding them to many cells*/
+#define MAX_CELLS_PER_CHILD     16
+
+/*Limit the number of columns and rows to keep the index small on extremely wide or tall objects*/
+#define MAX_GRID_SIZE           256
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static lv_indev_hit_index_t * get_index(lv_obj_t * obj);
+static bool rebuild(lv_obj_t * obj, lv_indev_hit_index_t * index);
+static bool get_child_area(const lv_obj_t * obj, const lv_obj_t * child, lv_area_t * area);
+static bool get_cell_range(const lv_indev_hit_index_t * index, const lv_area_t * area, lv_area_t * range);
+static void get_origin(const lv_obj_t * obj, lv_point_t * origin);
+static void free_buffers(lv_indev_hit_index_t * index);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+bool lv_indev_hit_index_query(lv_obj_t * obj, const lv_point_t * point, lv_indev_hit_index_result_t * res)
+{
+    lv_indev_hit_index_t * index = get_index(obj);
+    if(index == NULL) return false;
+
+    if(!index->valid) {
+        if(!rebuild(obj, index)) return false;
+    }
+
+    res->always_items = index->always_items;
+    res->always_cnt = index->always_cnt;
+    res->cell_items = NULL;
+    res->cell_cnt = 0;
+
+    lv_point_t origin;
+    get_origin(obj, &origin);
+
+    lv_point_t p = {point->x - origin.x, point->y - origin.y};
+    if(!lv_area_is_point_on(&index->bounds, &p, 0)) return true;
+
+    uint32_t col = (p.x - index->bounds.x1) / index->cell_w;
+    uint32_t row = (p.y - index->bounds.y1) / index->cell_h;
+    uint32_t cell = row * index->col_cnt + col;
+
+    res->cell_items = &index->cell_items[index->cell_start[cell]];
+    res->cell_cnt = index->cell_start[cell + 1] - index->cell_start[cell];
+
+    return true;
+}
+
+void lv_indev_hit_index_invalidate(lv_obj_t * obj)
+{
+    if(obj && obj->spec_attr && obj->spec_attr->hit_index) {
+        obj->spec_attr->hit_index->valid = 0;
+    }
+}
+
+bool lv_indev_hit_index_is_valid(const lv_obj_t * obj)
+{
+    return obj->spec_attr && obj->spec_attr->hit_index && obj->spec_attr->hit_index->valid;
+}
+
+void lv_indev_hit_index_delete(lv_obj_t * obj)
+{
+    if(obj->spec_attr == NULL || obj->spec_attr->hit_index == NULL) return;
+
+    free_buffers(obj->spec_attr->hit_index);
+    lv_free(obj->spec_attr->hit_index);
+    obj->spec_attr->hit_index = NULL;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static lv_indev_hit_index_t * get_index(lv_obj_t * obj)
+{
+    /*Only objects with children have spec_attr*/
+    if(obj->spec_attr == NULL) return NULL;
+
+    if(obj->spec_attr->hit_index == NULL) {
+        obj->spec_attr->hit_index = lv_malloc_zeroed(sizeof(lv_indev_hit_index_t));
+        LV_ASSERT_MALLOC(obj->spec_attr->hit_index);
+    }
+
+    return obj->spec_attr->hit_index;
+}
+
+static bool rebuild(lv_obj_t * obj, lv_indev_hit_index_t * index)
+{
+    LV_PROFILER_INDEV_BEGIN;
+
+    free_buffers(index);
+
+    uint32_t child_cnt = obj->spec_attr->child_cnt;
+    lv_obj_t ** children = obj->spec_attr->children;
+
+    /*Get the bounding box of the children to index*/
+    uint32_t indexed_cnt = 0;
+    lv_area_t bounds = {0};
+    uint32_t i;
+    for(i = 0; i < child_cnt; i++) {
+        lv_area_t a;
+        if(!get_child_area(obj, children[i], &a)) continue;
+
+        if(indexed_cnt == 0) bounds = a;
+        else lv_area_join(&bounds, &bounds, &a);
+        indexed_cnt++;
+    }
+
+    /*Use about one cell per child and keep the cells about square shaped*/
+    if(indexed_cnt == 0) {
+        index->col_cnt = 1;
+        index->row_cnt = 1;
+        bounds.x2 = bounds.x1 - 1; /*Empty area, never matches*/
+    }
+    else {
+        int32_t w = lv_area_get_width(&bounds);
+        int32_t h = lv_area_get_height(&bounds);
+        uint32_t cols = lv_sqrt32((uint32_t)(((uint64_t)indexed_cnt * w) / h));
+        cols = LV_CLAMP(1, cols, LV_MIN(indexed_cnt, MAX_GRID_SIZE));
+        uint32_t rows = (indexed_cnt + cols - 1) / cols;
+        rows = LV_CLAMP(1, rows, MAX_GRID_SIZE);
+        index->col_cnt = cols;
+        index->row_cnt = rows;
+        index->cell_w = LV_MAX((w + (int32_t)cols - 1) / (int32_t)cols, 1);
+        index->cell_h = LV_MAX((h + (int32_t)rows - 1) / (int32_t)rows, 1);
+    }
+    index->bounds = bounds;
+
+    uint32_t cell_cnt = index->col_cnt * index->row_cnt;
+    index->cell_start = lv_malloc_zeroed((cell_cnt + 1) * sizeof(uint32_t));
+    index->always_items = lv_malloc(LV_MAX(child_cnt, 1) * sizeof(uint16_t));
+    if(index->cell_start == NULL || index->always_items == NULL) {
+        free_buffers(index);
+        LV_PROFILER_INDEV_END;
+        return false;
+    }
+
+    /*Count the children on each cell. `cell_start[c + 1]` is the count of the c-th cell*/
+    uint32_t item_cnt = 0;
+    for(i = 0; i < child_cnt; i++) {
+        lv_area_t a;
+        lv_area_t range;
+        if(!get_child_area(obj, children[i], &a)) {
+            if(!lv_obj_has_flag(children[i], LV_OBJ_FLAG_HIDDEN)) {
+                index->always_items[index->always_cnt] = (uint16_t)i;
+                index->always_cnt++;
+            }
+            continue;
+        }
+
+        if(!get_cell_range(index, &a, &range)) {
+            index->always_items[index->always_cnt] = (uint16_t)i;
+            index->always_cnt++;
+            continue;
+        }
+
+        int32_t col, row;
+        for(row = range.y1; row <= range.y2; row++) {
+            for(col = range.x1; col <= range.x2; col++) {
+                index->cell_start[row * index->col_cnt + col + 1]++;
+                item_cnt++;
+            }
+        }
+    }
+
+    /*Turn the counts into start indices*/
+    uint32_t c;
+    for(c = 0; c < cell_cnt; c++) {
+        index->cell_start[c + 1] += index->cell_start[c];
+    }
+
+    index->cell_items = lv_malloc(LV_MAX(item_cnt, 1) * sizeof(uint16_t));
+    if(index->cell_items == NULL) {
+        free_buffers(index);
+        LV_PROFILER_INDEV_END;
+        return false;
+    }
+
+    /*Add the children to the cells. `cell_start[c]` is used as write position of the c-th cell*/
+    for(i = 0; i < child_cnt; i++) {
+        lv_area_t a;
+        lv_area_t range;
+        if(!get_child_area(obj, children[i], &a)) continue;
+        if(!get_cell_range(index, &a, &range)) continue;
+
+        int32_t col, row;
+        for(row = range.y1; row <= range.y2; row++) {
+            for(col = range.x1; col <= range.x2; col++) {
+                uint32_t cell = row * index->col_cnt + col;
+                index->cell_items[index->cell_start[cell]] = (uint16_t)i;
+                index->cell_start[cell]++;
+            }
+        }
+    }
+
+    /*Now `cell_start[c]` is the end of the c-th cell, i.e. the start of the next one. Shift them back*/
+    for(c = cell_cnt; c > 0; c--) {
+        index->cell_start[c] = index->cell_start[c - 1];
+    }
+    index->cell_start[0] = 0;
+
+    index->valid = 1;
+
+    LV_PROFILER_INDEV_END;
+    return true;
+}
+
+/**
+ * Get the area where `lv_indev_search_obj` can find anything on a child (the child itself or its children).
+ * @param obj       the parent
+ * @param child     the child
+ * @param area      store the area here, relative to the scrolled content of the parent
+ * @return          false: the child can't be indexed (it's hidden, floating or transformed)
+ */
+static bool get_child_area(const lv_obj_t * obj, const lv_obj_t * child, lv_area_t * area)
+{
+    if(lv_obj_has_flag_any(child, LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING)) return false;
+    if(lv_obj_get_layer_type(child) == LV_LAYER_TYPE_TRANSFORM) return false;
+
+    int32_t ext = 0;
+    if(child->spec_attr) {
+        ext = child->spec_attr->ext_click_pad;
+        if(lv_obj_has_flag(child, LV_OBJ_FLAG_OVERFLOW_VISIBLE)) ext = LV_MAX(ext, child->spec_attr->ext_draw_size);
+    }
+
+    lv_point_t origin;
+    get_origin(obj, &origin);
+
+    *area = child->coords;
+    lv_area_increase(area, ext, ext);
+    lv_area_move(area, -origin.x, -origin.y);
+
+    return true;
+}
+
+/**
+ * Get the first and last columns and rows covered by an area
+ * @param index     pointer to an index
+ * @param area      the area relative to the content
+ * @param range     store the columns in x1 and x2 and rows in y1 and y2
+ * @return          false: the area covers too many cells
+ */
+static bool get_cell_range(const lv_indev_hit_index_t * index, const lv_area_t * area, lv_area_t * range)
+{
+    range->x1 = (area->x1 - index->bounds.x1) / index->cell_w;
+    range->x2 = (area->x2 - index->bounds.x1) / index->cell_w;
+    range->y1 = (area->y1 - index->bounds.y1) / index->cell_h;
+    range->y2 = (area->y2 - index->bounds.y1) / index->cell_h;
+
+    /*The last cells might be a little bit larger due to rounding*/
+    range->x2 = LV_MIN(range->x2, (int32_t)index->col_cnt - 1);
+    range->y2 = LV_MIN(range->y2, (int32_t)index->row_cnt - 1);
+
+    return lv_area_get_size(range) <= MAX_CELLS_PER_CHILD;
+}
+
+/**
+ * Get the origin of the scrolled content. The children keep their position relative to it
+ * when the object is moved or scrolled.
+ */
+static void get_origin(const lv_obj_t * obj, lv_point_t * origin)
+{
+    origin->x = obj->coords.x1 - lv_obj_get_scroll_x(obj);
+    origin->y = obj->coords.y1 - lv_obj_get_scroll_y(obj);
+}
+
+static void free_buffers(lv_indev_hit_index_t * index)
+{
+    lv_free(index->cell_start);
+    lv_free(index->cell_items);
+    lv_free(index->always_items);
+    index->cell_start = NULL;
+    index->cell_items = NULL;
+    index->always_items = NULL;
+    index->always_cnt = 0;
+    index->valid = 0;
+}
+
+#endif /*LV_INDEV_HIT_INDEX*/
@@ -0,0 +1,116 @@
+/**
+ * @file lv_indev_hit_index.h
+ *
+ */
+
+#ifndef LV_INDEV_HIT_INDEX_H
+#define LV_INDEV_HIT_INDEX_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../core/lv_obj.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/** Build an index only for objects having at least this many children*/
+#define LV_INDEV_HIT_INDEX_MIN_CHILDREN     16
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+#if LV_INDEV_HIT_INDEX
+
+/**
+ * A uniform grid over the children of an object to quickly find
+ * the children which can be on a given point.
+ * The areas are stored relative to the scrolled content of the object
+ * so that scrolling or moving the object doesn't make the index invalid.
+ */
+struct _lv_indev_hit_index_t {
+    lv_area_t bounds;           /**< Bounding box of the indexed children relative to the content*/
+    int32_t cell_w;             /**< Width of a cell*/
+    int32_t cell_h;             /**< Height of a cell*/
+    uint32_t col_cnt;           /**< Number of columns*/
+    uint32_t row_cnt;           /**< Number of rows*/
+    uint32_t * cell_start;      /**< `cell_items[cell_start[i]..cell_start[i + 1]]` are on the i-th cell*/
+    uint16_t * cell_items;      /**< Indices of the children in increasing order in each cell*/
+    uint16_t * always_items;    /**< Indices of the children which need to be checked always*/
+    uint32_t always_cnt;        /**< Number of elements in `always_items`*/
+    uint32_t valid : 1;         /**< 0: needs to be rebuilt before use*/
+};
+
+/**
+ * The children which can be on a point, i.e. the elements of two lists
+ * in increasing order. Each child is in at most one list.
+ */
+typedef struct {
+    const uint16_t * cell_items;
+    uint32_t cell_cnt;
+    const uint16_t * always_items;
+    uint32_t always_cnt;
+} lv_indev_hit_index_result_t;
+
+#endif /*LV_INDEV_HIT_INDEX*/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+#if LV_INDEV_HIT_INDEX
+
+/**
+ * Get the indices of the children of an object which can be on a point.
+ * The other children surely won't be found by `lv_indev_search_obj`.
+ * The index is (re)built here if needed.
+ * @param obj       pointer to an object with at least `LV_INDEV_HIT_INDEX_MIN_CHILDREN` children
+ * @param point     the point in the same coordinate system as the `coords` of the children
+ * @param res       store the result here
+ * @return          false: the index couldn't be created, check all the children
+ */
+bool lv_indev_hit_index_query(lv_obj_t * obj, const lv_point_t * point, lv_indev_hit_index_result_t * res);
+
+/**
+ * Mark the index of an object as invalid. Needs to be called if the position, size,
+ * order or relevant flags of any children of `obj` change.
+ * @param obj       pointer to an object or NULL
+ */
+void lv_indev_hit_index_invalidate(lv_obj_t * obj);
+
+/**
+ * Check if the index of an object is still valid, i.e. the result of
+ * the last query can be used.
+ * @param obj       pointer to an object
+ * @return          true: the index is valid
+ */
+bool lv_indev_hit_index_is_valid(const lv_obj_t * obj);
+
+/**
+ * Free the index of an object.
+ * @param obj       pointer to an object
+ */
+void lv_indev_hit_index_delete(lv_obj_t * obj);
+
+#else
+
+#define lv_indev_hit_index_invalidate(obj) LV_UNUSED(obj)
+#define lv_indev_hit_index_delete(obj) LV_UNUSED(obj)
+
+#endif /*LV_INDEV_HIT_INDEX*/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_INDEV_HIT_INDEX_H*/
@@ -17,6 +17,7 @@ extern "C" {
 #include "../misc/lv_anim.h"
 #include "lv_indev_scroll.h"
 #include "lv_indev_gesture.h"
+#include "lv_indev_hit_index.h"
 
 /*********************
  *      DEFINES
@@ -15,6 +15,7 @@
 
 #include "lv_svg_token.h"
 #include "lv_svg_parser.h"
+#include "lv_svg_render.h"
 
 /*********************
 *      DEFINES
@@ -59,6 +60,66 @@ static bool svg_token_process_cb(_lv_svg_token_t * token, void * data)
     return _lv_svg_parser_token(parser, token);
 }
 
+static bool svg_probe_token_cb(_lv_svg_token_t * token, void * data)
+{
+    _lv_svg_parser_t * parser = (_lv_svg_parser_t *)data;
+
+    /* only the root element is needed, ignore the content around it */
+    if(token->type != LV_SVG_TOKEN_BEGIN || parser->doc_root) {
+        return true;
+    }
+    return _lv_svg_parser_token(parser, token);
+}
+
+static const char * svg_root_tag_end(const char * str, const char * str_end)
+{
+    while(str < str_end) {
+        if(*str != '<') {
+            str++;
+        }
+        else if(str_end - str >= 4 && lv_memcmp(str, "<!--", 4) == 0) {
+            /* comments can contain '>' */
+            str += 4;
+            while(str_end - str >= 3 && lv_memcmp(str, "-->", 3) != 0) {
+                str++;
+            }
+            if(str_end - str < 3) {
+                return NULL;
+            }
+            str += 3;
+        }
+        else if(str_end - str >= 2 && (str[1] == '?' || str[1] == '!')) {
+            /* xml instruction or doctype */
+            while(str < str_end && *str != '>') {
+                str++;
+            }
+            if(str == str_end) {
+                return NULL;
+            }
+            str++;
+        }
+        else {
+            /* the first element, find its end outside of the attribute values */
+            char quote = 0;
+            for(str++; str < str_end; str++) {
+                if(quote) {
+                    if(*str == quote) {
+                        quote = 0;
+                    }
+                }
+                else if(*str == '\'' || *str == '\"') {
+                    quote = *str;
+                }
+                else if(*str == '>') {
+                    return str + 1;
+                }
+            }
+            return NULL;
+        }
+    }
+    return NULL;
+}
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -107,6 +168,27 @@ lv_svg_node_t * lv_svg_load_data(const char * svg_data, uint32_t data_len)
     }
 }
 
+lv_result_t lv_svg_get_viewport_size(const char * svg_data, uint32_t data_len, float * width, float * height)
+{
+    LV_ASSERT_NULL(svg_data);
+
+    const char * root_end = svg_root_tag_end(svg_data, svg_data + data_len);
+    if(!root_end) {
+        return LV_RESULT_INVALID;
+    }
+
+    _lv_svg_parser_t parser;
+    _lv_svg_parser_init(&parser);
+
+    lv_result_t res = LV_RESULT_INVALID;
+    if(_lv_svg_tokenizer(svg_data, root_end - svg_data, svg_probe_token_cb, &parser) && parser.doc_root) {
+        res = lv_svg_render_get_node_viewport_size(parser.doc_root, width, height);
+    }
+
+    _lv_svg_parser_deinit(&parser);
+    return res;
+}
+
 lv_svg_node_t * lv_svg_node_create(lv_svg_node_t * parent)
 {
     lv_tree_node_t * node = lv_tree_node_create(&lv_svg_node_class, (lv_tree_node_t *)parent);
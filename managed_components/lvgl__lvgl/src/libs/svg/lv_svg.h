@@ -309,6 +309,17 @@ typedef struct {
  */
 lv_svg_node_t * lv_svg_load_data(const char * svg_data, uint32_t data_len);
 
+/**
+ * @brief Get the viewport size of an SVG document by parsing only its root `<svg>` element.
+ *        The DOM tree of the document is not created, so it's much cheaper than `lv_svg_load_data`.
+ * @param svg_data pointer to the SVG data, it's enough to pass the beginning of the document
+ * @param data_len the SVG data length
+ * @param width pointer to save the width of the viewport
+ * @param height pointer to save the height of the viewport
+ * @return LV_RESULT_OK: success, LV_RESULT_INVALID: the root element is not `<svg>` or is incomplete
+ */
+lv_result_t lv_svg_get_viewport_size(const char * svg_data, uint32_t data_len, float * width, float * height);
+
 /**
  * @brief Create an SVG DOM node
  * @param parent pointer to the parent node
@@ -22,10 +22,31 @@
 
 #define DECODER_NAME    "SVG"
 
+/*Read the beginning of the files in chunks of this size while looking for the root element*/
+#define SVG_PROBE_CHUNK_SIZE    512
+
+/*Give up searching the root element after this many bytes*/
+#define SVG_PROBE_MAX_SIZE      (8 * SVG_PROBE_CHUNK_SIZE)
+
+#define CACHE_NAME  "SVG_DOC"
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+/*A parsed document shared by the decoder opens of the same source*/
+typedef struct {
+    lv_svg_render_obj_t * draw_list;
+    uint32_t ref_cnt;
+} svg_doc_t;
+
+typedef struct {
+    lv_image_src_t src_type;
+    const void * src;       /**< The path of files or the SVG data of variables*/
+    uint32_t data_size;     /**< Size of the SVG data of variables*/
+    svg_doc_t * doc;
+} svg_doc_cache_data_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -33,7 +54,18 @@ static lv_result_t svg_decoder_info(lv_image_decoder_t * decoder, lv_image_decod
                                     lv_image_header_t * header);
 static lv_result_t svg_decoder_open(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc);
 static void svg_decoder_close(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc);
+static void svg_decoder_drop_cache(lv_image_decoder_t * decoder, const void * src);
 static uint8_t * alloc_file(const char * filename, uint32_t * size);
+static lv_result_t probe_file(lv_fs_file_t * file, int32_t * width, int32_t * height);
+static svg_doc_t * svg_doc_load(lv_image_decoder_dsc_t * dsc);
+static void svg_doc_cache_key_init(svg_doc_cache_data_t * key, const void * src, lv_image_src_t src_type);
+static svg_doc_t * svg_doc_cache_get(lv_image_decoder_t * decoder, const void * src, lv_image_src_t src_type);
+static void svg_doc_cache_add(lv_image_decoder_t * decoder, const void * src, lv_image_src_t src_type,
+                              svg_doc_t * doc);
+static void svg_doc_release(svg_doc_t * doc);
+static lv_cache_compare_res_t svg_doc_cache_compare_cb(const svg_doc_cache_data_t * lhs,
+                                                       const svg_doc_cache_data_t * rhs);
+static void svg_doc_cache_free_cb(svg_doc_cache_data_t * node, void * user_data);
 static void svg_draw_buf_free(void * svg_buf);
 
 static void svg_draw(lv_layer_t * layer, const lv_image_decoder_dsc_t * dsc, const lv_area_t * coords,
@@ -62,8 +94,29 @@ void lv_svg_decoder_init(void)
     lv_image_decoder_set_info_cb(dec, svg_decoder_info);
     lv_image_decoder_set_open_cb(dec, svg_decoder_open);
     lv_image_decoder_set_close_cb(dec, svg_decoder_close);
+    lv_image_decoder_set_drop_cache_cb(dec, svg_decoder_drop_cache);
 
     dec->name = DECODER_NAME;
+
+    lv_cache_t * doc_cache = lv_cache_create(&lv_cache_class_lru_rb_count,
+    sizeof(svg_doc_cache_data_t), LV_SVG_DOC_CACHE_CNT, (lv_cache_ops_t) {
+        .compare_cb = (lv_cache_compare_cb_t) svg_doc_cache_compare_cb,
+        .create_cb = NULL,
+        .free_cb = (lv_cache_free_cb_t) svg_doc_cache_free_cb
+    });
+    lv_cache_set_name(doc_cache, CACHE_NAME);
+    dec->user_data = doc_cache;
+}
+
+void lv_svg_decoder_drop_cache(void)
+{
+    lv_image_decoder_t * dec = NULL;
+    while((dec = lv_image_decoder_get_next(dec)) != NULL) {
+        if(dec->info_cb == svg_decoder_info) {
+            svg_decoder_drop_cache(dec, NULL);
+            break;
+        }
+    }
 }
 
 void lv_svg_decoder_deinit(void)
@@ -71,6 +124,7 @@ void lv_svg_decoder_deinit(void)
     lv_image_decoder_t * dec = NULL;
     while((dec = lv_image_decoder_get_next(dec)) != NULL) {
         if(dec->info_cb == svg_decoder_info) {
+            lv_cache_destroy(dec->user_data, NULL);
             lv_image_decoder_delete(dec);
             break;
         }
@@ -91,12 +145,11 @@ static lv_result_t svg_decoder_info(lv_image_decoder_t * decoder, lv_image_decod
 {
     lv_image_src_t src_type = src->src_type;
 
-    int width = 0;
-    int height = 0;
+    int32_t width = 0;
+    int32_t height = 0;
 
     if(src_type == LV_IMAGE_SRC_FILE || src_type == LV_IMAGE_SRC_VARIABLE) {
         const void * src_data = src->src;
-        uint8_t * buf = NULL;
 
         if(src_type == LV_IMAGE_SRC_FILE) {
             /*Support only "*.svg" files*/
@@ -104,72 +157,19 @@ static lv_result_t svg_decoder_info(lv_image_decoder_t * decoder, lv_image_decod
                 return LV_RESULT_INVALID;
             }
 
-            uint32_t rn;
-            lv_fs_res_t res;
-            uint32_t file_size = 0;
-            res = lv_fs_seek(&src->file, 0, LV_FS_SEEK_END);
-            if(res == LV_FS_RES_OK) {
-                lv_fs_tell(&src->file, &file_size);
-                lv_fs_seek(&src->file, 0, LV_FS_SEEK_SET); /* Reset position to start */
-            }
-#ifdef LV_USE_SVG_DEBUG
-            LV_LOG_INFO("LVGL file_size = %d.", file_size);
-
-#endif
-            if(file_size > 512)
-                file_size = 512;
-
-            buf = (uint8_t *)lv_zalloc(file_size);
-            LV_ASSERT_NULL(buf);
-            /* read some bytes for searching svg header */
-            res = lv_fs_read(&src->file, buf, file_size, &rn);
-            if(res != LV_FS_RES_OK) {
-                LV_LOG_WARN("can't open %s", (char *)src_data);
-                lv_free(buf);
-                return LV_RESULT_INVALID;
+            svg_doc_t * doc = svg_doc_cache_get(decoder, src_data, src_type);
+            if(doc) {
+                /*Already parsed, the size of the viewport is known*/
+                float w = 0;
+                float h = 0;
+                lv_svg_render_get_viewport_size(doc->draw_list, &w, &h);
+                width = (int32_t)(w + 0.5f);
+                height = (int32_t)(h + 0.5f);
+                svg_doc_release(doc);
             }
-
-            if(!valid_svg_data(buf, rn)) {
-                lv_free(buf);
+            else if(probe_file(&src->file, &width, &height) != LV_RESULT_OK) {
                 return LV_RESULT_INVALID;
             }
-
-            width = LV_DPI_DEF;
-            height = LV_DPI_DEF;
-
-            uint8_t * svg_start = NULL;
-            uint8_t * svg_end = NULL;
-            uint8_t * ptr = buf;
-            uint8_t * ptr_end = buf + file_size - 1;
-            while(ptr < ptr_end) {
-                if(*ptr == '<') {
-                    if(lv_strncmp((char *)(ptr + 1), "svg", 3) == 0) {
-                        svg_start = ptr;
-                    }
-                }
-                if(svg_start && (*ptr == '>')) {
-                    svg_end = ptr;
-                    break;
-                }
-                ptr++;
-            }
-
-            if(svg_start && svg_end) {
-                lv_svg_node_t * svg_doc = lv_svg_load_data((char *)svg_start, svg_end - svg_start);
-                lv_svg_render_obj_t * svg_header = lv_svg_render_create(svg_doc);
-                if(svg_header->tag == LV_SVG_TAG_SVG) {
-                    lv_area_t bounds;
-                    svg_header->clz->get_bounds(svg_header, &bounds);
-                    width = lv_area_get_width(&bounds) - 1;
-                    height = lv_area_get_height(&bounds) - 1;
-                }
-                lv_svg_render_delete(svg_header);
-                lv_svg_node_delete(svg_doc);
-            }
-            else
-                LV_LOG_WARN("can't find svg viewport tag end");
-
-            lv_free(buf);
         }
         else {
             const lv_image_dsc_t * img_dsc = src_data;
@@ -180,6 +180,16 @@ static lv_result_t svg_decoder_info(lv_image_decoder_t * decoder, lv_image_decod
             if(!valid_svg_data(img_dsc->data, data_size)) {
                 return LV_RESULT_INVALID;
             }
+
+            if(width == 0 || height == 0) {
+                /*The size is not set in the descriptor, read it from the root element*/
+                float w = 0;
+                float h = 0;
+                if(lv_svg_get_viewport_size((const char *)img_dsc->data, data_size, &w, &h) == LV_RESULT_OK) {
+                    width = (int32_t)(w + 0.5f);
+                    height = (int32_t)(h + 0.5f);
+                }
+            }
         }
 
         header->cf = LV_COLOR_FORMAT_ARGB8888;
@@ -197,46 +207,23 @@ static lv_result_t svg_decoder_info(lv_image_decoder_t * decoder, lv_image_decod
 
 static lv_result_t svg_decoder_open(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc)
 {
-    LV_UNUSED(decoder);
     LV_PROFILER_DECODER_BEGIN_TAG("lv_svg_decoder_open");
 
-    uint8_t * svg_data = NULL;
-    uint32_t svg_data_size = 0;
-
-    if(dsc->src_type == LV_IMAGE_SRC_FILE) {
-        const char * fn = dsc->src;
-        if(lv_strcmp(lv_fs_get_ext(fn), "svg") == 0) {              /*Check the extension*/
-
-            svg_data = alloc_file(fn, &svg_data_size);
-            if(svg_data == NULL) {
-                LV_LOG_WARN("can't load file: %s", (const char *)dsc->src);
-                LV_PROFILER_DECODER_END_TAG("lv_svg_decoder_open");
-                return LV_RESULT_INVALID;
-            }
-
-        }
-        else {
-            LV_PROFILER_DECODER_END_TAG("lv_svg_decoder_open");
-            return LV_RESULT_INVALID;
-        }
-    }
-    else if(dsc->src_type == LV_IMAGE_SRC_VARIABLE) {
-        const lv_image_dsc_t * img_dsc = dsc->src;
-        svg_data = (uint8_t *)img_dsc->data;
-        svg_data_size = (uint32_t)img_dsc->data_size;
-    }
-    else {
+    if(dsc->src_type != LV_IMAGE_SRC_FILE && dsc->src_type != LV_IMAGE_SRC_VARIABLE) {
         LV_PROFILER_DECODER_END_TAG("lv_svg_decoder_open");
         return LV_RESULT_INVALID;
     }
 
-    lv_svg_node_t * svg_doc = lv_svg_load_data((char *)svg_data, svg_data_size);
-    lv_svg_render_obj_t * draw_list = lv_svg_render_create(svg_doc);
-
-    if(dsc->src_type == LV_IMAGE_SRC_FILE) {
-        lv_free(svg_data);
+    /*Parse the document only if it's not shared by an other open yet*/
+    svg_doc_t * doc = dsc->args.no_cache ? NULL : svg_doc_cache_get(decoder, dsc->src, dsc->src_type);
+    if(doc == NULL) {
+        doc = svg_doc_load(dsc);
+        if(doc == NULL) {
+            LV_PROFILER_DECODER_END_TAG("lv_svg_decoder_open");
+            return LV_RESULT_INVALID;
+        }
+        if(!dsc->args.no_cache) svg_doc_cache_add(decoder, dsc->src, dsc->src_type, doc);
     }
-    lv_svg_node_delete(svg_doc);
 
     /* create a fake draw_buf object */
     lv_draw_buf_t * draw_buf = lv_zalloc(sizeof(lv_draw_buf_t));
@@ -248,8 +235,8 @@ static lv_result_t svg_decoder_open(lv_image_decoder_t * decoder, lv_image_decod
     draw_buf->header.stride = 4;
     draw_buf->header.magic = LV_IMAGE_HEADER_MAGIC;
     draw_buf->data = NULL;
-    draw_buf->unaligned_data = (void *)draw_list;
-    draw_buf->data_size = lv_svg_render_get_size(draw_list);
+    draw_buf->unaligned_data = (void *)doc;
+    draw_buf->data_size = lv_svg_render_get_size(doc->draw_list);
     draw_buf->handlers = &_svg_draw_buf_handler;
 
     dsc->decoded = draw_buf;
@@ -283,6 +270,22 @@ static void svg_decoder_close(lv_image_decoder_t * decoder, lv_image_decoder_dsc
        !lv_image_cache_is_enabled()) lv_draw_buf_destroy((lv_draw_buf_t *)dsc->decoded);
 }
 
+static void svg_decoder_drop_cache(lv_image_decoder_t * decoder, const void * src)
+{
+    lv_cache_t * doc_cache = decoder->user_data;
+    if(src == NULL) {
+        lv_cache_drop_all(doc_cache, NULL);
+        return;
+    }
+
+    lv_image_src_t src_type = lv_image_src_get_type(src);
+    if(src_type != LV_IMAGE_SRC_FILE && src_type != LV_IMAGE_SRC_VARIABLE) return;
+
+    svg_doc_cache_data_t search_key;
+    svg_doc_cache_key_init(&search_key, src, src_type);
+    lv_cache_drop(doc_cache, &search_key, NULL);
+}
+
 static uint8_t * alloc_file(const char * filename, uint32_t * size)
 {
     uint8_t * data = NULL;
@@ -337,17 +340,219 @@ failed:
     return data;
 }
 
+static lv_result_t probe_file(lv_fs_file_t * file, int32_t * width, int32_t * height)
+{
+    char * buf = NULL;
+    uint32_t data_size = 0;
+
+    if(lv_fs_seek(file, 0, LV_FS_SEEK_SET) != LV_FS_RES_OK) {
+        return LV_RESULT_INVALID;
+    }
+
+    /*Read only as much as needed to find the end of the root element*/
+    while(data_size < SVG_PROBE_MAX_SIZE) {
+        char * new_buf = lv_realloc(buf, data_size + SVG_PROBE_CHUNK_SIZE + 1);
+        LV_ASSERT_MALLOC(new_buf);
+        if(new_buf == NULL) {
+            lv_free(buf);
+            return LV_RESULT_INVALID;
+        }
+        buf = new_buf;
+
+        uint32_t rn = 0;
+        if(lv_fs_read(file, buf + data_size, SVG_PROBE_CHUNK_SIZE, &rn) != LV_FS_RES_OK) {
+            LV_LOG_WARN("can't read the svg file");
+            lv_free(buf);
+            return LV_RESULT_INVALID;
+        }
+        data_size += rn;
+        buf[data_size] = '\0';
+
+        if(!valid_svg_data((uint8_t *)buf, data_size)) {
+            lv_free(buf);
+            return LV_RESULT_INVALID;
+        }
+
+        float w = 0;
+        float h = 0;
+        if(lv_svg_get_viewport_size(buf, data_size, &w, &h) == LV_RESULT_OK) {
+            *width = (int32_t)(w + 0.5f);
+            *height = (int32_t)(h + 0.5f);
+            lv_free(buf);
+            return LV_RESULT_OK;
+        }
+
+        if(rn < SVG_PROBE_CHUNK_SIZE) break; /*End of the file*/
+    }
+
+    LV_LOG_WARN("can't find svg viewport tag end");
+    *width = LV_DPI_DEF;
+    *height = LV_DPI_DEF;
+    lv_free(buf);
+    return LV_RESULT_OK;
+}
+
+static svg_doc_t * svg_doc_load(lv_image_decoder_dsc_t * dsc)
+{
+    uint8_t * svg_data = NULL;
+    uint32_t svg_data_size = 0;
+
+    if(dsc->src_type == LV_IMAGE_SRC_FILE) {
+        const char * fn = dsc->src;
+        if(lv_strcmp(lv_fs_get_ext(fn), "svg") != 0) {              /*Check the extension*/
+            return NULL;
+        }
+
+        svg_data = alloc_file(fn, &svg_data_size);
+        if(svg_data == NULL) {
+            LV_LOG_WARN("can't load file: %s", fn);
+            return NULL;
+        }
+    }
+    else {
+        const lv_image_dsc_t * img_dsc = dsc->src;
+        svg_data = (uint8_t *)img_dsc->data;
+        svg_data_size = (uint32_t)img_dsc->data_size;
+    }
+
+    lv_svg_node_t * svg_doc = lv_svg_load_data((char *)svg_data, svg_data_size);
+    lv_svg_render_obj_t * draw_list = lv_svg_render_create(svg_doc);
+
+    if(dsc->src_type == LV_IMAGE_SRC_FILE) {
+        lv_free(svg_data);
+    }
+    lv_svg_node_delete(svg_doc);
+
+    svg_doc_t * doc = lv_malloc(sizeof(svg_doc_t));
+    LV_ASSERT_MALLOC(doc);
+    if(doc == NULL) {
+        lv_svg_render_delete(draw_list);
+        return NULL;
+    }
+
+    doc->draw_list = draw_list;
+    doc->ref_cnt = 1;
+    return doc;
+}
+
+/**
+ * Initialize the key of a document in the cache.
+ * The descriptors of variables might be reused for other data so they are identified by the data itself.
+ */
+static void svg_doc_cache_key_init(svg_doc_cache_data_t * key, const void * src, lv_image_src_t src_type)
+{
+    lv_memzero(key, sizeof(svg_doc_cache_data_t));
+    key->src_type = src_type;
+    if(src_type == LV_IMAGE_SRC_VARIABLE) {
+        const lv_image_dsc_t * img_dsc = src;
+        key->src = img_dsc->data;
+        key->data_size = img_dsc->data_size;
+    }
+    else {
+        key->src = src;
+    }
+}
+
+/**
+ * Get a parsed document from the cache of the decoder.
+ * The returned document must be released with `svg_doc_release`.
+ */
+static svg_doc_t * svg_doc_cache_get(lv_image_decoder_t * decoder, const void * src, lv_image_src_t src_type)
+{
+    lv_cache_t * doc_cache = decoder->user_data;
+    if(!lv_cache_is_enabled(doc_cache)) return NULL;
+
+    svg_doc_cache_data_t search_key;
+    svg_doc_cache_key_init(&search_key, src, src_type);
+
+    lv_cache_entry_t * entry = lv_cache_acquire(doc_cache, &search_key, NULL);
+    if(entry == NULL) return NULL;
+
+    svg_doc_cache_data_t * cached_data = lv_cache_entry_get_data(entry);
+    svg_doc_t * doc = cached_data->doc;
+    doc->ref_cnt++;
+    lv_cache_release(doc_cache, entry, NULL);
+
+    return doc;
+}
+
+static void svg_doc_cache_add(lv_image_decoder_t * decoder, const void * src, lv_image_src_t src_type,
+                              svg_doc_t * doc)
+{
+    lv_cache_t * doc_cache = decoder->user_data;
+    if(!lv_cache_is_enabled(doc_cache)) return;
+
+    svg_doc_cache_data_t search_key;
+    svg_doc_cache_key_init(&search_key, src, src_type);
+    if(src_type == LV_IMAGE_SRC_FILE) search_key.src = lv_strdup(src);
+    search_key.doc = doc;
+
+    lv_cache_entry_t * entry = lv_cache_add(doc_cache, &search_key, NULL);
+    if(entry == NULL) {
+        if(src_type == LV_IMAGE_SRC_FILE) lv_free((void *)search_key.src);
+        return;
+    }
+
+    /*The cache keeps a reference until the entry is evicted*/
+    doc->ref_cnt++;
+    lv_cache_release(doc_cache, entry, NULL);
+}
+
+static void svg_doc_release(svg_doc_t * doc)
+{
+    LV_ASSERT(doc->ref_cnt > 0);
+    doc->ref_cnt--;
+    if(doc->ref_cnt == 0) {
+        lv_svg_render_delete(doc->draw_list);
+        lv_free(doc);
+    }
+}
+
+static lv_cache_compare_res_t svg_doc_cache_compare_cb(const svg_doc_cache_data_t * lhs,
+                                                       const svg_doc_cache_data_t * rhs)
+{
+    if(lhs->src_type != rhs->src_type) {
+        return lhs->src_type > rhs->src_type ? 1 : -1;
+    }
+
+    if(lhs->src_type == LV_IMAGE_SRC_FILE) {
+        int32_t cmp_res = lv_strcmp(lhs->src, rhs->src);
+        if(cmp_res != 0) {
+            return cmp_res > 0 ? 1 : -1;
+        }
+    }
+    else {
+        if(lhs->src != rhs->src) {
+            return lhs->src > rhs->src ? 1 : -1;
+        }
+
+        if(lhs->data_size != rhs->data_size) {
+            return lhs->data_size > rhs->data_size ? 1 : -1;
+        }
+    }
+
+    return 0;
+}
+
+static void svg_doc_cache_free_cb(svg_doc_cache_data_t * node, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    if(node->src_type == LV_IMAGE_SRC_FILE) lv_free((void *)node->src);
+    svg_doc_release(node->doc);
+}
+
 static void svg_draw_buf_free(void * svg_buf)
 {
-    lv_svg_render_obj_t * draw_list = (lv_svg_render_obj_t *)svg_buf;
-    lv_svg_render_delete(draw_list);
+    svg_doc_release((svg_doc_t *)svg_buf);
 }
 
 static void svg_draw(lv_layer_t * layer, const lv_image_decoder_dsc_t * decoder_dsc, const lv_area_t * coords,
                      const lv_draw_image_dsc_t * image_dsc, const lv_area_t * clip_area)
 {
     const lv_draw_buf_t * draw_buf = decoder_dsc->decoded;
-    const lv_svg_render_obj_t * list = draw_buf->unaligned_data;
+    const svg_doc_t * doc = draw_buf->unaligned_data;
+    const lv_svg_render_obj_t * list = doc->draw_list;
 
     LV_PROFILER_DRAW_BEGIN;
 
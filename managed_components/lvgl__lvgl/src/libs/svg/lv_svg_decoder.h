@@ -38,6 +38,13 @@ void lv_svg_decoder_init(void);
 
 void lv_svg_decoder_deinit(void);
 
+/**
+ * Drop all the parsed SVG documents shared between the opens of the same source.
+ * The documents still used by opened images are freed when those are closed.
+ * `lv_image_cache_drop` drops them too.
+ */
+void lv_svg_decoder_drop_cache(void);
+
 /**********************
  *      MACROS
  **********************/
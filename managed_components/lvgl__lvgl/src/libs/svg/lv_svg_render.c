@@ -2554,6 +2554,30 @@ lv_result_t lv_svg_render_get_viewport_size(const lv_svg_render_obj_t * render,
     return LV_RESULT_OK;
 }
 
+lv_result_t lv_svg_render_get_node_viewport_size(const lv_svg_node_t * node, float * width, float * height)
+{
+    if(!node || node->type != LV_SVG_TAG_SVG) {
+        LV_LOG_WARN("Invalid svg node");
+        return LV_RESULT_INVALID;
+    }
+
+    /* apply only the sizing attributes on a temporary viewport, no render list is created */
+    lv_svg_render_viewport_t view;
+    lv_memzero(&view, sizeof(view));
+    view.base.clz = &svg_viewport_class;
+    _init_viewport(LV_SVG_RENDER_OBJ(&view), node);
+
+    uint32_t len = lv_array_size(&node->attrs);
+    for(uint32_t i = 0; i < len; i++) {
+        const lv_svg_attr_t * attr = lv_array_at(&node->attrs, i);
+        if(attr->id == LV_SVG_ATTR_WIDTH || attr->id == LV_SVG_ATTR_HEIGHT || attr->id == LV_SVG_ATTR_VIEWBOX) {
+            _set_viewport_attr(LV_SVG_RENDER_OBJ(&view), NULL, attr);
+        }
+    }
+
+    return lv_svg_render_get_viewport_size(LV_SVG_RENDER_OBJ(&view), width, height);
+}
+
 void lv_draw_svg_render(lv_draw_vector_dsc_t * dsc, const lv_svg_render_obj_t * render)
 {
     if(!render || !dsc) {
@@ -102,6 +102,15 @@ uint32_t lv_svg_render_get_size(const lv_svg_render_obj_t * render);
  */
 lv_result_t lv_svg_render_get_viewport_size(const lv_svg_render_obj_t * render, float * width, float * height);
 
+/**
+ * @brief Get the viewport's width and height of an `<svg>` node without creating its render object
+ * @param node pointer to the `<svg>` node of the SVG document
+ * @param width pointer to save the width of the viewport
+ * @param height pointer to save the height of the viewport
+ * @return lv_result_t, LV_RESULT_OK if success, LV_RESULT_INVALID if fail
+ */
+lv_result_t lv_svg_render_get_node_viewport_size(const lv_svg_node_t * node, float * width, float * height);
+
 /**
  * @brief Render an SVG object to a vector graphics
  * @param dsc pointer to the vector graphics descriptor
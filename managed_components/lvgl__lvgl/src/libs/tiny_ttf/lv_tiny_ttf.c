@@ -10,8 +10,12 @@
 
 #if LV_USE_TINY_TTF != 0
 #include "../../core/lv_global.h"
+#include "../../misc/cache/lv_cache_private.h"
+#include "../../misc/lv_text_private.h"
 
 #define font_draw_buf_handlers &(LV_GLOBAL_DEFAULT()->font_draw_buf_handlers)
+#define bitmap_cache LV_GLOBAL_DEFAULT()->tiny_ttf_bitmap_cache
+#define gamma_table LV_GLOBAL_DEFAULT()->tiny_ttf_gamma_table
 
 /*********************
  *      DEFINES
@@ -54,7 +58,6 @@ static void ttf_cb_stream_seek(ttf_cb_stream_t * stream, size_t position);
 
 typedef struct ttf_font_desc {
     lv_cache_t * glyph_cache;
-    lv_cache_t * draw_data_cache;
     lv_cache_t * kerning_cache;
     stbtt_fontinfo info;
     lv_fs_file_t file;
@@ -63,34 +66,52 @@ typedef struct ttf_font_desc {
 #else
     const uint8_t * stream;
 #endif
+    /**
+     * Protects `scale` and `font_size` as they can be changed while an other thread prefetches glyphs.
+     * The stream has only one read position so it's also protected by the lock.
+     */
+    lv_mutex_t lock;
     float scale;
     int ascent;
     int descent;
     int cache_size;
+    uint32_t id;        /**< Identifies the font in the bitmap cache shared by all fonts*/
+    int32_t font_size;
     lv_font_kerning_t kerning;
 } ttf_font_desc_t;
 
 typedef struct _tiny_ttf_glyph_cache_data_t {
     lv_font_glyph_dsc_t glyph_dsc;
     uint32_t unicode;
+    int32_t font_size;
     int adv_w;
 } tiny_ttf_glyph_cache_data_t;
 
+typedef struct {
+    ttf_font_desc_t * dsc;
+    float scale;        /**< The scale belonging to the font size of the key*/
+} tiny_ttf_glyph_cache_create_data_t;
+
 typedef struct  {
     int glyph1_idx;
     int glyph2_idx;
+    int32_t font_size;
     uint16_t adv_w16;
 } tiny_ttf_kerning_cache_data_t;
 
 typedef struct {
-    const ttf_font_desc_t * dsc;
+    ttf_font_desc_t * dsc;
+    float scale;        /**< The scale belonging to the font size of the key*/
     int adv_w;
 } tiny_ttf_kerning_cache_create_data_t;
 
 typedef struct _lv_tiny_ttf_cache_data_t {
-    lv_draw_buf_t * draw_buf;
+    lv_cache_slot_size_t slot;  /**< Size of the bitmap, must be the first field*/
+    uint32_t font_id;
+    int32_t font_size;
     uint32_t glyph_index;
-    uint32_t size;
+    lv_draw_buf_t * draw_buf;
+    bool uncached;              /**< Not added to the cache, destroy it when it's released*/
 } tiny_ttf_cache_data_t;
 
 /**********************
@@ -120,6 +141,14 @@ static lv_cache_compare_res_t tiny_ttf_kerning_cache_compare_cb(const tiny_ttf_k
                                                                 const tiny_ttf_kerning_cache_data_t * rhs);
 
 static void lv_tiny_ttf_cache_create(ttf_font_desc_t * dsc);
+static inline void ttf_lock(ttf_font_desc_t * dsc);
+static inline void ttf_unlock(ttf_font_desc_t * dsc);
+static float ttf_get_scale(ttf_font_desc_t * dsc, int32_t * font_size);
+static lv_draw_buf_t * ttf_render_glyph(ttf_font_desc_t * dsc, uint32_t glyph_index, float scale);
+static lv_cache_entry_t * ttf_bitmap_cache_acquire(ttf_font_desc_t * dsc, uint32_t glyph_index, bool * created);
+static void ttf_bitmap_cache_release(lv_cache_entry_t * entry);
+static uint32_t ttf_bitmap_cache_ref(void);
+static void ttf_bitmap_cache_unref(void);
 
 static lv_font_t * tiny_ttf_font_create_cb(const lv_font_info_t * info, const void * src);
 static void tiny_ttf_font_delete_cb(lv_font_t * font);
@@ -145,6 +174,12 @@ const lv_font_class_t lv_tiny_ttf_font_class = {
  *      MACROS
  **********************/
 
+/**
+ * The bitmaps are rendered into a cache shared by all fonts.
+ * It's not used if the font has no cache or the shared cache has no space.
+ */
+#define ttf_bitmap_cache_used(dsc) ((dsc)->cache_size != 0 && LV_TINY_TTF_CACHE_BITMAP_SIZE > 0)
+
 /**********************
  *   GLOBAL FUNCTIONS
  **********************/
@@ -156,29 +191,19 @@ void lv_tiny_ttf_set_size(lv_font_t * font, int32_t font_size)
         return;
     }
     ttf_font_desc_t * dsc = (ttf_font_desc_t *)font->dsc;
-    dsc->scale = stbtt_ScaleForMappingEmToPixels(&dsc->info, font_size);
+
+    /* The glyphs, the kerning values and the bitmaps are cached per size,
+     * so the caches are kept and can be used by an other thread meanwhile */
+    lv_mutex_lock(&dsc->lock);
+    float scale = stbtt_ScaleForMappingEmToPixels(&dsc->info, font_size);
     int line_gap = 0;
     stbtt_GetFontVMetrics(&dsc->info, &dsc->ascent, &dsc->descent, &line_gap);
-    font->line_height = (int32_t)(dsc->scale * (dsc->ascent - dsc->descent + line_gap));
-    font->base_line = (int32_t)(dsc->scale * (line_gap - dsc->descent));
-
-    /* size change means cache needs to be invalidated. */
-
-    if(dsc->glyph_cache) {
-        lv_cache_destroy(dsc->glyph_cache, NULL);
-        dsc->glyph_cache = NULL;
-    }
-
-    if(dsc->draw_data_cache) {
-        lv_cache_destroy(dsc->draw_data_cache, NULL);
-        dsc->draw_data_cache = NULL;
-    }
-    if(dsc->kerning_cache) {
-        lv_cache_destroy(dsc->kerning_cache, NULL);
-        dsc->kerning_cache = NULL;
-    }
+    dsc->scale = scale;
+    dsc->font_size = font_size;
+    lv_mutex_unlock(&dsc->lock);
 
-    lv_tiny_ttf_cache_create(dsc);
+    font->line_height = (int32_t)(scale * (dsc->ascent - dsc->descent + line_gap));
+    font->base_line = (int32_t)(scale * (line_gap - dsc->descent));
 }
 
 void lv_tiny_ttf_destroy(lv_font_t * font)
@@ -192,16 +217,48 @@ void lv_tiny_ttf_destroy(lv_font_t * font)
             lv_fs_close(&ttf->file);
         }
 #endif
+        lv_mutex_delete(&ttf->lock);
         lv_cache_destroy(ttf->glyph_cache, NULL);
-        lv_cache_destroy(ttf->draw_data_cache, NULL);
         lv_cache_destroy(ttf->kerning_cache, NULL);
         lv_free(ttf);
         font->dsc = NULL;
+        ttf_bitmap_cache_unref();
     }
 
     lv_free(font);
 }
 
+uint32_t lv_tiny_ttf_prefetch_text(const lv_font_t * font, const char * text)
+{
+    LV_ASSERT_NULL(font);
+    LV_ASSERT_NULL(text);
+
+    ttf_font_desc_t * dsc = (ttf_font_desc_t *)font->dsc;
+    if(!ttf_bitmap_cache_used(dsc)) return 0;
+
+    uint32_t cnt = 0;
+    uint32_t i = 0;
+    while(text[i] != '\0') {
+        uint32_t letter;
+        uint32_t letter_next;
+        lv_text_encoded_letter_next_2(text, &letter, &letter_next, &i);
+
+        /* Also caches the kerning of the letter pairs */
+        lv_font_glyph_dsc_t g;
+        if(!ttf_get_glyph_dsc_cb(font, &g, letter, letter_next)) continue;
+        if(g.box_w == 0 || g.box_h == 0) continue;
+
+        bool created;
+        lv_cache_entry_t * entry = ttf_bitmap_cache_acquire(dsc, g.gid.index, &created);
+        if(entry == NULL) continue;
+
+        ttf_bitmap_cache_release(entry);
+        if(created) cnt++;
+    }
+
+    return cnt;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -237,6 +294,44 @@ static void ttf_cb_stream_seek(ttf_cb_stream_t * stream, size_t position)
 }
 #endif
 
+/**
+ * Lock the font while the stb_truetype functions read it.
+ * Only streams need it, the fonts in memory can be read from more threads at once.
+ * Don't use a cache or `ttf_get_scale` while the lock is held to avoid dead locks.
+ */
+static inline void ttf_lock(ttf_font_desc_t * dsc)
+{
+#if LV_TINY_TTF_FILE_SUPPORT != 0
+    lv_mutex_lock(&dsc->lock);
+#else
+    LV_UNUSED(dsc);
+#endif
+}
+
+static inline void ttf_unlock(ttf_font_desc_t * dsc)
+{
+#if LV_TINY_TTF_FILE_SUPPORT != 0
+    lv_mutex_unlock(&dsc->lock);
+#else
+    LV_UNUSED(dsc);
+#endif
+}
+
+/**
+ * Get the current scale and font size together as an other thread might change them meanwhile.
+ * @param dsc           the font
+ * @param font_size     store the font size belonging to the scale here
+ * @return              the scale
+ */
+static float ttf_get_scale(ttf_font_desc_t * dsc, int32_t * font_size)
+{
+    lv_mutex_lock(&dsc->lock);
+    float scale = dsc->scale;
+    *font_size = dsc->font_size;
+    lv_mutex_unlock(&dsc->lock);
+    return scale;
+}
+
 static inline uint16_t ttf_calculate_kerning_width(float scale, uint16_t adv_w, int k)
 {
 
@@ -244,16 +339,19 @@ static inline uint16_t ttf_calculate_kerning_width(float scale, uint16_t adv_w,
     return (uint16_t)(scale * (adv_w + k) + 0.5f);
 }
 
-static uint16_t ttf_get_glyph_pair_kerning_width(const ttf_font_desc_t * dsc, uint32_t g1, uint32_t g2, int adv_w)
+static uint16_t ttf_get_glyph_pair_kerning_width(ttf_font_desc_t * dsc, int32_t font_size, float scale,
+                                                 uint32_t g1, uint32_t g2, int adv_w)
 {
     tiny_ttf_kerning_cache_data_t kerning_cache_search_key = {
         .glyph1_idx = g1,
         .glyph2_idx = g2,
+        .font_size = font_size,
     };
 
     tiny_ttf_kerning_cache_create_data_t kerning_cache_create_data = {
         .adv_w = adv_w,
         .dsc = dsc,
+        .scale = scale,
     };
 
     if(dsc->kerning_cache->max_size == 0) {
@@ -270,8 +368,9 @@ static uint16_t ttf_get_glyph_pair_kerning_width(const ttf_font_desc_t * dsc, ui
     tiny_ttf_kerning_cache_data_t * data = lv_cache_entry_get_data(kerning_entry);
     LV_ASSERT_NULL(data);
 
-    lv_cache_release(dsc->glyph_cache, kerning_entry, NULL);
-    return data->adv_w16;
+    uint16_t adv_w16 = data->adv_w16;
+    lv_cache_release(dsc->kerning_cache, kerning_entry, NULL);
+    return adv_w16;
 }
 
 static bool ttf_get_glyph_dsc_cb(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t unicode_letter,
@@ -296,30 +395,39 @@ static bool ttf_get_glyph_dsc_cb(const lv_font_t * font, lv_font_glyph_dsc_t * d
         .unicode = unicode_letter,
     };
 
+    tiny_ttf_glyph_cache_create_data_t create_data = {
+        .dsc = dsc,
+    };
+    create_data.scale = ttf_get_scale(dsc, &search_key.font_size);
 
     int adv_w;
-    lv_cache_entry_t * entry = lv_cache_acquire_or_create(dsc->glyph_cache, &search_key, (void *)dsc);
+    lv_cache_entry_t * entry = lv_cache_acquire_or_create(dsc->glyph_cache, &search_key, &create_data);
 
     if(entry == NULL) {
         if(!dsc->cache_size) {  /* no cache, do everything directly */
-            int g1 = stbtt_FindGlyphIndex(&dsc->info, (int)unicode_letter);
-            tiny_ttf_glyph_cache_create_cb(&search_key, dsc);
+            if(!tiny_ttf_glyph_cache_create_cb(&search_key, &create_data)) {
+                return false;
+            }
+            int g1 = (int)search_key.glyph_dsc.gid.index;
             *dsc_out = search_key.glyph_dsc;
             adv_w = search_key.adv_w;
 
             /*Kerning correction*/
             if(font->kerning == LV_FONT_KERNING_NORMAL &&
                unicode_letter_next != 0) {
+                ttf_lock(dsc);
                 int g2 = stbtt_FindGlyphIndex(&dsc->info, (int)unicode_letter_next); /* not using cache, only do glyph id lookup */
+                ttf_unlock(dsc);
                 if(g2) {
-                    dsc_out->adv_w = ttf_get_glyph_pair_kerning_width(dsc, g1, g2, adv_w);
+                    dsc_out->adv_w = ttf_get_glyph_pair_kerning_width(dsc, search_key.font_size, create_data.scale,
+                                                                      g1, g2, adv_w);
                 }
             }
 
             dsc_out->entry = NULL;
             return true;
         }
-        LV_LOG_ERROR("cache not allocated");
+        /* Glyph not found */
         return false;
     }
 
@@ -335,10 +443,12 @@ static bool ttf_get_glyph_dsc_cb(const lv_font_t * font, lv_font_glyph_dsc_t * d
 
         int g2 = 0;
         search_key.unicode = unicode_letter_next; /* reuse search key */
-        lv_cache_entry_t * entry_next = lv_cache_acquire_or_create(dsc->glyph_cache, &search_key, (void *)dsc);
+        lv_cache_entry_t * entry_next = lv_cache_acquire_or_create(dsc->glyph_cache, &search_key, &create_data);
 
         if(entry_next == NULL) {
+            ttf_lock(dsc);
             g2 = stbtt_FindGlyphIndex(&dsc->info, (int)unicode_letter_next);
+            ttf_unlock(dsc);
         }
         else {
             tiny_ttf_glyph_cache_data_t * data_next = lv_cache_entry_get_data(entry_next);
@@ -346,7 +456,8 @@ static bool ttf_get_glyph_dsc_cb(const lv_font_t * font, lv_font_glyph_dsc_t * d
             lv_cache_release(dsc->glyph_cache, entry_next, NULL);
         }
         if(g2) {
-            dsc_out->adv_w = ttf_get_glyph_pair_kerning_width(dsc, g1, g2, adv_w);
+            dsc_out->adv_w = ttf_get_glyph_pair_kerning_width(dsc, search_key.font_size, create_data.scale,
+                                                              g1, g2, adv_w);
         }
     }
 
@@ -360,24 +471,17 @@ static const void * ttf_get_glyph_bitmap_cb(lv_font_glyph_dsc_t * g_dsc, lv_draw
     uint32_t glyph_index = g_dsc->gid.index;
     const lv_font_t * font = g_dsc->resolved_font;
     ttf_font_desc_t * dsc = (ttf_font_desc_t *)font->dsc;
-    tiny_ttf_cache_data_t search_key = {
-        .glyph_index = glyph_index,
-        .size = font->line_height,
-    };
 
-    lv_cache_entry_t * entry = lv_cache_acquire_or_create(dsc->draw_data_cache, &search_key, (void *)font->dsc);
+    if(!ttf_bitmap_cache_used(dsc)) {  /* no cache, do everything directly */
+        /* use the cache entry to store the buffer if no cache specified */
+        int32_t font_size;
+        float scale = ttf_get_scale(dsc, &font_size);
+        g_dsc->entry = (lv_cache_entry_t *)ttf_render_glyph(dsc, glyph_index, scale);
+        return g_dsc->entry;
+    }
+
+    lv_cache_entry_t * entry = ttf_bitmap_cache_acquire(dsc, glyph_index, NULL);
     if(entry == NULL) {
-        if(!dsc->cache_size) {  /* no cache, do everything directly */
-            if(tiny_ttf_draw_data_cache_create_cb(&search_key, (void *)font->dsc)) {
-                /* use the cache entry to store the buffer if no cache specified */
-                g_dsc->entry = (lv_cache_entry_t *)search_key.draw_buf;
-                return g_dsc->entry;
-            }
-            else {
-                return NULL;
-            }
-        }
-        LV_LOG_ERROR("cache not allocated");
         return NULL;
     }
 
@@ -391,18 +495,193 @@ static void ttf_release_glyph_cb(const lv_font_t * font, lv_font_glyph_dsc_t * g
     LV_ASSERT_NULL(font);
 
     ttf_font_desc_t * dsc = (ttf_font_desc_t *)font->dsc;
-    if(!dsc->cache_size) {  /* no cache, do everything directly */
+    if(g_dsc->entry == NULL) {
+        return;
+    }
+
+    if(!ttf_bitmap_cache_used(dsc)) {  /* no cache, do everything directly */
         lv_draw_buf_destroy((lv_draw_buf_t *)g_dsc->entry);
     }
     else {
-        if(g_dsc->entry == NULL) {
-            return;
-        }
-        lv_cache_release(dsc->draw_data_cache, g_dsc->entry, NULL);
+        ttf_bitmap_cache_release(g_dsc->entry);
     }
     g_dsc->entry = NULL;
 }
 
+/**
+ * Rasterize a glyph into a new draw buffer.
+ * No cache is locked meanwhile so the other draw units can keep using the cached glyphs.
+ * @param dsc           the font
+ * @param glyph_index   index of the glyph in the font
+ * @param scale         scale of the glyph
+ * @return              the new A8 draw buffer or NULL on error
+ */
+static lv_draw_buf_t * ttf_render_glyph(ttf_font_desc_t * dsc, uint32_t glyph_index, float scale)
+{
+    int g1 = (int)glyph_index;
+    if(g1 == 0) {
+        /* Glyph not found */
+        return NULL;
+    }
+
+    const stbtt_fontinfo * info = (const stbtt_fontinfo *)&dsc->info;
+    int x1, y1, x2, y2;
+    ttf_lock(dsc);
+    stbtt_GetGlyphBitmapBox(info, g1, scale, scale, &x1, &y1, &x2, &y2);
+    ttf_unlock(dsc);
+    int w, h;
+    w = x2 - x1 + 1;
+    h = y2 - y1 + 1;
+
+    lv_draw_buf_t * draw_buf = lv_draw_buf_create_ex(font_draw_buf_handlers, w, h, LV_COLOR_FORMAT_A8, LV_STRIDE_AUTO);
+    if(NULL == draw_buf) {
+        LV_LOG_ERROR("tiny_ttf: out of memory");
+        return NULL;
+    }
+
+    lv_draw_buf_clear(draw_buf, NULL);
+
+    uint32_t stride = draw_buf->header.stride;
+    ttf_lock(dsc);
+    stbtt_MakeGlyphBitmap(info, draw_buf->data, w, h, stride, scale, scale, g1);
+    ttf_unlock(dsc);
+
+#if LV_TINY_TTF_GAMMA != 100
+    /* stb_truetype calculates the covered area but the colors are mixed in the non-linear color space
+     * which makes the edges look too light. Correct the coverage to compensate it. */
+    int x, y;
+    for(y = 0; y < h; y++) {
+        uint8_t * row = draw_buf->data + y * stride;
+        for(x = 0; x < w; x++) {
+            row[x] = gamma_table[row[x]];
+        }
+    }
+#endif
+
+    lv_draw_buf_flush_cache(draw_buf, NULL);
+    return draw_buf;
+}
+
+/**
+ * Get a glyph's bitmap from the shared cache or render and add it if it's not cached yet.
+ * If the bitmap can't be added to the cache (it's too large or all entries are in use)
+ * a detached entry is returned which is not part of the cache.
+ * @param dsc           the font
+ * @param glyph_index   index of the glyph in the font
+ * @param created       set to true if the glyph was rendered and added to the cache now (can be NULL)
+ * @return              the acquired entry (release it with `ttf_bitmap_cache_release`) or NULL on error
+ */
+static lv_cache_entry_t * ttf_bitmap_cache_acquire(ttf_font_desc_t * dsc, uint32_t glyph_index, bool * created)
+{
+    if(created) *created = false;
+
+    tiny_ttf_cache_data_t search_key = {
+        .font_id = dsc->id,
+        .glyph_index = glyph_index,
+    };
+    float scale = ttf_get_scale(dsc, &search_key.font_size);
+
+    lv_cache_entry_t * entry = lv_cache_acquire(bitmap_cache, &search_key, NULL);
+    if(entry != NULL) {
+        return entry;
+    }
+
+    lv_draw_buf_t * draw_buf = ttf_render_glyph(dsc, glyph_index, scale);
+    if(draw_buf == NULL) {
+        return NULL;
+    }
+
+    search_key.slot.size = draw_buf->data_size;
+    entry = lv_cache_acquire_or_create(bitmap_cache, &search_key, draw_buf);
+    if(entry == NULL) {
+        LV_LOG_INFO("tiny_ttf: the glyph's bitmap (%" LV_PRIu32 " bytes) is not cached", draw_buf->data_size);
+        entry = lv_cache_entry_alloc(sizeof(tiny_ttf_cache_data_t), bitmap_cache);
+        if(entry == NULL) {
+            lv_draw_buf_destroy(draw_buf);
+            return NULL;
+        }
+
+        tiny_ttf_cache_data_t * uncached_data = lv_cache_entry_get_data(entry);
+        *uncached_data = search_key;
+        uncached_data->draw_buf = draw_buf;
+        uncached_data->uncached = true;
+        return entry;
+    }
+
+    tiny_ttf_cache_data_t * cached_data = lv_cache_entry_get_data(entry);
+    if(cached_data->draw_buf != draw_buf) {
+        /* An other thread has added the same glyph meanwhile */
+        lv_draw_buf_destroy(draw_buf);
+    }
+    else if(created) {
+        *created = true;
+    }
+
+    return entry;
+}
+
+/**
+ * Release an entry returned by `ttf_bitmap_cache_acquire`.
+ * @param entry         the entry to release
+ */
+static void ttf_bitmap_cache_release(lv_cache_entry_t * entry)
+{
+    tiny_ttf_cache_data_t * data = lv_cache_entry_get_data(entry);
+    if(data->uncached) {
+        lv_draw_buf_destroy(data->draw_buf);
+        lv_cache_entry_delete(entry);
+    }
+    else {
+        lv_cache_release(bitmap_cache, entry, NULL);
+    }
+}
+
+/**
+ * Register a new font. The shared bitmap cache is created with the first font.
+ * @return a new unique id for the font
+ */
+static uint32_t ttf_bitmap_cache_ref(void)
+{
+    lv_global_t * g = LV_GLOBAL_DEFAULT();
+    if(g->tiny_ttf_font_count == 0) {
+        g->tiny_ttf_bitmap_cache = lv_cache_create(&lv_cache_class_lru_rb_size, sizeof(tiny_ttf_cache_data_t),
+                                                   LV_TINY_TTF_CACHE_BITMAP_SIZE,
+        (lv_cache_ops_t) {
+            .compare_cb = (lv_cache_compare_cb_t)tiny_ttf_draw_data_cache_compare_cb,
+            .create_cb = (lv_cache_create_cb_t)tiny_ttf_draw_data_cache_create_cb,
+            .free_cb = (lv_cache_free_cb_t)tiny_ttf_draw_data_cache_free_cb,
+        });
+        lv_cache_set_name(g->tiny_ttf_bitmap_cache, "TINY_TTF_DRAW_DATA");
+
+#if LV_TINY_TTF_GAMMA != 100
+        uint32_t i;
+        for(i = 0; i < 256; i++) {
+            g->tiny_ttf_gamma_table[i] = (uint8_t)(STBTT_pow(i / 255.0, 100.0 / LV_TINY_TTF_GAMMA) * 255.0 + 0.5);
+        }
+#endif
+    }
+
+    g->tiny_ttf_font_count++;
+    g->tiny_ttf_font_id++;
+    return g->tiny_ttf_font_id;
+}
+
+/**
+ * Unregister a deleted font. The shared bitmap cache is freed with the last font.
+ * Until then the bitmaps of the deleted fonts are freed when they become the least recently used.
+ */
+static void ttf_bitmap_cache_unref(void)
+{
+    lv_global_t * g = LV_GLOBAL_DEFAULT();
+    LV_ASSERT(g->tiny_ttf_font_count > 0);
+
+    g->tiny_ttf_font_count--;
+    if(g->tiny_ttf_font_count == 0) {
+        lv_cache_destroy(g->tiny_ttf_bitmap_cache, NULL);
+        g->tiny_ttf_bitmap_cache = NULL;
+    }
+}
+
 static void lv_tiny_ttf_cache_create(ttf_font_desc_t * dsc)
 {
     /*Init cache*/
@@ -414,14 +693,6 @@ static void lv_tiny_ttf_cache_create(ttf_font_desc_t * dsc)
     });
     lv_cache_set_name(dsc->glyph_cache, "TINY_TTF_GLYPH");
 
-    dsc->draw_data_cache = lv_cache_create(&lv_cache_class_lru_rb_count, sizeof(tiny_ttf_cache_data_t), dsc->cache_size,
-    (lv_cache_ops_t) {
-        .compare_cb = (lv_cache_compare_cb_t)tiny_ttf_draw_data_cache_compare_cb,
-        .create_cb = (lv_cache_create_cb_t)tiny_ttf_draw_data_cache_create_cb,
-        .free_cb = (lv_cache_free_cb_t)tiny_ttf_draw_data_cache_free_cb,
-    });
-    lv_cache_set_name(dsc->draw_data_cache, "TINY_TTF_DRAW_DATA");
-
     dsc->kerning_cache = lv_cache_create(&lv_cache_class_lru_rb_count, sizeof(tiny_ttf_kerning_cache_data_t),
                                          LV_TINY_TTF_CACHE_KERNING_CNT,
     (lv_cache_ops_t) {
@@ -459,6 +730,9 @@ static lv_font_t * lv_tiny_ttf_create(const char * path, const void * data, size
         dsc->stream.size = data_size;
     }
     if(0 == stbtt_InitFont(&dsc->info, &dsc->stream, stbtt_GetFontOffsetForIndex(&dsc->stream, 0))) {
+        if(path != NULL) {
+            lv_fs_close(&dsc->file);
+        }
         lv_free(dsc);
         LV_LOG_ERROR("tiny_ttf: init failed");
         return NULL;
@@ -477,6 +751,11 @@ static lv_font_t * lv_tiny_ttf_create(const char * path, const void * data, size
 
     lv_font_t * out_font = lv_malloc_zeroed(sizeof(lv_font_t));
     if(out_font == NULL) {
+#if LV_TINY_TTF_FILE_SUPPORT != 0
+        if(path != NULL) {
+            lv_fs_close(&dsc->file);
+        }
+#endif
         lv_free(dsc);
         LV_LOG_ERROR("tiny_ttf: out of memory");
         return NULL;
@@ -491,6 +770,9 @@ static lv_font_t * lv_tiny_ttf_create(const char * path, const void * data, size
 
     dsc->kerning = kerning;
     out_font->kerning = kerning;
+    lv_mutex_init(&dsc->lock);
+    dsc->id = ttf_bitmap_cache_ref();
+    lv_tiny_ttf_cache_create(dsc);
 
     out_font->get_glyph_dsc = ttf_get_glyph_dsc_cb;
     out_font->get_glyph_bitmap = ttf_get_glyph_bitmap_cb;
@@ -527,28 +809,33 @@ lv_font_t * lv_tiny_ttf_create_data(const void * data, size_t data_size, int32_t
 
 static bool tiny_ttf_glyph_cache_create_cb(tiny_ttf_glyph_cache_data_t * node, void * user_data)
 {
-    ttf_font_desc_t * dsc = (ttf_font_desc_t *)user_data;
+    tiny_ttf_glyph_cache_create_data_t * create_data = (tiny_ttf_glyph_cache_create_data_t *)user_data;
+    ttf_font_desc_t * dsc = create_data->dsc;
+    const float scale = create_data->scale;
     lv_font_glyph_dsc_t * dsc_out = &node->glyph_dsc;
 
     uint32_t unicode_letter = node->unicode;
 
+    ttf_lock(dsc);
     int g1 = stbtt_FindGlyphIndex(&dsc->info, (int)unicode_letter);
     if(g1 == 0) {
+        ttf_unlock(dsc);
         /* Glyph not found */
         return false;
     }
     int x1, y1, x2, y2;
 
-    stbtt_GetGlyphBitmapBox(&dsc->info, g1, dsc->scale, dsc->scale, &x1, &y1, &x2, &y2);
+    stbtt_GetGlyphBitmapBox(&dsc->info, g1, scale, scale, &x1, &y1, &x2, &y2);
 
     int advw;
     int lsb;
     stbtt_GetGlyphHMetrics(&dsc->info, g1, &advw, &lsb);
+    ttf_unlock(dsc);
     if(dsc->kerning != LV_FONT_KERNING_NORMAL) { /* calculate default advance */
-        dsc_out->adv_w = ttf_get_glyph_pair_kerning_width(dsc, g1, 0, advw);
+        dsc_out->adv_w = ttf_get_glyph_pair_kerning_width(dsc, node->font_size, scale, g1, 0, advw);
     }
     else {
-        dsc_out->adv_w = ttf_calculate_kerning_width(dsc->scale, advw, 0);
+        dsc_out->adv_w = ttf_calculate_kerning_width(scale, advw, 0);
     }
     /* precalculate no kerning value */
     node->adv_w = advw;
@@ -576,40 +863,18 @@ static lv_cache_compare_res_t tiny_ttf_glyph_cache_compare_cb(const tiny_ttf_gly
         return lhs->unicode > rhs->unicode ? 1 : -1;
     }
 
+    if(lhs->font_size != rhs->font_size) {
+        return lhs->font_size > rhs->font_size ? 1 : -1;
+    }
+
     return 0;
 }
 
 static bool tiny_ttf_draw_data_cache_create_cb(tiny_ttf_cache_data_t * node, void * user_data)
 {
-    int g1 = (int)node->glyph_index;
-    if(g1 == 0) {
-        /* Glyph not found */
-        return false;
-    }
-
-    ttf_font_desc_t * dsc = (ttf_font_desc_t *)user_data;
-
-    const stbtt_fontinfo * info = (const stbtt_fontinfo *)&dsc->info;
-    int x1, y1, x2, y2;
-    stbtt_GetGlyphBitmapBox(info, g1, dsc->scale, dsc->scale, &x1, &y1, &x2, &y2);
-    int w, h;
-    w = x2 - x1 + 1;
-    h = y2 - y1 + 1;
-
-    lv_draw_buf_t * draw_buf = lv_draw_buf_create_ex(font_draw_buf_handlers, w, h, LV_COLOR_FORMAT_A8, LV_STRIDE_AUTO);
-    if(NULL == draw_buf) {
-        LV_LOG_ERROR("tiny_ttf: out of memory");
-        return false;
-    }
-
-    lv_draw_buf_clear(draw_buf, NULL);
-
-    uint32_t stride = draw_buf->header.stride;
-    stbtt_MakeGlyphBitmap(info, draw_buf->data, w, h, stride, dsc->scale, dsc->scale, g1);
-
-    lv_draw_buf_flush_cache(draw_buf, NULL);
-    node->draw_buf = draw_buf;
-    return true;
+    /* The glyph is rendered before adding it to the cache, just take it over */
+    node->draw_buf = (lv_draw_buf_t *)user_data;
+    return node->draw_buf != NULL;
 }
 
 static void tiny_ttf_draw_data_cache_free_cb(tiny_ttf_cache_data_t * node, void * user_data)
@@ -626,8 +891,12 @@ static lv_cache_compare_res_t tiny_ttf_draw_data_cache_compare_cb(const tiny_ttf
         return lhs->glyph_index > rhs->glyph_index ? 1 : -1;
     }
 
-    if(lhs->size != rhs->size) {
-        return lhs->size > rhs->size ? 1 : -1;
+    if(lhs->font_size != rhs->font_size) {
+        return lhs->font_size > rhs->font_size ? 1 : -1;
+    }
+
+    if(lhs->font_id != rhs->font_id) {
+        return lhs->font_id > rhs->font_id ? 1 : -1;
     }
 
     return 0;
@@ -636,10 +905,12 @@ static lv_cache_compare_res_t tiny_ttf_draw_data_cache_compare_cb(const tiny_ttf
 static bool tiny_ttf_kerning_cache_create_cb(tiny_ttf_kerning_cache_data_t * node, void * user_data)
 {
     tiny_ttf_kerning_cache_create_data_t * create_data = (tiny_ttf_kerning_cache_create_data_t *)user_data;
-    const ttf_font_desc_t * dsc = create_data->dsc;
+    ttf_font_desc_t * dsc = create_data->dsc;
     const int adv_w = create_data->adv_w;
+    ttf_lock(dsc);
     const int k = stbtt_GetGlyphKernAdvance(&dsc->info, node->glyph1_idx, node->glyph2_idx);
-    node->adv_w16 = ttf_calculate_kerning_width(dsc->scale, adv_w, k);
+    ttf_unlock(dsc);
+    node->adv_w16 = ttf_calculate_kerning_width(create_data->scale, adv_w, k);
     return true;
 }
 
@@ -652,6 +923,10 @@ static void tiny_ttf_kerning_cache_free_cb(tiny_ttf_kerning_cache_data_t * node,
 static lv_cache_compare_res_t tiny_ttf_kerning_cache_compare_cb(const tiny_ttf_kerning_cache_data_t * lhs,
                                                                 const tiny_ttf_kerning_cache_data_t * rhs)
 {
+    if(lhs->font_size != rhs->font_size) {
+        return lhs->font_size > rhs->font_size ? 1 : -1;
+    }
+
     lv_cache_compare_res_t ret = lhs->glyph1_idx - rhs->glyph1_idx;
     if(ret == 0) {
         return lhs->glyph2_idx - rhs->glyph2_idx;
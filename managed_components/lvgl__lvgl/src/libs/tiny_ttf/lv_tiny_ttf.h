@@ -82,12 +82,24 @@ lv_font_t * lv_tiny_ttf_create_data_ex(const void * data, size_t data_size, int3
 
 /**
  * Set the size of the font to a new font_size
- * @note the font bitmap cache and glyph cache will be flushed.
+ * @note the glyphs and their bitmaps are cached per size so the caches are kept.
+ *       It can be called while `lv_tiny_ttf_prefetch_text` runs in an other thread.
  * @param font        the font object
  * @param font_size   the font size in pixel
  */
 void lv_tiny_ttf_set_size(lv_font_t * font, int32_t font_size);
 
+/**
+ * Render the glyphs of a text into the glyph bitmap cache shared by all Tiny TTF fonts,
+ * so drawing the text later doesn't need to rasterize them.
+ * It can be called from an other thread too, e.g. to prepare the text of the next screen while drawing.
+ * @note only the glyphs of `font` are rendered, not the glyphs of its fallback fonts
+ * @param font        the font object
+ * @param text        the UTF-8 text whose glyphs should be rendered
+ * @return            number of glyphs which were not in the cache yet
+ */
+uint32_t lv_tiny_ttf_prefetch_text(const lv_font_t * font, const char * text);
+
 /**
  * Destroy a font previously created with lv_tiny_ttf_create_xxxx()
  * @param font        the font object
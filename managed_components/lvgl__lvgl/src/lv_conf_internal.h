@@ -642,6 +642,19 @@
         #endif
     #endif
 
+    /** Size of the cache for the flattened paths and coverage masks of `lv_draw_vector` in bytes.
+     *  Used only if the vector graphics are rendered without ThorVG.
+     *  Paths which are drawn again with the same scale and rotation are not rasterized again,
+     *  only blended, even if they are moved by whole pixels or their color changes.
+     *  - 0: disables caching */
+    #ifndef LV_DRAW_SW_VECTOR_CACHE_SIZE
+        #ifdef CONFIG_LV_DRAW_SW_VECTOR_CACHE_SIZE
+            #define LV_DRAW_SW_VECTOR_CACHE_SIZE CONFIG_LV_DRAW_SW_VECTOR_CACHE_SIZE
+        #else
+            #define LV_DRAW_SW_VECTOR_CACHE_SIZE    0
+        #endif
+    #endif
+
 #endif
 
 /*Use TSi's aka (Think Silicon) NemaGFX */
@@ -1489,6 +1502,48 @@
     #endif
 #endif
 
+/** Index the children of objects having many children on a grid to find
+ *  the pressed object quickly on dense screens (e.g. large button grids or lists). */
+#ifndef LV_INDEV_HIT_INDEX
+    #ifdef CONFIG_LV_INDEV_HIT_INDEX
+        #define LV_INDEV_HIT_INDEX CONFIG_LV_INDEV_HIT_INDEX
+    #else
+        #define LV_INDEV_HIT_INDEX      0
+    #endif
+#endif
+
+/** Cache the visible area of the ancestors and whether they are hidden in each object
+ *  to make invalidation independent of the depth of the object in the tree.
+ *  Adds 6 x 32-bit variables and a pointer to each `lv_obj_t` */
+#ifndef LV_OBJ_VISIBILITY_CACHE
+    #ifdef CONFIG_LV_OBJ_VISIBILITY_CACHE
+        #define LV_OBJ_VISIBILITY_CACHE CONFIG_LV_OBJ_VISIBILITY_CACHE
+    #else
+        #define LV_OBJ_VISIBILITY_CACHE 0
+    #endif
+#endif
+
+/** Maximum time in ms spent in each `lv_timer_handler()` call on deleting the objects
+ *  passed to `lv_obj_delete_incremental()` */
+#ifndef LV_OBJ_DELETE_INCREMENTAL_TIME
+    #ifdef CONFIG_LV_OBJ_DELETE_INCREMENTAL_TIME
+        #define LV_OBJ_DELETE_INCREMENTAL_TIME CONFIG_LV_OBJ_DELETE_INCREMENTAL_TIME
+    #else
+        #define LV_OBJ_DELETE_INCREMENTAL_TIME  2
+    #endif
+#endif
+
+/** Don't refresh the object (layout, children, extra draw size, etc.) when one of its local
+ *  style properties is set, only mark what needs to be refreshed. All the marked objects
+ *  are refreshed once before the next layout update. */
+#ifndef LV_OBJ_STYLE_DEFERRED_REFRESH
+    #ifdef CONFIG_LV_OBJ_STYLE_DEFERRED_REFRESH
+        #define LV_OBJ_STYLE_DEFERRED_REFRESH CONFIG_LV_OBJ_STYLE_DEFERRED_REFRESH
+    #else
+        #define LV_OBJ_STYLE_DEFERRED_REFRESH   0
+    #endif
+#endif
+
 /** Add `id` field to `lv_obj_t` */
 #ifndef LV_USE_OBJ_ID
     #ifdef CONFIG_LV_USE_OBJ_ID
@@ -1969,6 +2024,16 @@
     #endif
 #endif
 
+/** Number of letters cached per text while resolving glyphs from fallback fonts.
+ *  Used only by fonts having a `fallback`. Must be a power of 2. */
+#ifndef LV_FONT_FALLBACK_CACHE_SIZE
+    #ifdef CONFIG_LV_FONT_FALLBACK_CACHE_SIZE
+        #define LV_FONT_FALLBACK_CACHE_SIZE CONFIG_LV_FONT_FALLBACK_CACHE_SIZE
+    #else
+        #define LV_FONT_FALLBACK_CACHE_SIZE 32
+    #endif
+#endif
+
 /*=================
  *  TEXT SETTINGS
  *=================*/
@@ -3159,6 +3224,23 @@
             #define LV_TINY_TTF_CACHE_KERNING_CNT 256
         #endif
     #endif
+    /** Size of the glyph bitmap cache shared by all Tiny TTF fonts and sizes [bytes] */
+    #ifndef LV_TINY_TTF_CACHE_BITMAP_SIZE
+        #ifdef CONFIG_LV_TINY_TTF_CACHE_BITMAP_SIZE
+            #define LV_TINY_TTF_CACHE_BITMAP_SIZE CONFIG_LV_TINY_TTF_CACHE_BITMAP_SIZE
+        #else
+            #define LV_TINY_TTF_CACHE_BITMAP_SIZE (128 * 1024)
+        #endif
+    #endif
+    /** Gamma applied to the rasterized glyph coverage, in hundredths.
+     *  100: linear coverage (no correction); >100: darker, heavier anti-aliased edges. */
+    #ifndef LV_TINY_TTF_GAMMA
+        #ifdef CONFIG_LV_TINY_TTF_GAMMA
+            #define LV_TINY_TTF_GAMMA CONFIG_LV_TINY_TTF_GAMMA
+        #else
+            #define LV_TINY_TTF_GAMMA 100
+        #endif
+    #endif
 #endif
 
 /** Rlottie library */
@@ -3180,7 +3262,8 @@
 #endif
 
 /** Enable Vector Graphic APIs
- *  Requires `LV_USE_MATRIX = 1` */
+ *  Requires `LV_USE_MATRIX = 1`
+ *  With the software renderer ThorVG is used if enabled, else a built-in lightweight rasterizer. */
 #ifndef LV_USE_VECTOR_GRAPHIC
     #ifdef CONFIG_LV_USE_VECTOR_GRAPHIC
         #define LV_USE_VECTOR_GRAPHIC CONFIG_LV_USE_VECTOR_GRAPHIC
@@ -3250,6 +3333,17 @@
         #define LV_USE_SVG_DEBUG 0
     #endif
 #endif
+/** Number of parsed SVG documents to keep, keyed by their source.
+ *  Opening an already parsed SVG again (e.g. the same icon on many images or
+ *  redrawing it with the image cache disabled) shares its render list instead of parsing it again.
+ *  0 to disable. */
+#ifndef LV_SVG_DOC_CACHE_CNT
+    #ifdef CONFIG_LV_SVG_DOC_CACHE_CNT
+        #define LV_SVG_DOC_CACHE_CNT CONFIG_LV_SVG_DOC_CACHE_CNT
+    #else
+        #define LV_SVG_DOC_CACHE_CNT 0
+    #endif
+#endif
 
 /** FFmpeg library for image decoding and playing videos.
  *  Supports all major image formats so do not enable other image decoder with it. */
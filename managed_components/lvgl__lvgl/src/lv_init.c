@@ -143,6 +143,11 @@ static inline void lv_global_init(lv_global_t * global)
     global->event_last_register_id = LV_EVENT_LAST;
     lv_rand_set_seed(0x1234ABCD);
 
+#if LV_OBJ_VISIBILITY_CACHE
+    /*The cache of new objects is zeroed so don't start from 0*/
+    global->obj_visibility_gen = 1;
+#endif
+
 #ifdef LV_LOG_PRINT_CB
     void LV_LOG_PRINT_CB(lv_log_level_t, const char * txt);
     global->custom_log_print_cb = LV_LOG_PRINT_CB;
@@ -463,6 +468,10 @@ void lv_deinit(void)
     lv_theme_mono_deinit();
 #endif
 
+#if LV_USE_SVG
+    lv_svg_decoder_deinit();
+#endif
+
     lv_image_decoder_deinit();
 
     lv_refr_deinit();
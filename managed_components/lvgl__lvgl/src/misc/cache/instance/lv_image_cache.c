@@ -82,6 +82,12 @@ void lv_image_cache_drop(const void * src)
     /*If user invalidate image, the header cache should be invalidated too.*/
     lv_image_header_cache_drop(src);
 
+    /*And the data which the decoders cache themselves*/
+    lv_image_decoder_t * dec = NULL;
+    while((dec = lv_image_decoder_get_next(dec)) != NULL) {
+        if(dec->drop_cache_cb) dec->drop_cache_cb(dec, src);
+    }
+
     if(src == NULL) {
         lv_cache_drop_all(img_cache_p, NULL);
         return;
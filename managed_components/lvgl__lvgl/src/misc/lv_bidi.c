@@ -287,6 +287,163 @@ void lv_bidi_set_custom_neutrals_static(const char * neutrals)
     custom_neutrals = neutrals;
 }
 
+lv_result_t lv_bidi_text_process(lv_bidi_text_t * bidi_text, const char * txt, lv_base_dir_t base_dir,
+                                 const lv_font_t * font, const lv_text_attributes_t * attributes)
+{
+    lv_bidi_text_reset(bidi_text);
+
+    if(base_dir == LV_BASE_DIR_AUTO) base_dir = lv_bidi_detect_base_dir(txt);
+
+    lv_text_attributes_t line_attributes = *attributes;
+
+    /*Break the lines first to allocate the other buffers at once*/
+    uint32_t line_cnt = 0;
+    uint32_t lines_size = 0;
+    uint32_t byte_start = 0;
+    uint32_t char_start = 0;
+    while(1) {
+        /*Keep one more element for the end of the text*/
+        if(line_cnt + 1 >= lines_size) {
+            lines_size = lines_size ? lines_size * 2 : 8;
+            lv_bidi_text_line_t * lines = lv_realloc(bidi_text->lines, lines_size * sizeof(lv_bidi_text_line_t));
+            if(lines == NULL) {
+                lv_bidi_text_reset(bidi_text);
+                return LV_RESULT_INVALID;
+            }
+            bidi_text->lines = lines;
+        }
+
+        bidi_text->lines[line_cnt].byte_start = byte_start;
+        bidi_text->lines[line_cnt].char_start = char_start;
+        if(txt[byte_start] == '\0') break;
+
+        uint32_t line_len = lv_text_get_next_line(&txt[byte_start], LV_TEXT_LEN_MAX - byte_start, font, NULL,
+                                                  &line_attributes);
+        uint32_t line_char_cnt = get_txt_len(&txt[byte_start], line_len);
+        if(line_len == 0 || line_char_cnt > GET_POS(UINT16_MAX)) {
+            lv_bidi_text_reset(bidi_text);
+            return LV_RESULT_INVALID;
+        }
+
+        byte_start += line_len;
+        char_start += line_char_cnt;
+        line_cnt++;
+    }
+
+    bidi_text->line_cnt = line_cnt;
+    if(line_cnt == 0) return LV_RESULT_OK;
+
+    bidi_text->txt = lv_malloc(byte_start + line_cnt);
+    bidi_text->logical_pos = lv_malloc(char_start * sizeof(uint16_t));
+    bidi_text->visual_pos = lv_malloc(char_start * sizeof(uint16_t));
+    if(bidi_text->txt == NULL || bidi_text->logical_pos == NULL || bidi_text->visual_pos == NULL) {
+        lv_bidi_text_reset(bidi_text);
+        return LV_RESULT_INVALID;
+    }
+
+    bool reordered = false;
+    uint32_t i;
+    for(i = 0; i < line_cnt; i++) {
+        byte_start = bidi_text->lines[i].byte_start;
+        char_start = bidi_text->lines[i].char_start;
+        uint32_t line_len = bidi_text->lines[i + 1].byte_start - byte_start;
+        uint32_t line_char_cnt = bidi_text->lines[i + 1].char_start - char_start;
+
+        /*Each line is closed by a '\0' so the lines can be used as strings*/
+        uint16_t * logical_pos = &bidi_text->logical_pos[char_start];
+        lv_bidi_process_paragraph(&txt[byte_start], &bidi_text->txt[byte_start + i], line_len, base_dir,
+                                  logical_pos, (uint16_t)line_char_cnt);
+
+        uint32_t c;
+        for(c = 0; c < line_char_cnt; c++) {
+            uint16_t pos = logical_pos[c];
+            if(pos != c) reordered = true;
+            bidi_text->visual_pos[char_start + GET_POS(pos)] = SET_RTL_POS(c, IS_RTL_POS(pos));
+        }
+    }
+
+    /*Only the lines are needed if the text is shown as it is*/
+    if(!reordered) {
+        lv_free(bidi_text->txt);
+        lv_free(bidi_text->logical_pos);
+        lv_free(bidi_text->visual_pos);
+        bidi_text->txt = NULL;
+        bidi_text->logical_pos = NULL;
+        bidi_text->visual_pos = NULL;
+    }
+
+    return LV_RESULT_OK;
+}
+
+void lv_bidi_text_reset(lv_bidi_text_t * bidi_text)
+{
+    lv_free(bidi_text->txt);
+    lv_free(bidi_text->logical_pos);
+    lv_free(bidi_text->visual_pos);
+    lv_free(bidi_text->lines);
+    lv_memzero(bidi_text, sizeof(lv_bidi_text_t));
+}
+
+const lv_bidi_text_line_t * lv_bidi_text_find_line(const lv_bidi_text_t * bidi_text, uint32_t line_start,
+                                                   uint32_t line_end)
+{
+    if(bidi_text->lines == NULL) return NULL;
+
+    /*Binary search for the line starting at `line_start`*/
+    uint32_t min = 0;
+    uint32_t max = bidi_text->line_cnt;
+    while(min < max) {
+        uint32_t mid = min + (max - min) / 2;
+        uint32_t mid_start = bidi_text->lines[mid].byte_start;
+        if(mid_start == line_start) {
+            /*It's the same line only if it ends at the same place too*/
+            if(bidi_text->lines[mid + 1].byte_start != line_end) return NULL;
+            return &bidi_text->lines[mid];
+        }
+        else if(mid_start < line_start) min = mid + 1;
+        else max = mid;
+    }
+
+    return NULL;
+}
+
+const char * lv_bidi_text_get_line_text(const lv_bidi_text_t * bidi_text, const lv_bidi_text_line_t * line,
+                                        const char * txt)
+{
+    if(bidi_text->txt == NULL) return &txt[line->byte_start];
+
+    uint32_t line_id = (uint32_t)(line - bidi_text->lines);
+    return &bidi_text->txt[line->byte_start + line_id];
+}
+
+uint32_t lv_bidi_text_get_logical_pos(const lv_bidi_text_t * bidi_text, const lv_bidi_text_line_t * line,
+                                      uint32_t visual_pos, bool * is_rtl)
+{
+    uint32_t line_char_cnt = line[1].char_start - line->char_start;
+    if(bidi_text->logical_pos == NULL || visual_pos >= line_char_cnt) {
+        if(is_rtl) *is_rtl = false;
+        return visual_pos;
+    }
+
+    uint16_t pos = bidi_text->logical_pos[line->char_start + visual_pos];
+    if(is_rtl) *is_rtl = IS_RTL_POS(pos);
+    return GET_POS(pos);
+}
+
+uint32_t lv_bidi_text_get_visual_pos(const lv_bidi_text_t * bidi_text, const lv_bidi_text_line_t * line,
+                                     uint32_t logical_pos, bool * is_rtl)
+{
+    uint32_t line_char_cnt = line[1].char_start - line->char_start;
+    if(bidi_text->visual_pos == NULL || logical_pos >= line_char_cnt) {
+        if(is_rtl) *is_rtl = false;
+        return logical_pos;
+    }
+
+    uint16_t pos = bidi_text->visual_pos[line->char_start + logical_pos];
+    if(is_rtl) *is_rtl = IS_RTL_POS(pos);
+    return GET_POS(pos);
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
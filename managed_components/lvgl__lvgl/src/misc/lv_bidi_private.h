@@ -15,6 +15,7 @@ extern "C" {
  *********************/
 
 #include "lv_bidi.h"
+#include "lv_text_private.h"
 #if LV_USE_BIDI
 
 /*********************
@@ -25,6 +26,24 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+typedef struct {
+    uint32_t byte_start;        /**< Byte index of the line in the original text*/
+    uint32_t char_start;        /**< Character index of the line in the original text*/
+} lv_bidi_text_line_t;
+
+/**
+ * A multi-line text processed by the Bidi algorithm line by line.
+ * It is stored e.g. by the label to not process the text again on every redraw.
+ */
+struct _lv_bidi_text_t {
+    char * txt;                     /**< The lines in visual order, each closed by a `'\0'`.
+                                     *   `NULL` if the text is shown in logical order*/
+    uint16_t * logical_pos;         /**< Logical position of the visual characters in their line. MSB: RTL*/
+    uint16_t * visual_pos;          /**< Visual position of the logical characters in their line. MSB: RTL*/
+    lv_bidi_text_line_t * lines;    /**< The lines and a closing element with the end of the text*/
+    uint32_t line_cnt;
+};
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -88,6 +107,69 @@ uint16_t lv_bidi_get_visual_pos(const char * str_in, char ** bidi_txt, uint16_t
 void lv_bidi_process_paragraph(const char * str_in, char * str_out, uint32_t len, lv_base_dir_t base_dir,
                                uint16_t * pos_conv_out, uint16_t pos_conv_len);
 
+/**
+ * Break a text to lines and Bidi process the lines with their position maps.
+ * The lines are broken the same way as `lv_draw_label` does.
+ * @param bidi_text     store the result here. Free it with `lv_bidi_text_reset()`
+ * @param txt           the text to process
+ * @param base_dir      base dir of the text
+ * @param font          font of the text
+ * @param attributes    letter space, flags and max. width to break the lines
+ * @return              LV_RESULT_OK: processed. If the visual order is the same as the logical
+ *                      only the lines are stored and `bidi_text->txt` is `NULL`.
+ *                      LV_RESULT_INVALID: out of memory or too long line, nothing is stored
+ */
+lv_result_t lv_bidi_text_process(lv_bidi_text_t * bidi_text, const char * txt, lv_base_dir_t base_dir,
+                                 const lv_font_t * font, const lv_text_attributes_t * attributes);
+
+/**
+ * Free the buffers of a processed text
+ * @param bidi_text     pointer to a processed text
+ */
+void lv_bidi_text_reset(lv_bidi_text_t * bidi_text);
+
+/**
+ * Find a line of a processed text
+ * @param bidi_text     pointer to a processed text
+ * @param line_start    byte index of the start of the line in the original text
+ * @param line_end      byte index of the end of the line in the original text
+ * @return              the line or `NULL` if the text was processed with other line breaks
+ */
+const lv_bidi_text_line_t * lv_bidi_text_find_line(const lv_bidi_text_t * bidi_text, uint32_t line_start,
+                                                   uint32_t line_end);
+
+/**
+ * Get the visual text of a line
+ * @param bidi_text     pointer to a processed text
+ * @param line          a line returned by `lv_bidi_text_find_line()`
+ * @param txt           the original text
+ * @return              the line in visual order. It's in `txt` if the text is shown in logical order
+ */
+const char * lv_bidi_text_get_line_text(const lv_bidi_text_t * bidi_text, const lv_bidi_text_line_t * line,
+                                        const char * txt);
+
+/**
+ * Get the logical position of a character in a line of a processed text
+ * @param bidi_text     pointer to a processed text
+ * @param line          a line returned by `lv_bidi_text_find_line()`
+ * @param visual_pos    the visual character position in the line
+ * @param is_rtl        tell the char at `visual_pos` is RTL or LTR context. Can be `NULL`
+ * @return              the logical character position in the line
+ */
+uint32_t lv_bidi_text_get_logical_pos(const lv_bidi_text_t * bidi_text, const lv_bidi_text_line_t * line,
+                                      uint32_t visual_pos, bool * is_rtl);
+
+/**
+ * Get the visual position of a character in a line of a processed text
+ * @param bidi_text     pointer to a processed text
+ * @param line          a line returned by `lv_bidi_text_find_line()`
+ * @param logical_pos   the logical character position in the line
+ * @param is_rtl        tell the char at `logical_pos` is RTL or LTR context. Can be `NULL`
+ * @return              the visual character position in the line
+ */
+uint32_t lv_bidi_text_get_visual_pos(const lv_bidi_text_t * bidi_text, const lv_bidi_text_line_t * line,
+                                     uint32_t logical_pos, bool * is_rtl);
+
 /**********************
  *      MACROS
  **********************/
@@ -124,6 +124,15 @@ void lv_text_get_size_attributes(lv_point_t * size_res, const char * text, const
         attributes->max_width = LV_COORD_MAX;
     }
 
+    /*The same letters are measured by the line breaking and the line width calculation too,
+     *so resolve the fallback fonts only once*/
+    lv_font_fallback_cache_t fallback_cache;
+    lv_font_fallback_cache_t * fallback_cache_ori = attributes->fallback_cache;
+    if(fallback_cache_ori == NULL && font->fallback) {
+        lv_font_fallback_cache_init(&fallback_cache, font);
+        attributes->fallback_cache = &fallback_cache;
+    }
+
     /*Calc. the height and longest line*/
     while(text[line_start] != '\0') {
         new_line_start += lv_text_get_next_line(
@@ -132,6 +141,7 @@ void lv_text_get_size_attributes(lv_point_t * size_res, const char * text, const
         if((unsigned long)size_res->y +
            (unsigned long)letter_height + (unsigned long)attributes->line_space > LV_MAX_OF(int32_t)) {
             LV_LOG_WARN("integer overflow while calculating text height");
+            attributes->fallback_cache = fallback_cache_ori;
             return;
         }
         else {
@@ -147,6 +157,8 @@ void lv_text_get_size_attributes(lv_point_t * size_res, const char * text, const
         line_start  = new_line_start;
     }
 
+    attributes->fallback_cache = fallback_cache_ori;
+
     /*Make the text one line taller if the last character is '\n' or '\r'*/
     if((line_start != 0) && (text[line_start - 1] == '\n' || text[line_start - 1] == '\r')) {
         size_res->y += letter_height + attributes->line_space;
@@ -219,12 +231,13 @@ bool lv_text_is_cmd(lv_text_cmd_state_t * state, uint32_t c)
  * @param flags settings for the text from 'txt_flag_type' enum
  * @param[out] word_w_ptr width (in pixels) of the parsed word. May be NULL.
  * @param cmd_state Pointer to a lv_text_cmd_state_t variable which stored the current state of command processing
+ * @param fallback_cache cache of the fonts resolved from the fallback chain. May be NULL.
  * @return the index of the first char of the next word (in byte index not letter index. With UTF-8 they are different)
  */
 static uint32_t lv_text_get_next_word(const char * txt, const lv_font_t * font,
                                       int32_t letter_space, int32_t max_width,
                                       lv_text_flag_t flag, uint32_t * word_w_ptr,
-                                      lv_text_cmd_state_t * cmd_state)
+                                      lv_text_cmd_state_t * cmd_state, lv_font_fallback_cache_t * fallback_cache)
 {
     if(txt == NULL || txt[0] == '\0') return 0;
     if(font == NULL) return 0;
@@ -258,7 +271,7 @@ static uint32_t lv_text_get_next_word(const char * txt, const lv_font_t * font,
             }
         }
 
-        letter_w = lv_font_get_glyph_width(font, letter, letter_next);
+        letter_w = lv_font_get_glyph_width_cached(font, fallback_cache, letter, letter_next);
         cur_w += letter_w;
 
         if(letter_w > 0) {
@@ -382,7 +395,7 @@ uint32_t lv_text_get_next_line(const char * txt, uint32_t len,
 
         uint32_t word_w = 0;
         uint32_t advance = lv_text_get_next_word(&txt[i], font, attributes->letter_space,
-                                                 max_width, word_flag, &word_w, &cmd_state);
+                                                 max_width, word_flag, &word_w, &cmd_state, attributes->fallback_cache);
         max_width -= word_w;
         line_w += word_w;
 
@@ -404,7 +417,7 @@ uint32_t lv_text_get_next_line(const char * txt, uint32_t len,
     if(i == 0) {
         uint32_t letter = lv_text_encoded_next(txt, &i);
         if(used_width != NULL) {
-            line_w = lv_font_get_glyph_width(font, letter, '\0');
+            line_w = lv_font_get_glyph_width_cached(font, attributes->fallback_cache, letter, '\0');
         }
     }
 
@@ -440,7 +453,7 @@ int32_t lv_text_get_width(const char * txt, uint32_t length, const lv_font_t * f
                 }
             }
 
-            int32_t char_width = lv_font_get_glyph_width(font, letter, letter_next);
+            int32_t char_width = lv_font_get_glyph_width_cached(font, attributes->fallback_cache, letter, letter_next);
             if(char_width > 0) {
                 width += char_width;
                 width += attributes->letter_space;
@@ -45,6 +45,7 @@ typedef struct {
     int32_t line_space;     /**< Space between lines of text*/
     int32_t max_width;      /**< Max width of the text (break the lines to fit this size). Set COORD_MAX to avoid*/
     lv_text_flag_t text_flags;
+    lv_font_fallback_cache_t * fallback_cache; /**< Remember the fonts resolved from the fallback chain. May be NULL*/
 } lv_text_attributes_t;
 
 
@@ -122,6 +122,8 @@ typedef struct _lv_draw_task_t lv_draw_task_t;
 
 typedef struct _lv_indev_t lv_indev_t;
 
+typedef struct _lv_indev_hit_index_t lv_indev_hit_index_t;
+
 typedef struct _lv_event_t lv_event_t;
 
 typedef struct _lv_timer_t lv_timer_t;
@@ -138,6 +140,8 @@ typedef struct _lv_font_info_t lv_font_info_t;
 
 typedef struct _lv_font_manager_t lv_font_manager_t;
 
+typedef struct _lv_bidi_text_t lv_bidi_text_t;
+
 typedef struct _lv_image_decoder_t lv_image_decoder_t;
 
 typedef struct _lv_image_decoder_dsc_t lv_image_decoder_dsc_t;
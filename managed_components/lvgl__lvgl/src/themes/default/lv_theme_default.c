@@ -13,6 +13,7 @@
 #include "../lv_theme_private.h"
 #include "../../misc/lv_color.h"
 #include "../../core/lv_global.h"
+#include "../../core/lv_obj_style_private.h"
 
 /*********************
  *      DEFINES
@@ -44,6 +45,13 @@ typedef struct _my_theme_t my_theme_t;
 #define PAD_SMALL   LV_DPX_CALC(theme->disp_dpi, theme->disp_size == DISP_LARGE ? 14 : theme->disp_size == DISP_MEDIUM ? 12 : 10)
 #define PAD_TINY    LV_DPX_CALC(theme->disp_dpi, theme->disp_size == DISP_LARGE ? 8 : theme->disp_size == DISP_MEDIUM ? 6 : 2)
 
+/*The class table is kept at most half full so that a lookup needs only a few probes*/
+#define CLASS_TABLE_BITS        7
+#define CLASS_TABLE_SIZE        (1 << CLASS_TABLE_BITS)
+
+/*Reserved while building the lists (enough for the styles of all the widgets), then trimmed to the used size*/
+#define STYLE_POOL_CAPACITY     256
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -153,6 +161,36 @@ typedef struct {
 #endif
 } my_theme_styles_t;
 
+/**
+ * A range of styles in `style_pool` which are added to a widget together
+ */
+typedef struct {
+    uint16_t start;
+    uint16_t cnt;
+} style_list_t;
+
+typedef struct {
+    const lv_obj_class_t * class_p;
+    style_list_t list;
+} class_style_list_t;
+
+/**
+ * Style lists of widgets which are styled depending on their parent
+ */
+typedef enum {
+    STYLE_LIST_EMPTY,
+    STYLE_LIST_SCR,
+    STYLE_LIST_TABVIEW_HEADER,
+    STYLE_LIST_TABVIEW_PAGE,
+    STYLE_LIST_TABVIEW_BUTTON,
+    STYLE_LIST_WIN_HEADER,
+    STYLE_LIST_WIN_CONTENT,
+    STYLE_LIST_CALENDAR_BUTTONMATRIX,
+    STYLE_LIST_TEXTAREA_LABEL,
+    STYLE_LIST_MENU_HEADER_BUTTON,  /*Added after the normal button styles*/
+    STYLE_LIST_CNT,
+} style_list_id_t;
+
 typedef enum {
     DISP_SMALL = 3,
     DISP_MEDIUM = 2,
@@ -170,6 +208,14 @@ struct _my_theme_t {
     bool inited;
     my_theme_styles_t styles;
 
+    /*The styles of the widgets collected in the order they are added, so that
+     *they can be added to a new widget in one step without checking its type one by one*/
+    lv_array_t style_pool;                              /*`lv_obj_style_t` elements*/
+    class_style_list_t class_table[CLASS_TABLE_SIZE];   /*Hash table keyed by the class*/
+    uint32_t class_table_cnt;
+    style_list_t style_lists[STYLE_LIST_CNT];           /*Indexed by `style_list_id_t`*/
+    style_list_t * list_act;                            /*The list being built*/
+
 #if LV_THEME_DEFAULT_TRANSITION_TIME
     lv_style_transition_dsc_t trans_delayed;
     lv_style_transition_dsc_t trans_normal;
@@ -181,6 +227,10 @@ struct _my_theme_t {
  **********************/
 static void style_init_reset(lv_style_t * style);
 static void theme_apply(lv_theme_t * th, lv_obj_t * obj);
+static const style_list_t * find_context_style_list(my_theme_t * theme, lv_obj_t * obj, lv_obj_t * parent);
+static const style_list_t * find_class_style_list(my_theme_t * theme, const lv_obj_class_t * class_p);
+static void apply_style_list(my_theme_t * theme, lv_obj_t * obj, const style_list_t * list);
+static void style_lists_init(my_theme_t * theme);
 static void resolution_change_event_cb(lv_event_t * e);
 
 /**********************
@@ -632,6 +682,7 @@ lv_theme_t * lv_theme_default_init(lv_display_t * disp, lv_color_t color_primary
     if(!lv_theme_default_is_inited()) {
         theme_def = lv_malloc_zeroed(sizeof(my_theme_t));
         LV_ASSERT_MALLOC(theme_def);
+        lv_array_init(&theme_def->style_pool, STYLE_POOL_CAPACITY, sizeof(lv_obj_style_t));
     }
 
     my_theme_t * theme = theme_def;
@@ -669,6 +720,7 @@ lv_theme_t * lv_theme_default_init(lv_display_t * disp, lv_color_t color_primary
     theme->base.flags = dark ? MODE_DARK : 0;
 
     style_init(theme);
+    style_lists_init(theme);
 
     if(disp == NULL || lv_display_get_theme(disp) == (lv_theme_t *)theme) {
         lv_obj_report_style_change(NULL);
@@ -711,6 +763,7 @@ void lv_theme_default_deinit(void)
                 lv_style_reset(theme_styles + i);
             }
         }
+        lv_array_deinit(&theme->style_pool);
         lv_free(theme_def);
         theme_def = NULL;
     }
@@ -728,486 +781,603 @@ static void theme_apply(lv_theme_t * th, lv_obj_t * obj)
     lv_obj_t * parent = lv_obj_get_parent(obj);
 
     if(parent == NULL) {
-        lv_obj_add_style(obj, &theme->styles.scr, 0);
-        lv_obj_add_style(obj, &theme->styles.scrollbar, LV_PART_SCROLLBAR);
-        lv_obj_add_style(obj, &theme->styles.scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
+        apply_style_list(theme, obj, &theme->style_lists[STYLE_LIST_SCR]);
+        return;
+    }
+
+    /*Some widgets are styled differently depending on where they are*/
+    const style_list_t * list = find_context_style_list(theme, obj, parent);
+    if(list) {
+        apply_style_list(theme, obj, list);
         return;
     }
 
+    list = find_class_style_list(theme, lv_obj_get_class(obj));
+    if(list == NULL) return;
+
+    apply_style_list(theme, obj, list);
+
+#if LV_USE_BUTTON && LV_USE_MENU
+    if(lv_obj_check_type(obj, &lv_button_class) &&
+       (lv_obj_check_type(parent, &lv_menu_sidebar_header_cont_class) ||
+        lv_obj_check_type(parent, &lv_menu_main_header_cont_class))) {
+        apply_style_list(theme, obj, &theme->style_lists[STYLE_LIST_MENU_HEADER_BUTTON]);
+    }
+#endif
+}
+
+static const style_list_t * find_context_style_list(my_theme_t * theme, lv_obj_t * obj, lv_obj_t * parent)
+{
+    style_list_t * lists = theme->style_lists;
+
     if(lv_obj_check_type(obj, &lv_obj_class)) {
 #if LV_USE_TABVIEW
         /*Tabview content area*/
         if(lv_obj_check_type(parent, &lv_tabview_class) && lv_obj_get_child(parent, 1) == obj) {
-            return;
+            return &lists[STYLE_LIST_EMPTY];
         }
         /*Tabview button container*/
         else if(lv_obj_check_type(parent, &lv_tabview_class) && lv_obj_get_child(parent, 0) == obj) {
-            lv_obj_add_style(obj, &theme->styles.bg_color_white, 0);
-            lv_obj_add_style(obj, &theme->styles.outline_primary, LV_STATE_FOCUS_KEY);
-            lv_obj_add_style(obj, &theme->styles.tab_bg_focus, LV_STATE_FOCUS_KEY);
-            return;
+            return &lists[STYLE_LIST_TABVIEW_HEADER];
         }
         /*Tabview pages*/
         else if(lv_obj_check_type(lv_obj_get_parent(parent), &lv_tabview_class)) {
-            lv_obj_add_style(obj, &theme->styles.pad_normal, 0);
-            lv_obj_add_style(obj, &theme->styles.rotary_scroll, 0);
-            lv_obj_add_style(obj, &theme->styles.scrollbar, LV_PART_SCROLLBAR);
-            lv_obj_add_style(obj, &theme->styles.scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
-            return;
+            return &lists[STYLE_LIST_TABVIEW_PAGE];
         }
 #endif
 
 #if LV_USE_WIN
         /*Header*/
         if(lv_obj_check_type(parent, &lv_win_class) && lv_obj_get_child(parent, 0) == obj) {
-            lv_obj_add_style(obj, &theme->styles.bg_color_grey, 0);
-            lv_obj_add_style(obj, &theme->styles.pad_tiny, 0);
-            return;
+            return &lists[STYLE_LIST_WIN_HEADER];
         }
         /*Content*/
         else if(lv_obj_check_type(parent, &lv_win_class) && lv_obj_get_child(parent, 1) == obj) {
-            lv_obj_add_style(obj, &theme->styles.scr, 0);
-            lv_obj_add_style(obj, &theme->styles.pad_normal, 0);
-            lv_obj_add_style(obj, &theme->styles.scrollbar, LV_PART_SCROLLBAR);
-            lv_obj_add_style(obj, &theme->styles.scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
-            return;
+            return &lists[STYLE_LIST_WIN_CONTENT];
         }
 #endif
 
 #if LV_USE_CALENDAR
         if(lv_obj_check_type(parent, &lv_calendar_class)) {
             /*No style*/
-            return;
+            return &lists[STYLE_LIST_EMPTY];
         }
 #endif
-
-        lv_obj_add_style(obj, &theme->styles.card, 0);
-        lv_obj_add_style(obj, &theme->styles.scrollbar, LV_PART_SCROLLBAR);
-        lv_obj_add_style(obj, &theme->styles.scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
     }
-#if LV_USE_BUTTON
+#if LV_USE_BUTTON && LV_USE_TABVIEW
     else if(lv_obj_check_type(obj, &lv_button_class)) {
-
-#if LV_USE_TABVIEW
         lv_obj_t * tv = lv_obj_get_parent(parent); /*parent is the tabview header*/
         if(tv && lv_obj_get_child(tv, 0) == parent) { /*The button is on the tab view header*/
             if(lv_obj_check_type(tv, &lv_tabview_class)) {
-                lv_obj_add_style(obj, &theme->styles.pressed, LV_STATE_PRESSED);
-                lv_obj_add_style(obj, &theme->styles.bg_color_primary_muted, LV_STATE_CHECKED);
-                lv_obj_add_style(obj, &theme->styles.tab_btn, LV_STATE_CHECKED);
-                lv_obj_add_style(obj, &theme->styles.outline_primary, LV_STATE_FOCUS_KEY);
-                lv_obj_add_style(obj, &theme->styles.outline_secondary, LV_STATE_EDITED);
-                lv_obj_add_style(obj, &theme->styles.tab_bg_focus, LV_STATE_FOCUS_KEY);
-                return;
+                return &lists[STYLE_LIST_TABVIEW_BUTTON];
             }
         }
+    }
 #endif
-        lv_obj_add_style(obj, &theme->styles.btn, 0);
-        lv_obj_add_style(obj, &theme->styles.bg_color_primary, 0);
-        lv_obj_add_style(obj, &theme->styles.transition_delayed, 0);
-        lv_obj_add_style(obj, &theme->styles.pressed, LV_STATE_PRESSED);
-        lv_obj_add_style(obj, &theme->styles.transition_normal, LV_STATE_PRESSED);
-        lv_obj_add_style(obj, &theme->styles.outline_primary, LV_STATE_FOCUS_KEY);
-#if LV_THEME_DEFAULT_GROW
-        lv_obj_add_style(obj, &theme->styles.grow, LV_STATE_PRESSED);
-#endif
-        lv_obj_add_style(obj, &theme->styles.bg_color_secondary, LV_STATE_CHECKED);
-        lv_obj_add_style(obj, &theme->styles.disabled, LV_STATE_DISABLED);
-
-#if LV_USE_MENU
-        if(lv_obj_check_type(parent, &lv_menu_sidebar_header_cont_class) ||
-           lv_obj_check_type(parent, &lv_menu_main_header_cont_class)) {
-            lv_obj_add_style(obj, &theme->styles.menu_header_btn, 0);
-            lv_obj_add_style(obj, &theme->styles.menu_pressed, LV_STATE_PRESSED);
+#if LV_USE_BUTTONMATRIX && LV_USE_CALENDAR
+    else if(lv_obj_check_type(obj, &lv_buttonmatrix_class)) {
+        if(lv_obj_check_type(parent, &lv_calendar_class)) {
+            return &lists[STYLE_LIST_CALENDAR_BUTTONMATRIX];
         }
+    }
 #endif
+#if LV_USE_LABEL && LV_USE_TEXTAREA
+    else if(lv_obj_check_type(obj, &lv_label_class) && lv_obj_check_type(parent, &lv_textarea_class)) {
+        return &lists[STYLE_LIST_TEXTAREA_LABEL];
     }
 #endif
 
-#if LV_USE_LINE
-    else if(lv_obj_check_type(obj, &lv_line_class)) {
-        lv_obj_add_style(obj, &theme->styles.line, 0);
+    return NULL;
+}
+
+static uint32_t class_hash(const lv_obj_class_t * class_p)
+{
+    /*The classes are aligned structures so the lowest bits don't carry information*/
+    uint32_t v = (uint32_t)((lv_uintptr_t)class_p >> 3);
+    return (v * 2654435761U) >> (32 - CLASS_TABLE_BITS);
+}
+
+static const style_list_t * find_class_style_list(my_theme_t * theme, const lv_obj_class_t * class_p)
+{
+    uint32_t i = class_hash(class_p);
+    while(theme->class_table[i].class_p) {
+        if(theme->class_table[i].class_p == class_p) return &theme->class_table[i].list;
+        i = (i + 1) & (CLASS_TABLE_SIZE - 1);
+    }
+
+    return NULL;
+}
+
+static void apply_style_list(my_theme_t * theme, lv_obj_t * obj, const style_list_t * list)
+{
+    if(list->cnt == 0) return;
+
+    lv_obj_add_style_list(obj, lv_array_at(&theme->style_pool, list->start), list->cnt);
+}
+
+/**
+ * Start a new style list for the widgets of a class. The styles can be added with `list_add`.
+ */
+static void class_list_begin(my_theme_t * theme, const lv_obj_class_t * class_p)
+{
+    uint32_t i = class_hash(class_p);
+    while(theme->class_table[i].class_p) {
+        i = (i + 1) & (CLASS_TABLE_SIZE - 1);
     }
+
+    LV_ASSERT(theme->class_table_cnt < CLASS_TABLE_SIZE / 2);
+    theme->class_table_cnt++;
+    theme->class_table[i].class_p = class_p;
+    theme->list_act = &theme->class_table[i].list;
+    theme->list_act->start = lv_array_size(&theme->style_pool);
+    theme->list_act->cnt = 0;
+}
+
+/**
+ * Use the last style list for an other class too
+ */
+static void class_list_share(my_theme_t * theme, const lv_obj_class_t * class_p)
+{
+    style_list_t list = *theme->list_act;
+    class_list_begin(theme, class_p);
+    *theme->list_act = list;
+}
+
+/**
+ * Start a new style list for the widgets whose styles depend on their parent
+ */
+static void context_list_begin(my_theme_t * theme, style_list_id_t id)
+{
+    theme->list_act = &theme->style_lists[id];
+    theme->list_act->start = lv_array_size(&theme->style_pool);
+    theme->list_act->cnt = 0;
+}
+
+static void list_add(my_theme_t * theme, const lv_style_t * style, lv_style_selector_t selector)
+{
+    lv_obj_style_t obj_style;
+    lv_memzero(&obj_style, sizeof(obj_style));
+    obj_style.style = style;
+    obj_style.selector = selector;
+    lv_array_push_back(&theme->style_pool, &obj_style);
+    theme->list_act->cnt++;
+}
+
+/**
+ * Collect the styles of each widget in the order they should be added.
+ * It needs to be called when the styles are initialized, as some lists depend on the display size.
+ */
+static void style_lists_init(my_theme_t * theme)
+{
+    /*The pool was trimmed when the lists were built last time, so reserve the space again*/
+    lv_array_clear(&theme->style_pool);
+    lv_array_resize(&theme->style_pool, STYLE_POOL_CAPACITY);
+    lv_memzero(theme->class_table, sizeof(theme->class_table));
+    lv_memzero(theme->style_lists, sizeof(theme->style_lists));
+    theme->class_table_cnt = 0;
+
+    context_list_begin(theme, STYLE_LIST_SCR);
+    list_add(theme, &theme->styles.scr, 0);
+    list_add(theme, &theme->styles.scrollbar, LV_PART_SCROLLBAR);
+    list_add(theme, &theme->styles.scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
+
+#if LV_USE_TABVIEW
+    context_list_begin(theme, STYLE_LIST_TABVIEW_HEADER);
+    list_add(theme, &theme->styles.bg_color_white, 0);
+    list_add(theme, &theme->styles.outline_primary, LV_STATE_FOCUS_KEY);
+    list_add(theme, &theme->styles.tab_bg_focus, LV_STATE_FOCUS_KEY);
+
+    context_list_begin(theme, STYLE_LIST_TABVIEW_PAGE);
+    list_add(theme, &theme->styles.pad_normal, 0);
+    list_add(theme, &theme->styles.rotary_scroll, 0);
+    list_add(theme, &theme->styles.scrollbar, LV_PART_SCROLLBAR);
+    list_add(theme, &theme->styles.scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
+
+#if LV_USE_BUTTON
+    context_list_begin(theme, STYLE_LIST_TABVIEW_BUTTON);
+    list_add(theme, &theme->styles.pressed, LV_STATE_PRESSED);
+    list_add(theme, &theme->styles.bg_color_primary_muted, LV_STATE_CHECKED);
+    list_add(theme, &theme->styles.tab_btn, LV_STATE_CHECKED);
+    list_add(theme, &theme->styles.outline_primary, LV_STATE_FOCUS_KEY);
+    list_add(theme, &theme->styles.outline_secondary, LV_STATE_EDITED);
+    list_add(theme, &theme->styles.tab_bg_focus, LV_STATE_FOCUS_KEY);
+#endif
 #endif
 
-#if LV_USE_BUTTONMATRIX
-    else if(lv_obj_check_type(obj, &lv_buttonmatrix_class)) {
+#if LV_USE_WIN
+    context_list_begin(theme, STYLE_LIST_WIN_HEADER);
+    list_add(theme, &theme->styles.bg_color_grey, 0);
+    list_add(theme, &theme->styles.pad_tiny, 0);
 
-#if LV_USE_CALENDAR
-        if(lv_obj_check_type(parent, &lv_calendar_class)) {
-            lv_obj_add_style(obj, &theme->styles.calendar_btnm_bg, 0);
-            lv_obj_add_style(obj, &theme->styles.outline_primary, LV_STATE_FOCUS_KEY);
-            lv_obj_add_style(obj, &theme->styles.outline_secondary, LV_STATE_EDITED);
-            lv_obj_add_style(obj, &theme->styles.calendar_btnm_day, LV_PART_ITEMS);
-            lv_obj_add_style(obj, &theme->styles.pressed, LV_PART_ITEMS | LV_STATE_PRESSED);
-            lv_obj_add_style(obj, &theme->styles.disabled, LV_PART_ITEMS | LV_STATE_DISABLED);
-            lv_obj_add_style(obj, &theme->styles.outline_primary, LV_PART_ITEMS | LV_STATE_FOCUS_KEY);
-            lv_obj_add_style(obj, &theme->styles.outline_secondary, LV_PART_ITEMS | LV_STATE_EDITED);
-            return;
-        }
+    context_list_begin(theme, STYLE_LIST_WIN_CONTENT);
+    list_add(theme, &theme->styles.scr, 0);
+    list_add(theme, &theme->styles.pad_normal, 0);
+    list_add(theme, &theme->styles.scrollbar, LV_PART_SCROLLBAR);
+    list_add(theme, &theme->styles.scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
 #endif
-        lv_obj_add_style(obj, &theme->styles.card, 0);
-        lv_obj_add_style(obj, &theme->styles.outline_primary, LV_STATE_FOCUS_KEY);
-        lv_obj_add_style(obj, &theme->styles.outline_secondary, LV_STATE_EDITED);
-        lv_obj_add_style(obj, &theme->styles.btn, LV_PART_ITEMS);
-        lv_obj_add_style(obj, &theme->styles.disabled, LV_PART_ITEMS | LV_STATE_DISABLED);
-        lv_obj_add_style(obj, &theme->styles.pressed, LV_PART_ITEMS | LV_STATE_PRESSED);
-        lv_obj_add_style(obj, &theme->styles.bg_color_primary, LV_PART_ITEMS | LV_STATE_CHECKED);
-        lv_obj_add_style(obj, &theme->styles.outline_primary, LV_PART_ITEMS | LV_STATE_FOCUS_KEY);
-        lv_obj_add_style(obj, &theme->styles.outline_secondary, LV_PART_ITEMS | LV_STATE_EDITED);
-    }
+
+#if LV_USE_BUTTONMATRIX && LV_USE_CALENDAR
+    context_list_begin(theme, STYLE_LIST_CALENDAR_BUTTONMATRIX);
+    list_add(theme, &theme->styles.calendar_btnm_bg, 0);
+    list_add(theme, &theme->styles.outline_primary, LV_STATE_FOCUS_KEY);
+    list_add(theme, &theme->styles.outline_secondary, LV_STATE_EDITED);
+    list_add(theme, &theme->styles.calendar_btnm_day, LV_PART_ITEMS);
+    list_add(theme, &theme->styles.pressed, LV_PART_ITEMS | LV_STATE_PRESSED);
+    list_add(theme, &theme->styles.disabled, LV_PART_ITEMS | LV_STATE_DISABLED);
+    list_add(theme, &theme->styles.outline_primary, LV_PART_ITEMS | LV_STATE_FOCUS_KEY);
+    list_add(theme, &theme->styles.outline_secondary, LV_PART_ITEMS | LV_STATE_EDITED);
+#endif
+
+#if LV_USE_LABEL && LV_USE_TEXTAREA
+    context_list_begin(theme, STYLE_LIST_TEXTAREA_LABEL);
+    list_add(theme, &theme->styles.bg_color_primary, LV_PART_SELECTED);
+#endif
+
+#if LV_USE_BUTTON && LV_USE_MENU
+    context_list_begin(theme, STYLE_LIST_MENU_HEADER_BUTTON);
+    list_add(theme, &theme->styles.menu_header_btn, 0);
+    list_add(theme, &theme->styles.menu_pressed, LV_STATE_PRESSED);
+#endif
+
+    class_list_begin(theme, &lv_obj_class);
+    list_add(theme, &theme->styles.card, 0);
+    list_add(theme, &theme->styles.scrollbar, LV_PART_SCROLLBAR);
+    list_add(theme, &theme->styles.scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
+
+#if LV_USE_BUTTON
+    class_list_begin(theme, &lv_button_class);
+    list_add(theme, &theme->styles.btn, 0);
+    list_add(theme, &theme->styles.bg_color_primary, 0);
+    list_add(theme, &theme->styles.transition_delayed, 0);
+    list_add(theme, &theme->styles.pressed, LV_STATE_PRESSED);
+    list_add(theme, &theme->styles.transition_normal, LV_STATE_PRESSED);
+    list_add(theme, &theme->styles.outline_primary, LV_STATE_FOCUS_KEY);
+#if LV_THEME_DEFAULT_GROW
+    list_add(theme, &theme->styles.grow, LV_STATE_PRESSED);
+#endif
+    list_add(theme, &theme->styles.bg_color_secondary, LV_STATE_CHECKED);
+    list_add(theme, &theme->styles.disabled, LV_STATE_DISABLED);
+#endif
+
+#if LV_USE_LINE
+    class_list_begin(theme, &lv_line_class);
+    list_add(theme, &theme->styles.line, 0);
+#endif
+
+#if LV_USE_BUTTONMATRIX
+    class_list_begin(theme, &lv_buttonmatrix_class);
+    list_add(theme, &theme->styles.card, 0);
+    list_add(theme, &theme->styles.outline_primary, LV_STATE_FOCUS_KEY);
+    list_add(theme, &theme->styles.outline_secondary, LV_STATE_EDITED);
+    list_add(theme, &theme->styles.btn, LV_PART_ITEMS);
+    list_add(theme, &theme->styles.disabled, LV_PART_ITEMS | LV_STATE_DISABLED);
+    list_add(theme, &theme->styles.pressed, LV_PART_ITEMS | LV_STATE_PRESSED);
+    list_add(theme, &theme->styles.bg_color_primary, LV_PART_ITEMS | LV_STATE_CHECKED);
+    list_add(theme, &theme->styles.outline_primary, LV_PART_ITEMS | LV_STATE_FOCUS_KEY);
+    list_add(theme, &theme->styles.outline_secondary, LV_PART_ITEMS | LV_STATE_EDITED);
 #endif
 
 #if LV_USE_BAR
-    else if(lv_obj_check_type(obj, &lv_bar_class)) {
-        lv_obj_add_style(obj, &theme->styles.bg_color_primary_muted, 0);
-        lv_obj_add_style(obj, &theme->styles.circle, 0);
-        lv_obj_add_style(obj, &theme->styles.outline_primary, LV_STATE_FOCUS_KEY);
-        lv_obj_add_style(obj, &theme->styles.outline_secondary, LV_STATE_EDITED);
-        lv_obj_add_style(obj, &theme->styles.bg_color_primary, LV_PART_INDICATOR);
-        lv_obj_add_style(obj, &theme->styles.circle, LV_PART_INDICATOR);
-    }
+    class_list_begin(theme, &lv_bar_class);
+    list_add(theme, &theme->styles.bg_color_primary_muted, 0);
+    list_add(theme, &theme->styles.circle, 0);
+    list_add(theme, &theme->styles.outline_primary, LV_STATE_FOCUS_KEY);
+    list_add(theme, &theme->styles.outline_secondary, LV_STATE_EDITED);
+    list_add(theme, &theme->styles.bg_color_primary, LV_PART_INDICATOR);
+    list_add(theme, &theme->styles.circle, LV_PART_INDICATOR);
 #endif
 
 #if LV_USE_SLIDER
-    else if(lv_obj_check_type(obj, &lv_slider_class)) {
-        lv_obj_add_style(obj, &theme->styles.bg_color_primary_muted, 0);
-        lv_obj_add_style(obj, &theme->styles.circle, 0);
-        lv_obj_add_style(obj, &theme->styles.outline_primary, LV_STATE_FOCUS_KEY);
-        lv_obj_add_style(obj, &theme->styles.outline_secondary, LV_STATE_EDITED);
-        lv_obj_add_style(obj, &theme->styles.bg_color_primary, LV_PART_INDICATOR);
-        lv_obj_add_style(obj, &theme->styles.circle, LV_PART_INDICATOR);
-        lv_obj_add_style(obj, &theme->styles.knob, LV_PART_KNOB);
+    class_list_begin(theme, &lv_slider_class);
+    list_add(theme, &theme->styles.bg_color_primary_muted, 0);
+    list_add(theme, &theme->styles.circle, 0);
+    list_add(theme, &theme->styles.outline_primary, LV_STATE_FOCUS_KEY);
+    list_add(theme, &theme->styles.outline_secondary, LV_STATE_EDITED);
+    list_add(theme, &theme->styles.bg_color_primary, LV_PART_INDICATOR);
+    list_add(theme, &theme->styles.circle, LV_PART_INDICATOR);
+    list_add(theme, &theme->styles.knob, LV_PART_KNOB);
 #if LV_THEME_DEFAULT_GROW
-        lv_obj_add_style(obj, &theme->styles.grow, LV_PART_KNOB | LV_STATE_PRESSED);
+    list_add(theme, &theme->styles.grow, LV_PART_KNOB | LV_STATE_PRESSED);
 #endif
-        lv_obj_add_style(obj, &theme->styles.transition_delayed, LV_PART_KNOB);
-        lv_obj_add_style(obj, &theme->styles.transition_normal, LV_PART_KNOB | LV_STATE_PRESSED);
-    }
+    list_add(theme, &theme->styles.transition_delayed, LV_PART_KNOB);
+    list_add(theme, &theme->styles.transition_normal, LV_PART_KNOB | LV_STATE_PRESSED);
 #endif
 
 #if LV_USE_TABLE
-    else if(lv_obj_check_type(obj, &lv_table_class)) {
-        lv_obj_add_style(obj, &theme->styles.card, 0);
-        lv_obj_add_style(obj, &theme->styles.pad_zero, 0);
-        lv_obj_add_style(obj, &theme->styles.no_radius, 0);
-        lv_obj_add_style(obj, &theme->styles.outline_primary, LV_STATE_FOCUS_KEY);
-        lv_obj_add_style(obj, &theme->styles.outline_secondary, LV_STATE_EDITED);
-        lv_obj_add_style(obj, &theme->styles.scrollbar, LV_PART_SCROLLBAR);
-        lv_obj_add_style(obj, &theme->styles.scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
-        lv_obj_add_style(obj, &theme->styles.bg_color_white, LV_PART_ITEMS);
-        lv_obj_add_style(obj, &theme->styles.table_cell, LV_PART_ITEMS);
-        lv_obj_add_style(obj, &theme->styles.pad_normal, LV_PART_ITEMS);
-        lv_obj_add_style(obj, &theme->styles.pressed, LV_PART_ITEMS | LV_STATE_PRESSED);
-        lv_obj_add_style(obj, &theme->styles.bg_color_primary, LV_PART_ITEMS | LV_STATE_FOCUS_KEY);
-        lv_obj_add_style(obj, &theme->styles.bg_color_secondary, LV_PART_ITEMS | LV_STATE_EDITED);
-    }
+    class_list_begin(theme, &lv_table_class);
+    list_add(theme, &theme->styles.card, 0);
+    list_add(theme, &theme->styles.pad_zero, 0);
+    list_add(theme, &theme->styles.no_radius, 0);
+    list_add(theme, &theme->styles.outline_primary, LV_STATE_FOCUS_KEY);
+    list_add(theme, &theme->styles.outline_secondary, LV_STATE_EDITED);
+    list_add(theme, &theme->styles.scrollbar, LV_PART_SCROLLBAR);
+    list_add(theme, &theme->styles.scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
+    list_add(theme, &theme->styles.bg_color_white, LV_PART_ITEMS);
+    list_add(theme, &theme->styles.table_cell, LV_PART_ITEMS);
+    list_add(theme, &theme->styles.pad_normal, LV_PART_ITEMS);
+    list_add(theme, &theme->styles.pressed, LV_PART_ITEMS | LV_STATE_PRESSED);
+    list_add(theme, &theme->styles.bg_color_primary, LV_PART_ITEMS | LV_STATE_FOCUS_KEY);
+    list_add(theme, &theme->styles.bg_color_secondary, LV_PART_ITEMS | LV_STATE_EDITED);
 #endif
 
 #if LV_USE_CHECKBOX
-    else if(lv_obj_check_type(obj, &lv_checkbox_class)) {
-        lv_obj_add_style(obj, &theme->styles.pad_gap, 0);
-        lv_obj_add_style(obj, &theme->styles.outline_primary, LV_STATE_FOCUS_KEY);
-        lv_obj_add_style(obj, &theme->styles.disabled, LV_PART_INDICATOR | LV_STATE_DISABLED);
-        lv_obj_add_style(obj, &theme->styles.cb_marker, LV_PART_INDICATOR);
-        lv_obj_add_style(obj, &theme->styles.bg_color_primary, LV_PART_INDICATOR | LV_STATE_CHECKED);
-        lv_obj_add_style(obj, &theme->styles.cb_marker_checked, LV_PART_INDICATOR | LV_STATE_CHECKED);
-        lv_obj_add_style(obj, &theme->styles.pressed, LV_PART_INDICATOR | LV_STATE_PRESSED);
+    class_list_begin(theme, &lv_checkbox_class);
+    list_add(theme, &theme->styles.pad_gap, 0);
+    list_add(theme, &theme->styles.outline_primary, LV_STATE_FOCUS_KEY);
+    list_add(theme, &theme->styles.disabled, LV_PART_INDICATOR | LV_STATE_DISABLED);
+    list_add(theme, &theme->styles.cb_marker, LV_PART_INDICATOR);
+    list_add(theme, &theme->styles.bg_color_primary, LV_PART_INDICATOR | LV_STATE_CHECKED);
+    list_add(theme, &theme->styles.cb_marker_checked, LV_PART_INDICATOR | LV_STATE_CHECKED);
+    list_add(theme, &theme->styles.pressed, LV_PART_INDICATOR | LV_STATE_PRESSED);
 #if LV_THEME_DEFAULT_GROW
-        lv_obj_add_style(obj, &theme->styles.grow, LV_PART_INDICATOR | LV_STATE_PRESSED);
+    list_add(theme, &theme->styles.grow, LV_PART_INDICATOR | LV_STATE_PRESSED);
 #endif
-        lv_obj_add_style(obj, &theme->styles.transition_normal, LV_PART_INDICATOR | LV_STATE_PRESSED);
-        lv_obj_add_style(obj, &theme->styles.transition_delayed, LV_PART_INDICATOR);
-    }
+    list_add(theme, &theme->styles.transition_normal, LV_PART_INDICATOR | LV_STATE_PRESSED);
+    list_add(theme, &theme->styles.transition_delayed, LV_PART_INDICATOR);
 #endif
 
 #if LV_USE_SWITCH
-    else if(lv_obj_check_type(obj, &lv_switch_class)) {
-        lv_obj_add_style(obj, &theme->styles.bg_color_grey, 0);
-        lv_obj_add_style(obj, &theme->styles.circle, 0);
-        lv_obj_add_style(obj, &theme->styles.anim_fast, 0);
-        lv_obj_add_style(obj, &theme->styles.disabled, LV_STATE_DISABLED);
-        lv_obj_add_style(obj, &theme->styles.outline_primary, LV_STATE_FOCUS_KEY);
-        lv_obj_add_style(obj, &theme->styles.bg_color_primary, LV_PART_INDICATOR | LV_STATE_CHECKED);
-        lv_obj_add_style(obj, &theme->styles.circle, LV_PART_INDICATOR);
-        lv_obj_add_style(obj, &theme->styles.knob, LV_PART_KNOB);
-        lv_obj_add_style(obj, &theme->styles.bg_color_white, LV_PART_KNOB);
-        lv_obj_add_style(obj, &theme->styles.switch_knob, LV_PART_KNOB);
-
-        lv_obj_add_style(obj, &theme->styles.transition_normal, LV_PART_INDICATOR | LV_STATE_CHECKED);
-        lv_obj_add_style(obj, &theme->styles.transition_normal, LV_PART_INDICATOR);
-    }
+    class_list_begin(theme, &lv_switch_class);
+    list_add(theme, &theme->styles.bg_color_grey, 0);
+    list_add(theme, &theme->styles.circle, 0);
+    list_add(theme, &theme->styles.anim_fast, 0);
+    list_add(theme, &theme->styles.disabled, LV_STATE_DISABLED);
+    list_add(theme, &theme->styles.outline_primary, LV_STATE_FOCUS_KEY);
+    list_add(theme, &theme->styles.bg_color_primary, LV_PART_INDICATOR | LV_STATE_CHECKED);
+    list_add(theme, &theme->styles.circle, LV_PART_INDICATOR);
+    list_add(theme, &theme->styles.knob, LV_PART_KNOB);
+    list_add(theme, &theme->styles.bg_color_white, LV_PART_KNOB);
+    list_add(theme, &theme->styles.switch_knob, LV_PART_KNOB);
+
+    list_add(theme, &theme->styles.transition_normal, LV_PART_INDICATOR | LV_STATE_CHECKED);
+    list_add(theme, &theme->styles.transition_normal, LV_PART_INDICATOR);
 #endif
 
 #if LV_USE_CHART
-    else if(lv_obj_check_type(obj, &lv_chart_class)) {
-        lv_obj_add_style(obj, &theme->styles.card, 0);
-        lv_obj_add_style(obj, &theme->styles.pad_small, 0);
-        lv_obj_add_style(obj, &theme->styles.chart_bg, 0);
-        lv_obj_add_style(obj, &theme->styles.scrollbar, LV_PART_SCROLLBAR);
-        lv_obj_add_style(obj, &theme->styles.scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
-        lv_obj_add_style(obj, &theme->styles.chart_series, LV_PART_ITEMS);
-        lv_obj_add_style(obj, &theme->styles.chart_indic, LV_PART_INDICATOR);
-        lv_obj_add_style(obj, &theme->styles.chart_series, LV_PART_CURSOR);
-    }
+    class_list_begin(theme, &lv_chart_class);
+    list_add(theme, &theme->styles.card, 0);
+    list_add(theme, &theme->styles.pad_small, 0);
+    list_add(theme, &theme->styles.chart_bg, 0);
+    list_add(theme, &theme->styles.scrollbar, LV_PART_SCROLLBAR);
+    list_add(theme, &theme->styles.scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
+    list_add(theme, &theme->styles.chart_series, LV_PART_ITEMS);
+    list_add(theme, &theme->styles.chart_indic, LV_PART_INDICATOR);
+    list_add(theme, &theme->styles.chart_series, LV_PART_CURSOR);
 #endif
 
 #if LV_USE_ROLLER
-    else if(lv_obj_check_type(obj, &lv_roller_class)) {
-        lv_obj_add_style(obj, &theme->styles.card, 0);
-        lv_obj_add_style(obj, &theme->styles.anim, 0);
-        lv_obj_add_style(obj, &theme->styles.line_space_large, 0);
-        lv_obj_add_style(obj, &theme->styles.text_align_center, 0);
-        lv_obj_add_style(obj, &theme->styles.outline_primary, LV_STATE_FOCUS_KEY);
-        lv_obj_add_style(obj, &theme->styles.outline_secondary, LV_STATE_EDITED);
-        lv_obj_add_style(obj, &theme->styles.bg_color_primary, LV_PART_SELECTED);
-    }
+    class_list_begin(theme, &lv_roller_class);
+    list_add(theme, &theme->styles.card, 0);
+    list_add(theme, &theme->styles.anim, 0);
+    list_add(theme, &theme->styles.line_space_large, 0);
+    list_add(theme, &theme->styles.text_align_center, 0);
+    list_add(theme, &theme->styles.outline_primary, LV_STATE_FOCUS_KEY);
+    list_add(theme, &theme->styles.outline_secondary, LV_STATE_EDITED);
+    list_add(theme, &theme->styles.bg_color_primary, LV_PART_SELECTED);
 #endif
 
 #if LV_USE_DROPDOWN
-    else if(lv_obj_check_type(obj, &lv_dropdown_class)) {
-        lv_obj_add_style(obj, &theme->styles.card, 0);
-        lv_obj_add_style(obj, &theme->styles.pad_small, 0);
-        lv_obj_add_style(obj, &theme->styles.transition_delayed, 0);
-        lv_obj_add_style(obj, &theme->styles.transition_normal, LV_STATE_PRESSED);
-        lv_obj_add_style(obj, &theme->styles.pressed, LV_STATE_PRESSED);
-        lv_obj_add_style(obj, &theme->styles.outline_primary, LV_STATE_FOCUS_KEY);
-        lv_obj_add_style(obj, &theme->styles.outline_secondary, LV_STATE_EDITED);
-        lv_obj_add_style(obj, &theme->styles.transition_normal, LV_PART_INDICATOR);
-        lv_obj_add_style(obj, &theme->styles.disabled, LV_STATE_DISABLED);
-    }
-    else if(lv_obj_check_type(obj, &lv_dropdownlist_class)) {
-        lv_obj_add_style(obj, &theme->styles.card, 0);
-        lv_obj_add_style(obj, &theme->styles.clip_corner, 0);
-        lv_obj_add_style(obj, &theme->styles.line_space_large, 0);
-        lv_obj_add_style(obj, &theme->styles.dropdown_list, 0);
-        lv_obj_add_style(obj, &theme->styles.scrollbar, LV_PART_SCROLLBAR);
-        lv_obj_add_style(obj, &theme->styles.scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
-        lv_obj_add_style(obj, &theme->styles.bg_color_white, LV_PART_SELECTED);
-        lv_obj_add_style(obj, &theme->styles.bg_color_primary, LV_PART_SELECTED | LV_STATE_CHECKED);
-        lv_obj_add_style(obj, &theme->styles.pressed, LV_PART_SELECTED | LV_STATE_PRESSED);
-    }
+    class_list_begin(theme, &lv_dropdown_class);
+    list_add(theme, &theme->styles.card, 0);
+    list_add(theme, &theme->styles.pad_small, 0);
+    list_add(theme, &theme->styles.transition_delayed, 0);
+    list_add(theme, &theme->styles.transition_normal, LV_STATE_PRESSED);
+    list_add(theme, &theme->styles.pressed, LV_STATE_PRESSED);
+    list_add(theme, &theme->styles.outline_primary, LV_STATE_FOCUS_KEY);
+    list_add(theme, &theme->styles.outline_secondary, LV_STATE_EDITED);
+    list_add(theme, &theme->styles.transition_normal, LV_PART_INDICATOR);
+    list_add(theme, &theme->styles.disabled, LV_STATE_DISABLED);
+
+    class_list_begin(theme, &lv_dropdownlist_class);
+    list_add(theme, &theme->styles.card, 0);
+    list_add(theme, &theme->styles.clip_corner, 0);
+    list_add(theme, &theme->styles.line_space_large, 0);
+    list_add(theme, &theme->styles.dropdown_list, 0);
+    list_add(theme, &theme->styles.scrollbar, LV_PART_SCROLLBAR);
+    list_add(theme, &theme->styles.scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
+    list_add(theme, &theme->styles.bg_color_white, LV_PART_SELECTED);
+    list_add(theme, &theme->styles.bg_color_primary, LV_PART_SELECTED | LV_STATE_CHECKED);
+    list_add(theme, &theme->styles.pressed, LV_PART_SELECTED | LV_STATE_PRESSED);
 #endif
 
 #if LV_USE_ARC
-    else if(lv_obj_check_type(obj, &lv_arc_class)) {
-        lv_obj_add_style(obj, &theme->styles.arc_indic, 0);
-        lv_obj_add_style(obj, &theme->styles.arc_indic, LV_PART_INDICATOR);
-        lv_obj_add_style(obj, &theme->styles.arc_indic_primary, LV_PART_INDICATOR);
-        lv_obj_add_style(obj, &theme->styles.knob, LV_PART_KNOB);
-    }
+    class_list_begin(theme, &lv_arc_class);
+    list_add(theme, &theme->styles.arc_indic, 0);
+    list_add(theme, &theme->styles.arc_indic, LV_PART_INDICATOR);
+    list_add(theme, &theme->styles.arc_indic_primary, LV_PART_INDICATOR);
+    list_add(theme, &theme->styles.knob, LV_PART_KNOB);
 #endif
 
 #if LV_USE_SPINNER
-    else if(lv_obj_check_type(obj, &lv_spinner_class)) {
-        lv_obj_add_style(obj, &theme->styles.arc_indic, 0);
-        lv_obj_add_style(obj, &theme->styles.arc_indic, LV_PART_INDICATOR);
-        lv_obj_add_style(obj, &theme->styles.arc_indic_primary, LV_PART_INDICATOR);
-    }
+    class_list_begin(theme, &lv_spinner_class);
+    list_add(theme, &theme->styles.arc_indic, 0);
+    list_add(theme, &theme->styles.arc_indic, LV_PART_INDICATOR);
+    list_add(theme, &theme->styles.arc_indic_primary, LV_PART_INDICATOR);
 #endif
 
 #if LV_USE_TEXTAREA
-    else if(lv_obj_check_type(obj, &lv_textarea_class)) {
-        lv_obj_add_style(obj, &theme->styles.card, 0);
-        lv_obj_add_style(obj, &theme->styles.pad_small, 0);
-        lv_obj_add_style(obj, &theme->styles.disabled, LV_STATE_DISABLED);
-        lv_obj_add_style(obj, &theme->styles.outline_primary, LV_STATE_FOCUS_KEY);
-        lv_obj_add_style(obj, &theme->styles.outline_secondary, LV_STATE_EDITED);
-        lv_obj_add_style(obj, &theme->styles.scrollbar, LV_PART_SCROLLBAR);
-        lv_obj_add_style(obj, &theme->styles.scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
-        lv_obj_add_style(obj, &theme->styles.ta_cursor, LV_PART_CURSOR | LV_STATE_FOCUSED);
-        lv_obj_add_style(obj, &theme->styles.ta_placeholder, LV_PART_TEXTAREA_PLACEHOLDER);
-    }
+    class_list_begin(theme, &lv_textarea_class);
+    list_add(theme, &theme->styles.card, 0);
+    list_add(theme, &theme->styles.pad_small, 0);
+    list_add(theme, &theme->styles.disabled, LV_STATE_DISABLED);
+    list_add(theme, &theme->styles.outline_primary, LV_STATE_FOCUS_KEY);
+    list_add(theme, &theme->styles.outline_secondary, LV_STATE_EDITED);
+    list_add(theme, &theme->styles.scrollbar, LV_PART_SCROLLBAR);
+    list_add(theme, &theme->styles.scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
+    list_add(theme, &theme->styles.ta_cursor, LV_PART_CURSOR | LV_STATE_FOCUSED);
+    list_add(theme, &theme->styles.ta_placeholder, LV_PART_TEXTAREA_PLACEHOLDER);
 #endif
 
 #if LV_USE_CALENDAR
-    else if(lv_obj_check_type(obj, &lv_calendar_class)) {
-        lv_obj_add_style(obj, &theme->styles.card, 0);
-        lv_obj_add_style(obj, &theme->styles.pad_zero, 0);
-    }
+    class_list_begin(theme, &lv_calendar_class);
+    list_add(theme, &theme->styles.card, 0);
+    list_add(theme, &theme->styles.pad_zero, 0);
 
 #if LV_USE_CALENDAR_HEADER_ARROW
-    else if(lv_obj_check_type(obj, &lv_calendar_header_arrow_class)) {
-        lv_obj_add_style(obj, &theme->styles.calendar_header, 0);
-    }
+    class_list_begin(theme, &lv_calendar_header_arrow_class);
+    list_add(theme, &theme->styles.calendar_header, 0);
 #endif
 
 #if LV_USE_CALENDAR_HEADER_DROPDOWN
-    else if(lv_obj_check_type(obj, &lv_calendar_header_dropdown_class)) {
-        lv_obj_add_style(obj, &theme->styles.calendar_header, 0);
-    }
+    class_list_begin(theme, &lv_calendar_header_dropdown_class);
+    list_add(theme, &theme->styles.calendar_header, 0);
 #endif
 #endif
 
 #if LV_USE_KEYBOARD
-    else if(lv_obj_check_type(obj, &lv_keyboard_class)) {
-        lv_obj_add_style(obj, &theme->styles.scr, 0);
-        lv_obj_add_style(obj, theme->disp_size == DISP_LARGE ? &theme->styles.pad_small : &theme->styles.pad_tiny, 0);
-        lv_obj_add_style(obj, &theme->styles.outline_primary, LV_STATE_FOCUS_KEY);
-        lv_obj_add_style(obj, &theme->styles.outline_secondary, LV_STATE_EDITED);
-        lv_obj_add_style(obj, &theme->styles.btn, LV_PART_ITEMS);
-        lv_obj_add_style(obj, &theme->styles.disabled, LV_PART_ITEMS | LV_STATE_DISABLED);
-        lv_obj_add_style(obj, &theme->styles.bg_color_white, LV_PART_ITEMS);
-        lv_obj_add_style(obj, &theme->styles.keyboard_button_bg, LV_PART_ITEMS);
-        lv_obj_add_style(obj, &theme->styles.pressed, LV_PART_ITEMS | LV_STATE_PRESSED);
-        lv_obj_add_style(obj, &theme->styles.bg_color_grey, LV_PART_ITEMS | LV_STATE_CHECKED);
-        lv_obj_add_style(obj, &theme->styles.bg_color_primary_muted, LV_PART_ITEMS | LV_STATE_FOCUS_KEY);
-        lv_obj_add_style(obj, &theme->styles.bg_color_secondary_muted, LV_PART_ITEMS | LV_STATE_EDITED);
-    }
-#endif
-
-#if LV_USE_LABEL && LV_USE_TEXTAREA
-    else if(lv_obj_check_type(obj, &lv_label_class) && lv_obj_check_type(parent, &lv_textarea_class)) {
-        lv_obj_add_style(obj, &theme->styles.bg_color_primary, LV_PART_SELECTED);
-    }
+    class_list_begin(theme, &lv_keyboard_class);
+    list_add(theme, &theme->styles.scr, 0);
+    list_add(theme, theme->disp_size == DISP_LARGE ? &theme->styles.pad_small : &theme->styles.pad_tiny, 0);
+    list_add(theme, &theme->styles.outline_primary, LV_STATE_FOCUS_KEY);
+    list_add(theme, &theme->styles.outline_secondary, LV_STATE_EDITED);
+    list_add(theme, &theme->styles.btn, LV_PART_ITEMS);
+    list_add(theme, &theme->styles.disabled, LV_PART_ITEMS | LV_STATE_DISABLED);
+    list_add(theme, &theme->styles.bg_color_white, LV_PART_ITEMS);
+    list_add(theme, &theme->styles.keyboard_button_bg, LV_PART_ITEMS);
+    list_add(theme, &theme->styles.pressed, LV_PART_ITEMS | LV_STATE_PRESSED);
+    list_add(theme, &theme->styles.bg_color_grey, LV_PART_ITEMS | LV_STATE_CHECKED);
+    list_add(theme, &theme->styles.bg_color_primary_muted, LV_PART_ITEMS | LV_STATE_FOCUS_KEY);
+    list_add(theme, &theme->styles.bg_color_secondary_muted, LV_PART_ITEMS | LV_STATE_EDITED);
 #endif
 
 #if LV_USE_LIST
-    else if(lv_obj_check_type(obj, &lv_list_class)) {
-        lv_obj_add_style(obj, &theme->styles.card, 0);
-        lv_obj_add_style(obj, &theme->styles.list_bg, 0);
-        lv_obj_add_style(obj, &theme->styles.scrollbar, LV_PART_SCROLLBAR);
-        lv_obj_add_style(obj, &theme->styles.scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
-        return;
-    }
-    else if(lv_obj_check_type(obj, &lv_list_text_class)) {
-        lv_obj_add_style(obj, &theme->styles.bg_color_grey, 0);
-        lv_obj_add_style(obj, &theme->styles.list_item_grow, 0);
-    }
-    else if(lv_obj_check_type(obj, &lv_list_button_class)) {
-        lv_obj_add_style(obj, &theme->styles.bg_color_white, 0);
-        lv_obj_add_style(obj, &theme->styles.list_btn, 0);
-        lv_obj_add_style(obj, &theme->styles.bg_color_primary, LV_STATE_FOCUS_KEY);
-        lv_obj_add_style(obj, &theme->styles.list_item_grow, LV_STATE_FOCUS_KEY);
-        lv_obj_add_style(obj, &theme->styles.list_item_grow, LV_STATE_PRESSED);
-        lv_obj_add_style(obj, &theme->styles.pressed, LV_STATE_PRESSED);
-    }
+    class_list_begin(theme, &lv_list_class);
+    list_add(theme, &theme->styles.card, 0);
+    list_add(theme, &theme->styles.list_bg, 0);
+    list_add(theme, &theme->styles.scrollbar, LV_PART_SCROLLBAR);
+    list_add(theme, &theme->styles.scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
+
+    class_list_begin(theme, &lv_list_text_class);
+    list_add(theme, &theme->styles.bg_color_grey, 0);
+    list_add(theme, &theme->styles.list_item_grow, 0);
+
+    class_list_begin(theme, &lv_list_button_class);
+    list_add(theme, &theme->styles.bg_color_white, 0);
+    list_add(theme, &theme->styles.list_btn, 0);
+    list_add(theme, &theme->styles.bg_color_primary, LV_STATE_FOCUS_KEY);
+    list_add(theme, &theme->styles.list_item_grow, LV_STATE_FOCUS_KEY);
+    list_add(theme, &theme->styles.list_item_grow, LV_STATE_PRESSED);
+    list_add(theme, &theme->styles.pressed, LV_STATE_PRESSED);
 #endif
+
 #if LV_USE_MENU
-    else if(lv_obj_check_type(obj, &lv_menu_class)) {
-        lv_obj_add_style(obj, &theme->styles.card, 0);
-        lv_obj_add_style(obj, &theme->styles.menu_bg, 0);
-    }
-    else if(lv_obj_check_type(obj, &lv_menu_sidebar_cont_class)) {
-        lv_obj_add_style(obj, &theme->styles.menu_sidebar_cont, 0);
-        lv_obj_add_style(obj, &theme->styles.scrollbar, LV_PART_SCROLLBAR);
-        lv_obj_add_style(obj, &theme->styles.scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
-    }
-    else if(lv_obj_check_type(obj, &lv_menu_main_cont_class)) {
-        lv_obj_add_style(obj, &theme->styles.menu_main_cont, 0);
-        lv_obj_add_style(obj, &theme->styles.scrollbar, LV_PART_SCROLLBAR);
-        lv_obj_add_style(obj, &theme->styles.scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
-    }
-    else if(lv_obj_check_type(obj, &lv_menu_cont_class)) {
-        lv_obj_add_style(obj, &theme->styles.menu_cont, 0);
-        lv_obj_add_style(obj, &theme->styles.menu_pressed, LV_STATE_PRESSED);
-        lv_obj_add_style(obj, &theme->styles.bg_color_primary_muted, LV_STATE_PRESSED | LV_STATE_CHECKED);
-        lv_obj_add_style(obj, &theme->styles.bg_color_primary_muted, LV_STATE_CHECKED);
-        lv_obj_add_style(obj, &theme->styles.bg_color_primary, LV_STATE_FOCUS_KEY);
-    }
-    else if(lv_obj_check_type(obj, &lv_menu_sidebar_header_cont_class) ||
-            lv_obj_check_type(obj, &lv_menu_main_header_cont_class)) {
-        lv_obj_add_style(obj, &theme->styles.menu_header_cont, 0);
-    }
-    else if(lv_obj_check_type(obj, &lv_menu_page_class)) {
-        lv_obj_add_style(obj, &theme->styles.menu_page, 0);
-        lv_obj_add_style(obj, &theme->styles.scrollbar, LV_PART_SCROLLBAR);
-        lv_obj_add_style(obj, &theme->styles.scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
-    }
-    else if(lv_obj_check_type(obj, &lv_menu_section_class)) {
-        lv_obj_add_style(obj, &theme->styles.menu_section, 0);
-    }
-    else if(lv_obj_check_type(obj, &lv_menu_separator_class)) {
-        lv_obj_add_style(obj, &theme->styles.menu_separator, 0);
-    }
+    class_list_begin(theme, &lv_menu_class);
+    list_add(theme, &theme->styles.card, 0);
+    list_add(theme, &theme->styles.menu_bg, 0);
+
+    class_list_begin(theme, &lv_menu_sidebar_cont_class);
+    list_add(theme, &theme->styles.menu_sidebar_cont, 0);
+    list_add(theme, &theme->styles.scrollbar, LV_PART_SCROLLBAR);
+    list_add(theme, &theme->styles.scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
+
+    class_list_begin(theme, &lv_menu_main_cont_class);
+    list_add(theme, &theme->styles.menu_main_cont, 0);
+    list_add(theme, &theme->styles.scrollbar, LV_PART_SCROLLBAR);
+    list_add(theme, &theme->styles.scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
+
+    class_list_begin(theme, &lv_menu_cont_class);
+    list_add(theme, &theme->styles.menu_cont, 0);
+    list_add(theme, &theme->styles.menu_pressed, LV_STATE_PRESSED);
+    list_add(theme, &theme->styles.bg_color_primary_muted, LV_STATE_PRESSED | LV_STATE_CHECKED);
+    list_add(theme, &theme->styles.bg_color_primary_muted, LV_STATE_CHECKED);
+    list_add(theme, &theme->styles.bg_color_primary, LV_STATE_FOCUS_KEY);
+
+    class_list_begin(theme, &lv_menu_sidebar_header_cont_class);
+    list_add(theme, &theme->styles.menu_header_cont, 0);
+    class_list_share(theme, &lv_menu_main_header_cont_class);
+
+    class_list_begin(theme, &lv_menu_page_class);
+    list_add(theme, &theme->styles.menu_page, 0);
+    list_add(theme, &theme->styles.scrollbar, LV_PART_SCROLLBAR);
+    list_add(theme, &theme->styles.scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
+
+    class_list_begin(theme, &lv_menu_section_class);
+    list_add(theme, &theme->styles.menu_section, 0);
+
+    class_list_begin(theme, &lv_menu_separator_class);
+    list_add(theme, &theme->styles.menu_separator, 0);
 #endif
+
 #if LV_USE_MSGBOX
-    else if(lv_obj_check_type(obj, &lv_msgbox_class)) {
-        lv_obj_add_style(obj, &theme->styles.card, 0);
-        lv_obj_add_style(obj, &theme->styles.pad_zero, 0);
-        lv_obj_add_style(obj, &theme->styles.clip_corner, 0);
-        return;
-    }
-    else if(lv_obj_check_type(obj, &lv_msgbox_backdrop_class)) {
-        lv_obj_add_style(obj, &theme->styles.msgbox_backdrop_bg, 0);
-        return;
-    }
-    else if(lv_obj_check_type(obj, &lv_msgbox_header_class)) {
-        lv_obj_add_style(obj, &theme->styles.pad_tiny, 0);
-        lv_obj_add_style(obj, &theme->styles.bg_color_grey, 0);
-        return;
-    }
-    else if(lv_obj_check_type(obj, &lv_msgbox_footer_class)) {
-        lv_obj_add_style(obj, &theme->styles.pad_tiny, 0);
-        return;
-    }
-    else if(lv_obj_check_type(obj, &lv_msgbox_content_class)) {
-        lv_obj_add_style(obj, &theme->styles.scrollbar, LV_PART_SCROLLBAR);
-        lv_obj_add_style(obj, &theme->styles.scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
-        lv_obj_add_style(obj, &theme->styles.pad_tiny, 0);
-        return;
-    }
-    else if(lv_obj_check_type(obj, &lv_msgbox_header_button_class) ||
-            lv_obj_check_type(obj, &lv_msgbox_footer_button_class)) {
-        lv_obj_add_style(obj, &theme->styles.btn, 0);
-        lv_obj_add_style(obj, &theme->styles.bg_color_primary, 0);
-        lv_obj_add_style(obj, &theme->styles.transition_delayed, 0);
-        lv_obj_add_style(obj, &theme->styles.pressed, LV_STATE_PRESSED);
-        lv_obj_add_style(obj, &theme->styles.transition_normal, LV_STATE_PRESSED);
-        lv_obj_add_style(obj, &theme->styles.outline_primary, LV_STATE_FOCUS_KEY);
-        lv_obj_add_style(obj, &theme->styles.bg_color_secondary, LV_STATE_CHECKED);
-        lv_obj_add_style(obj, &theme->styles.disabled, LV_STATE_DISABLED);
-        return;
-    }
+    class_list_begin(theme, &lv_msgbox_class);
+    list_add(theme, &theme->styles.card, 0);
+    list_add(theme, &theme->styles.pad_zero, 0);
+    list_add(theme, &theme->styles.clip_corner, 0);
+
+    class_list_begin(theme, &lv_msgbox_backdrop_class);
+    list_add(theme, &theme->styles.msgbox_backdrop_bg, 0);
+
+    class_list_begin(theme, &lv_msgbox_header_class);
+    list_add(theme, &theme->styles.pad_tiny, 0);
+    list_add(theme, &theme->styles.bg_color_grey, 0);
+
+    class_list_begin(theme, &lv_msgbox_footer_class);
+    list_add(theme, &theme->styles.pad_tiny, 0);
+
+    class_list_begin(theme, &lv_msgbox_content_class);
+    list_add(theme, &theme->styles.scrollbar, LV_PART_SCROLLBAR);
+    list_add(theme, &theme->styles.scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
+    list_add(theme, &theme->styles.pad_tiny, 0);
+
+    class_list_begin(theme, &lv_msgbox_header_button_class);
+    list_add(theme, &theme->styles.btn, 0);
+    list_add(theme, &theme->styles.bg_color_primary, 0);
+    list_add(theme, &theme->styles.transition_delayed, 0);
+    list_add(theme, &theme->styles.pressed, LV_STATE_PRESSED);
+    list_add(theme, &theme->styles.transition_normal, LV_STATE_PRESSED);
+    list_add(theme, &theme->styles.outline_primary, LV_STATE_FOCUS_KEY);
+    list_add(theme, &theme->styles.bg_color_secondary, LV_STATE_CHECKED);
+    list_add(theme, &theme->styles.disabled, LV_STATE_DISABLED);
+    class_list_share(theme, &lv_msgbox_footer_button_class);
 #endif
 
 #if LV_USE_SPINBOX
-    else if(lv_obj_check_type(obj, &lv_spinbox_class)) {
-        lv_obj_add_style(obj, &theme->styles.card, 0);
-        lv_obj_add_style(obj, &theme->styles.pad_small, 0);
-        lv_obj_add_style(obj, &theme->styles.outline_primary, LV_STATE_FOCUS_KEY);
-        lv_obj_add_style(obj, &theme->styles.outline_secondary, LV_STATE_EDITED);
-        lv_obj_add_style(obj, &theme->styles.bg_color_primary, LV_PART_CURSOR);
-    }
+    class_list_begin(theme, &lv_spinbox_class);
+    list_add(theme, &theme->styles.card, 0);
+    list_add(theme, &theme->styles.pad_small, 0);
+    list_add(theme, &theme->styles.outline_primary, LV_STATE_FOCUS_KEY);
+    list_add(theme, &theme->styles.outline_secondary, LV_STATE_EDITED);
+    list_add(theme, &theme->styles.bg_color_primary, LV_PART_CURSOR);
 #endif
+
 #if LV_USE_TILEVIEW
-    else if(lv_obj_check_type(obj, &lv_tileview_class)) {
-        lv_obj_add_style(obj, &theme->styles.scr, 0);
-        lv_obj_add_style(obj, &theme->styles.scrollbar, LV_PART_SCROLLBAR);
-        lv_obj_add_style(obj, &theme->styles.scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
-    }
-    else if(lv_obj_check_type(obj, &lv_tileview_tile_class)) {
-        lv_obj_add_style(obj, &theme->styles.scrollbar, LV_PART_SCROLLBAR);
-        lv_obj_add_style(obj, &theme->styles.scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
-    }
+    class_list_begin(theme, &lv_tileview_class);
+    list_add(theme, &theme->styles.scr, 0);
+    list_add(theme, &theme->styles.scrollbar, LV_PART_SCROLLBAR);
+    list_add(theme, &theme->styles.scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
+
+    class_list_begin(theme, &lv_tileview_tile_class);
+    list_add(theme, &theme->styles.scrollbar, LV_PART_SCROLLBAR);
+    list_add(theme, &theme->styles.scrollbar_scrolled, LV_PART_SCROLLBAR | LV_STATE_SCROLLED);
 #endif
 
 #if LV_USE_TABVIEW
-    else if(lv_obj_check_type(obj, &lv_tabview_class)) {
-        lv_obj_add_style(obj, &theme->styles.scr, 0);
-        lv_obj_add_style(obj, &theme->styles.pad_zero, 0);
-    }
+    class_list_begin(theme, &lv_tabview_class);
+    list_add(theme, &theme->styles.scr, 0);
+    list_add(theme, &theme->styles.pad_zero, 0);
 #endif
 
 #if LV_USE_WIN
-    else if(lv_obj_check_type(obj, &lv_win_class)) {
-        lv_obj_add_style(obj, &theme->styles.clip_corner, 0);
-    }
+    class_list_begin(theme, &lv_win_class);
+    list_add(theme, &theme->styles.clip_corner, 0);
 #endif
 
 #if LV_USE_LED
-    else if(lv_obj_check_type(obj, &lv_led_class)) {
-        lv_obj_add_style(obj, &theme->styles.led, 0);
-    }
+    class_list_begin(theme, &lv_led_class);
+    list_add(theme, &theme->styles.led, 0);
 #endif
 
 #if LV_USE_SCALE
-    else if(lv_obj_check_type(obj, &lv_scale_class)) {
-        lv_obj_add_style(obj, &theme->styles.scale, LV_PART_MAIN);
-        lv_obj_add_style(obj, &theme->styles.scale, LV_PART_INDICATOR);
-        lv_obj_add_style(obj, &theme->styles.scale, LV_PART_ITEMS);
-    }
+    class_list_begin(theme, &lv_scale_class);
+    list_add(theme, &theme->styles.scale, LV_PART_MAIN);
+    list_add(theme, &theme->styles.scale, LV_PART_INDICATOR);
+    list_add(theme, &theme->styles.scale, LV_PART_ITEMS);
 #endif
+
+    theme->list_act = NULL;
+
+    /*Free the unused part of the pool*/
+    lv_array_resize(&theme->style_pool, lv_array_size(&theme->style_pool));
 }
 
 static void style_init_reset(lv_style_t * style)
@@ -26,6 +26,10 @@
 #include "../../misc/lv_math.h"
 #include "../../misc/lv_log.h"
 #include "../../misc/lv_anim.h"
+#include "../../misc/cache/instance/lv_image_cache.h"
+#include "../../draw/lv_draw_private.h"
+#include "../../draw/lv_draw_image.h"
+#include "../../stdlib/lv_string.h"
 
 /*********************
  *      DEFINES
@@ -43,7 +47,9 @@
  **********************/
 static void index_change(lv_obj_t * obj, int32_t idx);
 static void lv_animimg_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
+static void lv_animimg_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void lv_animimg_set_src_inner(lv_obj_t * obj, const void * dsc[], size_t num, bool reverse);
+static void atlas_free(lv_animimg_t * animimg);
 
 /**********************
  *  STATIC VARIABLES
@@ -76,6 +82,7 @@ static const lv_property_ops_t properties[] = {
 
 const lv_obj_class_t lv_animimg_class = {
     .constructor_cb = lv_animimg_constructor,
+    .destructor_cb = lv_animimg_destructor,
     .instance_size = sizeof(lv_animimg_t),
     .base_class = &lv_image_class,
     .name = "lv_animimg",
@@ -179,6 +186,146 @@ void lv_animimg_set_completed_cb(lv_obj_t * obj, lv_anim_completed_cb_t complete
     lv_anim_set_completed_cb(&animimg->anim, completed_cb);
 }
 
+lv_result_t lv_animimg_create_atlas(lv_obj_t * obj, lv_color_format_t cf, uint32_t max_size)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_animimg_t * animimg = (lv_animimg_t *)obj;
+
+    lv_animimg_delete_atlas(obj);
+
+    /*The pictures are drawn into the atlas so only the formats of the supported layers can be used*/
+    switch(cf) {
+#if LV_DRAW_SW_SUPPORT_RGB565
+        case LV_COLOR_FORMAT_RGB565:
+#endif
+#if LV_DRAW_SW_SUPPORT_RGB888
+        case LV_COLOR_FORMAT_RGB888:
+#endif
+#if LV_DRAW_SW_SUPPORT_XRGB8888
+        case LV_COLOR_FORMAT_XRGB8888:
+#endif
+#if LV_DRAW_SW_SUPPORT_ARGB8888
+        case LV_COLOR_FORMAT_ARGB8888:
+#endif
+#if LV_DRAW_SW_SUPPORT_L8
+        case LV_COLOR_FORMAT_L8:
+#endif
+            break;
+        default:
+            LV_LOG_WARN("Not supported color format");
+            return LV_RESULT_INVALID;
+    }
+
+    if(animimg->dsc == NULL || animimg->pic_count <= 0) {
+        LV_LOG_WARN("no pictures are set");
+        return LV_RESULT_INVALID;
+    }
+
+    /*All the pictures need to have the same size*/
+    uint32_t pic_cnt = animimg->pic_count;
+    lv_image_header_t header;
+    int32_t w = 0;
+    int32_t h = 0;
+    uint32_t i;
+    for(i = 0; i < pic_cnt; i++) {
+        if(lv_image_decoder_get_info(animimg->dsc[i], &header) != LV_RESULT_OK) {
+            LV_LOG_WARN("couldn't get the info of picture %" LV_PRIu32, i);
+            return LV_RESULT_INVALID;
+        }
+
+        if(i == 0) {
+            w = header.w;
+            h = header.h;
+        }
+        else if(header.w != w || header.h != h) {
+            LV_LOG_WARN("the pictures have different sizes");
+            return LV_RESULT_INVALID;
+        }
+    }
+
+    /*Each picture starts on an aligned address so that it can be used as an image directly*/
+    uint32_t stride = lv_draw_buf_width_to_stride(w, cf);
+    uint32_t slot_h = h;
+    while((slot_h * stride) % LV_DRAW_BUF_ALIGN) slot_h++;
+
+    uint64_t atlas_size = (uint64_t)slot_h * stride * pic_cnt;
+    if(atlas_size > max_size) {
+        LV_LOG_WARN("the atlas needs %" LV_PRIu32 " bytes, only %" LV_PRIu32 " is allowed",
+                    (uint32_t)atlas_size, max_size);
+        return LV_RESULT_INVALID;
+    }
+
+    lv_draw_buf_t * atlas = lv_draw_buf_create(w, slot_h * pic_cnt, cf, stride);
+    if(atlas == NULL) {
+        LV_LOG_WARN("couldn't allocate the atlas");
+        return LV_RESULT_INVALID;
+    }
+
+    lv_image_dsc_t * frames = lv_malloc(sizeof(lv_image_dsc_t) * pic_cnt);
+    LV_ASSERT_MALLOC(frames);
+    if(frames == NULL) {
+        lv_draw_buf_destroy(atlas);
+        return LV_RESULT_INVALID;
+    }
+
+    /*Draw the pictures below each other*/
+    lv_draw_buf_clear(atlas, NULL);
+
+    lv_layer_t layer;
+    lv_layer_init(&layer);
+    lv_area_t atlas_area = {0, 0, w - 1, (int32_t)(slot_h * pic_cnt) - 1};
+    layer.draw_buf = atlas;
+    layer.color_format = cf;
+    layer.buf_area = atlas_area;
+    layer._clip_area = atlas_area;
+    layer.phy_clip_area = atlas_area;
+
+    lv_draw_image_dsc_t img_dsc;
+    lv_draw_image_dsc_init(&img_dsc);
+    for(i = 0; i < pic_cnt; i++) {
+        lv_area_t frame_area = {0, (int32_t)(i * slot_h), w - 1, (int32_t)(i * slot_h) + h - 1};
+        img_dsc.src = animimg->dsc[i];
+        lv_draw_image(&layer, &img_dsc, &frame_area);
+
+        lv_memzero(&frames[i], sizeof(lv_image_dsc_t));
+        frames[i].header.magic = LV_IMAGE_HEADER_MAGIC;
+        frames[i].header.cf = cf;
+        frames[i].header.w = w;
+        frames[i].header.h = h;
+        frames[i].header.stride = stride;
+        frames[i].data = atlas->data + i * slot_h * stride;
+        frames[i].data_size = h * stride;
+    }
+
+    while(layer.draw_task_head) {
+        lv_draw_dispatch_wait_for_request();
+        if(!lv_draw_dispatch_layer(lv_obj_get_display(obj), &layer)) {
+            lv_draw_wait_for_finish();
+            lv_draw_dispatch_request();
+        }
+    }
+
+    animimg->atlas = atlas;
+    animimg->atlas_frames = frames;
+
+    /*Show the current picture from the atlas too*/
+    if(animimg->pic_idx >= 0) lv_image_set_src(obj, &frames[animimg->pic_idx]);
+
+    return LV_RESULT_OK;
+}
+
+void lv_animimg_delete_atlas(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_animimg_t * animimg = (lv_animimg_t *)obj;
+    if(animimg->atlas == NULL) return;
+
+    /*Don't let the image show a deleted picture*/
+    if(animimg->pic_idx >= 0) lv_image_set_src(obj, animimg->dsc[animimg->pic_idx]);
+
+    atlas_free(animimg);
+}
+
 /*=====================
  * Getter functions
  *====================*/
@@ -218,6 +365,13 @@ lv_anim_t * lv_animimg_get_anim(lv_obj_t * obj)
     return &animimg->anim;
 }
 
+uint32_t lv_animimg_get_atlas_size(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_animimg_t * animimg = (lv_animimg_t *)obj;
+    return animimg->atlas ? animimg->atlas->data_size : 0;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -231,6 +385,9 @@ static void lv_animimg_constructor(const lv_obj_class_t * class_p, lv_obj_t * ob
 
     animimg->dsc = NULL;
     animimg->pic_count = -1;
+    animimg->pic_idx = -1;
+    animimg->atlas = NULL;
+    animimg->atlas_frames = NULL;
 
     /*initial animation*/
     lv_anim_init(&animimg->anim);
@@ -241,6 +398,15 @@ static void lv_animimg_constructor(const lv_obj_class_t * class_p, lv_obj_t * ob
     lv_anim_set_repeat_count(&animimg->anim, LV_ANIM_REPEAT_INFINITE);
 }
 
+static void lv_animimg_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
+{
+    LV_UNUSED(class_p);
+    lv_animimg_t * animimg = (lv_animimg_t *)obj;
+
+    /*The image is not drawn anymore so its source doesn't need to be changed*/
+    if(animimg->atlas) atlas_free(animimg);
+}
+
 static void index_change(lv_obj_t * obj, int32_t idx)
 {
     lv_animimg_t * animimg = (lv_animimg_t *)obj;
@@ -252,15 +418,19 @@ static void index_change(lv_obj_t * obj, int32_t idx)
 
     if(idx >= animimg->pic_count) idx =  animimg->pic_count - 1;
 
-    lv_image_set_src(obj, animimg->dsc[idx]);
+    animimg->pic_idx = idx;
+    if(animimg->atlas) lv_image_set_src(obj, &animimg->atlas_frames[idx]);
+    else lv_image_set_src(obj, animimg->dsc[idx]);
 }
 
 static void lv_animimg_set_src_inner(lv_obj_t * obj, const void * dsc[], size_t num, bool reverse)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
     lv_animimg_t * animimg = (lv_animimg_t *)obj;
+    lv_animimg_delete_atlas(obj);
     animimg->dsc = dsc;
     animimg->pic_count = num;
+    animimg->pic_idx = -1;
     if(reverse) {
         lv_anim_set_values(&animimg->anim, (int32_t)num, 0);
     }
@@ -269,4 +439,18 @@ static void lv_animimg_set_src_inner(lv_obj_t * obj, const void * dsc[], size_t
     }
 }
 
+static void atlas_free(lv_animimg_t * animimg)
+{
+    /*The descriptors' addresses might be reused by other images*/
+    int32_t i;
+    for(i = 0; i < animimg->pic_count; i++) {
+        lv_image_cache_drop(&animimg->atlas_frames[i]);
+    }
+
+    lv_free(animimg->atlas_frames);
+    lv_draw_buf_destroy(animimg->atlas);
+    animimg->atlas_frames = NULL;
+    animimg->atlas = NULL;
+}
+
 #endif
@@ -137,6 +137,29 @@ void lv_animimg_set_start_cb(lv_obj_t * obj, lv_anim_start_cb_t start_cb);
  */
 void lv_animimg_set_completed_cb(lv_obj_t * obj, lv_anim_completed_cb_t completed_cb);
 
+/**
+ * Decode all the pictures once into a single buffer and play the animation from there.
+ * This way the pictures are not opened, decoded or decompressed again in every cycle,
+ * showing a picture means only drawing a part of an already decoded buffer.
+ * All the pictures need to have the same size.
+ * Setting a new source deletes the atlas.
+ * @param obj       pointer to an animation image object
+ * @param cf        color format of the decoded pictures. A compact format, e.g. `LV_COLOR_FORMAT_RGB565`
+ *                  saves memory but the transparent pixels of the pictures will be black.
+ *                  Supported: RGB565, RGB888, XRGB8888, ARGB8888, L8 if enabled by `LV_DRAW_SW_SUPPORT_...`
+ * @param max_size  max. size of the atlas in bytes
+ * @return          LV_RESULT_OK: the atlas is created;
+ *                  LV_RESULT_INVALID: the pictures couldn't be decoded or they don't fit into `max_size`.
+ *                  The pictures are decoded while playing as before.
+ */
+lv_result_t lv_animimg_create_atlas(lv_obj_t * obj, lv_color_format_t cf, uint32_t max_size);
+
+/**
+ * Delete the atlas of the animation image and decode the pictures while playing again.
+ * @param obj       pointer to an animation image object
+ */
+void lv_animimg_delete_atlas(lv_obj_t * obj);
+
 /*=====================
  * Getter functions
  *====================*/
@@ -176,6 +199,13 @@ uint32_t lv_animimg_get_repeat_count(lv_obj_t * obj);
  */
 lv_anim_t * lv_animimg_get_anim(lv_obj_t * obj);
 
+/**
+ * Get the size of the atlas of the animation image.
+ * @param obj   pointer to an animation image object
+ * @return      the size of the decoded pictures in bytes or 0 if there is no atlas
+ */
+uint32_t lv_animimg_get_atlas_size(lv_obj_t * obj);
+
 #endif /*LV_USE_ANIMIMG*/
 
 #ifdef __cplusplus
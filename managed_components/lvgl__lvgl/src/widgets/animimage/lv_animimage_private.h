@@ -35,6 +35,11 @@ struct _lv_animimg_t {
     /* picture sequence */
     const void ** dsc;
     int8_t  pic_count;
+    int8_t  pic_idx;                /**< Index of the currently shown picture or -1 */
+
+    /* all the pictures decoded once into one buffer */
+    lv_draw_buf_t * atlas;          /**< The decoded pictures below each other or NULL if not used */
+    lv_image_dsc_t * atlas_frames;  /**< Image descriptors of the pictures pointing into `atlas` */
 };
 
 
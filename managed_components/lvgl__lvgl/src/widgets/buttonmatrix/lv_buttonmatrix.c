@@ -53,6 +53,9 @@ static bool button_get_checked(lv_buttonmatrix_ctrl_t ctrl_bits);
 static uint32_t get_button_from_point(lv_obj_t * obj, lv_point_t * p);
 static void allocate_button_areas_and_controls(const lv_obj_t * obj, const char * const * map);
 static void invalidate_button_area(const lv_obj_t * obj, uint32_t btn_idx);
+static void invalidate_text_sizes(lv_buttonmatrix_t * btnm);
+static int32_t get_rect_ext_size(const lv_draw_rect_dsc_t * dsc);
+static int32_t get_gap_ext_size(const lv_obj_t * obj);
 static void make_one_button_checked(lv_obj_t * obj, uint32_t btn_idx);
 static bool has_popovers_in_top_row(lv_obj_t * obj);
 static bool button_is_recolor(lv_buttonmatrix_ctrl_t ctrl_bits);
@@ -75,6 +78,7 @@ const lv_obj_class_t lv_buttonmatrix_class = {
     .instance_size = sizeof(lv_buttonmatrix_t),
     .editable = LV_OBJ_CLASS_EDITABLE_TRUE,
     .group_def = LV_OBJ_CLASS_GROUP_DEF_TRUE,
+    .items_redraw_self = 1,
     .base_class = &lv_obj_class,
     .name = "lv_buttonmatrix",
 };
@@ -151,6 +155,7 @@ void lv_buttonmatrix_set_button_ctrl(lv_obj_t * obj, uint32_t btn_id, lv_buttonm
     }
 
     btnm->ctrl_bits[btn_id] |= ctrl;
+    if(ctrl & LV_BUTTONMATRIX_CTRL_RECOLOR) btnm->text_sizes[btn_id].x = -1;
     invalidate_button_area(obj, btn_id);
 
     if(ctrl & LV_BUTTONMATRIX_CTRL_POPOVER) {
@@ -167,6 +172,7 @@ void lv_buttonmatrix_clear_button_ctrl(lv_obj_t * obj, uint32_t btn_id, lv_butto
     if(btn_id >= btnm->btn_cnt) return;
 
     btnm->ctrl_bits[btn_id] &= (~ctrl);
+    if(ctrl & LV_BUTTONMATRIX_CTRL_RECOLOR) btnm->text_sizes[btn_id].x = -1;
     invalidate_button_area(obj, btn_id);
 
     if(ctrl & LV_BUTTONMATRIX_CTRL_POPOVER) {
@@ -196,6 +202,17 @@ void lv_buttonmatrix_clear_button_ctrl_all(lv_obj_t * obj, lv_buttonmatrix_ctrl_
     }
 }
 
+void lv_buttonmatrix_refresh_button_text(lv_obj_t * obj, uint32_t btn_id)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_buttonmatrix_t * btnm = (lv_buttonmatrix_t *)obj;
+    if(btn_id >= btnm->btn_cnt) return;
+
+    btnm->text_sizes[btn_id].x = -1;
+    invalidate_button_area(obj, btn_id);
+}
+
 void lv_buttonmatrix_set_button_width(lv_obj_t * obj, uint32_t btn_id, uint32_t width)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
@@ -296,6 +313,8 @@ static void lv_buttonmatrix_constructor(const lv_obj_class_t * class_p, lv_obj_t
     btnm->row_cnt        = 0;
     btnm->btn_id_sel     = LV_BUTTONMATRIX_BUTTON_NONE;
     btnm->button_areas   = NULL;
+    btnm->text_sizes     = NULL;
+    btnm->text_font      = NULL;
     btnm->ctrl_bits      = NULL;
     btnm->map_p          = NULL;
     btnm->one_check      = 0;
@@ -314,8 +333,10 @@ static void lv_buttonmatrix_destructor(const lv_obj_class_t * class_p, lv_obj_t
     LV_UNUSED(class_p);
     lv_buttonmatrix_t * btnm = (lv_buttonmatrix_t *)obj;
     lv_free(btnm->button_areas);
+    lv_free(btnm->text_sizes);
     lv_free(btnm->ctrl_bits);
     btnm->button_areas = NULL;
+    btnm->text_sizes = NULL;
     btnm->ctrl_bits = NULL;
     LV_TRACE_OBJ_CREATE("finished");
 }
@@ -480,11 +501,12 @@ static void lv_buttonmatrix_event(const lv_obj_class_t * class_p, lv_event_t * e
                 btnm->btn_id_sel = LV_BUTTONMATRIX_BUTTON_NONE;
             }
         }
+
+        /*The focus related states are applied only on the selected button*/
+        invalidate_button_area(obj, btnm->btn_id_sel);
     }
     else if(code == LV_EVENT_DEFOCUSED || code == LV_EVENT_LEAVE) {
-        //        TODO
-        //        if(btnm->btn_id_sel != LV_BUTTONMATRIX_BUTTON_NONE) invalidate_button_area(obj, btnm->btn_id_sel);
-        //        btnm->btn_id_sel = LV_BUTTONMATRIX_BUTTON_NONE;
+        invalidate_button_area(obj, btnm->btn_id_sel);
     }
     else if(code == LV_EVENT_KEY) {
 
@@ -620,6 +642,11 @@ static void draw_main(lv_event_t * e)
     lv_draw_rect_dsc_t draw_rect_dsc_def;
     lv_draw_label_dsc_t draw_label_dsc_def;
 
+    /*Descriptors of the last used non-default state. Typically many buttons share the same state (e.g. checked)*/
+    lv_draw_rect_dsc_t draw_rect_dsc_state;
+    lv_draw_label_dsc_t draw_label_dsc_state;
+    lv_state_t dsc_state = LV_STATE_DEFAULT;
+
     lv_state_t state_ori = obj->state;
     obj->state = LV_STATE_DEFAULT;
     obj->skip_trans = 1;
@@ -637,6 +664,20 @@ static void draw_main(lv_event_t * e)
     int32_t pleft = lv_obj_get_style_pad_left(obj, LV_PART_MAIN);
     int32_t pright = lv_obj_get_style_pad_right(obj, LV_PART_MAIN);
 
+    /*Changing the items' text style doesn't necessarily send LV_EVENT_STYLE_CHANGED so check it here*/
+    if(btnm->text_font != draw_label_dsc_def.font ||
+       btnm->text_letter_space != draw_label_dsc_def.letter_space ||
+       btnm->text_line_space != draw_label_dsc_def.line_space) {
+        invalidate_text_sizes(btnm);
+        btnm->text_font = draw_label_dsc_def.font;
+        btnm->text_letter_space = draw_label_dsc_def.letter_space;
+        btnm->text_line_space = draw_label_dsc_def.line_space;
+    }
+
+    /*Buttons in the default state can be skipped early if they are out of the clip area*/
+    int32_t ext_def = LV_MAX(get_rect_ext_size(&draw_rect_dsc_def), get_gap_ext_size(obj));
+    const lv_area_t * clip_area = &layer->_clip_area;
+
 #if LV_USE_ARABIC_PERSIAN_CHARS
     char txt_ap[256];
 #endif
@@ -669,23 +710,41 @@ static void draw_main(lv_event_t * e)
         btn_area.x2 += area_obj.x1;
         btn_area.y2 += area_obj.y1;
 
+        bool popover = (btn_state & LV_STATE_PRESSED) && (btnm->ctrl_bits[btn_i] & LV_BUTTONMATRIX_CTRL_POPOVER);
+
         /*Set up the draw descriptors*/
         if(btn_state == LV_STATE_DEFAULT) {
+            lv_area_t ext_area = btn_area;
+            lv_area_increase(&ext_area, ext_def, ext_def);
+            if(!lv_area_is_on(&ext_area, clip_area)) continue;
+
             lv_memcpy(&draw_rect_dsc_act, &draw_rect_dsc_def, sizeof(lv_draw_rect_dsc_t));
             lv_memcpy(&draw_label_dsc_act, &draw_label_dsc_def, sizeof(lv_draw_label_dsc_t));
         }
-        /*In other cases get the styles directly without caching them*/
+        /*In other cases get the styles directly and keep them for the next button with the same state*/
         else {
-            obj->state = btn_state;
-            obj->skip_trans = 1;
-            lv_draw_rect_dsc_init(&draw_rect_dsc_act);
-            draw_rect_dsc_act.base.layer = layer;
-            lv_draw_label_dsc_init(&draw_label_dsc_act);
-            draw_label_dsc_act.base.layer = layer;
-            lv_obj_init_draw_rect_dsc(obj, LV_PART_ITEMS, &draw_rect_dsc_act);
-            lv_obj_init_draw_label_dsc(obj, LV_PART_ITEMS, &draw_label_dsc_act);
-            obj->state = state_ori;
-            obj->skip_trans = 0;
+            if(btn_state != dsc_state) {
+                obj->state = btn_state;
+                obj->skip_trans = 1;
+                lv_draw_rect_dsc_init(&draw_rect_dsc_state);
+                draw_rect_dsc_state.base.layer = layer;
+                lv_draw_label_dsc_init(&draw_label_dsc_state);
+                draw_label_dsc_state.base.layer = layer;
+                lv_obj_init_draw_rect_dsc(obj, LV_PART_ITEMS, &draw_rect_dsc_state);
+                lv_obj_init_draw_label_dsc(obj, LV_PART_ITEMS, &draw_label_dsc_state);
+                obj->state = state_ori;
+                obj->skip_trans = 0;
+                dsc_state = btn_state;
+            }
+
+            lv_area_t ext_area = btn_area;
+            int32_t ext = LV_MAX(get_rect_ext_size(&draw_rect_dsc_state), get_gap_ext_size(obj));
+            lv_area_increase(&ext_area, ext, ext);
+            if(popover) ext_area.y1 -= lv_area_get_height(&btn_area);
+            if(!lv_area_is_on(&ext_area, clip_area)) continue;
+
+            lv_memcpy(&draw_rect_dsc_act, &draw_rect_dsc_state, sizeof(lv_draw_rect_dsc_t));
+            lv_memcpy(&draw_label_dsc_act, &draw_label_dsc_state, sizeof(lv_draw_label_dsc_t));
         }
 
         bool recolor = button_is_recolor(btnm->ctrl_bits[btn_i]);
@@ -705,7 +764,7 @@ static void draw_main(lv_event_t * e)
 
         int32_t btn_height = lv_area_get_height(&btn_area);
 
-        if((btn_state & LV_STATE_PRESSED) && (btnm->ctrl_bits[btn_i] & LV_BUTTONMATRIX_CTRL_POPOVER)) {
+        if(popover) {
             /*Push up the upper boundary of the btn area to create the popover*/
             btn_area.y1 -= btn_height;
         }
@@ -727,21 +786,32 @@ static void draw_main(lv_event_t * e)
             txt = txt_ap;
         }
 #endif
-        lv_text_attributes_t attributes = {0};
-        attributes.letter_space = letter_space;
-        attributes.line_space = line_space;
-        attributes.text_flags = draw_label_dsc_act.flag;
-        attributes.max_width = lv_area_get_width(&area_obj);
+        /*The cached size is valid only if the state doesn't change the text's font or spacing*/
+        bool use_cache = font == draw_label_dsc_def.font &&
+                         letter_space == draw_label_dsc_def.letter_space &&
+                         line_space == draw_label_dsc_def.line_space;
 
         lv_point_t txt_size;
-        lv_text_get_size_attributes(&txt_size, txt, font, &attributes);
+        if(use_cache && btnm->text_sizes[btn_i].x >= 0) {
+            txt_size = btnm->text_sizes[btn_i];
+        }
+        else {
+            lv_text_attributes_t attributes = {0};
+            attributes.letter_space = letter_space;
+            attributes.line_space = line_space;
+            attributes.text_flags = draw_label_dsc_act.flag;
+            attributes.max_width = lv_area_get_width(&area_obj);
+
+            lv_text_get_size_attributes(&txt_size, txt, font, &attributes);
+            if(use_cache) btnm->text_sizes[btn_i] = txt_size;
+        }
 
         btn_area.x1 += (lv_area_get_width(&btn_area) - txt_size.x) / 2;
         btn_area.y1 += (lv_area_get_height(&btn_area) - txt_size.y) / 2;
         btn_area.x2 = btn_area.x1 + txt_size.x;
         btn_area.y2 = btn_area.y1 + txt_size.y;
 
-        if((btn_state & LV_STATE_PRESSED) && (btnm->ctrl_bits[btn_i] & LV_BUTTONMATRIX_CTRL_POPOVER)) {
+        if(popover) {
             /*Push up the button text into the popover*/
             btn_area.y1 -= btn_height / 2;
             btn_area.y2 -= btn_height / 2;
@@ -756,6 +826,7 @@ static void draw_main(lv_event_t * e)
 
     obj->skip_trans = 0;
 }
+
 /**
  * Create the required number of buttons and control bytes according to a map
  * @param obj pointer to button matrix object
@@ -785,6 +856,10 @@ static void allocate_button_areas_and_controls(const lv_obj_t * obj, const char
         lv_free(btnm->button_areas);
         btnm->button_areas = NULL;
     }
+    if(btnm->text_sizes != NULL) {
+        lv_free(btnm->text_sizes);
+        btnm->text_sizes = NULL;
+    }
     if(btnm->ctrl_bits != NULL) {
         lv_free(btnm->ctrl_bits);
         btnm->ctrl_bits = NULL;
@@ -792,9 +867,11 @@ static void allocate_button_areas_and_controls(const lv_obj_t * obj, const char
 
     btnm->button_areas = lv_malloc(sizeof(lv_area_t) * btn_cnt);
     LV_ASSERT_MALLOC(btnm->button_areas);
+    btnm->text_sizes = lv_malloc(sizeof(lv_point_t) * btn_cnt);
+    LV_ASSERT_MALLOC(btnm->text_sizes);
     btnm->ctrl_bits = lv_malloc(sizeof(lv_buttonmatrix_ctrl_t) * btn_cnt);
     LV_ASSERT_MALLOC(btnm->ctrl_bits);
-    if(btnm->button_areas == NULL || btnm->ctrl_bits == NULL) btn_cnt = 0;
+    if(btnm->button_areas == NULL || btnm->text_sizes == NULL || btnm->ctrl_bits == NULL) btn_cnt = 0;
 
     lv_memzero(btnm->ctrl_bits, sizeof(lv_buttonmatrix_ctrl_t) * btn_cnt);
 
@@ -926,19 +1003,13 @@ static void invalidate_button_area(const lv_obj_t * obj, uint32_t btn_idx)
 
     /*The buttons might have outline and shadow so make the invalidation larger with the gaps between the buttons.
      *It assumes that the outline or shadow is smaller than the gaps*/
-    int32_t row_gap = lv_obj_get_style_pad_row(obj, LV_PART_MAIN);
-    int32_t col_gap = lv_obj_get_style_pad_column(obj, LV_PART_MAIN);
-
-    /*Be sure to have a minimal extra space if row/col_gap is small*/
-    int32_t dpi = lv_display_get_dpi(lv_obj_get_display(obj));
-    row_gap = LV_MAX(row_gap, dpi / 10);
-    col_gap = LV_MAX(col_gap, dpi / 10);
+    int32_t gap = get_gap_ext_size(obj);
 
     /*Convert relative coordinates to absolute*/
-    btn_area.x1 += obj_area.x1 - row_gap;
-    btn_area.y1 += obj_area.y1 - col_gap;
-    btn_area.x2 += obj_area.x1 + row_gap;
-    btn_area.y2 += obj_area.y1 + col_gap;
+    btn_area.x1 += obj_area.x1 - gap;
+    btn_area.y1 += obj_area.y1 - gap;
+    btn_area.x2 += obj_area.x1 + gap;
+    btn_area.y2 += obj_area.y1 + gap;
 
     if((btn_idx == btnm->btn_id_sel) && (btnm->ctrl_bits[btn_idx] & LV_BUTTONMATRIX_CTRL_POPOVER)) {
         /*Push up the upper boundary of the btn area to also invalidate the popover*/
@@ -1076,10 +1147,58 @@ static void update_map(lv_obj_t * obj)
      *the row height which may have changed when setting the new map*/
     lv_obj_refresh_ext_draw_size(obj);
 
+    /*The font, the texts or the available width might have changed*/
+    invalidate_text_sizes(btnm);
+
     lv_obj_invalidate(obj);
 
 }
 
+static void invalidate_text_sizes(lv_buttonmatrix_t * btnm)
+{
+    uint32_t i;
+    for(i = 0; i < btnm->btn_cnt; i++) {
+        btnm->text_sizes[i].x = -1;
+    }
+}
+
+/**
+ * Get how much a rectangle drawn with a descriptor can be larger than its area
+ * due to its outline and shadow.
+ * @param dsc   pointer to an initialized rectangle draw descriptor
+ * @return      the extra size on each side
+ */
+static int32_t get_rect_ext_size(const lv_draw_rect_dsc_t * dsc)
+{
+    int32_t ext = 0;
+    if(dsc->outline_width && dsc->outline_opa > LV_OPA_MIN) {
+        ext = dsc->outline_width + dsc->outline_pad;
+    }
+
+    if(dsc->shadow_width && dsc->shadow_opa > LV_OPA_MIN) {
+        int32_t sh = dsc->shadow_width / 2 + 1 + dsc->shadow_spread;
+        sh += LV_MAX(LV_ABS(dsc->shadow_offset_x), LV_ABS(dsc->shadow_offset_y));
+        ext = LV_MAX(ext, sh);
+    }
+
+    return ext;
+}
+
+/**
+ * Get the extra space around the buttons which is redrawn when a button is invalidated.
+ * @param obj   pointer to a button matrix object
+ * @return      the larger of the row and column gap, but at least 1/10 inch
+ */
+static int32_t get_gap_ext_size(const lv_obj_t * obj)
+{
+    int32_t row_gap = lv_obj_get_style_pad_row(obj, LV_PART_MAIN);
+    int32_t col_gap = lv_obj_get_style_pad_column(obj, LV_PART_MAIN);
+
+    /*Be sure to have a minimal extra space if row/col_gap is small*/
+    int32_t dpi = lv_display_get_dpi(lv_obj_get_display(obj));
+    return LV_MAX3(row_gap, col_gap, dpi / 10);
+}
+
 static void free_map(lv_buttonmatrix_t * btnm)
 {
     uint32_t i;
@@ -32,6 +32,10 @@ struct _lv_buttonmatrix_t {
     lv_obj_t obj;
     const char * const * map_p;          /**< Pointer to the current map */
     lv_area_t * button_areas;            /**< Array of areas of buttons */
+    lv_point_t * text_sizes;             /**< Cached size of the buttons' texts with the default font. x < 0: not measured yet*/
+    const lv_font_t * text_font;         /**< The default state's font `text_sizes` were measured with */
+    int32_t text_letter_space;           /**< The default state's letter space `text_sizes` were measured with */
+    int32_t text_line_space;             /**< The default state's line space `text_sizes` were measured with */
     lv_buttonmatrix_ctrl_t * ctrl_bits;  /**< Array of control bytes */
     uint32_t btn_cnt;                    /**< Number of button in 'map_p'(Handled by the library) */
     uint32_t row_cnt;                    /**< Number of rows in 'map_p'(Handled by the library) */
@@ -45,6 +49,15 @@ struct _lv_buttonmatrix_t {
  * GLOBAL PROTOTYPES
  **********************/
 
+/**
+ * Notify the button matrix that the text of a button was modified in place,
+ * i.e. the map's string was rewritten without calling `lv_buttonmatrix_set_map`.
+ * Drops the cached size of the text and invalidates only the given button.
+ * @param obj       pointer to a button matrix object
+ * @param btn_id    index of the button whose text has changed
+ */
+void lv_buttonmatrix_refresh_button_text(lv_obj_t * obj, uint32_t btn_id);
+
 /**********************
  *      MACROS
  **********************/
@@ -7,6 +7,7 @@
  *      INCLUDES
  *********************/
 #include "lv_calendar_private.h"
+#include "../buttonmatrix/lv_buttonmatrix_private.h"
 #include "../../draw/lv_draw_private.h"
 #include "../../core/lv_obj_class_private.h"
 #include "../../../lvgl.h"
@@ -20,6 +21,12 @@
 #define LV_CALENDAR_CTRL_TODAY      LV_BUTTONMATRIX_CTRL_CUSTOM_1
 #define LV_CALENDAR_CTRL_HIGHLIGHT  LV_BUTTONMATRIX_CTRL_CUSTOM_2
 
+/*The controls of the day cells which are updated on date changes*/
+#define LV_CALENDAR_CTRL_CELL_MASK  (LV_BUTTONMATRIX_CTRL_DISABLED | LV_CALENDAR_CTRL_TODAY | LV_CALENDAR_CTRL_HIGHLIGHT)
+
+/*The first 7 buttons are the day names*/
+#define CELL_TO_BUTTON(cell)        ((cell) + 7)
+
 #define MY_CLASS (&lv_calendar_class)
 
 /**********************
@@ -32,16 +39,10 @@
 static void lv_calendar_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void draw_task_added_event_cb(lv_event_t * e);
 
-static uint8_t get_day_of_week(uint32_t year, uint32_t month, uint32_t day);
-static uint8_t get_month_length(int32_t year, int32_t month);
-static uint8_t is_leap_year(uint32_t year);
 static void highlight_update(lv_obj_t * calendar);
 
 #if LV_USE_CALENDAR_CHINESE
-static lv_calendar_date_t gregorian_get_last_month_time(lv_calendar_date_t * time);
-static lv_calendar_date_t gregorian_get_next_month_time(lv_calendar_date_t * time);
-static void chinese_calendar_set_day_name(lv_obj_t * calendar, uint8_t index, uint8_t day,
-                                          lv_calendar_date_t * gregorian_time);
+static void chinese_calendar_format_day(char * buf, size_t buf_size, lv_calendar_date_t * gregorian_time);
 #endif
 
 /**********************
@@ -88,8 +89,8 @@ void lv_calendar_set_day_names(lv_obj_t * obj, const char * day_names[])
     uint32_t i;
     for(i = 0; i < 7; i++) {
         calendar->map[i] = day_names[i];
+        lv_buttonmatrix_refresh_button_text(calendar->btnm, i);
     }
-    lv_obj_invalidate(obj);
 }
 
 void lv_calendar_set_today_date(lv_obj_t * obj, uint32_t year, uint32_t month, uint32_t day)
@@ -154,82 +155,34 @@ void lv_calendar_set_month_shown(lv_obj_t * obj, uint32_t year, uint32_t month)
     calendar->showed_date.month  = month;
     calendar->showed_date.day    = 1;
 
-    lv_calendar_date_t d;
-    d.year = calendar->showed_date.year;
-    d.month = calendar->showed_date.month;
-    d.day = calendar->showed_date.day;
+    lv_calendar_grid_init(&calendar->grid, year, month);
 
+    /*Rewrite only the texts which are different in the new month,
+     *so the unchanged cells keep their cached text size and needn't be redrawn*/
+    char txt[sizeof(calendar->nums[0])];
+    lv_calendar_date_t d;
     uint32_t i;
-
-    /*Remove the disabled state but revert it for day names*/
-    lv_buttonmatrix_clear_button_ctrl_all(calendar->btnm, LV_BUTTONMATRIX_CTRL_DISABLED);
-    for(i = 0; i < 7; i++) {
-        lv_buttonmatrix_set_button_ctrl(calendar->btnm, i, LV_BUTTONMATRIX_CTRL_DISABLED);
-    }
-
-    uint8_t act_mo_len = get_month_length(d.year, d.month);
-    uint8_t day_first = get_day_of_week(d.year, d.month, 1);
-    uint8_t c;
-
-#if LV_USE_CALENDAR_CHINESE
-    lv_calendar_date_t gregorian_time;
-    gregorian_time = d;
-#endif
-
-    for(i = day_first, c = 1; i < act_mo_len + day_first; i++, c++) {
-#if LV_USE_CALENDAR_CHINESE
-        if(calendar->use_chinese_calendar) {
-            gregorian_time.day = c;
-            chinese_calendar_set_day_name(obj, i, c, &gregorian_time);
-        }
-        else
-#endif
-            lv_snprintf(calendar->nums[i], sizeof(calendar->nums[0]), "%d", c);
-    }
-
-    uint8_t prev_mo_len = get_month_length(d.year, d.month - 1);
-
-#if LV_USE_CALENDAR_CHINESE
-    gregorian_time = gregorian_get_last_month_time(&d);
-#endif
-
-    for(i = 0, c = prev_mo_len - day_first + 1; i < day_first; i++, c++) {
+    for(i = 0; i < LV_CALENDAR_GRID_CELL_CNT; i++) {
+        lv_calendar_grid_get_date(&calendar->grid, i, &d);
 #if LV_USE_CALENDAR_CHINESE
-        if(calendar->use_chinese_calendar) {
-            gregorian_time.day = c;
-            chinese_calendar_set_day_name(obj, i, c, &gregorian_time);
-        }
+        if(calendar->use_chinese_calendar) chinese_calendar_format_day(txt, sizeof(txt), &d);
         else
 #endif
-            lv_snprintf(calendar->nums[i], sizeof(calendar->nums[0]), "%d", c);
-        lv_buttonmatrix_set_button_ctrl(calendar->btnm, i + 7, LV_BUTTONMATRIX_CTRL_DISABLED);
-    }
-
-#if LV_USE_CALENDAR_CHINESE
-    gregorian_time = gregorian_get_next_month_time(&d);
-#endif
+            lv_snprintf(txt, sizeof(txt), "%d", d.day);
 
-    for(i = day_first + act_mo_len, c = 1; i < 6 * 7; i++, c++) {
-#if LV_USE_CALENDAR_CHINESE
-        if(calendar->use_chinese_calendar) {
-            gregorian_time.day = c;
-            chinese_calendar_set_day_name(obj, i, c, &gregorian_time);
+        if(lv_strcmp(txt, calendar->nums[i]) != 0) {
+            lv_strcpy(calendar->nums[i], txt);
+            lv_buttonmatrix_refresh_button_text(calendar->btnm, CELL_TO_BUTTON(i));
         }
-        else
-#endif
-            lv_snprintf(calendar->nums[i], sizeof(calendar->nums[0]), "%d", c);
-        lv_buttonmatrix_set_button_ctrl(calendar->btnm, i + 7, LV_BUTTONMATRIX_CTRL_DISABLED);
     }
 
     highlight_update(obj);
 
     /*Reset the focused button if the days changes*/
     if(lv_buttonmatrix_get_selected_button(calendar->btnm) != LV_BUTTONMATRIX_BUTTON_NONE) {
-        lv_buttonmatrix_set_selected_button(calendar->btnm, day_first + 7);
+        lv_buttonmatrix_set_selected_button(calendar->btnm, CELL_TO_BUTTON(calendar->grid.first_cell));
     }
 
-    lv_obj_invalidate(obj);
-
     /* The children of the calendar are probably headers.
      * Notify them to let the headers updated to the new date*/
     uint32_t child_cnt = lv_obj_get_child_count(obj);
@@ -311,13 +264,15 @@ lv_result_t lv_calendar_get_pressed_date(const lv_obj_t * obj, lv_calendar_date_
         return LV_RESULT_INVALID;
     }
 
-    const char * txt = lv_buttonmatrix_get_button_text(calendar->btnm, lv_buttonmatrix_get_selected_button(calendar->btnm));
-
-    if(txt[1] == 0) date->day = txt[0] - '0';
-    else date->day = (txt[0] - '0') * 10 + (txt[1] - '0');
+    if(d < CELL_TO_BUTTON(0)) {
+        /*A day name is selected*/
+        date->year = 0;
+        date->month = 0;
+        date->day = 0;
+        return LV_RESULT_INVALID;
+    }
 
-    date->year = calendar->showed_date.year;
-    date->month = calendar->showed_date.month;
+    lv_calendar_grid_get_date(&calendar->grid, d - CELL_TO_BUTTON(0), date);
 
     return LV_RESULT_OK;
 }
@@ -356,6 +311,9 @@ static void lv_calendar_constructor(const lv_obj_class_t * class_p, lv_obj_t * o
     lv_obj_add_event_cb(calendar->btnm, draw_task_added_event_cb, LV_EVENT_DRAW_TASK_ADDED, NULL);
     lv_obj_set_width(calendar->btnm, lv_pct(100));
     lv_obj_add_flag(calendar->btnm, LV_OBJ_FLAG_EVENT_BUBBLE | LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS);
+    for(i = 0; i < 7; i++) {
+        lv_buttonmatrix_set_button_ctrl(calendar->btnm, i, LV_BUTTONMATRIX_CTRL_DISABLED);
+    }
 
     lv_obj_set_flex_flow(obj, LV_FLEX_FLOW_COLUMN);
     lv_obj_set_flex_grow(calendar->btnm, 1);
@@ -408,125 +366,53 @@ static void draw_task_added_event_cb(lv_event_t * e)
 }
 
 /**
- * Get the number of days in a month
- * @param year a year
- * @param month a month. The range is basically [1..12] but [-11..0] or [13..24] is also
- *              supported to handle next/prev. year
- * @return [28..31]
- */
-static uint8_t get_month_length(int32_t year, int32_t month)
-{
-    month--;
-    if(month < 0) {
-        year--;             /*Already in the previous year (won't be less than -12 to skip a whole year)*/
-        month = 12 + month; /*`month` is negative, the result will be < 12*/
-    }
-    if(month >= 12) {
-        year++;
-        month -= 12;
-    }
-
-    /*month == 1 is february*/
-    return (month == 1) ? (28 + is_leap_year(year)) : 31 - month % 7 % 2;
-}
-
-/**
- * Tells whether a year is leap year or not
- * @param year a year
- * @return 0: not leap year; 1: leap year
- */
-static uint8_t is_leap_year(uint32_t year)
-{
-    return (year % 4) || ((year % 100 == 0) && (year % 400)) ? 0 : 1;
-}
-
-/**
- * Get the day of the week
- * @param year a year
- * @param month a  month [1..12]
- * @param day a day [1..32]
- * @return [0..6] which means [Sun..Sat] or [Mon..Sun] depending on LV_CALENDAR_WEEK_STARTS_MONDAY
+ * Update the disabled, today and highlighted state of the day cells.
+ * Only the cells whose state has changed are modified and invalidated.
+ * @param obj   pointer to a calendar
  */
-static uint8_t get_day_of_week(uint32_t year, uint32_t month, uint32_t day)
-{
-    uint32_t a = month < 3 ? 1 : 0;
-    uint32_t b = year - a;
-
-#if LV_CALENDAR_WEEK_STARTS_MONDAY
-    uint32_t day_of_week = (day + (31 * (month - 2 + 12 * a) / 12) + b + (b / 4) - (b / 100) + (b / 400) - 1) % 7;
-#else
-    uint32_t day_of_week = (day + (31 * (month - 2 + 12 * a) / 12) + b + (b / 4) - (b / 100) + (b / 400)) % 7;
-#endif
-
-    return day_of_week  ;
-}
-
 static void highlight_update(lv_obj_t * obj)
 {
     lv_calendar_t * calendar = (lv_calendar_t *)obj;
+    lv_buttonmatrix_t * btnm = (lv_buttonmatrix_t *)calendar->btnm;
+    lv_buttonmatrix_ctrl_t ctrls[LV_CALENDAR_GRID_CELL_CNT];
     uint32_t i;
+    int32_t cell;
 
-    /*Clear all kind of selection*/
-    lv_buttonmatrix_clear_button_ctrl_all(calendar->btnm, LV_CALENDAR_CTRL_TODAY | LV_CALENDAR_CTRL_HIGHLIGHT);
+    for(i = 0; i < LV_CALENDAR_GRID_CELL_CNT; i++) {
+        ctrls[i] = lv_calendar_grid_is_in_month(&calendar->grid, i) ? 0 : LV_BUTTONMATRIX_CTRL_DISABLED;
+    }
 
-    uint8_t day_first = get_day_of_week(calendar->showed_date.year, calendar->showed_date.month, 1);
     if(calendar->highlighted_dates) {
         for(i = 0; i < calendar->highlighted_dates_num; i++) {
-            if(calendar->highlighted_dates[i].year == calendar->showed_date.year &&
-               calendar->highlighted_dates[i].month == calendar->showed_date.month) {
-                lv_buttonmatrix_set_button_ctrl(calendar->btnm, calendar->highlighted_dates[i].day - 1 + day_first + 7,
-                                                LV_CALENDAR_CTRL_HIGHLIGHT);
-            }
+            cell = lv_calendar_grid_find_date(&calendar->grid, &calendar->highlighted_dates[i]);
+            if(cell >= 0) ctrls[cell] |= LV_CALENDAR_CTRL_HIGHLIGHT;
         }
     }
 
-    if(calendar->showed_date.year == calendar->today.year && calendar->showed_date.month == calendar->today.month) {
-        lv_buttonmatrix_set_button_ctrl(calendar->btnm, calendar->today.day - 1 + day_first + 7, LV_CALENDAR_CTRL_TODAY);
-    }
-}
+    cell = lv_calendar_grid_find_date(&calendar->grid, &calendar->today);
+    if(cell >= 0) ctrls[cell] |= LV_CALENDAR_CTRL_TODAY;
 
-#if LV_USE_CALENDAR_CHINESE
+    for(i = 0; i < LV_CALENDAR_GRID_CELL_CNT; i++) {
+        uint32_t btn_id = CELL_TO_BUTTON(i);
+        lv_buttonmatrix_ctrl_t old_ctrl = btnm->ctrl_bits[btn_id] & LV_CALENDAR_CTRL_CELL_MASK;
+        if(old_ctrl == ctrls[i]) continue;
 
-static lv_calendar_date_t gregorian_get_last_month_time(lv_calendar_date_t * time)
-{
-    lv_calendar_date_t last_month_time;
-    if(time->month == 1) {
-        last_month_time.month = 12;
-        last_month_time.year = time->year - 1;
-    }
-    else {
-        last_month_time.month = time->month - 1;
-        last_month_time.year = time->year;
+        lv_buttonmatrix_ctrl_t removed = old_ctrl & ~ctrls[i];
+        lv_buttonmatrix_ctrl_t added = ctrls[i] & ~old_ctrl;
+        if(removed) lv_buttonmatrix_clear_button_ctrl(calendar->btnm, btn_id, removed);
+        if(added) lv_buttonmatrix_set_button_ctrl(calendar->btnm, btn_id, added);
     }
-    return last_month_time;
 }
 
-static lv_calendar_date_t gregorian_get_next_month_time(lv_calendar_date_t * time)
-{
-    lv_calendar_date_t next_month_time;
-    if(time->month == 12) {
-        next_month_time.month = 1;
-        next_month_time.year = time->year + 1;
-    }
-    else {
-        next_month_time.month = time->month + 1;
-        next_month_time.year = time->year;
-    }
-    return next_month_time;
-}
+#if LV_USE_CALENDAR_CHINESE
 
-static void chinese_calendar_set_day_name(lv_obj_t * obj, uint8_t index, uint8_t day,
-                                          lv_calendar_date_t * gregorian_time)
+static void chinese_calendar_format_day(char * buf, size_t buf_size, lv_calendar_date_t * gregorian_time)
 {
-    lv_calendar_t * calendar = (lv_calendar_t *)obj;
     const char * day_name = lv_calendar_get_day_name(gregorian_time);
     if(day_name != NULL)
-        lv_snprintf(calendar->nums[index], sizeof(calendar->nums[0]),
-                    "%d\n%s",
-                    day,
-                    day_name);
+        lv_snprintf(buf, buf_size, "%d\n%s", gregorian_time->day, day_name);
     else
-        lv_snprintf(calendar->nums[index], sizeof(calendar->nums[0]), "%d", day);
+        lv_snprintf(buf, buf_size, "%d", gregorian_time->day);
 }
 #endif
 
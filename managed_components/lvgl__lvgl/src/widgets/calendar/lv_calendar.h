@@ -182,6 +182,7 @@ lv_result_t lv_calendar_get_pressed_date(const lv_obj_t * calendar, lv_calendar_
  *      MACROS
  **********************/
 
+#include "lv_calendar_grid.h"
 #include "lv_calendar_header_arrow.h"
 #include "lv_calendar_header_dropdown.h"
 #include "lv_calendar_chinese.h"
@@ -0,0 +1,128 @@
+/**
+ * @file lv_calendar_grid.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_calendar_grid.h"
+#if LV_USE_CALENDAR
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+bool lv_calendar_is_leap_year(uint32_t year)
+{
+    return (year % 4) || ((year % 100 == 0) && (year % 400)) ? false : true;
+}
+
+uint8_t lv_calendar_get_month_length(int32_t year, int32_t month)
+{
+    month--;
+    if(month < 0) {
+        year--;             /*Already in the previous year (won't be less than -12 to skip a whole year)*/
+        month = 12 + month; /*`month` is negative, the result will be < 12*/
+    }
+    if(month >= 12) {
+        year++;
+        month -= 12;
+    }
+
+    /*month == 1 is february*/
+    return (month == 1) ? (28 + lv_calendar_is_leap_year(year)) : 31 - month % 7 % 2;
+}
+
+uint8_t lv_calendar_get_day_of_week(uint32_t year, uint32_t month, uint32_t day)
+{
+    uint32_t a = month < 3 ? 1 : 0;
+    uint32_t b = year - a;
+
+#if LV_CALENDAR_WEEK_STARTS_MONDAY
+    uint32_t day_of_week = (day + (31 * (month - 2 + 12 * a) / 12) + b + (b / 4) - (b / 100) + (b / 400) - 1) % 7;
+#else
+    uint32_t day_of_week = (day + (31 * (month - 2 + 12 * a) / 12) + b + (b / 4) - (b / 100) + (b / 400)) % 7;
+#endif
+
+    return day_of_week;
+}
+
+void lv_calendar_grid_init(lv_calendar_grid_t * grid, uint32_t year, uint32_t month)
+{
+    grid->year = year;
+    grid->month = month;
+    grid->first_cell = lv_calendar_get_day_of_week(year, month, 1);
+    grid->month_len = lv_calendar_get_month_length(year, month);
+    grid->prev_month_len = lv_calendar_get_month_length(year, month - 1);
+}
+
+void lv_calendar_grid_get_date(const lv_calendar_grid_t * grid, uint32_t cell, lv_calendar_date_t * date)
+{
+    if(cell < grid->first_cell) {
+        date->day = grid->prev_month_len - grid->first_cell + cell + 1;
+        if(grid->month == 1) {
+            date->month = 12;
+            date->year = grid->year - 1;
+        }
+        else {
+            date->month = grid->month - 1;
+            date->year = grid->year;
+        }
+    }
+    else if(cell < (uint32_t)grid->first_cell + grid->month_len) {
+        date->day = cell - grid->first_cell + 1;
+        date->month = grid->month;
+        date->year = grid->year;
+    }
+    else {
+        date->day = cell - grid->first_cell - grid->month_len + 1;
+        if(grid->month == 12) {
+            date->month = 1;
+            date->year = grid->year + 1;
+        }
+        else {
+            date->month = grid->month + 1;
+            date->year = grid->year;
+        }
+    }
+}
+
+bool lv_calendar_grid_is_in_month(const lv_calendar_grid_t * grid, uint32_t cell)
+{
+    return cell >= grid->first_cell && cell < (uint32_t)grid->first_cell + grid->month_len;
+}
+
+int32_t lv_calendar_grid_find_date(const lv_calendar_grid_t * grid, const lv_calendar_date_t * date)
+{
+    if(date->year != grid->year || date->month != grid->month) return -1;
+    if(date->day < 1 || date->day > grid->month_len) return -1;
+
+    return grid->first_cell + date->day - 1;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#endif /*LV_USE_CALENDAR*/
@@ -0,0 +1,114 @@
+/**
+ * @file lv_calendar_grid.h
+ *
+ */
+
+#ifndef LV_CALENDAR_GRID_H
+#define LV_CALENDAR_GRID_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_calendar.h"
+#if LV_USE_CALENDAR
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/** A month is shown on 6 weeks of 7 days */
+#define LV_CALENDAR_GRID_CELL_CNT   (7 * 6)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Layout of a month on the calendar's 7x6 grid of days.
+ * The grid starts with the last days of the previous month,
+ * continues with the days of the month and is filled with the first days of the next month.
+ */
+typedef struct {
+    uint16_t year;
+    uint8_t month;           /**< 1..12 */
+    uint8_t first_cell;      /**< Index of the 1st day of the month in the grid [0..6] */
+    uint8_t month_len;       /**< Number of days in the month [28..31] */
+    uint8_t prev_month_len;  /**< Number of days in the previous month [28..31] */
+} lv_calendar_grid_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Tell whether a year is a leap year
+ * @param year      a year
+ * @return          true: leap year; false: not leap year
+ */
+bool lv_calendar_is_leap_year(uint32_t year);
+
+/**
+ * Get the number of days in a month
+ * @param year      a year
+ * @param month     a month. The range is basically [1..12] but [-11..0] or [13..24] is also
+ *                  supported to handle the previous or next year
+ * @return          [28..31]
+ */
+uint8_t lv_calendar_get_month_length(int32_t year, int32_t month);
+
+/**
+ * Get the day of the week
+ * @param year      a year
+ * @param month     a month [1..12]
+ * @param day       a day [1..31]
+ * @return          [0..6] which means [Sun..Sat] or [Mon..Sun] depending on `LV_CALENDAR_WEEK_STARTS_MONDAY`
+ */
+uint8_t lv_calendar_get_day_of_week(uint32_t year, uint32_t month, uint32_t day);
+
+/**
+ * Compute the layout of a month
+ * @param grid      pointer to a grid to initialize
+ * @param year      a year
+ * @param month     a month [1..12]
+ */
+void lv_calendar_grid_init(lv_calendar_grid_t * grid, uint32_t year, uint32_t month);
+
+/**
+ * Get the date shown in a cell of the grid
+ * @param grid      pointer to an initialized grid
+ * @param cell      index of the cell [0..LV_CALENDAR_GRID_CELL_CNT - 1]
+ * @param date      store the date here. It can be in the previous or next month too.
+ */
+void lv_calendar_grid_get_date(const lv_calendar_grid_t * grid, uint32_t cell, lv_calendar_date_t * date);
+
+/**
+ * Tell whether a cell shows a day of the grid's month
+ * @param grid      pointer to an initialized grid
+ * @param cell      index of the cell [0..LV_CALENDAR_GRID_CELL_CNT - 1]
+ * @return          true: the cell is in the month; false: the cell is in the previous or next month
+ */
+bool lv_calendar_grid_is_in_month(const lv_calendar_grid_t * grid, uint32_t cell);
+
+/**
+ * Find the cell of a day of the grid's month
+ * @param grid      pointer to an initialized grid
+ * @param date      a date
+ * @return          index of the cell or -1 if `date` is not in the grid's month
+ */
+int32_t lv_calendar_grid_find_date(const lv_calendar_grid_t * grid, const lv_calendar_date_t * date);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_CALENDAR*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_CALENDAR_GRID_H*/
@@ -36,6 +36,7 @@ struct _lv_calendar_t {
     lv_calendar_date_t showed_date;          /**< Currently visible month (day is ignored) */
     lv_calendar_date_t * highlighted_dates;  /**< Apply different style on these days (pointer to user-defined array) */
     size_t highlighted_dates_num;            /**< Number of elements in `highlighted_days` */
+    lv_calendar_grid_t grid;                 /**< Layout of the shown month */
     const char * map[8 * 7];
 #ifdef LV_USE_CALENDAR_CHINESE
     bool use_chinese_calendar;
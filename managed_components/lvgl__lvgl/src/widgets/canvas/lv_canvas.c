@@ -15,6 +15,7 @@
 #if LV_USE_CANVAS != 0
 #include "../../misc/lv_assert.h"
 #include "../../misc/lv_math.h"
+#include "../../misc/lv_area_private.h"
 #include "../../draw/lv_draw_private.h"
 #include "../../core/lv_refr.h"
 #include "../../display/lv_display.h"
@@ -35,6 +36,8 @@
  **********************/
 static void lv_canvas_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void lv_canvas_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
+static void add_dirty_area(lv_canvas_t * canvas, const lv_area_t * area);
+static void invalidate_buf_area(lv_obj_t * obj, const lv_area_t * area);
 
 /**********************
  *  STATIC VARIABLES
@@ -132,10 +135,14 @@ void lv_canvas_set_px(lv_obj_t * obj, int32_t x, int32_t y, lv_color_t color, lv
             case LV_COLOR_FORMAT_I4:
                 shift = 4 - 4 * (x & 0x1);
                 break;
-            case LV_COLOR_FORMAT_I8:
-                /*Indexed8 format is a easy case, process and return.*/
-                shift = 0;
-                *data = c_int;
+            case LV_COLOR_FORMAT_I8: {
+                    /*Indexed8 format is a easy case, process and return.*/
+                    *data = c_int;
+                    lv_area_t px_area;
+                    lv_area_set(&px_area, x, y, x, y);
+                    lv_canvas_mark_dirty(obj, &px_area);
+                    return;
+                }
             default:
                 return;
         }
@@ -180,7 +187,10 @@ void lv_canvas_set_px(lv_obj_t * obj, int32_t x, int32_t y, lv_color_t color, lv
         buf->lumi = lv_color_luminance(color);
         buf->alpha = 255;
     }
-    lv_obj_invalidate(obj);
+
+    lv_area_t px_area;
+    lv_area_set(&px_area, x, y, x, y);
+    lv_canvas_mark_dirty(obj, &px_area);
 }
 
 void lv_canvas_set_palette(lv_obj_t * obj, uint8_t index, lv_color32_t color)
@@ -307,6 +317,8 @@ void lv_canvas_fill_bg(lv_obj_t * obj, lv_color_t color, lv_opa_t opa)
     uint32_t x;
     uint32_t y;
 
+    lv_canvas_begin_write(obj);
+
     uint32_t stride = header->stride;
     uint8_t * data = draw_buf->data;
     if(header->cf == LV_COLOR_FORMAT_RGB565) {
@@ -370,8 +382,10 @@ void lv_canvas_fill_bg(lv_obj_t * obj, lv_color_t color, lv_opa_t opa)
         }
     }
 
-    lv_draw_buf_flush_cache(canvas->draw_buf, NULL);
-    lv_obj_invalidate(obj);
+    lv_area_t buf_area;
+    lv_area_set(&buf_area, 0, 0, header->w - 1, header->h - 1);
+    lv_canvas_mark_dirty(obj, &buf_area);
+    lv_canvas_end_write(obj);
 }
 
 void lv_canvas_init_layer(lv_obj_t * obj, lv_layer_t * layer)
@@ -396,6 +410,18 @@ void lv_canvas_finish_layer(lv_obj_t * canvas, lv_layer_t * layer)
 {
     if(layer->draw_task_head == NULL) return;
 
+    /*Collect the affected area before the tasks are dispatched and freed*/
+    lv_area_t dirty_area;
+    bool dirty_valid = false;
+    lv_draw_task_t * t;
+    for(t = layer->draw_task_head; t; t = t->next) {
+        lv_area_t task_area;
+        if(!lv_area_intersect(&task_area, &t->_real_area, &t->clip_area)) continue;
+        if(dirty_valid) lv_area_join(&dirty_area, &dirty_area, &task_area);
+        else dirty_area = task_area;
+        dirty_valid = true;
+    }
+
     bool task_dispatched;
 
     while(layer->draw_task_head) {
@@ -407,7 +433,83 @@ void lv_canvas_finish_layer(lv_obj_t * canvas, lv_layer_t * layer)
             lv_draw_dispatch_request();
         }
     }
-    lv_obj_invalidate(canvas);
+
+    if(dirty_valid) lv_canvas_mark_dirty(canvas, &dirty_area);
+}
+
+void lv_canvas_begin_write(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_canvas_t * canvas = (lv_canvas_t *)obj;
+    if(canvas->write_session == 0) canvas->dirty_cnt = 0;
+    canvas->write_session++;
+}
+
+void lv_canvas_end_write(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_canvas_t * canvas = (lv_canvas_t *)obj;
+    if(canvas->write_session == 0) {
+        LV_LOG_WARN("no write session was started");
+        return;
+    }
+
+    canvas->write_session--;
+    if(canvas->write_session) return;
+
+    uint32_t i;
+    for(i = 0; i < canvas->dirty_cnt; i++) {
+        if(canvas->draw_buf) lv_draw_buf_flush_cache(canvas->draw_buf, &canvas->dirty_areas[i]);
+        invalidate_buf_area(obj, &canvas->dirty_areas[i]);
+    }
+    canvas->dirty_cnt = 0;
+}
+
+void lv_canvas_mark_dirty(lv_obj_t * obj, const lv_area_t * area)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    LV_ASSERT_NULL(area);
+
+    lv_canvas_t * canvas = (lv_canvas_t *)obj;
+    if(canvas->draw_buf == NULL) return;
+
+    lv_area_t buf_area;
+    lv_area_set(&buf_area, 0, 0, canvas->draw_buf->header.w - 1, canvas->draw_buf->header.h - 1);
+    lv_area_t clipped;
+    if(!lv_area_intersect(&clipped, area, &buf_area)) return;
+
+    if(canvas->write_session) add_dirty_area(canvas, &clipped);
+    else invalidate_buf_area(obj, &clipped);
+}
+
+void * lv_canvas_get_write_area(lv_obj_t * obj, const lv_area_t * area, uint32_t * stride)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    LV_ASSERT_NULL(area);
+    LV_ASSERT_NULL(stride);
+
+    lv_canvas_t * canvas = (lv_canvas_t *)obj;
+    if(canvas->write_session == 0) {
+        LV_LOG_WARN("direct buffer access is allowed only in a write session");
+        return NULL;
+    }
+
+    lv_draw_buf_t * draw_buf = canvas->draw_buf;
+    if(draw_buf == NULL) return NULL;
+
+    lv_area_t buf_area;
+    lv_area_set(&buf_area, 0, 0, draw_buf->header.w - 1, draw_buf->header.h - 1);
+    lv_area_t clipped;
+    if(!lv_area_intersect(&clipped, area, &buf_area)) return NULL;
+
+    /*The GPU might have written the buffer so drop the stale cache lines before CPU access*/
+    lv_draw_buf_invalidate_cache(draw_buf, &clipped);
+    add_dirty_area(canvas, &clipped);
+
+    *stride = draw_buf->header.stride;
+    return lv_draw_buf_goto_xy(draw_buf, clipped.x1, clipped.y1);
 }
 
 uint32_t lv_canvas_buf_size(int32_t w, int32_t h, uint8_t bpp, uint8_t stride)
@@ -436,4 +538,61 @@ static void lv_canvas_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     lv_image_cache_drop(&canvas->draw_buf);
 }
 
+static void add_dirty_area(lv_canvas_t * canvas, const lv_area_t * area)
+{
+    uint32_t i;
+    /*Merge into an area if it doesn't make the invalidated region larger than drawing the two separately*/
+    for(i = 0; i < canvas->dirty_cnt; i++) {
+        lv_area_t joined;
+        lv_area_join(&joined, &canvas->dirty_areas[i], area);
+        if(lv_area_get_size(&joined) <= lv_area_get_size(&canvas->dirty_areas[i]) + lv_area_get_size(area)) {
+            canvas->dirty_areas[i] = joined;
+            return;
+        }
+    }
+
+    if(canvas->dirty_cnt < LV_CANVAS_DIRTY_AREA_MAX) {
+        canvas->dirty_areas[canvas->dirty_cnt] = *area;
+        canvas->dirty_cnt++;
+        return;
+    }
+
+    /*No free slot: join with the area which grows the least*/
+    uint32_t best = 0;
+    uint32_t best_growth = UINT32_MAX;
+    for(i = 0; i < canvas->dirty_cnt; i++) {
+        lv_area_t joined;
+        lv_area_join(&joined, &canvas->dirty_areas[i], area);
+        uint32_t growth = lv_area_get_size(&joined) - lv_area_get_size(&canvas->dirty_areas[i]);
+        if(growth < best_growth) {
+            best_growth = growth;
+            best = i;
+        }
+    }
+    lv_area_join(&canvas->dirty_areas[best], &canvas->dirty_areas[best], area);
+}
+
+/**
+ * Invalidate an area given in canvas buffer coordinates.
+ * Falls back to invalidating the whole object if the image is transformed.
+ */
+static void invalidate_buf_area(lv_obj_t * obj, const lv_area_t * area)
+{
+    lv_image_t * img = (lv_image_t *)obj;
+    if(img->rotation != 0 || img->scale_x != LV_SCALE_NONE || img->scale_y != LV_SCALE_NONE ||
+       img->align >= _LV_IMAGE_ALIGN_AUTO_TRANSFORM || img->w == 0 || img->h == 0) {
+        lv_obj_invalidate(obj);
+        return;
+    }
+
+    /*Locate the image in the object the same way as the image widget draws it*/
+    lv_area_t image_area;
+    lv_area_set(&image_area, 0, 0, img->w - 1, img->h - 1);
+    lv_area_align(&obj->coords, &image_area, (lv_align_t)img->align, img->offset.x, img->offset.y);
+
+    lv_area_t inv_area = *area;
+    lv_area_move(&inv_area, image_area.x1, image_area.y1);
+    lv_obj_invalidate_area(obj, &inv_area);
+}
+
 #endif
@@ -165,6 +165,46 @@ void lv_canvas_init_layer(lv_obj_t * canvas, lv_layer_t * layer);
  */
 void lv_canvas_finish_layer(lv_obj_t * canvas, lv_layer_t * layer);
 
+/**
+ * Start a write session on the canvas.
+ * Until the matching `lv_canvas_end_write` the changes made by `lv_canvas_set_px`,
+ * `lv_canvas_finish_layer`, `lv_canvas_get_write_area` and `lv_canvas_mark_dirty`
+ * are not invalidated one by one. Instead their bounding boxes are collected
+ * and only these areas are invalidated when the session ends.
+ * Sessions can be nested; only the outermost `lv_canvas_end_write` invalidates.
+ * @param obj       pointer to a canvas
+ */
+void lv_canvas_begin_write(lv_obj_t * obj);
+
+/**
+ * Finish a write session started by `lv_canvas_begin_write`.
+ * Flushes the CPU cache of the changed areas and invalidates them.
+ * @param obj       pointer to a canvas
+ */
+void lv_canvas_end_write(lv_obj_t * obj);
+
+/**
+ * Mark an area of the canvas buffer as changed.
+ * In a write session the area is collected, else it's invalidated immediately.
+ * @param obj       pointer to a canvas
+ * @param area      the changed area in canvas buffer coordinates (0;0 is the top left pixel)
+ */
+void lv_canvas_mark_dirty(lv_obj_t * obj, const lv_area_t * area);
+
+/**
+ * Get direct access to an area of the canvas buffer for bulk writes.
+ * The area is marked as dirty, the CPU cache is flushed and the area
+ * is invalidated at the end of the write session.
+ * Can be called only inside a write session.
+ * @param obj       pointer to a canvas
+ * @param area      the area to write in canvas buffer coordinates. Will be clipped to the buffer.
+ * @param stride    store the number of bytes between the start of two rows here
+ * @return          pointer to the top left pixel of `area` or NULL if the area is out of the buffer
+ *                  (or no buffer is set). To get the next row add `stride` to the pointer.
+ * @note            Writing outside of the returned area's rows has undefined effect on redrawing.
+ */
+void * lv_canvas_get_write_area(lv_obj_t * obj, const lv_area_t * area, uint32_t * stride);
+
 /**********************
  *      MACROS
  **********************/
@@ -23,6 +23,9 @@ extern "C" {
  *      DEFINES
  *********************/
 
+/** Max number of separate dirty areas tracked in a write session. Further areas are merged. */
+#define LV_CANVAS_DIRTY_AREA_MAX 4
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -32,6 +35,9 @@ struct _lv_canvas_t {
     lv_image_t img;
     lv_draw_buf_t * draw_buf;
     lv_draw_buf_t static_buf;
+    lv_area_t dirty_areas[LV_CANVAS_DIRTY_AREA_MAX];    /**< Changed areas in buffer coordinates*/
+    uint8_t dirty_cnt;                                  /**< Number of valid `dirty_areas`*/
+    uint8_t write_session;                              /**< Nesting level of write sessions*/
 };
 
 
@@ -945,7 +945,7 @@ static void draw_image(lv_event_t * e)
             if((needs_inner_alignment || has_offset) && !inner_alignment_is_transforming) {
                 lv_point_t text_size;
 
-                lv_text_attributes_t attributes;
+                lv_text_attributes_t attributes = {0};
                 attributes.letter_space = label_dsc.letter_space;
                 attributes.line_space = label_dsc.line_space;
                 attributes.max_width = LV_COORD_MAX;
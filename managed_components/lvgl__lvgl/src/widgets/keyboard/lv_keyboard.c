@@ -77,6 +77,7 @@ const lv_obj_class_t lv_keyboard_class = {
     .height_def = LV_PCT(50),
     .instance_size = sizeof(lv_keyboard_t),
     .editable = 1,
+    .items_redraw_self = 1,
     .base_class = &lv_buttonmatrix_class,
     .name = "lv_keyboard",
 #if LV_USE_OBJ_PROPERTY
@@ -52,8 +52,12 @@ static void draw_main(lv_event_t * e);
 static void set_text_internal(lv_obj_t * obj, const char * text);
 static void remove_translation_tag(lv_obj_t * obj);
 static void lv_label_refr_text(lv_obj_t * obj);
+static lv_font_fallback_cache_t * get_fallback_cache(lv_obj_t * obj, const lv_font_t * font);
 static void lv_label_revert_dots(lv_obj_t * label);
 static void lv_label_set_dots(lv_obj_t * label, uint32_t dot_begin);
+#if LV_USE_BIDI
+    static void refr_bidi_text(lv_obj_t * obj);
+#endif
 
 static void set_ofs_x_anim(void * obj, int32_t v);
 static void set_ofs_y_anim(void * obj, int32_t v);
@@ -387,9 +391,17 @@ void lv_label_get_letter_pos(const lv_obj_t * obj, uint32_t char_id, lv_point_t
         uint32_t line_char_id = lv_text_encoded_get_char_id(&txt[line_start], byte_id - line_start);
 
         bool is_rtl;
-        uint32_t visual_char_pos = lv_bidi_get_visual_pos(&txt[line_start], &mutable_bidi_txt, new_line_start - line_start,
-                                                          base_dir, line_char_id, &is_rtl);
-        bidi_txt = mutable_bidi_txt;
+        uint32_t visual_char_pos;
+        const lv_bidi_text_line_t * bidi_line = lv_bidi_text_find_line(&label->bidi_text, line_start, new_line_start);
+        if(bidi_line) {
+            visual_char_pos = lv_bidi_text_get_visual_pos(&label->bidi_text, bidi_line, line_char_id, &is_rtl);
+            bidi_txt = lv_bidi_text_get_line_text(&label->bidi_text, bidi_line, txt);
+        }
+        else {
+            visual_char_pos = lv_bidi_get_visual_pos(&txt[line_start], &mutable_bidi_txt, new_line_start - line_start,
+                                                     base_dir, line_char_id, &is_rtl);
+            bidi_txt = mutable_bidi_txt;
+        }
         if(is_rtl) visual_char_pos++;
 
         visual_byte_pos = lv_text_encoded_get_byte_id(bidi_txt, visual_char_pos);
@@ -463,20 +475,30 @@ uint32_t lv_label_get_letter_on(const lv_obj_t * obj, lv_point_t * pos_in, bool
         line_start = new_line_start;
     }
 
-    char * bidi_txt;
+    const char * bidi_txt;
 
 #if LV_USE_BIDI
     uint32_t txt_len = 0;
+    char * bidi_txt_buf = NULL;
+    const lv_bidi_text_line_t * bidi_line = NULL;
     if(bidi) {
-        bidi_txt = lv_malloc(new_line_start - line_start + 1);
         txt_len = new_line_start - line_start;
         if(new_line_start > 0 && txt[new_line_start - 1] == '\0' && txt_len > 0) txt_len--;
-        lv_bidi_process_paragraph(txt + line_start, bidi_txt, txt_len, lv_obj_get_style_base_dir(obj, LV_PART_MAIN), NULL, 0);
+        bidi_line = lv_bidi_text_find_line(&label->bidi_text, line_start, line_start + txt_len);
+        if(bidi_line) {
+            bidi_txt = lv_bidi_text_get_line_text(&label->bidi_text, bidi_line, txt);
+        }
+        else {
+            bidi_txt_buf = lv_malloc(new_line_start - line_start + 1);
+            lv_bidi_process_paragraph(txt + line_start, bidi_txt_buf, txt_len, lv_obj_get_style_base_dir(obj, LV_PART_MAIN),
+                                      NULL, 0);
+            bidi_txt = bidi_txt_buf;
+        }
     }
     else
 #endif
     {
-        bidi_txt = (char *)txt + line_start;
+        bidi_txt = txt + line_start;
     }
 
     /*Calculate the x coordinate*/
@@ -527,11 +549,16 @@ uint32_t lv_label_get_letter_on(const lv_obj_t * obj, lv_point_t * pos_in, bool
         }
         else {
             bool is_rtl;
-            logical_pos = lv_bidi_get_logical_pos(&txt[line_start], NULL,
-                                                  txt_len, lv_obj_get_style_base_dir(obj, LV_PART_MAIN), cid, &is_rtl);
+            if(bidi_line) {
+                logical_pos = lv_bidi_text_get_logical_pos(&label->bidi_text, bidi_line, cid, &is_rtl);
+            }
+            else {
+                logical_pos = lv_bidi_get_logical_pos(&txt[line_start], NULL,
+                                                      txt_len, lv_obj_get_style_base_dir(obj, LV_PART_MAIN), cid, &is_rtl);
+            }
             if(is_rtl) logical_pos++;
         }
-        lv_free(bidi_txt);
+        lv_free(bidi_txt_buf);
     }
     else
 #endif
@@ -788,10 +815,15 @@ static void lv_label_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
 
     if(!label->static_txt) lv_free(label->text);
     label->text = NULL;
+#if LV_USE_BIDI
+    lv_bidi_text_reset(&label->bidi_text);
+#endif
 #if LV_USE_TRANSLATION
     if(label->translation_tag) lv_free(label->translation_tag);
     label->translation_tag = NULL;
 #endif /*LV_USE_TRANSLATION*/
+    lv_free(label->fallback_cache);
+    label->fallback_cache = NULL;
 }
 
 static void lv_label_event(const lv_obj_class_t * class_p, lv_event_t * e)
@@ -806,6 +838,11 @@ static void lv_label_event(const lv_obj_class_t * class_p, lv_event_t * e)
     lv_obj_t * obj = lv_event_get_current_target(e);
 
     if((code == LV_EVENT_STYLE_CHANGED) || (code == LV_EVENT_SIZE_CHANGED)) {
+        /*The font or its fallback chain might have changed*/
+        lv_label_t * label = (lv_label_t *)obj;
+        if(code == LV_EVENT_STYLE_CHANGED && label->fallback_cache) {
+            lv_font_fallback_cache_init(label->fallback_cache, lv_obj_get_style_text_font(obj, LV_PART_MAIN));
+        }
         lv_label_refr_text(obj);
     }
     else if(code == LV_EVENT_REFR_EXT_DRAW_SIZE) {
@@ -842,6 +879,7 @@ static void lv_label_event(const lv_obj_class_t * class_p, lv_event_t * e)
             attributes.line_space = line_space;
             attributes.text_flags = flag;
             attributes.max_width = w;
+            attributes.fallback_cache = get_fallback_cache(obj, font);
 
             lv_text_get_size_attributes(&label->size_cache, label->text, font, &attributes);
             lv_label_set_dots(obj, dot_begin);
@@ -894,10 +932,17 @@ static void draw_main(lv_event_t * e)
         label_draw_dsc.hint = &label->hint;
     }
 #endif
+#if LV_USE_BIDI
+    /*The text can be changed in the draw task events, so use the stored lines only without them*/
+    if(!lv_obj_has_flag(obj, LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS)) {
+        label_draw_dsc.bidi_text = &label->bidi_text;
+    }
+#endif
 
     label_draw_dsc.flag = flag;
     label_draw_dsc.base.layer = layer;
     lv_obj_init_draw_label_dsc(obj, LV_PART_MAIN, &label_draw_dsc);
+    label_draw_dsc.fallback_cache = get_fallback_cache(obj, label_draw_dsc.font);
     lv_bidi_calculate_align(&label_draw_dsc.align, &label_draw_dsc.bidi_dir, label->text);
 
     label_draw_dsc.sel_start = lv_label_get_text_selection_start(obj);
@@ -1083,6 +1128,7 @@ static void lv_label_refr_text(lv_obj_t * obj)
     attributes.letter_space = lv_obj_get_style_text_letter_space(obj, LV_PART_MAIN);
     attributes.text_flags = get_label_flags(label);
     attributes.max_width = lv_area_get_width(&txt_coords);
+    attributes.fallback_cache = get_fallback_cache(obj, font);
 
     /*Calc. the height and longest line*/
     lv_point_t size;
@@ -1332,9 +1378,35 @@ static void lv_label_refr_text(lv_obj_t * obj)
         /*Do nothing*/
     }
 
+#if LV_USE_BIDI
+    refr_bidi_text(obj);
+#endif
+
     lv_obj_invalidate(obj);
 }
 
+#if LV_USE_BIDI
+/**
+ * Bidi process the text with the same line breaks as drawing will use,
+ * so drawing and getting the letter positions don't need to process it again
+ * @param obj       pointer to a label
+ */
+static void refr_bidi_text(lv_obj_t * obj)
+{
+    lv_label_t * label = (lv_label_t *)obj;
+
+    lv_text_attributes_t attributes = {0};
+    attributes.letter_space = lv_obj_get_style_text_letter_space(obj, LV_PART_MAIN);
+    attributes.text_flags = get_label_flags(label);
+    if(attributes.text_flags & LV_TEXT_FLAG_EXPAND) attributes.max_width = label->text_size.x;
+    else attributes.max_width = lv_obj_get_content_width(obj);
+
+    const lv_font_t * font = lv_obj_get_style_text_font(obj, LV_PART_MAIN);
+    lv_base_dir_t base_dir = lv_obj_get_style_base_dir(obj, LV_PART_MAIN);
+    lv_bidi_text_process(&label->bidi_text, label->text, base_dir, font, &attributes);
+}
+#endif
+
 static void lv_label_revert_dots(lv_obj_t * obj)
 {
     lv_label_t * label = (lv_label_t *)obj;
@@ -1439,6 +1511,29 @@ static void calculate_x_coordinate(int32_t * x, const lv_text_align_t align, con
     }
 }
 
+/**
+ * Get the cache of the fonts resolved from the fallback chain of the label's font.
+ * It's kept between measuring and drawing the text, so the fallback chain needs to be
+ * walked only once for each letter. It's allocated when it's needed first.
+ * @param obj       pointer to a label
+ * @param font      the font of the label
+ * @return          the cache or NULL if the font has no fallback
+ */
+static lv_font_fallback_cache_t * get_fallback_cache(lv_obj_t * obj, const lv_font_t * font)
+{
+    lv_label_t * label = (lv_label_t *)obj;
+    if(font == NULL || font->fallback == NULL) return NULL;
+
+    if(label->fallback_cache == NULL) {
+        label->fallback_cache = lv_malloc(sizeof(lv_font_fallback_cache_t));
+        LV_ASSERT_MALLOC(label->fallback_cache);
+        if(label->fallback_cache == NULL) return NULL;
+        lv_font_fallback_cache_init(label->fallback_cache, font);
+    }
+
+    return label->fallback_cache;
+}
+
 #if LV_USE_OBSERVER
 
 static void label_text_observer_cb(lv_observer_t * observer, lv_subject_t * subject)
@@ -16,6 +16,7 @@ extern "C" {
 
 #include "../../draw/lv_draw_label_private.h"
 #include "../../core/lv_obj_private.h"
+#include "../../misc/lv_bidi_private.h"
 #include "lv_label.h"
 
 #if LV_USE_LABEL != 0
@@ -41,11 +42,17 @@ struct _lv_label_t {
     lv_draw_label_hint_t hint;
 #endif
 
+    lv_font_fallback_cache_t * fallback_cache;  /**< Fonts resolved from the fallback chain. NULL if not used yet*/
+
 #if LV_LABEL_TEXT_SELECTION
     uint32_t sel_start;
     uint32_t sel_end;
 #endif
 
+#if LV_USE_BIDI
+    lv_bidi_text_t bidi_text;           /**< The text processed by Bidi, refreshed with the text */
+#endif
+
     lv_point_t size_cache;              /**< Text size cache */
     lv_point_t offset;                  /**< Text draw position offset */
     lv_label_long_mode_t long_mode : 4; /**< Determine what to do with the long texts */
@@ -16,18 +16,37 @@
     #include "../../libs/thorvg/thorvg_capi.h"
 #endif
 
-#include "../../misc/lv_timer.h"
+#if LV_USE_LZ4_EXTERNAL
+    #include <lz4.h>
+#endif
+
+#if LV_USE_LZ4_INTERNAL
+    #include "../../libs/lz4/lz4.h"
+#endif
+
+#include "../../misc/lv_timer_private.h"
 #include "../../core/lv_obj_class_private.h"
 #include "../../misc/cache/lv_cache.h"
+#include "../../display/lv_display.h"
 
 /*********************
  *      DEFINES
  *********************/
 #define MY_CLASS (&lv_lottie_class)
 
+/*Size of the areas whose hashes are compared to find the changed parts of a frame*/
+#define TILE_SIZE   16
+
 /**********************
  *      TYPEDEFS
  **********************/
+typedef struct {
+    lv_cache_slot_size_t slot;
+    int32_t frame;
+    uint8_t * data;         /*The tile hashes followed by the (compressed) pixels*/
+    uint32_t pixels_size;
+    bool compressed;
+} frame_cache_data_t;
 
 /**********************
  *  STATIC PROTOTYPES
@@ -35,7 +54,17 @@
 static void lv_lottie_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void lv_lottie_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void anim_exec_cb(void * var, int32_t v);
+static void show_frame(lv_lottie_t * lottie, int32_t v);
+static void pending_timer_cb(lv_timer_t * t);
 static void lottie_update(lv_lottie_t * lottie, int32_t v);
+static void buffer_changed(lv_lottie_t * lottie);
+static void frames_reset(lv_lottie_t * lottie);
+static void hash_tiles(lv_lottie_t * lottie, uint32_t * hashes);
+static void invalidate_changed_tiles(lv_lottie_t * lottie);
+static bool frame_cache_load(lv_lottie_t * lottie, int32_t frame);
+static void frame_cache_store(lv_lottie_t * lottie, int32_t frame);
+static lv_cache_compare_res_t frame_cache_compare_cb(const frame_cache_data_t * lhs, const frame_cache_data_t * rhs);
+static void frame_cache_free_cb(frame_cache_data_t * node, void * user_data);
 
 /**********************
  *  STATIC VARIABLES
@@ -86,9 +115,10 @@ void lv_lottie_set_buffer(lv_obj_t * obj, int32_t w, int32_t h, void * buf)
     lv_draw_buf_set_flag(draw_buf, LV_IMAGE_FLAGS_PREMULTIPLIED);
 
     /*Force updating when the buffer changes*/
+    buffer_changed(lottie);
     float f_current;
     tvg_animation_get_frame(lottie->tvg_anim, &f_current);
-    anim_exec_cb(obj, (int32_t) f_current);
+    show_frame(lottie, (int32_t) f_current);
 }
 
 void lv_lottie_set_draw_buf(lv_obj_t * obj, lv_draw_buf_t * draw_buf)
@@ -109,9 +139,10 @@ void lv_lottie_set_draw_buf(lv_obj_t * obj, lv_draw_buf_t * draw_buf)
     lv_draw_buf_set_flag(draw_buf, LV_IMAGE_FLAGS_PREMULTIPLIED);
 
     /*Force updating when the buffer changes*/
+    buffer_changed(lottie);
     float f_current;
     tvg_animation_get_frame(lottie->tvg_anim, &f_current);
-    anim_exec_cb(obj, (int32_t) f_current);
+    show_frame(lottie, (int32_t) f_current);
 }
 
 void lv_lottie_set_src_data(lv_obj_t * obj, const void * src, size_t src_size)
@@ -129,6 +160,7 @@ void lv_lottie_set_src_data(lv_obj_t * obj, const void * src, size_t src_size)
     lottie->anim->act_time = 0;
     lottie->anim->end_value = (int32_t)f_total;
     lottie->anim->reverse_play_in_progress = false;
+    frames_reset(lottie);
     lottie_update(lottie, 0);   /*Render immediately*/
 }
 
@@ -147,9 +179,39 @@ void lv_lottie_set_src_file(lv_obj_t * obj, const char * src)
     lottie->anim->act_time = 0;
     lottie->anim->end_value = (int32_t)f_total;
     lottie->anim->reverse_play_in_progress = false;
+    frames_reset(lottie);
     lottie_update(lottie, 0);   /*Render immediately*/
 }
 
+void lv_lottie_set_frame_cache_size(lv_obj_t * obj, uint32_t size)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_lottie_t * lottie = (lv_lottie_t *)obj;
+
+    if(lottie->frame_cache) {
+        lv_cache_destroy(lottie->frame_cache, NULL);
+        lottie->frame_cache = NULL;
+    }
+
+    lottie->frame_cache_size = size;
+    if(size == 0) return;
+
+    const lv_cache_ops_t ops = {
+        .compare_cb = (lv_cache_compare_cb_t)frame_cache_compare_cb,
+        .create_cb = NULL,
+        .free_cb = (lv_cache_free_cb_t)frame_cache_free_cb,
+    };
+
+    lottie->frame_cache = lv_cache_create(&lv_cache_class_lru_rb_size, sizeof(frame_cache_data_t), size, ops);
+    lv_cache_set_name(lottie->frame_cache, "LOTTIE_FRAME");
+}
+
+uint32_t lv_lottie_get_frame_cache_size(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_lottie_t * lottie = (lv_lottie_t *)obj;
+    return lottie->frame_cache_size;
+}
 
 lv_anim_t * lv_lottie_get_anim(lv_obj_t * obj)
 {
@@ -176,6 +238,11 @@ static void lv_lottie_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj
 
     lottie->tvg_canvas = tvg_swcanvas_create();
 
+    lottie->rendered_frame = -1;
+    lottie->pending_frame = -1;
+    lottie->pending_timer = lv_timer_create(pending_timer_cb, 0, obj);
+    lv_timer_pause(lottie->pending_timer);
+
     lv_anim_t a;
     lv_anim_init(&a);
     lv_anim_set_exec_cb(&a, anim_exec_cb);
@@ -193,14 +260,43 @@ static void lv_lottie_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
 
     tvg_animation_del(lottie->tvg_anim);
     tvg_canvas_destroy(lottie->tvg_canvas);
+
+    lv_timer_delete(lottie->pending_timer);
+    if(lottie->frame_cache) lv_cache_destroy(lottie->frame_cache, NULL);
+    lv_free(lottie->tile_hashes);
 }
 
 static void anim_exec_cb(void * var, int32_t v)
 {
     lv_lottie_t * lottie = var;
 
+    /*Don't render more frames than the display can show.
+     *Keep the latest skipped frame and render it in the next refresh period instead.*/
+    lv_display_t * disp = lv_obj_get_display(var);
+    lv_timer_t * refr_timer = disp ? lv_display_get_refr_timer(disp) : NULL;
+    if(refr_timer && lottie->rendered_frame >= 0 && lv_obj_is_visible(var)) {
+        uint32_t elaps = lv_tick_elaps(lottie->last_render_tick);
+        if(elaps < refr_timer->period) {
+            if(lottie->pending_frame < 0) {
+                lv_timer_set_period(lottie->pending_timer, refr_timer->period - elaps);
+                lv_timer_reset(lottie->pending_timer);
+                lv_timer_resume(lottie->pending_timer);
+            }
+            lottie->pending_frame = v;
+            if(lottie->anim) {
+                lottie->last_rendered_time = lottie->anim->act_time;
+            }
+            return;
+        }
+    }
+
+    show_frame(lottie, v);
+}
+
+static void show_frame(lv_lottie_t * lottie, int32_t v)
+{
     /*Do not render not visible animations.*/
-    if(lv_obj_is_visible(var)) {
+    if(lv_obj_is_visible((lv_obj_t *)lottie)) {
         lottie_update(lottie, v);
         if(lottie->anim) {
             lottie->last_rendered_time = lottie->anim->act_time;
@@ -215,24 +311,261 @@ static void anim_exec_cb(void * var, int32_t v)
     }
 }
 
+static void pending_timer_cb(lv_timer_t * t)
+{
+    lv_lottie_t * lottie = lv_timer_get_user_data(t);
+    lv_timer_pause(t);
+
+    if(lottie->pending_frame >= 0) {
+        show_frame(lottie, lottie->pending_frame);
+    }
+}
+
 static void lottie_update(lv_lottie_t * lottie, int32_t v)
 {
     lv_obj_t * obj = (lv_obj_t *) lottie;
 
+    lottie->last_render_tick = lv_tick_get();
+    lottie->pending_frame = -1;
+
     lv_draw_buf_t * draw_buf = lv_canvas_get_draw_buf(obj);
-    if(draw_buf) {
+    if(draw_buf == NULL || lottie->tile_hashes == NULL) {
+        tvg_animation_set_frame(lottie->tvg_anim, v);
+        tvg_canvas_update(lottie->tvg_canvas);
+        tvg_canvas_draw(lottie->tvg_canvas);
+        tvg_canvas_sync(lottie->tvg_canvas);
+
+        lv_obj_invalidate(obj);
+        return;
+    }
+
+    /*The buffer already contains this frame*/
+    if(v == lottie->rendered_frame) return;
+
+    if(!frame_cache_load(lottie, v)) {
         lv_draw_buf_clear(draw_buf, NULL);
 
-        /*Drop old cached image*/
-        lv_image_cache_drop(lv_image_get_src(obj));
+        tvg_animation_set_frame(lottie->tvg_anim, v);
+        tvg_canvas_update(lottie->tvg_canvas);
+        tvg_canvas_draw(lottie->tvg_canvas);
+        tvg_canvas_sync(lottie->tvg_canvas);
+
+        hash_tiles(lottie, lottie->tile_hashes + lottie->tile_cnt);
+        frame_cache_store(lottie, v);
+    }
+
+    /*Drop old cached image*/
+    lv_image_cache_drop(lv_image_get_src(obj));
+
+    invalidate_changed_tiles(lottie);
+    lottie->rendered_frame = v;
+}
+
+/**
+ * Allocate the tile hashes for the new buffer and forget about the rendered frames
+ */
+static void buffer_changed(lv_lottie_t * lottie)
+{
+    lv_draw_buf_t * draw_buf = lv_canvas_get_draw_buf((lv_obj_t *)lottie);
+    uint32_t cols = (draw_buf->header.w + TILE_SIZE - 1) / TILE_SIZE;
+    uint32_t rows = (draw_buf->header.h + TILE_SIZE - 1) / TILE_SIZE;
+
+    lv_free(lottie->tile_hashes);
+    lottie->tile_cnt = cols * rows;
+    lottie->tile_hashes = lv_malloc(2 * lottie->tile_cnt * sizeof(uint32_t));
+    LV_ASSERT_MALLOC(lottie->tile_hashes);
+
+    frames_reset(lottie);
+}
+
+/**
+ * The rendered frames became invalid, e.g. a new source was set
+ */
+static void frames_reset(lv_lottie_t * lottie)
+{
+    lottie->rendered_frame = -1;
+    if(lottie->frame_cache) lv_cache_drop_all(lottie->frame_cache, NULL);
+}
+
+static void hash_tiles(lv_lottie_t * lottie, uint32_t * hashes)
+{
+    lv_draw_buf_t * draw_buf = lv_canvas_get_draw_buf((lv_obj_t *)lottie);
+    int32_t w = draw_buf->header.w;
+    int32_t h = draw_buf->header.h;
+    uint32_t cols = (w + TILE_SIZE - 1) / TILE_SIZE;
+
+    uint32_t i;
+    for(i = 0; i < lottie->tile_cnt; i++) {
+        hashes[i] = 2166136261u;
+    }
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        const uint32_t * px = (const uint32_t *)(draw_buf->data + y * draw_buf->header.stride);
+        uint32_t * row_hashes = &hashes[(y / TILE_SIZE) * cols];
+        uint32_t tx;
+        for(tx = 0; tx < cols; tx++) {
+            int32_t x_end = LV_MIN((int32_t)(tx + 1) * TILE_SIZE, w);
+            uint32_t hash = row_hashes[tx];
+            int32_t x;
+            for(x = tx * TILE_SIZE; x < x_end; x++) {
+                hash = (hash ^ px[x]) * 16777619u;
+            }
+            row_hashes[tx] = hash;
+        }
+    }
+}
+
+/**
+ * Invalidate only the bounding box of the tiles which are different in the new frame
+ */
+static void invalidate_changed_tiles(lv_lottie_t * lottie)
+{
+    lv_obj_t * obj = (lv_obj_t *)lottie;
+    lv_image_t * img = (lv_image_t *)obj;
+    lv_draw_buf_t * draw_buf = lv_canvas_get_draw_buf(obj);
+    uint32_t * hashes_act = lottie->tile_hashes;
+    uint32_t * hashes_new = lottie->tile_hashes + lottie->tile_cnt;
+    uint32_t cols = (draw_buf->header.w + TILE_SIZE - 1) / TILE_SIZE;
+
+    lv_area_t changed = {INT16_MAX, INT16_MAX, -1, -1};
+    uint32_t i;
+    for(i = 0; i < lottie->tile_cnt; i++) {
+        if(hashes_act[i] == hashes_new[i]) continue;
+        int32_t x = (i % cols) * TILE_SIZE;
+        int32_t y = (i / cols) * TILE_SIZE;
+        changed.x1 = LV_MIN(changed.x1, x);
+        changed.y1 = LV_MIN(changed.y1, y);
+        changed.x2 = LV_MAX(changed.x2, x + TILE_SIZE - 1);
+        changed.y2 = LV_MAX(changed.y2, y + TILE_SIZE - 1);
+    }
+
+    lv_memcpy(hashes_act, hashes_new, lottie->tile_cnt * sizeof(uint32_t));
+
+    bool transformed = img->scale_x != LV_SCALE_NONE || img->scale_y != LV_SCALE_NONE || img->rotation != 0 ||
+                       img->align > _LV_IMAGE_ALIGN_AUTO_TRANSFORM;
+    if(lottie->rendered_frame < 0 || transformed) {
+        lv_obj_invalidate(obj);
+        return;
+    }
+
+    /*Nothing has changed*/
+    if(changed.x2 < 0) return;
+
+    /*Map the changed area to the same place where the image is drawn*/
+    lv_area_t img_area;
+    lv_area_set(&img_area, 0, 0, img->w - 1, img->h - 1);
+    lv_area_align(&obj->coords, &img_area, img->align, img->offset.x, img->offset.y);
+    lv_area_move(&changed, img_area.x1, img_area.y1);
+    changed.x2 = LV_MIN(changed.x2, img_area.x2);
+    changed.y2 = LV_MIN(changed.y2, img_area.y2);
+    lv_obj_invalidate_area(obj, &changed);
+}
+
+static bool frame_cache_load(lv_lottie_t * lottie, int32_t frame)
+{
+    if(lottie->frame_cache == NULL) return false;
+
+    frame_cache_data_t search_key;
+    search_key.frame = frame;
+    lv_cache_entry_t * entry = lv_cache_acquire(lottie->frame_cache, &search_key, NULL);
+    if(entry == NULL) return false;
+
+    const frame_cache_data_t * cached = lv_cache_entry_get_data(entry);
+    lv_draw_buf_t * draw_buf = lv_canvas_get_draw_buf((lv_obj_t *)lottie);
+    uint32_t hashes_size = lottie->tile_cnt * sizeof(uint32_t);
+    uint32_t buf_size = draw_buf->header.stride * draw_buf->header.h;
+    const uint8_t * pixels = cached->data + hashes_size;
+    bool res = true;
+
+    if(cached->compressed) {
+#if LV_USE_LZ4
+        int ret = LZ4_decompress_safe((const char *)pixels, (char *)draw_buf->data, (int)cached->pixels_size, (int)buf_size);
+        res = ret == (int)buf_size;
+#else
+        res = false;
+#endif
+    }
+    else {
+        lv_memcpy(draw_buf->data, pixels, buf_size);
+    }
+
+    if(res) lv_memcpy(lottie->tile_hashes + lottie->tile_cnt, cached->data, hashes_size);
+    lv_cache_release(lottie->frame_cache, entry, NULL);
+
+    return res;
+}
+
+static void frame_cache_store(lv_lottie_t * lottie, int32_t frame)
+{
+    if(lottie->frame_cache == NULL) return;
+
+    lv_draw_buf_t * draw_buf = lv_canvas_get_draw_buf((lv_obj_t *)lottie);
+    uint32_t hashes_size = lottie->tile_cnt * sizeof(uint32_t);
+    uint32_t buf_size = draw_buf->header.stride * draw_buf->header.h;
+
+    frame_cache_data_t item;
+    lv_memzero(&item, sizeof(item));
+    item.frame = frame;
+    item.pixels_size = buf_size;
+
+#if LV_USE_LZ4
+    int bound = LZ4_compressBound((int)buf_size);
+    item.data = lv_malloc(hashes_size + bound);
+    if(item.data == NULL) return;
+
+    int compressed_size = LZ4_compress_default((const char *)draw_buf->data, (char *)item.data + hashes_size,
+                                               (int)buf_size, bound);
+    if(compressed_size > 0 && (uint32_t)compressed_size < buf_size) {
+        item.compressed = true;
+        item.pixels_size = compressed_size;
+        uint8_t * shrunk = lv_realloc(item.data, hashes_size + item.pixels_size);
+        if(shrunk) item.data = shrunk;
+    }
+    else {
+        lv_free(item.data);
+        item.data = NULL;
+    }
+#endif
+
+    if(item.data == NULL) {
+        if(sizeof(item) + hashes_size + buf_size > lottie->frame_cache_size) return;
+        item.data = lv_malloc(hashes_size + buf_size);
+        if(item.data == NULL) return;
+        lv_memcpy(item.data + hashes_size, draw_buf->data, buf_size);
     }
 
-    tvg_animation_set_frame(lottie->tvg_anim, v);
-    tvg_canvas_update(lottie->tvg_canvas);
-    tvg_canvas_draw(lottie->tvg_canvas);
-    tvg_canvas_sync(lottie->tvg_canvas);
+    lv_memcpy(item.data, lottie->tile_hashes + lottie->tile_cnt, hashes_size);
+    item.slot.size = sizeof(item) + hashes_size + item.pixels_size;
 
-    lv_obj_invalidate(obj);
+    /*Larger than the whole budget*/
+    if(item.slot.size > lottie->frame_cache_size) {
+        lv_free(item.data);
+        return;
+    }
+
+    lv_cache_entry_t * entry = lv_cache_add(lottie->frame_cache, &item, NULL);
+    if(entry == NULL) {
+        lv_free(item.data);
+        return;
+    }
+    lv_cache_release(lottie->frame_cache, entry, NULL);
+}
+
+static lv_cache_compare_res_t frame_cache_compare_cb(const frame_cache_data_t * lhs, const frame_cache_data_t * rhs)
+{
+    if(lhs->frame != rhs->frame) {
+        return lhs->frame > rhs->frame ? 1 : -1;
+    }
+
+    return 0;
+}
+
+static void frame_cache_free_cb(frame_cache_data_t * node, void * user_data)
+{
+    LV_UNUSED(user_data);
+    lv_free(node->data);
+    node->data = NULL;
 }
 
 #endif /*LV_USE_LOTTIE*/
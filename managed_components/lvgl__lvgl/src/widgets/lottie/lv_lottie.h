@@ -78,6 +78,23 @@ void lv_lottie_set_src_data(lv_obj_t * obj, const void * src, size_t src_size);
  */
 void lv_lottie_set_src_file(lv_obj_t * obj, const char * src);
 
+/**
+ * Keep the rendered frames in memory to show them again without rendering,
+ * e.g. when the animation is looping.
+ * The frames are compressed with LZ4 if `LV_USE_LZ4` is enabled.
+ * The least recently shown frames are dropped to stay within the budget.
+ * @param obj       pointer to a lottie widget
+ * @param size      memory budget of the cached frames in bytes, 0 to disable caching (default)
+ */
+void lv_lottie_set_frame_cache_size(lv_obj_t * obj, uint32_t size);
+
+/**
+ * Get the memory budget of the cached frames
+ * @param obj       pointer to a lottie widget
+ * @return          the memory budget in bytes, 0 if caching is disabled
+ */
+uint32_t lv_lottie_get_frame_cache_size(lv_obj_t * obj);
+
 /**
  * Get the LVGL animation which controls the lottie animation
  * @param obj       pointer to a lottie widget
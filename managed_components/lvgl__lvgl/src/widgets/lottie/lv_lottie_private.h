@@ -19,6 +19,7 @@ extern "C" {
 
 #include "lv_lottie.h"
 #include "../canvas/lv_canvas_private.h"
+#include "../../misc/cache/lv_cache.h"
 
 /*********************
  *      DEFINES
@@ -41,6 +42,14 @@ typedef struct {
     Tvg_Animation * tvg_anim;
     lv_anim_t * anim;
     int32_t last_rendered_time;
+    int32_t rendered_frame;         /**< The frame in the buffer or -1 if it needs to be rendered again*/
+    int32_t pending_frame;          /**< The latest frame skipped to not render faster than the display refreshes, or -1*/
+    lv_timer_t * pending_timer;     /**< Renders `pending_frame` in the next refresh period*/
+    uint32_t last_render_tick;
+    uint32_t * tile_hashes;         /**< Hashes of the tiles of the rendered frame followed by the ones of the new frame*/
+    uint32_t tile_cnt;
+    lv_cache_t * frame_cache;       /**< The rendered frames or NULL if not enabled*/
+    uint32_t frame_cache_size;
 } lv_lottie_t;
 
 /**********************
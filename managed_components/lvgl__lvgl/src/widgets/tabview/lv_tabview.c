@@ -14,12 +14,18 @@
 
 #include "../../misc/lv_assert.h"
 #include "../../indev/lv_indev_private.h"
+#include "../../misc/lv_area_private.h"
+#include "../../core/lv_obj_draw_private.h"
 
 /*********************
  *      DEFINES
  *********************/
 #define MY_CLASS (&lv_tabview_class)
 
+/*Same as the time of the scroll animations*/
+#define TRANSITION_TIME_MIN    200    /*ms*/
+#define TRANSITION_TIME_MAX    400    /*ms*/
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -28,15 +34,28 @@
  *  STATIC PROTOTYPES
  **********************/
 static void lv_tabview_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
+static void lv_tabview_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void lv_tabview_event(const lv_obj_class_t * class_p, lv_event_t * e);
 static void button_clicked_event_cb(lv_event_t * e);
 static void cont_scroll_end_event_cb(lv_event_t * e);
+static bool transition_start(lv_obj_t * obj, bool hor, int32_t scroll_end);
+static void transition_stop(lv_obj_t * obj);
+static void transition_anim_exec_cb(void * var, int32_t v);
+static void transition_anim_completed_cb(lv_anim_t * a);
+static void draw_transition(lv_obj_t * obj, lv_layer_t * layer);
+static void content_hide(lv_obj_t * obj, bool hide);
+static void tab_cache_event_cb(lv_event_t * e);
+static void tab_cache_drop(lv_tabview_t * tabview, lv_tabview_tab_cache_t * entry);
+static void tab_cache_remove(lv_tabview_t * tabview, lv_tabview_tab_cache_t * entry);
+static void tab_cache_unpin(lv_tabview_t * tabview);
+static bool tab_cache_make_room(lv_tabview_t * tabview, uint32_t size);
 
 /**********************
  *  STATIC VARIABLES
  **********************/
 const lv_obj_class_t lv_tabview_class = {
     .constructor_cb = lv_tabview_constructor,
+    .destructor_cb = lv_tabview_destructor,
     .event_cb = lv_tabview_event,
     .width_def = LV_PCT(100),
     .height_def = LV_PCT(100),
@@ -123,23 +142,32 @@ void lv_tabview_set_active(lv_obj_t * obj, uint32_t idx, lv_anim_enable_t anim_e
     /*To be sure lv_obj_get_content_width will return valid value*/
     if(cont == NULL) return;
 
+    transition_stop(obj);
     lv_obj_update_layout(obj);
 
-    if((tabview->tab_pos & LV_DIR_VER) != 0) {
+    bool hor = (tabview->tab_pos & LV_DIR_VER) != 0;
+    int32_t scroll_end;
+    if(hor) {
         int32_t gap = lv_obj_get_style_pad_column(cont, LV_PART_MAIN);
         int32_t w = lv_obj_get_content_width(cont);
         if(lv_obj_get_style_base_dir(obj, LV_PART_MAIN) != LV_BASE_DIR_RTL) {
-            lv_obj_scroll_to_x(cont, idx * (gap + w), anim_en);
+            scroll_end = idx * (gap + w);
         }
         else {
             int32_t id_rtl = -(int32_t)idx;
-            lv_obj_scroll_to_x(cont, (gap + w) * id_rtl, anim_en);
+            scroll_end = (gap + w) * id_rtl;
         }
     }
     else {
         int32_t gap = lv_obj_get_style_pad_row(cont, LV_PART_MAIN);
         int32_t h = lv_obj_get_content_height(cont);
-        lv_obj_scroll_to_y(cont, idx * (gap + h), anim_en);
+        scroll_end = idx * (gap + h);
+    }
+
+    /*Slide the cached images of the tabs if possible, else scroll the real tabs*/
+    if(anim_en == LV_ANIM_OFF || !transition_start(obj, hor, scroll_end)) {
+        if(hor) lv_obj_scroll_to_x(cont, scroll_end, anim_en);
+        else lv_obj_scroll_to_y(cont, scroll_end, anim_en);
     }
 
     uint32_t i = 0;
@@ -235,6 +263,39 @@ void lv_tabview_set_tab_bar_size(lv_obj_t * obj, int32_t size)
     }
 }
 
+void lv_tabview_set_tab_cache_size(lv_obj_t * obj, uint32_t size)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_tabview_t * tabview = (lv_tabview_t *)obj;
+
+#if LV_USE_SNAPSHOT == 0
+    if(size) {
+        LV_LOG_WARN("LV_USE_SNAPSHOT is required to cache the tabs");
+        size = 0;
+    }
+#endif
+
+    transition_stop(obj);
+    tabview->tab_cache_size = size;
+    if(size == 0) {
+        lv_tabview_tab_cache_t * entry = lv_ll_get_head(&tabview->tab_cache_ll);
+        while(entry) {
+            tab_cache_remove(tabview, entry);
+            entry = lv_ll_get_head(&tabview->tab_cache_ll);
+        }
+    }
+    else {
+        tab_cache_make_room(tabview, 0);
+    }
+}
+
+uint32_t lv_tabview_get_tab_cache_size(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_tabview_t * tabview = (lv_tabview_t *)obj;
+    return tabview->tab_cache_size;
+}
+
 uint32_t lv_tabview_get_tab_active(lv_obj_t * obj)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
@@ -275,6 +336,7 @@ static void lv_tabview_constructor(const lv_obj_class_t * class_p, lv_obj_t * ob
     LV_UNUSED(class_p);
     lv_tabview_t * tabview = (lv_tabview_t *)obj;
     tabview->tab_pos = LV_DIR_NONE;  /*Invalid value to apply the default TOP direction correctly*/
+    lv_ll_init(&tabview->tab_cache_ll, sizeof(lv_tabview_tab_cache_t));
 
     lv_obj_set_size(obj, LV_PCT(100), LV_PCT(100));
 
@@ -293,6 +355,19 @@ static void lv_tabview_constructor(const lv_obj_class_t * class_p, lv_obj_t * ob
     lv_obj_remove_flag(cont, LV_OBJ_FLAG_SCROLL_ON_FOCUS);
 }
 
+static void lv_tabview_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
+{
+    LV_UNUSED(class_p);
+    lv_tabview_t * tabview = (lv_tabview_t *)obj;
+
+    /*The deleted tabs have already removed themselves. Only the moved ones might remain.*/
+    lv_tabview_tab_cache_t * entry = lv_ll_get_head(&tabview->tab_cache_ll);
+    while(entry) {
+        tab_cache_remove(tabview, entry);
+        entry = lv_ll_get_head(&tabview->tab_cache_ll);
+    }
+}
+
 static void lv_tabview_event(const lv_obj_class_t * class_p, lv_event_t * e)
 {
     LV_UNUSED(class_p);
@@ -305,6 +380,10 @@ static void lv_tabview_event(const lv_obj_class_t * class_p, lv_event_t * e)
     if(code == LV_EVENT_SIZE_CHANGED) {
         lv_tabview_set_active(target, lv_tabview_get_tab_active(target), LV_ANIM_OFF);
     }
+    else if(code == LV_EVENT_DRAW_POST) {
+        lv_tabview_t * tabview = (lv_tabview_t *)target;
+        if(tabview->in_transition) draw_transition(target, lv_event_get_layer(e));
+    }
 }
 
 static void button_clicked_event_cb(lv_event_t * e)
@@ -338,6 +417,10 @@ static void cont_scroll_end_event_cb(lv_event_t * e)
 
     lv_obj_t * tv = lv_obj_get_parent(cont);
     lv_tabview_t * tv_obj = (lv_tabview_t *)tv;
+
+    /*The content is scrolled and hidden on purpose during the transition*/
+    if(tv_obj->in_transition) return;
+
     if(code == LV_EVENT_LAYOUT_CHANGED) {
         lv_tabview_set_active(tv, lv_tabview_get_tab_active(tv), LV_ANIM_OFF);
     }
@@ -376,4 +459,303 @@ static void cont_scroll_end_event_cb(lv_event_t * e)
         if(new_tab) lv_obj_send_event(tv, LV_EVENT_VALUE_CHANGED, NULL);
     }
 }
+
+/**
+ * Hide the content and slide the cached images of the tabs instead
+ * @param obj           pointer to a tabview
+ * @param hor           true: the tabs are scrolled horizontally
+ * @param scroll_end    the scroll position of the content where the transition should end
+ * @return              true: the transition has started; false: not all the required tabs could be cached
+ */
+static bool transition_start(lv_obj_t * obj, bool hor, int32_t scroll_end)
+{
+#if LV_USE_SNAPSHOT
+    lv_tabview_t * tabview = (lv_tabview_t *)obj;
+    if(tabview->tab_cache_size == 0) return false;
+
+    lv_obj_t * cont = lv_tabview_get_content(obj);
+    int32_t scroll_start = hor ? lv_obj_get_scroll_x(cont) : lv_obj_get_scroll_y(cont);
+    int32_t diff = scroll_end - scroll_start;
+    if(diff == 0) return false;
+
+    /*The area swept by the content during the transition*/
+    lv_area_t swept = cont->coords;
+    if(hor) {
+        if(diff > 0) swept.x2 += diff;
+        else swept.x1 += diff;
+    }
+    else {
+        if(diff > 0) swept.y2 += diff;
+        else swept.y1 += diff;
+    }
+
+    /*All the tabs which will be visible during the transition need to be cached*/
+    uint32_t i;
+    uint32_t page_cnt = lv_obj_get_child_count(cont);
+    for(i = 0; i < page_cnt; i++) {
+        lv_obj_t * page = lv_obj_get_child(cont, i);
+        if(lv_obj_has_flag(page, LV_OBJ_FLAG_HIDDEN)) continue;
+        if(!lv_area_is_on(&page->coords, &swept)) continue;
+
+        lv_tabview_tab_cache_t * entry;
+        LV_LL_READ(&tabview->tab_cache_ll, entry) {
+            if(entry->page == page) break;
+        }
+
+        if(entry == NULL) {
+            entry = lv_ll_ins_head(&tabview->tab_cache_ll);
+            LV_ASSERT_MALLOC(entry);
+            if(entry == NULL) break;
+            lv_memzero(entry, sizeof(lv_tabview_tab_cache_t));
+            entry->page = page;
+            lv_obj_set_watch_invalidation(page, true);
+            lv_obj_add_event_cb(page, tab_cache_event_cb, LV_EVENT_INVALIDATE_AREA, obj);
+            lv_obj_add_event_cb(page, tab_cache_event_cb, LV_EVENT_DELETE, obj);
+        }
+        else if(entry != lv_ll_get_head(&tabview->tab_cache_ll)) {
+            lv_ll_move_before(&tabview->tab_cache_ll, entry, lv_ll_get_head(&tabview->tab_cache_ll));
+        }
+
+        if(entry->draw_buf == NULL) {
+            int32_t ext = lv_obj_get_ext_draw_size(page);
+            int32_t w = lv_obj_get_width(page) + 2 * ext;
+            int32_t h = lv_obj_get_height(page) + 2 * ext;
+            uint32_t size = lv_draw_buf_width_to_stride(w, LV_COLOR_FORMAT_ARGB8888) * h;
+            if(!tab_cache_make_room(tabview, size)) break;
+
+            entry->draw_buf = lv_snapshot_take(page, LV_COLOR_FORMAT_ARGB8888);
+            if(entry->draw_buf == NULL) break;
+            entry->outdated = 0;
+            tabview->tab_cache_used += entry->draw_buf->data_size;
+        }
+
+        entry->pinned = 1;
+    }
+
+    if(i < page_cnt) {
+        tab_cache_unpin(tabview);
+        return false;
+    }
+
+    /*Move the content to its final position right away. It's not drawn until the end of the transition*/
+    tabview->in_transition = 1;
+    tabview->trans_outdated = 0;
+    tabview->trans_scroll = scroll_start;
+    tabview->trans_scroll_end = scroll_end;
+    content_hide(obj, true);
+    if(hor) lv_obj_scroll_to_x(cont, scroll_end, LV_ANIM_OFF);
+    else lv_obj_scroll_to_y(cont, scroll_end, LV_ANIM_OFF);
+
+    lv_display_t * disp = lv_obj_get_display(obj);
+    int32_t res = hor ? lv_display_get_horizontal_resolution(disp) : lv_display_get_vertical_resolution(disp);
+
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, obj);
+    lv_anim_set_values(&a, scroll_start, scroll_end);
+    lv_anim_set_exec_cb(&a, transition_anim_exec_cb);
+    lv_anim_set_completed_cb(&a, transition_anim_completed_cb);
+    lv_anim_set_duration(&a, lv_anim_speed_clamped(res >> 1, TRANSITION_TIME_MIN, TRANSITION_TIME_MAX));
+    lv_anim_set_path_cb(&a, lv_anim_path_ease_out);
+    lv_anim_start(&a);
+
+    return true;
+#else
+    LV_UNUSED(obj);
+    LV_UNUSED(hor);
+    LV_UNUSED(scroll_end);
+    return false;
+#endif
+}
+
+/**
+ * Finish the running transition immediately and show the real content
+ * @param obj   pointer to a tabview
+ */
+static void transition_stop(lv_obj_t * obj)
+{
+    lv_tabview_t * tabview = (lv_tabview_t *)obj;
+    if(!tabview->in_transition) return;
+
+    lv_anim_delete(obj, transition_anim_exec_cb);
+    content_hide(obj, false);
+    tabview->in_transition = 0;
+    tab_cache_unpin(tabview);
+}
+
+static void transition_anim_exec_cb(void * var, int32_t v)
+{
+    lv_obj_t * obj = var;
+    lv_tabview_t * tabview = var;
+    lv_obj_t * cont = lv_tabview_get_content(obj);
+
+    if(tabview->trans_outdated) {
+        /*A tab has changed, continue by scrolling the real tabs from the current position*/
+        bool hor = (tabview->tab_pos & LV_DIR_VER) != 0;
+        lv_anim_delete(obj, transition_anim_exec_cb);
+        content_hide(obj, false);
+        if(hor) lv_obj_scroll_to_x(cont, v, LV_ANIM_OFF);
+        else lv_obj_scroll_to_y(cont, v, LV_ANIM_OFF);
+        tabview->in_transition = 0;
+        tab_cache_unpin(tabview);
+
+        if(hor) lv_obj_scroll_to_x(cont, tabview->trans_scroll_end, LV_ANIM_ON);
+        else lv_obj_scroll_to_y(cont, tabview->trans_scroll_end, LV_ANIM_ON);
+        return;
+    }
+
+    tabview->trans_scroll = v;
+    lv_obj_invalidate_area(obj, &cont->coords);
+}
+
+static void transition_anim_completed_cb(lv_anim_t * a)
+{
+    transition_stop(a->var);
+}
+
+static void draw_transition(lv_obj_t * obj, lv_layer_t * layer)
+{
+    lv_tabview_t * tabview = (lv_tabview_t *)obj;
+    lv_obj_t * cont = lv_tabview_get_content(obj);
+
+    lv_area_t clip_area_ori = layer->_clip_area;
+    if(!lv_area_intersect(&layer->_clip_area, &clip_area_ori, &cont->coords)) {
+        layer->_clip_area = clip_area_ori;
+        return;
+    }
+
+    /*Draw the background of the content as it's not drawn now*/
+    lv_draw_rect_dsc_t rect_dsc;
+    lv_draw_rect_dsc_init(&rect_dsc);
+    lv_obj_init_draw_rect_dsc(cont, LV_PART_MAIN, &rect_dsc);
+    lv_draw_rect(layer, &rect_dsc, &cont->coords);
+
+    /*The tabs are at their final position so shift them back to the transition's position*/
+    int32_t ofs = tabview->trans_scroll_end - tabview->trans_scroll;
+    bool hor = (tabview->tab_pos & LV_DIR_VER) != 0;
+
+    lv_draw_image_dsc_t img_dsc;
+    lv_draw_image_dsc_init(&img_dsc);
+
+    lv_tabview_tab_cache_t * entry;
+    LV_LL_READ(&tabview->tab_cache_ll, entry) {
+        if(!entry->pinned || entry->draw_buf == NULL) continue;
+
+        int32_t ext = lv_obj_get_ext_draw_size(entry->page);
+        lv_area_t img_area = entry->page->coords;
+        lv_area_increase(&img_area, ext, ext);
+        if(hor) lv_area_move(&img_area, ofs, 0);
+        else lv_area_move(&img_area, 0, ofs);
+
+        img_dsc.src = entry->draw_buf;
+        lv_draw_image(layer, &img_dsc, &img_area);
+    }
+
+    layer->_clip_area = clip_area_ori;
+}
+
+/**
+ * Skip drawing the content during the transition.
+ * `opa_layered` is used instead of `LV_OBJ_FLAG_HIDDEN` to keep the layout untouched.
+ * The content's own local `opa_layered` is saved and restored when it's shown again.
+ * @param obj   pointer to a tabview
+ * @param hide  true: don't draw the content; false: draw it again
+ */
+static void content_hide(lv_obj_t * obj, bool hide)
+{
+    lv_tabview_t * tabview = (lv_tabview_t *)obj;
+    lv_obj_t * cont = lv_tabview_get_content(obj);
+
+    if(hide) {
+        lv_style_res_t res = lv_obj_get_local_style_prop(cont, LV_STYLE_OPA_LAYERED, &tabview->trans_opa_layered,
+                                                         LV_PART_MAIN);
+        tabview->trans_opa_layered_set = res == LV_STYLE_RES_FOUND;
+        lv_obj_set_style_opa_layered(cont, LV_OPA_TRANSP, LV_PART_MAIN);
+    }
+    else if(tabview->trans_opa_layered_set) {
+        lv_obj_set_local_style_prop(cont, LV_STYLE_OPA_LAYERED, tabview->trans_opa_layered, LV_PART_MAIN);
+    }
+    else {
+        lv_obj_remove_local_style_prop(cont, LV_STYLE_OPA_LAYERED, LV_PART_MAIN);
+    }
+}
+
+static void tab_cache_event_cb(lv_event_t * e)
+{
+    lv_event_code_t code = lv_event_get_code(e);
+    lv_obj_t * page = lv_event_get_current_target(e);
+    lv_tabview_t * tabview = lv_event_get_user_data(e);
+
+    lv_tabview_tab_cache_t * entry;
+    LV_LL_READ(&tabview->tab_cache_ll, entry) {
+        if(entry->page == page) break;
+    }
+    if(entry == NULL) return;
+
+    if(code == LV_EVENT_INVALIDATE_AREA) {
+        if(entry->draw_buf == NULL || entry->outdated) return;
+
+        /*Keep showing the image until the transition switches to the real tabs*/
+        if(entry->pinned) {
+            entry->outdated = 1;
+            tabview->trans_outdated = 1;
+        }
+        else {
+            tab_cache_drop(tabview, entry);
+        }
+    }
+    else if(code == LV_EVENT_DELETE) {
+        if(entry->pinned) tabview->trans_outdated = 1;
+        tab_cache_drop(tabview, entry);
+        lv_ll_remove(&tabview->tab_cache_ll, entry);
+        lv_free(entry);
+    }
+}
+
+static void tab_cache_drop(lv_tabview_t * tabview, lv_tabview_tab_cache_t * entry)
+{
+    if(entry->draw_buf == NULL) return;
+
+    tabview->tab_cache_used -= entry->draw_buf->data_size;
+    lv_draw_buf_destroy(entry->draw_buf);
+    entry->draw_buf = NULL;
+    entry->outdated = 0;
+}
+
+static void tab_cache_remove(lv_tabview_t * tabview, lv_tabview_tab_cache_t * entry)
+{
+    tab_cache_drop(tabview, entry);
+    lv_obj_set_watch_invalidation(entry->page, false);
+    lv_obj_remove_event_cb_with_user_data(entry->page, tab_cache_event_cb, tabview);
+    lv_ll_remove(&tabview->tab_cache_ll, entry);
+    lv_free(entry);
+}
+
+static void tab_cache_unpin(lv_tabview_t * tabview)
+{
+    lv_tabview_tab_cache_t * entry;
+    LV_LL_READ(&tabview->tab_cache_ll, entry) {
+        entry->pinned = 0;
+        if(entry->outdated) tab_cache_drop(tabview, entry);
+    }
+}
+
+/**
+ * Drop the least recently used images until an image of `size` bytes also fits into the cache
+ * @param tabview   pointer to a tabview
+ * @param size      size of the new image in bytes
+ * @return          true: there is enough space; false: the pinned images don't leave enough space
+ */
+static bool tab_cache_make_room(lv_tabview_t * tabview, uint32_t size)
+{
+    if(size > tabview->tab_cache_size) return false;
+
+    lv_tabview_tab_cache_t * entry = lv_ll_get_tail(&tabview->tab_cache_ll);
+    while(entry && tabview->tab_cache_used + size > tabview->tab_cache_size) {
+        if(!entry->pinned) tab_cache_drop(tabview, entry);
+        entry = lv_ll_get_prev(&tabview->tab_cache_ll, entry);
+    }
+
+    return tabview->tab_cache_used + size <= tabview->tab_cache_size;
+}
 #endif /*LV_USE_TABVIEW*/
@@ -74,6 +74,17 @@ void lv_tabview_set_tab_bar_position(lv_obj_t * obj, lv_dir_t dir);
  */
 void lv_tabview_set_tab_bar_size(lv_obj_t * obj, int32_t size);
 
+/**
+ * Keep rendered images of the tabs and slide them during the animated tab changes
+ * instead of redrawing the tabs' widgets in every frame.
+ * A tab's image is dropped when anything is invalidated on the tab.
+ * If the images don't fit into `size` the least recently used ones are dropped.
+ * Requires `LV_USE_SNAPSHOT`.
+ * @param obj       pointer to a tabview widget
+ * @param size      max. size of the cached images in bytes. 0: disable the cache (default)
+ */
+void lv_tabview_set_tab_cache_size(lv_obj_t * obj, uint32_t size);
+
 /**
  * Get the number of tabs
  * @param obj       pointer to a tabview widget
@@ -88,6 +99,13 @@ uint32_t lv_tabview_get_tab_count(lv_obj_t * obj);
  */
 uint32_t lv_tabview_get_tab_active(lv_obj_t * obj);
 
+/**
+ * Get the max. size of the tabs' cached images
+ * @param obj       pointer to a tabview widget
+ * @return          the max. size in bytes. 0: the cache is disabled
+ */
+uint32_t lv_tabview_get_tab_cache_size(lv_obj_t * obj);
+
 /**
  * Get a given tab button by index
  * @param obj       pointer to a tabview widget
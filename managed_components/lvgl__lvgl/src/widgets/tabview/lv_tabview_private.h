@@ -16,6 +16,7 @@ extern "C" {
 
 #include "../../core/lv_obj_private.h"
 #include "lv_tabview.h"
+#include "../../misc/lv_ll.h"
 
 #if LV_USE_TABVIEW
 
@@ -31,10 +32,27 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+/** Rendered image of a tab to slide it without redrawing its widgets */
+typedef struct {
+    lv_obj_t * page;            /**< The tab whose image is stored*/
+    lv_draw_buf_t * draw_buf;   /**< Image of the tab or NULL if it's not cached*/
+    uint8_t pinned : 1;         /**< 1: used by the running transition so it can't be dropped*/
+    uint8_t outdated : 1;       /**< 1: the tab has changed since the image was rendered*/
+} lv_tabview_tab_cache_t;
+
 struct _lv_tabview_t {
     lv_obj_t obj;
     uint32_t tab_cur;
     lv_dir_t tab_pos;
+    lv_ll_t tab_cache_ll;       /**< List of `lv_tabview_tab_cache_t`, the most recently used first*/
+    uint32_t tab_cache_size;    /**< Max. size of the cached images in bytes. 0: disabled*/
+    uint32_t tab_cache_used;    /**< Size of the currently cached images in bytes*/
+    int32_t trans_scroll;       /**< Scroll position shown by the running transition*/
+    int32_t trans_scroll_end;   /**< Scroll position where the transition ends*/
+    lv_style_value_t trans_opa_layered;  /**< The content's local `opa_layered` to restore after the transition*/
+    uint8_t in_transition : 1;  /**< 1: the content is hidden and the tabs' images are slid instead*/
+    uint8_t trans_outdated : 1; /**< 1: a tab used by the transition has changed, continue without the images*/
+    uint8_t trans_opa_layered_set : 1;  /**< 1: the content had a local `opa_layered` before the transition*/
 };
 
 
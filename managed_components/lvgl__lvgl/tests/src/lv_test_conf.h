@@ -22,6 +22,9 @@ extern "C" {
 #define LV_USE_STDLIB_SPRINTF       LV_STDLIB_CLIB
 #define LV_USE_OS                   LV_OS_PTHREAD
 #define LV_OBJ_STYLE_CACHE          0
+#define LV_INDEV_HIT_INDEX          1
+#define LV_OBJ_VISIBILITY_CACHE     1
+#define LV_OBJ_STYLE_DEFERRED_REFRESH 1
 #define LV_BIN_DECODER_RAM_LOAD     1   /* Run test with bin image loaded to RAM */
 #define LV_DRAW_BUF_STRIDE_ALIGN    64  /* Use a large value to be sure any issues will cause crash */
 #endif
@@ -31,6 +34,8 @@ extern "C" {
 #define LV_USE_STDLIB_STRING    LV_STDLIB_BUILTIN
 #define LV_USE_STDLIB_SPRINTF   LV_STDLIB_BUILTIN
 #define LV_OBJ_STYLE_CACHE      1
+#define LV_INDEV_HIT_INDEX      0
+#define LV_OBJ_VISIBILITY_CACHE 1
 #define LV_BIN_DECODER_RAM_LOAD 0
 #endif
 
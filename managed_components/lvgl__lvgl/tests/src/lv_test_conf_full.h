@@ -3,6 +3,7 @@
 
 #define LV_MEM_SIZE                     (32 * 1024 * 1024)
 #define LV_DRAW_SW_SHADOW_CACHE_SIZE    8
+#define LV_DRAW_SW_VECTOR_CACHE_SIZE    (64 * 1024)
 #define LV_DRAW_THREAD_STACK_SIZE    (64 * 1024) /*Increase stack size to 64KB in order to run ThorVG*/
 #define LV_USE_LOG              1
 #define LV_LOG_LEVEL            LV_LOG_LEVEL_TRACE
@@ -106,6 +107,7 @@
 #define LV_USE_SVG              1
 #define LV_USE_SVG_ANIMATION    1
 #define LV_USE_SVG_DEBUG        1
+#define LV_SVG_DOC_CACHE_CNT    16
 #define LV_USE_PROFILER         1
 #define LV_PROFILER_INCLUDE     "lv_profiler_builtin.h"
 #define LV_USE_PROFILER_BUILTIN_POSIX 1
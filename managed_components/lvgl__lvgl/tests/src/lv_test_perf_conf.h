@@ -217,6 +217,13 @@
 
             /** Enable drawing complex gradients in software: linear at an angle, radial or conical */
             #define LV_USE_DRAW_SW_COMPLEX_GRADIENTS    0
+
+            /** Size of the cache for the flattened paths and coverage masks of `lv_draw_vector` in bytes.
+             *  Used only if the vector graphics are rendered without ThorVG.
+             *  Paths which are drawn again with the same scale and rotation are not rasterized again,
+             *  only blended, even if they are moved by whole pixels or their color changes.
+             *  - 0: disables caching */
+            #define LV_DRAW_SW_VECTOR_CACHE_SIZE    (32 * 1024)
         #endif
 
         /*Use TSi's aka (Think Silicon) NemaGFX */
@@ -444,6 +451,24 @@
         /** Add 2 x 32-bit variables to each `lv_obj_t` to speed up getting style properties */
         #define LV_OBJ_STYLE_CACHE      0
 
+        /** Index the children of objects having many children on a grid to find
+         *  the pressed object quickly on dense screens (e.g. large button grids or lists). */
+        #define LV_INDEV_HIT_INDEX      1
+
+        /** Cache the visible area of the ancestors and whether they are hidden in each object
+         *  to make invalidation independent of the depth of the object in the tree.
+         *  Adds 6 x 32-bit variables and a pointer to each `lv_obj_t` */
+        #define LV_OBJ_VISIBILITY_CACHE 1
+
+        /** Maximum time in ms spent in each `lv_timer_handler()` call on deleting the objects
+         *  passed to `lv_obj_delete_incremental()` */
+        #define LV_OBJ_DELETE_INCREMENTAL_TIME  2
+
+        /** Don't refresh the object (layout, children, extra draw size, etc.) when one of its local
+         *  style properties is set, only mark what needs to be refreshed. All the marked objects
+         *  are refreshed once before the next layout update. */
+        #define LV_OBJ_STYLE_DEFERRED_REFRESH   1
+
         /** Add `id` field to `lv_obj_t` */
         #define LV_USE_OBJ_ID           0
 
@@ -533,11 +558,11 @@
         #define LV_ATTRIBUTE_EXTERN_DATA
 
         /** Use `float` as `lv_value_precise_t` */
-        #define LV_USE_FLOAT            0
+        #define LV_USE_FLOAT            1
 
         /** Enable matrix support
         *  - Requires `LV_USE_FLOAT = 1` */
-        #define LV_USE_MATRIX           0
+        #define LV_USE_MATRIX           1
 
         /** Include `lvgl_private.h` in `lvgl.h` to access internal data and functions by default */
         #define LV_USE_PRIVATE_API      0
@@ -571,8 +596,9 @@
         #define LV_FONT_MONTSERRAT_48 0
 
         /* Demonstrate special features */
-        #define LV_FONT_MONTSERRAT_28_COMPRESSED 0  /**< bpp = 3 */
-        #define LV_FONT_DEJAVU_16_PERSIAN_HEBREW 0  /**< Hebrew, Arabic, Persian letters and all their forms */
+        #define LV_FONT_MONTSERRAT_28_COMPRESSED 1  /**< bpp = 3 */
+        #define LV_FONT_DEJAVU_16_PERSIAN_HEBREW 1  /**< Hebrew, Arabic, Persian letters and all their forms */
+        #define LV_FONT_SOURCE_HAN_SANS_SC_16_CJK 1  /**< 1338 most common CJK radicals */
 
         /** Pixel perfect monospaced fonts */
         #define LV_FONT_UNSCII_8  0
@@ -598,11 +624,15 @@
         #define LV_FONT_FMT_TXT_LARGE 0
 
         /** Enables/disables support for compressed fonts. */
-        #define LV_USE_FONT_COMPRESSED 0
+        #define LV_USE_FONT_COMPRESSED 1
 
         /** Enable drawing placeholders when glyph dsc is not found. */
         #define LV_USE_FONT_PLACEHOLDER 1
 
+        /** Number of letters cached per text while resolving glyphs from fallback fonts.
+        *  Used only by fonts having a `fallback`. Must be a power of 2. */
+        #define LV_FONT_FALLBACK_CACHE_SIZE 32
+
         /*=================
         *  TEXT SETTINGS
         *=================*/
@@ -633,7 +663,7 @@
         /** Support bidirectional text. Allows mixing Left-to-Right and Right-to-Left text.
         *  The direction will be processed according to the Unicode Bidirectional Algorithm:
         *  https://www.w3.org/International/articles/inline-bidi-markup/uba-basics */
-        #define LV_USE_BIDI 0
+        #define LV_USE_BIDI 1
         #if LV_USE_BIDI
             /*Set the default direction. Supported values:
             *`LV_BASE_DIR_LTR` Left-to-Right
@@ -644,7 +674,7 @@
 
         /** Enable Arabic/Persian processing
         *  In these languages characters should be replaced with another form based on their position in the text */
-        #define LV_USE_ARABIC_PERSIAN_CHARS 0
+        #define LV_USE_ARABIC_PERSIAN_CHARS 1
 
         /*The control character to use for signaling text recoloring*/
         #define LV_TXT_COLOR_CMD "#"
@@ -832,9 +862,9 @@
         #endif
 
         /** API for memory-mapped file access. */
-        #define LV_USE_FS_MEMFS 0
+        #define LV_USE_FS_MEMFS 1
         #if LV_USE_FS_MEMFS
-            #define LV_FS_MEMFS_LETTER '\0'     /**< Set an upper-case driver-identifier letter for this driver (e.g. 'A'). */
+            #define LV_FS_MEMFS_LETTER 'M'      /**< Set an upper-case driver-identifier letter for this driver (e.g. 'A'). */
         #endif
 
         /** API for LittleFs. */
@@ -913,11 +943,17 @@
         #endif
 
         /** Built-in TTF decoder */
-        #define LV_USE_TINY_TTF 0
+        #define LV_USE_TINY_TTF 1
         #if LV_USE_TINY_TTF
             /* Enable loading TTF data from files */
             #define LV_TINY_TTF_FILE_SUPPORT 0
             #define LV_TINY_TTF_CACHE_GLYPH_CNT 256
+            #define LV_TINY_TTF_CACHE_KERNING_CNT 256
+            /** Size of the glyph bitmap cache shared by all Tiny TTF fonts and sizes [bytes] */
+            #define LV_TINY_TTF_CACHE_BITMAP_SIZE (128 * 1024)
+            /** Gamma applied to the rasterized glyph coverage, in hundredths.
+            *  100: linear coverage (no correction); >100: darker, heavier anti-aliased edges. */
+            #define LV_TINY_TTF_GAMMA 100
         #endif
 
         /** Rlottie library */
@@ -925,7 +961,7 @@
 
         /** Enable Vector Graphic APIs
         *  - Requires `LV_USE_MATRIX = 1` */
-        #define LV_USE_VECTOR_GRAPHIC  0
+        #define LV_USE_VECTOR_GRAPHIC  1
 
         /** Enable ThorVG (vector graphics library) from the src/libs folder */
         #define LV_USE_THORVG_INTERNAL 0
@@ -941,9 +977,14 @@
 
         /*SVG library
         *  - Requires `LV_USE_VECTOR_GRAPHIC = 1` */
-        #define LV_USE_SVG 0
+        #define LV_USE_SVG 1
         #define LV_USE_SVG_ANIMATION 0
         #define LV_USE_SVG_DEBUG 0
+        /** Number of parsed SVG documents to keep, keyed by their source.
+        *  Opening an already parsed SVG again (e.g. the same icon on many images or
+        *  redrawing it with the image cache disabled) shares its render list instead of parsing it again.
+        *  0 to disable. */
+        #define LV_SVG_DOC_CACHE_CNT 16
 
         /** FFmpeg library for image decoding and playing videos.
         *  Supports all major image formats so do not enable other image decoder with it. */
@@ -963,7 +1004,7 @@
         /* Documentation for several of the below items can be found here: https://docs.lvgl.io/master/others/index.html . */
 
         /** 1: Enable API to take snapshot for object */
-        #define LV_USE_SNAPSHOT 0
+        #define LV_USE_SNAPSHOT 1
 
         /** 1: Enable system monitor component */
         #define LV_USE_SYSMON   1
@@ -1256,7 +1297,7 @@
         ====================*/
 
         /** Show some widgets. This might be required to increase `LV_MEM_SIZE`. */
-        #define LV_USE_DEMO_WIDGETS 0
+        #define LV_USE_DEMO_WIDGETS 1
 
         /** Demonstrate usage of encoder and keyboard. */
         #define LV_USE_DEMO_KEYPAD_AND_ENCODER 0
@@ -189,7 +189,9 @@ const lv_image_dsc_t test_animimg001 = {
     .header.h = 170,
     .header.stride = 520,
     .header.cf = LV_COLOR_FORMAT_ARGB8888,
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
     .data = test_animimg001_map,
+    .data_size = sizeof(test_animimg001_map),
 };
 
 #endif /* LV_BUILD_TEST */
@@ -295,6 +295,75 @@ void test_rotate270_L8(void)
     TEST_ASSERT_EQUAL_UINT8_ARRAY(expectedArray, dstArray, sizeof(dstArray));
 }
 
+/*Rotate pixel by pixel to compare the optimized rotations with it*/
+static void rotate_ref(const uint8_t * src, uint8_t * dst, int32_t src_width, int32_t src_height,
+                       int32_t src_stride, int32_t dst_stride, lv_display_rotation_t rotation, uint32_t px_size)
+{
+    for(int32_t y = 0; y < src_height; y++) {
+        for(int32_t x = 0; x < src_width; x++) {
+            int32_t dst_x;
+            int32_t dst_y;
+            if(rotation == LV_DISPLAY_ROTATION_90) {
+                dst_x = y;
+                dst_y = src_width - x - 1;
+            }
+            else if(rotation == LV_DISPLAY_ROTATION_180) {
+                dst_x = src_width - x - 1;
+                dst_y = src_height - y - 1;
+            }
+            else {
+                dst_x = src_height - y - 1;
+                dst_y = x;
+            }
+            lv_memcpy(dst + dst_y * dst_stride + dst_x * px_size, src + y * src_stride + x * px_size, px_size);
+        }
+    }
+}
+
+void test_rotate_compare_with_reference(void)
+{
+    /*Sizes not divisible by the block size and by the 4 and 2 pixel groups*/
+    static const int32_t sizes[][2] = {{1, 1}, {3, 5}, {4, 4}, {37, 70}, {67, 33}, {64, 64}, {101, 45}};
+    static const lv_color_format_t cfs[] = {LV_COLOR_FORMAT_L8, LV_COLOR_FORMAT_RGB565, LV_COLOR_FORMAT_RGB888, LV_COLOR_FORMAT_ARGB8888};
+    static const lv_display_rotation_t rotations[] = {LV_DISPLAY_ROTATION_90, LV_DISPLAY_ROTATION_180, LV_DISPLAY_ROTATION_270};
+    static uint8_t src_buf[128 * 4 * 128];
+    static uint8_t dst_buf[128 * 4 * 128];
+    static uint8_t ref_buf[128 * 4 * 128];
+
+    uint32_t rnd = 1;
+    for(uint32_t i = 0; i < sizeof(src_buf); i++) {
+        rnd = rnd * 1103515245 + 12345;
+        src_buf[i] = (uint8_t)(rnd >> 16);
+    }
+
+    for(uint32_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        for(uint32_t c = 0; c < sizeof(cfs) / sizeof(cfs[0]); c++) {
+            for(uint32_t r = 0; r < sizeof(rotations) / sizeof(rotations[0]); r++) {
+                /*Test tight and padded strides with aligned and unaligned buffers*/
+                for(uint32_t pad = 0; pad < 3; pad++) {
+                    int32_t w = sizes[s][0];
+                    int32_t h = sizes[s][1];
+                    uint32_t px_size = lv_color_format_get_size(cfs[c]);
+                    bool swap = rotations[r] != LV_DISPLAY_ROTATION_180;
+                    int32_t dst_w = swap ? h : w;
+                    int32_t dst_h = swap ? w : h;
+                    int32_t src_stride = w * px_size + pad * 4;
+                    int32_t dst_stride = dst_w * px_size + pad * 4;
+                    uint32_t ofs = pad == 2 ? px_size : 0;
+                    uint32_t dst_size = dst_stride * dst_h + ofs;
+
+                    lv_memset(dst_buf, 0xcd, dst_size);
+                    lv_memset(ref_buf, 0xcd, dst_size);
+                    lv_draw_sw_rotate(src_buf + ofs, dst_buf + ofs, w, h, src_stride, dst_stride, rotations[r], cfs[c]);
+                    rotate_ref(src_buf + ofs, ref_buf + ofs, w, h, src_stride, dst_stride, rotations[r], px_size);
+
+                    TEST_ASSERT_EQUAL_UINT8_ARRAY(ref_buf, dst_buf, dst_size);
+                }
+            }
+        }
+    }
+}
+
 void test_invert(void)
 {
     uint8_t expected_buf[10] = {0xff, 0xfe, 0xfd, 0xfc, 0xfb, 0xfa, 0xf9, 0xf8, 0xf7, 0xf6};
@@ -0,0 +1,626 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+/*Render the same scenes with ThorVG and with the built-in rasterizer and compare the results*/
+#if LV_USE_VECTOR_GRAPHIC && LV_USE_THORVG
+
+#define CANVAS_W    320
+#define CANVAS_H    240
+
+/*A pixel is different if any of its channels differs more than this*/
+#define PX_DIFF_LIMIT   64
+
+static lv_draw_buf_t * tvg_buf;
+static lv_draw_buf_t * native_buf;
+typedef void (*scene_cb_t)(lv_draw_vector_dsc_t * dsc);
+
+static const lv_area_t canvas_area = {0, 0, CANVAS_W - 1, CANVAS_H - 1};
+
+void setUp(void)
+{
+    tvg_buf = lv_draw_buf_create(CANVAS_W, CANVAS_H, LV_COLOR_FORMAT_ARGB8888, LV_STRIDE_AUTO);
+    native_buf = lv_draw_buf_create(CANVAS_W, CANVAS_H, LV_COLOR_FORMAT_ARGB8888, LV_STRIDE_AUTO);
+}
+
+void tearDown(void)
+{
+    lv_draw_buf_destroy(tvg_buf);
+    lv_draw_buf_destroy(native_buf);
+}
+
+static void compare_bufs(const char * name, const lv_area_t * area);
+
+static void render(scene_cb_t scene, lv_draw_buf_t * buf, bool native, lv_opa_t opa, const lv_area_t * clip_area)
+{
+    /*Opaque background to compare only the colors*/
+    uint32_t y;
+    for(y = 0; y < buf->header.h; y++) {
+        lv_memset(buf->data + y * buf->header.stride, 0xff, buf->header.w * lv_color_format_get_size(buf->header.cf));
+    }
+
+    lv_area_t area = {0, 0, buf->header.w - 1, buf->header.h - 1};
+    lv_layer_t layer;
+    lv_memzero(&layer, sizeof(layer));
+    layer.draw_buf = buf;
+    layer.color_format = buf->header.cf;
+    layer.buf_area = area;
+    layer._clip_area = area;
+    layer.phy_clip_area = area;
+
+    lv_draw_vector_dsc_t * dsc = lv_draw_vector_dsc_create(&layer);
+    scene(dsc);
+
+    lv_draw_task_t t;
+    lv_memzero(&t, sizeof(t));
+    t.type = LV_DRAW_TASK_TYPE_VECTOR;
+    t.target_layer = &layer;
+    t.area = area;
+    t.clip_area = clip_area ? *clip_area : area;
+    t.opa = opa;
+    t.draw_dsc = dsc;
+
+    if(native) lv_draw_sw_vector_native(&t, dsc);
+    else lv_draw_sw_vector(&t, dsc);
+
+    lv_draw_vector_dsc_delete(dsc);
+}
+
+/**
+ * Compare the two renderings.
+ * The anti-aliased edges of the two renderers are slightly different,
+ * so only a few differing pixels and a small average difference are accepted.
+ */
+static void compare(scene_cb_t scene, lv_opa_t opa, const char * name)
+{
+    render(scene, tvg_buf, false, opa, NULL);
+    render(scene, native_buf, true, opa, NULL);
+    compare_bufs(name, &canvas_area);
+}
+
+static void compare_bufs(const char * name, const lv_area_t * area)
+{
+    uint32_t diff_px_cnt = 0;
+    uint64_t diff_sum = 0;
+    int32_t x, y;
+    for(y = area->y1; y <= area->y2; y++) {
+        const uint8_t * a = tvg_buf->data + y * tvg_buf->header.stride;
+        const uint8_t * b = native_buf->data + y * native_buf->header.stride;
+        for(x = area->x1 * 4; x <= area->x2 * 4; x += 4) {
+            int32_t d = 0;
+            int32_t c;
+            for(c = 0; c < 3; c++) d = LV_MAX(d, LV_ABS(a[x + c] - b[x + c]));
+            diff_sum += d;
+            if(d > PX_DIFF_LIMIT) diff_px_cnt++;
+        }
+    }
+
+    uint32_t px_cnt = lv_area_get_size(area);
+    char msg[128];
+    lv_snprintf(msg, sizeof(msg), "%s: %" LV_PRIu32 " different pixels, average difference %" LV_PRIu32 "/1000",
+                name, diff_px_cnt, (uint32_t)(diff_sum * 1000 / px_cnt));
+
+    TEST_ASSERT_LESS_THAN_MESSAGE(px_cnt / 200, diff_px_cnt, msg);
+    TEST_ASSERT_LESS_THAN_MESSAGE(3000, diff_sum * 1000 / px_cnt, msg);
+}
+
+static void assert_untouched_outside(const lv_draw_buf_t * buf, const lv_area_t * area)
+{
+    int32_t x, y;
+    for(y = 0; y < CANVAS_H; y++) {
+        const uint32_t * px = (const uint32_t *)(buf->data + y * buf->header.stride);
+        for(x = 0; x < CANVAS_W; x++) {
+            if(lv_area_is_point_on(area, &(lv_point_t) {
+            x, y
+        }, 0)) continue;
+            TEST_ASSERT_EQUAL_HEX32(0xffffffff, px[x]);
+        }
+    }
+}
+
+static void scene_fill(lv_draw_vector_dsc_t * dsc)
+{
+    lv_vector_path_t * path = lv_vector_path_create(LV_VECTOR_PATH_QUALITY_MEDIUM);
+
+    lv_area_t rect = {0, 0, 120, 100};
+    lv_draw_vector_dsc_set_fill_color(dsc, lv_color_hex(0xc0c0c0));
+    lv_draw_vector_dsc_clear_area(dsc, &rect);
+
+    rect = (lv_area_t) {
+        10, 10, 80, 60
+    };
+    lv_vector_path_append_rect(path, &rect, 0, 0);
+    lv_draw_vector_dsc_set_fill_color(dsc, lv_color_hex(0xff0000));
+    lv_draw_vector_dsc_add_path(dsc, path);
+
+    lv_vector_path_clear(path);
+    rect = (lv_area_t) {
+        100, 10, 190, 70
+    };
+    lv_vector_path_append_rect(path, &rect, 15, 15);
+    lv_draw_vector_dsc_set_fill_color(dsc, lv_color_hex(0x0000ff));
+    lv_draw_vector_dsc_add_path(dsc, path);
+
+    /*Semi transparent circle overlapping the rectangle*/
+    lv_vector_path_clear(path);
+    lv_fpoint_t c = {190, 70};
+    lv_vector_path_append_circle(path, &c, 40, 40);
+    lv_draw_vector_dsc_set_fill_color32(dsc, lv_color_to_32(lv_color_hex(0x00ff00), 0x80));
+    lv_draw_vector_dsc_add_path(dsc, path);
+
+    /*A star: the center is filled only with the non-zero rule*/
+    lv_fpoint_t star[5] = {{60, 110}, {90, 200}, {15, 145}, {105, 145}, {30, 200}};
+    lv_vector_path_clear(path);
+    lv_vector_path_move_to(path, &star[0]);
+    uint32_t i;
+    for(i = 1; i < 5; i++) lv_vector_path_line_to(path, &star[i]);
+    lv_vector_path_close(path);
+    lv_draw_vector_dsc_set_fill_color(dsc, lv_color_hex(0x800080));
+    lv_draw_vector_dsc_set_fill_rule(dsc, LV_VECTOR_FILL_NONZERO);
+    lv_draw_vector_dsc_add_path(dsc, path);
+
+    lv_draw_vector_dsc_translate(dsc, 100, 0);
+    lv_draw_vector_dsc_set_fill_rule(dsc, LV_VECTOR_FILL_EVENODD);
+    lv_draw_vector_dsc_add_path(dsc, path);
+
+    /*A ring by a hole*/
+    lv_vector_path_clear(path);
+    rect = (lv_area_t) {
+        120, 0, 200, 80
+    };
+    lv_vector_path_append_rect(path, &rect, 20, 20);
+    rect = (lv_area_t) {
+        140, 20, 180, 60
+    };
+    lv_vector_path_append_rect(path, &rect, 10, 10);
+    lv_draw_vector_dsc_translate(dsc, 0, 120);
+    lv_draw_vector_dsc_set_fill_color(dsc, lv_color_hex(0x008080));
+    lv_draw_vector_dsc_add_path(dsc, path);
+
+    /*Curves*/
+    lv_draw_vector_dsc_identity(dsc);
+    lv_draw_vector_dsc_set_fill_rule(dsc, LV_VECTOR_FILL_NONZERO);
+    lv_vector_path_clear(path);
+    lv_fpoint_t p0 = {220, 100};
+    lv_fpoint_t q1 = {320, 100};
+    lv_fpoint_t q2 = {300, 180};
+    lv_fpoint_t c1 = {260, 260};
+    lv_fpoint_t c2 = {180, 120};
+    lv_fpoint_t c3 = {220, 100};
+    lv_vector_path_move_to(path, &p0);
+    lv_vector_path_quad_to(path, &q1, &q2);
+    lv_vector_path_cubic_to(path, &c1, &c2, &c3);
+    lv_vector_path_close(path);
+    lv_draw_vector_dsc_set_fill_color(dsc, lv_color_hex(0xff8000));
+    lv_draw_vector_dsc_add_path(dsc, path);
+
+    lv_vector_path_delete(path);
+}
+
+static void scene_stroke(lv_draw_vector_dsc_t * dsc)
+{
+    lv_vector_path_t * path = lv_vector_path_create(LV_VECTOR_PATH_QUALITY_MEDIUM);
+    lv_draw_vector_dsc_set_fill_opa(dsc, LV_OPA_TRANSP);
+    lv_draw_vector_dsc_set_stroke_opa(dsc, LV_OPA_COVER);
+    lv_draw_vector_dsc_set_stroke_color(dsc, lv_color_hex(0x000000));
+
+    /*Thin and thick lines*/
+    float widths[] = {1, 3, 6};
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        lv_fpoint_t a = {10, 10 + i * 12.0f};
+        lv_fpoint_t b = {150, 20 + i * 14.0f};
+        lv_vector_path_clear(path);
+        lv_vector_path_move_to(path, &a);
+        lv_vector_path_line_to(path, &b);
+        lv_draw_vector_dsc_set_stroke_width(dsc, widths[i]);
+        lv_draw_vector_dsc_add_path(dsc, path);
+    }
+
+    /*Joins*/
+    lv_fpoint_t zigzag[] = {{10, 130}, {40, 80}, {60, 130}, {75, 90}};
+    lv_vector_path_clear(path);
+    lv_vector_path_move_to(path, &zigzag[0]);
+    for(i = 1; i < 4; i++) lv_vector_path_line_to(path, &zigzag[i]);
+    lv_draw_vector_dsc_set_stroke_width(dsc, 10);
+    lv_draw_vector_dsc_set_stroke_color(dsc, lv_color_hex(0x0000ff));
+    lv_vector_stroke_join_t joins[] = {LV_VECTOR_STROKE_JOIN_MITER, LV_VECTOR_STROKE_JOIN_BEVEL, LV_VECTOR_STROKE_JOIN_ROUND};
+    for(i = 0; i < 3; i++) {
+        lv_draw_vector_dsc_set_stroke_join(dsc, joins[i]);
+        lv_draw_vector_dsc_add_path(dsc, path);
+        lv_draw_vector_dsc_translate(dsc, 80, 0);
+    }
+
+    /*Caps*/
+    lv_draw_vector_dsc_identity(dsc);
+    lv_draw_vector_dsc_set_stroke_join(dsc, LV_VECTOR_STROKE_JOIN_MITER);
+    lv_fpoint_t line[] = {{20, 160}, {100, 160}};
+    lv_vector_path_clear(path);
+    lv_vector_path_move_to(path, &line[0]);
+    lv_vector_path_line_to(path, &line[1]);
+    lv_draw_vector_dsc_set_stroke_color(dsc, lv_color_hex(0xff0000));
+    lv_vector_stroke_cap_t caps[] = {LV_VECTOR_STROKE_CAP_BUTT, LV_VECTOR_STROKE_CAP_SQUARE, LV_VECTOR_STROKE_CAP_ROUND};
+    for(i = 0; i < 3; i++) {
+        lv_draw_vector_dsc_set_stroke_cap(dsc, caps[i]);
+        lv_draw_vector_dsc_add_path(dsc, path);
+        lv_draw_vector_dsc_translate(dsc, 0, 25);
+    }
+
+    /*Dashes on a closed curve*/
+    lv_draw_vector_dsc_identity(dsc);
+    lv_draw_vector_dsc_set_stroke_cap(dsc, LV_VECTOR_STROKE_CAP_BUTT);
+    lv_draw_vector_dsc_set_stroke_width(dsc, 4);
+    float dashes[] = {12, 6, 3, 6};
+    lv_draw_vector_dsc_set_stroke_dash(dsc, dashes, 4);
+    lv_vector_path_clear(path);
+    lv_fpoint_t c = {230, 170};
+    lv_vector_path_append_circle(path, &c, 50, 40);
+    lv_draw_vector_dsc_set_stroke_color(dsc, lv_color_hex(0x008000));
+    lv_draw_vector_dsc_add_path(dsc, path);
+
+    /*Stroked and filled, rotated rectangle*/
+    lv_draw_vector_dsc_set_stroke_dash(dsc, NULL, 0);
+    lv_draw_vector_dsc_set_fill_opa(dsc, LV_OPA_COVER);
+    lv_draw_vector_dsc_set_fill_color(dsc, lv_color_hex(0xffff00));
+    lv_draw_vector_dsc_set_stroke_color(dsc, lv_color_hex(0x800000));
+    lv_draw_vector_dsc_translate(dsc, 200, 60);
+    lv_draw_vector_dsc_rotate(dsc, 30);
+    lv_draw_vector_dsc_scale(dsc, 1.5f, 0.8f);
+    lv_area_t rect = {-30, -20, 30, 20};
+    lv_vector_path_clear(path);
+    lv_vector_path_append_rect(path, &rect, 0, 0);
+    lv_draw_vector_dsc_add_path(dsc, path);
+
+    lv_vector_path_delete(path);
+}
+
+static void scene_gradient(lv_draw_vector_dsc_t * dsc)
+{
+    lv_vector_path_t * path = lv_vector_path_create(LV_VECTOR_PATH_QUALITY_MEDIUM);
+
+    lv_grad_stop_t stops[2];
+    lv_memzero(stops, sizeof(stops));
+    stops[0].color = lv_color_hex(0xff0000);
+    stops[0].opa = LV_OPA_COVER;
+    stops[0].frac = 0;
+    stops[1].color = lv_color_hex(0x0000ff);
+    stops[1].opa = LV_OPA_COVER;
+    stops[1].frac = 255;
+
+    lv_vector_gradient_spread_t spreads[] = {LV_VECTOR_GRADIENT_SPREAD_PAD, LV_VECTOR_GRADIENT_SPREAD_REPEAT, LV_VECTOR_GRADIENT_SPREAD_REFLECT};
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        lv_area_t rect = {10 + i * 100, 10, 100 + i * 100, 100};
+        lv_vector_path_clear(path);
+        lv_vector_path_append_rect(path, &rect, 10, 10);
+        lv_draw_vector_dsc_set_fill_linear_gradient(dsc, rect.x1 + 30, rect.y1 + 20, rect.x1 + 60, rect.y1 + 40);
+        lv_draw_vector_dsc_set_fill_gradient_color_stops(dsc, stops, 2);
+        lv_draw_vector_dsc_set_fill_gradient_spread(dsc, spreads[i]);
+        lv_draw_vector_dsc_add_path(dsc, path);
+
+        rect.y1 += 110;
+        rect.y2 += 110;
+        lv_vector_path_clear(path);
+        lv_vector_path_append_rect(path, &rect, 0, 0);
+        lv_draw_vector_dsc_set_fill_radial_gradient(dsc, rect.x1 + 45, rect.y1 + 45, 25);
+        lv_draw_vector_dsc_add_path(dsc, path);
+    }
+
+    lv_vector_path_delete(path);
+}
+
+static void scene_gradient_transform(lv_draw_vector_dsc_t * dsc)
+{
+    lv_vector_path_t * path = lv_vector_path_create(LV_VECTOR_PATH_QUALITY_MEDIUM);
+
+    lv_grad_stop_t stops[2];
+    lv_memzero(stops, sizeof(stops));
+    stops[0].color = lv_color_hex(0xffffff);
+    stops[0].opa = LV_OPA_COVER;
+    stops[0].frac = 0;
+    stops[1].color = lv_color_hex(0x000080);
+    stops[1].opa = LV_OPA_COVER;
+    stops[1].frac = 255;
+
+    /*Transformed gradient on a transformed path*/
+    lv_matrix_t mt;
+    lv_matrix_identity(&mt);
+    lv_matrix_rotate(&mt, 20);
+    lv_matrix_scale(&mt, 1.0f, 0.5f);
+    lv_draw_vector_dsc_set_fill_transform(dsc, &mt);
+    lv_draw_vector_dsc_translate(dsc, 40, 20);
+    lv_draw_vector_dsc_skew(dsc, 10, 0);
+
+    lv_area_t rect = {0, 0, 150, 100};
+    lv_vector_path_append_rect(path, &rect, 20, 20);
+    lv_draw_vector_dsc_set_fill_radial_gradient(dsc, 75, 100, 80);
+    lv_draw_vector_dsc_set_fill_gradient_color_stops(dsc, stops, 2);
+    lv_draw_vector_dsc_set_fill_gradient_spread(dsc, LV_VECTOR_GRADIENT_SPREAD_REFLECT);
+    lv_draw_vector_dsc_add_path(dsc, path);
+
+    /*Gradient stroke. ThorVG ignores the opacity of gradient fills so use a solid fill*/
+    lv_draw_vector_dsc_identity(dsc);
+    lv_draw_vector_dsc_set_fill_color(dsc, lv_color_white());
+    lv_draw_vector_dsc_set_fill_opa(dsc, LV_OPA_TRANSP);
+    lv_draw_vector_dsc_set_stroke_opa(dsc, LV_OPA_COVER);
+    lv_draw_vector_dsc_set_stroke_width(dsc, 12);
+    lv_matrix_identity(&mt);
+    lv_draw_vector_dsc_set_stroke_transform(dsc, &mt);
+    lv_draw_vector_dsc_set_stroke_linear_gradient(dsc, 60, 0, 260, 0);
+    lv_draw_vector_dsc_set_stroke_gradient_color_stops(dsc, stops, 2);
+    lv_draw_vector_dsc_set_stroke_gradient_spread(dsc, LV_VECTOR_GRADIENT_SPREAD_PAD);
+    lv_vector_path_clear(path);
+    lv_fpoint_t c = {160, 180};
+    lv_vector_path_append_circle(path, &c, 100, 40);
+    lv_draw_vector_dsc_add_path(dsc, path);
+
+    lv_vector_path_delete(path);
+}
+
+static void scene_pattern(lv_draw_vector_dsc_t * dsc)
+{
+    lv_vector_path_t * path = lv_vector_path_create(LV_VECTOR_PATH_QUALITY_MEDIUM);
+
+    LV_IMAGE_DECLARE(test_image_cogwheel_argb8888);
+    lv_draw_image_dsc_t img_dsc;
+    lv_draw_image_dsc_init(&img_dsc);
+    img_dsc.header = test_image_cogwheel_argb8888.header;
+    img_dsc.src = &test_image_cogwheel_argb8888;
+
+    /*Image relative to the bounding box of the path*/
+    lv_fpoint_t c = {70, 70};
+    lv_vector_path_append_circle(path, &c, 50, 50);
+    lv_draw_vector_dsc_set_fill_image(dsc, &img_dsc);
+    lv_draw_vector_dsc_set_fill_units(dsc, LV_VECTOR_FILL_UNITS_OBJECT_BOUNDING_BOX);
+    lv_draw_vector_dsc_add_path(dsc, path);
+
+    /*Image in the path's space*/
+    lv_vector_path_clear(path);
+    lv_area_t rect = {150, 20, 300, 200};
+    lv_vector_path_append_rect(path, &rect, 0, 0);
+    lv_matrix_t mt;
+    lv_matrix_identity(&mt);
+    lv_matrix_translate(&mt, 170, 50);
+    lv_draw_vector_dsc_set_fill_units(dsc, LV_VECTOR_FILL_UNITS_USER_SPACE_ON_USE);
+    lv_draw_vector_dsc_set_fill_transform(dsc, &mt);
+    lv_draw_vector_dsc_add_path(dsc, path);
+
+    lv_vector_path_delete(path);
+}
+
+static const lv_area_t scissor_area = {30, 40, 250, 200};
+
+static void scene_clip(lv_draw_vector_dsc_t * dsc)
+{
+    lv_vector_path_t * path = lv_vector_path_create(LV_VECTOR_PATH_QUALITY_HIGH);
+
+    /*Larger than the canvas*/
+    lv_fpoint_t c = {160, 120};
+    lv_vector_path_append_circle(path, &c, 250, 200);
+    lv_draw_vector_dsc_set_fill_color(dsc, lv_color_hex(0x4080c0));
+    lv_draw_vector_dsc_set_stroke_opa(dsc, LV_OPA_COVER);
+    lv_draw_vector_dsc_set_stroke_width(dsc, 20);
+    lv_draw_vector_dsc_add_path(dsc, path);
+
+    lv_vector_path_clear(path);
+    lv_area_t rect = {-50, 100, 400, 150};
+    lv_vector_path_append_rect(path, &rect, 0, 0);
+    lv_draw_vector_dsc_set_fill_color(dsc, lv_color_hex(0xc04080));
+    lv_draw_vector_dsc_add_path(dsc, path);
+
+    lv_vector_path_delete(path);
+}
+
+static void scene_scissor(lv_draw_vector_dsc_t * dsc)
+{
+    dsc->ctx->scissor_area = scissor_area;
+    scene_clip(dsc);
+}
+
+void test_vector_native_fill(void)
+{
+    compare(scene_fill, LV_OPA_COVER, "fill");
+}
+
+void test_vector_native_stroke(void)
+{
+    compare(scene_stroke, LV_OPA_COVER, "stroke");
+}
+
+void test_vector_native_gradient(void)
+{
+    compare(scene_gradient, LV_OPA_COVER, "gradient");
+    compare(scene_gradient_transform, LV_OPA_COVER, "gradient_transform");
+}
+
+void test_vector_native_clip(void)
+{
+    /*Shapes larger than the clip area. ThorVG doesn't limit the drawing to
+     *the clip area, so compare only inside the clip area*/
+    render(scene_clip, tvg_buf, false, LV_OPA_COVER, NULL);
+    render(scene_clip, native_buf, true, LV_OPA_COVER, &scissor_area);
+    compare_bufs("clip", &scissor_area);
+    assert_untouched_outside(native_buf, &scissor_area);
+
+    /*The scissor area should clip the same way*/
+    render(scene_scissor, native_buf, true, LV_OPA_COVER, NULL);
+    compare_bufs("scissor", &scissor_area);
+    assert_untouched_outside(native_buf, &scissor_area);
+}
+
+void test_vector_native_pattern(void)
+{
+    compare(scene_pattern, LV_OPA_COVER, "pattern");
+}
+
+void test_vector_native_opa(void)
+{
+    compare(scene_fill, LV_OPA_50, "fill_opa");
+    compare(scene_stroke, LV_OPA_70, "stroke_opa");
+}
+
+void test_vector_native_rgb888(void)
+{
+    /*The same colors should be rendered to RGB888 as to ARGB8888*/
+    lv_draw_buf_t * rgb_buf = lv_draw_buf_create(CANVAS_W, CANVAS_H, LV_COLOR_FORMAT_RGB888, LV_STRIDE_AUTO);
+    render(scene_fill, native_buf, true, LV_OPA_COVER, NULL);
+    render(scene_fill, rgb_buf, true, LV_OPA_COVER, NULL);
+
+    int32_t x, y;
+    uint32_t max_diff = 0;
+    for(y = 0; y < CANVAS_H; y++) {
+        const uint8_t * a = native_buf->data + y * native_buf->header.stride;
+        const uint8_t * b = rgb_buf->data + y * rgb_buf->header.stride;
+        for(x = 0; x < CANVAS_W; x++) {
+            uint32_t c;
+            for(c = 0; c < 3; c++) max_diff = LV_MAX(max_diff, (uint32_t)LV_ABS(a[x * 4 + c] - b[x * 3 + c]));
+        }
+    }
+    TEST_ASSERT_LESS_OR_EQUAL(4, max_diff);
+
+    lv_draw_buf_destroy(rgb_buf);
+}
+
+#if LV_DRAW_SW_VECTOR_CACHE_SIZE > 0
+
+static float icon_x;
+static float icon_y;
+static lv_color_t icon_color;
+
+static void scene_icons(lv_draw_vector_dsc_t * dsc)
+{
+    lv_vector_path_t * path = lv_vector_path_create(LV_VECTOR_PATH_QUALITY_MEDIUM);
+    lv_draw_vector_dsc_translate(dsc, icon_x, icon_y);
+
+    /*Filled star*/
+    lv_fpoint_t star[5] = {{30, 0}, {48, 55}, {0, 20}, {60, 20}, {12, 55}};
+    lv_vector_path_move_to(path, &star[0]);
+    uint32_t i;
+    for(i = 1; i < 5; i++) lv_vector_path_line_to(path, &star[i]);
+    lv_vector_path_close(path);
+    lv_draw_vector_dsc_set_fill_color(dsc, icon_color);
+    lv_draw_vector_dsc_add_path(dsc, path);
+
+    /*Dashed ring with round caps*/
+    lv_vector_path_clear(path);
+    lv_fpoint_t c = {110, 30};
+    lv_vector_path_append_circle(path, &c, 25, 25);
+    float dashes[] = {10, 6};
+    lv_draw_vector_dsc_set_fill_opa(dsc, LV_OPA_TRANSP);
+    lv_draw_vector_dsc_set_stroke_opa(dsc, LV_OPA_COVER);
+    lv_draw_vector_dsc_set_stroke_color(dsc, icon_color);
+    lv_draw_vector_dsc_set_stroke_width(dsc, 5);
+    lv_draw_vector_dsc_set_stroke_cap(dsc, LV_VECTOR_STROKE_CAP_ROUND);
+    lv_draw_vector_dsc_set_stroke_dash(dsc, dashes, 2);
+    lv_draw_vector_dsc_add_path(dsc, path);
+
+    /*Rounded rectangle with a gradient*/
+    lv_grad_stop_t stops[2];
+    lv_memzero(stops, sizeof(stops));
+    stops[0].color = icon_color;
+    stops[0].opa = LV_OPA_COVER;
+    stops[0].frac = 0;
+    stops[1].color = lv_color_hex(0x000000);
+    stops[1].opa = LV_OPA_COVER;
+    stops[1].frac = 255;
+
+    lv_vector_path_clear(path);
+    lv_area_t rect = {150, 0, 210, 60};
+    lv_vector_path_append_rect(path, &rect, 12, 12);
+    lv_draw_vector_dsc_set_stroke_opa(dsc, LV_OPA_TRANSP);
+    lv_draw_vector_dsc_set_fill_opa(dsc, LV_OPA_COVER);
+    lv_draw_vector_dsc_set_fill_linear_gradient(dsc, 150, 0, 210, 60);
+    lv_draw_vector_dsc_set_fill_gradient_color_stops(dsc, stops, 2);
+    lv_draw_vector_dsc_add_path(dsc, path);
+
+    lv_vector_path_delete(path);
+}
+
+void test_vector_native_cache(void)
+{
+    lv_cache_t * cache = LV_GLOBAL_DEFAULT()->sw_vector_cache;
+    TEST_ASSERT_NOT_NULL(cache);
+    lv_draw_sw_vector_native_cache_drop_all();
+    TEST_ASSERT_EQUAL(0, lv_cache_get_size(cache, NULL));
+
+    icon_x = 10;
+    icon_y = 10;
+    icon_color = lv_color_hex(0xff0000);
+    render(scene_icons, native_buf, true, LV_OPA_COVER, NULL);
+    size_t size = lv_cache_get_size(cache, NULL);
+    TEST_ASSERT_GREATER_THAN(0, size);
+
+    /*Moved by whole pixels and recolored: nothing new is cached*/
+    icon_x = 97;
+    icon_y = 150;
+    icon_color = lv_color_hex(0x0080ff);
+    render(scene_icons, tvg_buf, false, LV_OPA_COVER, NULL);
+    render(scene_icons, native_buf, true, LV_OPA_COVER, NULL);
+    compare_bufs("cache_moved", &canvas_area);
+    TEST_ASSERT_EQUAL(size, lv_cache_get_size(cache, NULL));
+
+    /*Partially out of the clip area*/
+    icon_x = -30;
+    icon_y = 200;
+    render(scene_icons, tvg_buf, false, LV_OPA_COVER, NULL);
+    render(scene_icons, native_buf, true, LV_OPA_COVER, NULL);
+    compare_bufs("cache_clipped", &canvas_area);
+    TEST_ASSERT_EQUAL(size, lv_cache_get_size(cache, NULL));
+
+    /*Moved by a fraction of a pixel: the shapes are rasterized again*/
+    icon_x = 97.5f;
+    icon_y = 150.25f;
+    render(scene_icons, tvg_buf, false, LV_OPA_COVER, NULL);
+    render(scene_icons, native_buf, true, LV_OPA_COVER, NULL);
+    compare_bufs("cache_subpixel", &canvas_area);
+    TEST_ASSERT_GREATER_THAN(size, lv_cache_get_size(cache, NULL));
+
+    /*Large shapes are cached as edges and the result is the same as without the cache*/
+    render(scene_clip, tvg_buf, false, LV_OPA_COVER, NULL);
+    render(scene_clip, native_buf, true, LV_OPA_COVER, &scissor_area);
+    compare_bufs("cache_large", &scissor_area);
+    assert_untouched_outside(native_buf, &scissor_area);
+}
+
+static void scene_many_circles(lv_draw_vector_dsc_t * dsc)
+{
+    lv_vector_path_t * path = lv_vector_path_create(LV_VECTOR_PATH_QUALITY_MEDIUM);
+    lv_draw_vector_dsc_set_fill_color(dsc, lv_color_hex(0x008000));
+
+    uint32_t i;
+    for(i = 0; i < 100; i++) {
+        lv_fpoint_t c = {(float)(20 + (i % 10) * 30), (float)(20 + (i / 10) * 22)};
+        lv_vector_path_clear(path);
+        lv_vector_path_append_circle(path, &c, 8 + (float)i / 10, 8 + (float)i / 10);
+        lv_draw_vector_dsc_add_path(dsc, path);
+    }
+
+    lv_vector_path_delete(path);
+}
+
+void test_vector_native_cache_limit(void)
+{
+    lv_cache_t * cache = LV_GLOBAL_DEFAULT()->sw_vector_cache;
+    lv_draw_sw_vector_native_cache_drop_all();
+
+    /*More shapes than fit into the cache: the least recently used ones are evicted*/
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        render(scene_many_circles, native_buf, true, LV_OPA_COVER, NULL);
+        TEST_ASSERT_LESS_OR_EQUAL(LV_DRAW_SW_VECTOR_CACHE_SIZE, lv_cache_get_size(cache, NULL));
+    }
+
+    render(scene_many_circles, tvg_buf, false, LV_OPA_COVER, NULL);
+    compare_bufs("cache_limit", &canvas_area);
+
+    lv_draw_sw_vector_native_cache_drop_all();
+    TEST_ASSERT_EQUAL(0, lv_cache_get_size(cache, NULL));
+}
+
+#endif /*LV_DRAW_SW_VECTOR_CACHE_SIZE > 0*/
+
+#endif
+
+#endif
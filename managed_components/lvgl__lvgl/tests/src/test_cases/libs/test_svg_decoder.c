@@ -100,4 +100,130 @@ void test_svg_snapshot(void)
     TEST_ASSERT_MEM_LEAK_LESS_THAN(mem_before, 0);
 }
 
+static void assert_probe_same_as_parse(const char * svg, float exp_w, float exp_h)
+{
+    float w = -1;
+    float h = -1;
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_svg_get_viewport_size(svg, lv_strlen(svg), &w, &h));
+    TEST_ASSERT_EQUAL_FLOAT(exp_w, w);
+    TEST_ASSERT_EQUAL_FLOAT(exp_h, h);
+
+    /*The probe must give the same size as the full document*/
+    lv_svg_node_t * doc = lv_svg_load_data(svg, lv_strlen(svg));
+    lv_svg_render_obj_t * list = lv_svg_render_create(doc);
+    float parsed_w = -1;
+    float parsed_h = -1;
+    lv_svg_render_get_viewport_size(list, &parsed_w, &parsed_h);
+    TEST_ASSERT_EQUAL_FLOAT(parsed_w, w);
+    TEST_ASSERT_EQUAL_FLOAT(parsed_h, h);
+    lv_svg_render_delete(list);
+    lv_svg_node_delete(doc);
+}
+
+void test_svg_decoder_probe(void)
+{
+    assert_probe_same_as_parse("<svg width=\"120\" height=\"80\"><rect width=\"10\" height=\"10\"/></svg>", 120, 80);
+    assert_probe_same_as_parse("<?xml version=\"1.0\"?>\n"
+                               "<!-- <svg width=\"1\" height=\"1\"> in a comment -->\n"
+                               "<svg viewBox=\"0 0 48 24\" data-note=\"a > b\"><circle cx=\"4\" cy=\"4\" r=\"2\"/></svg>", 48, 24);
+    assert_probe_same_as_parse("<svg width=\"1in\" height=\"48\" viewBox=\"0 0 24 24\"><path d=\"M0 0 L24 24\"/></svg>", 96, 48);
+
+    /*Only the beginning of the document is required*/
+    const char * partial = "<svg width=\"32\" height=\"16\"><path d=\"M0 0 L";
+    float w = 0;
+    float h = 0;
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_svg_get_viewport_size(partial, lv_strlen(partial), &w, &h));
+    TEST_ASSERT_EQUAL_FLOAT(32, w);
+    TEST_ASSERT_EQUAL_FLOAT(16, h);
+
+    const char * incomplete = "<svg width=\"32\" hei";
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_svg_get_viewport_size(incomplete, lv_strlen(incomplete), &w, &h));
+
+    const char * not_svg = "<html><svg width=\"32\" height=\"16\"></svg></html>";
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_svg_get_viewport_size(not_svg, lv_strlen(not_svg), &w, &h));
+}
+
+void test_svg_decoder_header(void)
+{
+    lv_image_header_t header;
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_get_info("A:src/test_assets/test_img_svg_tiger.svg", &header));
+    TEST_ASSERT_EQUAL(900, header.w);
+    TEST_ASSERT_EQUAL(900, header.h);
+    TEST_ASSERT_TRUE(header.flags & LV_IMAGE_FLAGS_CUSTOM_DRAW);
+
+    /*The size of variables is read from the SVG if it's not set in the descriptor*/
+    static const char svg[] = "<svg width=\"64\" height=\"40\"><rect width=\"10\" height=\"10\"/></svg>";
+    lv_image_dsc_t img_dsc;
+    lv_memzero(&img_dsc, sizeof(img_dsc));
+    img_dsc.header.magic = LV_IMAGE_HEADER_MAGIC;
+    img_dsc.data = (const uint8_t *)svg;
+    img_dsc.data_size = sizeof(svg) - 1;
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_get_info(&img_dsc, &header));
+    TEST_ASSERT_EQUAL(64, header.w);
+    TEST_ASSERT_EQUAL(40, header.h);
+}
+
+void test_svg_decoder_doc_cache(void)
+{
+    const char * src = "A:src/test_assets/test_img_svg_tiger.svg";
+    lv_image_decoder_args_t args;
+    lv_memzero(&args, sizeof(args));
+
+    /*Opens of the same source share the parsed document even without the image cache*/
+    lv_image_cache_resize(0, true);
+    lv_image_decoder_dsc_t dsc1;
+    lv_image_decoder_dsc_t dsc2;
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_open(&dsc1, src, &args));
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_open(&dsc2, src, &args));
+    TEST_ASSERT_NOT_NULL(dsc1.decoded->unaligned_data);
+    TEST_ASSERT_EQUAL_PTR(dsc1.decoded->unaligned_data, dsc2.decoded->unaligned_data);
+
+    /*Dropping the cache keeps the documents of the opened images*/
+    lv_image_cache_drop(src);
+    lv_image_decoder_dsc_t dsc3;
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_open(&dsc3, src, &args));
+    TEST_ASSERT_NOT_EQUAL(dsc1.decoded->unaligned_data, dsc3.decoded->unaligned_data);
+    lv_image_decoder_close(&dsc1);
+    lv_image_decoder_close(&dsc2);
+    lv_image_decoder_close(&dsc3);
+
+    /*Not shared if caching is disabled for the open*/
+    args.no_cache = true;
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_open(&dsc1, src, &args));
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_open(&dsc2, src, &args));
+    TEST_ASSERT_NOT_EQUAL(dsc1.decoded->unaligned_data, dsc2.decoded->unaligned_data);
+    lv_image_decoder_close(&dsc1);
+    lv_image_decoder_close(&dsc2);
+    args.no_cache = false;
+
+    /*Variables are identified by their data, so a reused descriptor is parsed again*/
+    static const char svg1[] = "<svg width=\"64\" height=\"40\"><rect width=\"10\" height=\"10\"/></svg>";
+    static const char svg2[] = "<svg width=\"32\" height=\"20\"><rect width=\"20\" height=\"5\"/></svg>";
+    lv_image_dsc_t img_dsc;
+    lv_memzero(&img_dsc, sizeof(img_dsc));
+    img_dsc.header.magic = LV_IMAGE_HEADER_MAGIC;
+    img_dsc.data = (const uint8_t *)svg1;
+    img_dsc.data_size = sizeof(svg1) - 1;
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_open(&dsc1, &img_dsc, &args));
+    img_dsc.data = (const uint8_t *)svg2;
+    img_dsc.data_size = sizeof(svg2) - 1;
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_open(&dsc2, &img_dsc, &args));
+    TEST_ASSERT_NOT_EQUAL(dsc1.decoded->unaligned_data, dsc2.decoded->unaligned_data);
+    lv_image_decoder_close(&dsc1);
+    lv_image_decoder_close(&dsc2);
+    lv_image_cache_drop(NULL);
+    lv_image_cache_resize(LV_CACHE_DEF_SIZE, true);
+
+    size_t mem_before = lv_test_get_free_mem();
+    for(uint32_t i = 0; i < 4; i++) {
+        lv_obj_t * img = lv_image_create(lv_screen_active());
+        lv_image_set_src(img, src);
+        lv_image_set_scale(img, 32);
+    }
+    lv_refr_now(NULL);
+    lv_obj_clean(lv_screen_active());
+    lv_image_cache_drop(NULL);
+    TEST_ASSERT_MEM_LEAK_LESS_THAN(mem_before, 0);
+}
+
 #endif
@@ -49,6 +49,154 @@ void test_tiny_ttf_rendering_test(void)
 #endif
 }
 
+void test_tiny_ttf_prefetch(void)
+{
+#if LV_USE_TINY_TTF
+    extern const uint8_t test_ubuntu_font[];
+    extern size_t test_ubuntu_font_size;
+    lv_font_t * font = lv_tiny_ttf_create_data(test_ubuntu_font, test_ubuntu_font_size, 30);
+    lv_font_t * font2 = lv_tiny_ttf_create_data(test_ubuntu_font, test_ubuntu_font_size, 30);
+
+    /*The repeated letters are rendered only once*/
+    TEST_ASSERT_EQUAL_UINT32(4, lv_tiny_ttf_prefetch_text(font, "Hello"));
+    TEST_ASSERT_EQUAL_UINT32(0, lv_tiny_ttf_prefetch_text(font, "Hello"));
+    TEST_ASSERT_EQUAL_UINT32(1, lv_tiny_ttf_prefetch_text(font, "Hello!"));
+
+    /*The bitmaps of other fonts are cached separately*/
+    TEST_ASSERT_EQUAL_UINT32(4, lv_tiny_ttf_prefetch_text(font2, "Hello"));
+
+    /*The bitmaps are cached per size and kept when the size changes*/
+    lv_tiny_ttf_set_size(font, 40);
+    TEST_ASSERT_EQUAL_UINT32(4, lv_tiny_ttf_prefetch_text(font, "Hello"));
+    lv_tiny_ttf_set_size(font, 30);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_tiny_ttf_prefetch_text(font, "Hello"));
+
+    /*The glyph descriptors are cached per size too*/
+    lv_font_glyph_dsc_t g30;
+    lv_font_glyph_dsc_t g40;
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(font, &g30, 'H', 'e'));
+    lv_tiny_ttf_set_size(font, 40);
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(font, &g40, 'H', 'e'));
+    TEST_ASSERT_GREATER_THAN_UINT16(g30.box_h, g40.box_h);
+    TEST_ASSERT_GREATER_THAN_UINT16(g30.adv_w, g40.adv_w);
+    lv_tiny_ttf_set_size(font, 30);
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(font, &g40, 'H', 'e'));
+    TEST_ASSERT_EQUAL_UINT16(g30.box_h, g40.box_h);
+    TEST_ASSERT_EQUAL_UINT16(g30.adv_w, g40.adv_w);
+
+    /*Missing glyphs are skipped*/
+    TEST_ASSERT_EQUAL_UINT32(0, lv_tiny_ttf_prefetch_text(font, "\xE4\xBD\xA0\xE5\xA5\xBD"));
+
+    lv_tiny_ttf_destroy(font2);
+    lv_tiny_ttf_destroy(font);
+
+    /*Without cache nothing is prefetched*/
+    font = lv_tiny_ttf_create_data_ex(test_ubuntu_font, test_ubuntu_font_size, 30, LV_FONT_KERNING_NORMAL, 0);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_tiny_ttf_prefetch_text(font, "Hello"));
+    lv_tiny_ttf_destroy(font);
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_tiny_ttf_missing_glyph(void)
+{
+#if LV_USE_TINY_TTF
+    extern const uint8_t test_ubuntu_font[];
+    extern size_t test_ubuntu_font_size;
+    lv_font_t * font = lv_tiny_ttf_create_data(test_ubuntu_font, test_ubuntu_font_size, 30);
+    lv_font_t * font_no_cache = lv_tiny_ttf_create_data_ex(test_ubuntu_font, test_ubuntu_font_size, 30,
+                                                           LV_FONT_KERNING_NORMAL, 0);
+
+    lv_font_glyph_dsc_t g;
+    TEST_ASSERT_FALSE(lv_font_get_glyph_dsc(font, &g, 0x4F60, 0));
+    TEST_ASSERT_FALSE(lv_font_get_glyph_dsc(font_no_cache, &g, 0x4F60, 0));
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(font, &g, 'A', 'V'));
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(font_no_cache, &g, 'A', 'V'));
+
+    lv_tiny_ttf_destroy(font_no_cache);
+    lv_tiny_ttf_destroy(font);
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_tiny_ttf_large_glyph(void)
+{
+#if LV_USE_TINY_TTF
+    /*The bitmap of the glyph doesn't fit into the shared cache but it's still rendered*/
+    extern const uint8_t test_ubuntu_font[];
+    extern size_t test_ubuntu_font_size;
+    lv_font_t * font = lv_tiny_ttf_create_data(test_ubuntu_font, test_ubuntu_font_size, 800);
+
+    lv_font_glyph_dsc_t g;
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(font, &g, 'W', 0));
+    TEST_ASSERT_GREATER_THAN_UINT32(LV_TINY_TTF_CACHE_BITMAP_SIZE, (uint32_t)g.box_w * g.box_h);
+
+    const lv_draw_buf_t * draw_buf = lv_font_get_glyph_bitmap(&g, NULL);
+    TEST_ASSERT_NOT_NULL(draw_buf);
+    TEST_ASSERT_EQUAL_UINT32(g.box_w, draw_buf->header.w);
+    TEST_ASSERT_EQUAL_UINT32(g.box_h, draw_buf->header.h);
+
+    /*The middle of the first stroke is covered*/
+    const uint8_t * row = lv_draw_buf_goto_xy(draw_buf, 0, draw_buf->header.h / 2);
+    uint32_t x;
+    uint32_t covered = 0;
+    for(x = 0; x < draw_buf->header.w / 4; x++) {
+        if(row[x] == 0xff) covered++;
+    }
+    TEST_ASSERT_GREATER_THAN_UINT32(0, covered);
+
+    /*It's freed on release*/
+    lv_font_glyph_release_draw_data(&g);
+    TEST_ASSERT_NULL(g.entry);
+
+    /*It's not counted as prefetched*/
+    TEST_ASSERT_EQUAL_UINT32(0, lv_tiny_ttf_prefetch_text(font, "W"));
+
+    lv_tiny_ttf_destroy(font);
+#else
+    TEST_PASS();
+#endif
+}
+
+void test_tiny_ttf_rendering_cache_modes(void)
+{
+#if LV_USE_TINY_TTF
+    /*Prefetched and not cached glyphs look the same as the ones rendered while drawing*/
+    extern const uint8_t test_ubuntu_font[];
+    extern size_t test_ubuntu_font_size;
+    const char * text = "Hello world\n"
+                        "I'm a font created with Tiny TTF\n"
+                        "Accents: ÁÉÍÓÖŐÜŰ áéíóöőüű";
+
+    lv_font_t * fonts[2];
+    fonts[0] = lv_tiny_ttf_create_data(test_ubuntu_font, test_ubuntu_font_size, 30);
+    lv_tiny_ttf_prefetch_text(fonts[0], text);
+    fonts[1] = lv_tiny_ttf_create_data_ex(test_ubuntu_font, test_ubuntu_font_size, 30, LV_FONT_KERNING_NORMAL, 0);
+
+    uint32_t i;
+    for(i = 0; i < 2; i++) {
+        lv_obj_t * label = lv_label_create(lv_screen_active());
+        lv_obj_set_style_text_font(label, fonts[i], 0);
+        lv_obj_set_style_text_align(label, LV_TEXT_ALIGN_CENTER, 0);
+        lv_obj_set_style_bg_opa(label, LV_OPA_COVER, 0);
+        lv_obj_set_style_bg_color(label, lv_color_hex(0xffaaaa), 0);
+        lv_label_set_text(label, text);
+        lv_obj_center(label);
+
+#ifndef NON_AMD64_BUILD
+        TEST_ASSERT_EQUAL_SCREENSHOT("libs/tiny_ttf_1.png");
+#endif
+
+        lv_obj_delete(label);
+        lv_tiny_ttf_destroy(fonts[i]);
+    }
+#else
+    TEST_PASS();
+#endif
+}
+
 void test_tiny_ttf_kerning(void)
 {
 #if LV_USE_TINY_TTF
@@ -283,4 +283,174 @@ void test_display_deleted_during_event(void)
     lv_draw_buf_destroy(buf1);
 }
 
+#define ROT_HOR_RES 120
+#define ROT_VER_RES 80
+
+/*The frame as a panel with software rotation shows it*/
+static uint32_t panel[ROT_HOR_RES * ROT_VER_RES];
+static uint32_t panel_frame_cnt;
+static lv_draw_buf_t * panel_bufs[2];
+
+static void panel_flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map)
+{
+    LV_UNUSED(area);
+    if(lv_display_flush_is_last(disp) && disp->render_mode != LV_DISPLAY_RENDER_MODE_PARTIAL) {
+        int32_t w = lv_display_get_horizontal_resolution(disp);
+        int32_t h = lv_display_get_vertical_resolution(disp);
+        uint32_t stride = lv_draw_buf_width_to_stride(w, LV_COLOR_FORMAT_XRGB8888);
+        lv_display_rotation_t rotation = lv_display_get_rotation(disp);
+        if(rotation == LV_DISPLAY_ROTATION_0) {
+            int32_t y;
+            for(y = 0; y < h; y++) {
+                lv_memcpy(&panel[y * ROT_HOR_RES], px_map + y * stride, ROT_HOR_RES * 4);
+            }
+        }
+        else {
+            lv_draw_sw_rotate(px_map, panel, w, h, stride, ROT_HOR_RES * 4, rotation, LV_COLOR_FORMAT_XRGB8888);
+        }
+        panel_frame_cnt++;
+    }
+    lv_display_flush_ready(disp);
+}
+
+static lv_display_t * panel_display_create(lv_display_render_mode_t render_mode)
+{
+    lv_display_t * disp = lv_display_create(ROT_HOR_RES, ROT_VER_RES);
+    lv_display_set_color_format(disp, LV_COLOR_FORMAT_XRGB8888);
+    lv_display_set_flush_cb(disp, panel_flush_cb);
+
+    uint32_t buf_h = render_mode == LV_DISPLAY_RENDER_MODE_PARTIAL ? ROT_VER_RES / 4 : ROT_VER_RES;
+    panel_bufs[0] = lv_draw_buf_create(ROT_HOR_RES, buf_h, LV_COLOR_FORMAT_XRGB8888, LV_STRIDE_AUTO);
+    panel_bufs[1] = lv_draw_buf_create(ROT_HOR_RES, buf_h, LV_COLOR_FORMAT_XRGB8888, LV_STRIDE_AUTO);
+    lv_display_set_buffers(disp, panel_bufs[0]->data, panel_bufs[1]->data, panel_bufs[0]->data_size, render_mode);
+
+#if LV_USE_SYSMON
+#if LV_USE_MEM_MONITOR
+    lv_sysmon_hide_memory(disp);
+#endif
+#if LV_USE_PERF_MONITOR
+    lv_sysmon_hide_performance(disp);
+#endif
+#endif
+
+    /*Something that looks different in every orientation*/
+    lv_obj_t * scr = lv_display_get_screen_active(disp);
+    lv_obj_set_flex_flow(scr, LV_FLEX_FLOW_ROW_WRAP);
+    uint32_t i;
+    for(i = 0; i < 5; i++) {
+        lv_obj_t * obj = lv_obj_create(scr);
+        lv_obj_set_size(obj, 20 + i * 7, 15 + i * 3);
+        lv_obj_set_style_bg_color(obj, lv_palette_main(LV_PALETTE_RED + i), 0);
+    }
+
+    panel_frame_cnt = 0;
+    lv_refr_now(disp);
+
+    return disp;
+}
+
+static void panel_display_delete(lv_display_t * disp)
+{
+    lv_display_delete(disp);
+    lv_draw_buf_destroy(panel_bufs[0]);
+    lv_draw_buf_destroy(panel_bufs[1]);
+}
+
+void test_display_rotation_anim_keeps_last_frame(void)
+{
+    static uint32_t last_frame[ROT_HOR_RES * ROT_VER_RES];
+    static uint32_t ref_frame[ROT_HOR_RES * ROT_VER_RES];
+
+    lv_display_t * disp = panel_display_create(LV_DISPLAY_RENDER_MODE_DIRECT);
+    lv_obj_t * sys_layer = lv_display_get_layer_sys(disp);
+    uint32_t sys_child_cnt = lv_obj_get_child_count(sys_layer);
+    TEST_ASSERT_EQUAL_UINT32(1, panel_frame_cnt);
+    lv_memcpy(last_frame, panel, sizeof(panel));
+
+    /*The first frame of each new orientation is the same as the last one on the panel.
+     *Rotating again during the cross-fade continues from the visible frame.*/
+    static const lv_display_rotation_t rotations[] = {
+        LV_DISPLAY_ROTATION_90, LV_DISPLAY_ROTATION_270, LV_DISPLAY_ROTATION_180, LV_DISPLAY_ROTATION_90
+    };
+    uint32_t i;
+    for(i = 0; i < sizeof(rotations) / sizeof(rotations[0]); i++) {
+        lv_display_set_rotation_anim(disp, rotations[i], 300);
+        TEST_ASSERT_NOT_NULL(disp->rotation_snapshot);
+        TEST_ASSERT_EQUAL_UINT32(sys_child_cnt + 1, lv_obj_get_child_count(sys_layer));
+
+        lv_refr_now(disp);
+        TEST_ASSERT_EQUAL_UINT32(i + 2, panel_frame_cnt);
+        TEST_ASSERT_EQUAL_MEMORY(last_frame, panel, sizeof(panel));
+    }
+
+    /*The snapshot is removed after the cross-fade*/
+    lv_test_fast_forward(400);
+    TEST_ASSERT_NULL(disp->rotation_snapshot);
+    TEST_ASSERT_EQUAL_UINT32(sys_child_cnt, lv_obj_get_child_count(sys_layer));
+    lv_refr_now(disp);
+    lv_memcpy(last_frame, panel, sizeof(panel));
+
+    /*And the result is the same as rotating without animation*/
+    lv_display_set_rotation(disp, LV_DISPLAY_ROTATION_0);
+    lv_refr_now(disp);
+    lv_memcpy(ref_frame, panel, sizeof(panel));
+    lv_display_set_rotation(disp, LV_DISPLAY_ROTATION_90);
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL_MEMORY(last_frame, panel, sizeof(panel));
+    TEST_ASSERT_FALSE(lv_memcmp(ref_frame, panel, sizeof(panel)) == 0);
+
+    panel_display_delete(disp);
+}
+
+void test_display_rotation_anim_fallback(void)
+{
+    /*No whole frame is available in partial mode*/
+    lv_display_t * disp = panel_display_create(LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_rotation_anim(disp, LV_DISPLAY_ROTATION_90, 300);
+    TEST_ASSERT_NULL(disp->rotation_snapshot);
+    TEST_ASSERT_EQUAL(LV_DISPLAY_ROTATION_90, lv_display_get_rotation(disp));
+    TEST_ASSERT_EQUAL_INT32(ROT_VER_RES, lv_display_get_horizontal_resolution(disp));
+    panel_display_delete(disp);
+
+    /*No animation time or no change*/
+    disp = panel_display_create(LV_DISPLAY_RENDER_MODE_FULL);
+    lv_display_set_rotation_anim(disp, LV_DISPLAY_ROTATION_270, 0);
+    TEST_ASSERT_NULL(disp->rotation_snapshot);
+    TEST_ASSERT_EQUAL(LV_DISPLAY_ROTATION_270, lv_display_get_rotation(disp));
+    lv_refr_now(disp);
+    lv_display_set_rotation_anim(disp, LV_DISPLAY_ROTATION_270, 300);
+    TEST_ASSERT_NULL(disp->rotation_snapshot);
+
+    /*Rotating twice before a refresh: the last frame has the wrong size*/
+    lv_display_set_rotation_anim(disp, LV_DISPLAY_ROTATION_0, 300);
+    TEST_ASSERT_NOT_NULL(disp->rotation_snapshot);
+    lv_display_set_rotation_anim(disp, LV_DISPLAY_ROTATION_90, 300);
+    TEST_ASSERT_NULL(disp->rotation_snapshot);
+
+    /*Deleting the display during the cross-fade frees the snapshot*/
+    lv_refr_now(disp);
+    lv_display_set_rotation_anim(disp, LV_DISPLAY_ROTATION_180, 300);
+    TEST_ASSERT_NOT_NULL(disp->rotation_snapshot);
+    panel_display_delete(disp);
+}
+
+void test_display_rotation_updates_visibility(void)
+{
+    lv_display_t * disp = lv_display_get_default();
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_set_pos(obj, 10, 600);
+    lv_obj_set_size(obj, 50, 50);
+    lv_obj_update_layout(obj);
+
+    /*Below the bottom of the 800x480 screen*/
+    TEST_ASSERT_FALSE(lv_obj_is_visible(obj));
+
+    /*On the 480x800 screen after rotating*/
+    lv_display_set_rotation(disp, LV_DISPLAY_ROTATION_90);
+    TEST_ASSERT_TRUE(lv_obj_is_visible(obj));
+
+    lv_display_set_rotation(disp, LV_DISPLAY_ROTATION_0);
+    TEST_ASSERT_FALSE(lv_obj_is_visible(obj));
+}
+
 #endif
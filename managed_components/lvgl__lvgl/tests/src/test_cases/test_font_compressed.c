@@ -0,0 +1,170 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_FONT_COMPRESSED && LV_FONT_MONTSERRAT_28_COMPRESSED
+
+#include <pthread.h>
+
+#define GLYPH_FIRST     0x21
+#define GLYPH_CNT       (0x7F - GLYPH_FIRST)
+#define THREAD_CNT      4
+#define THREAD_LOOPS    50
+
+LV_FONT_DECLARE(test_font_montserrat_ascii_3bpp_compressed)
+
+typedef struct {
+    const lv_font_t * font;
+    lv_font_glyph_dsc_t dscs[GLYPH_CNT];
+    lv_draw_buf_t * ref_bufs[GLYPH_CNT];
+} glyph_set_t;
+
+typedef struct {
+    const glyph_set_t * set;
+    lv_draw_buf_t * buf;
+    uint32_t mismatch_cnt;
+} thread_ctx_t;
+
+static glyph_set_t glyph_set;
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+static void glyph_set_init(glyph_set_t * set, const lv_font_t * font)
+{
+    lv_memzero(set, sizeof(glyph_set_t));
+    set->font = font;
+
+    uint32_t i;
+    for(i = 0; i < GLYPH_CNT; i++) {
+        lv_font_glyph_dsc_t * dsc = &set->dscs[i];
+        TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(font, dsc, GLYPH_FIRST + i, 0));
+        set->ref_bufs[i] = lv_draw_buf_create(dsc->box_w, dsc->box_h, LV_COLOR_FORMAT_A8, LV_STRIDE_AUTO);
+        lv_font_get_glyph_bitmap(dsc, set->ref_bufs[i]);
+    }
+}
+
+static void glyph_set_deinit(glyph_set_t * set)
+{
+    uint32_t i;
+    for(i = 0; i < GLYPH_CNT; i++) {
+        lv_draw_buf_destroy(set->ref_bufs[i]);
+    }
+}
+
+/*Hash of the decoded pixels of all glyphs to verify that the output of the decoder doesn't change*/
+static uint32_t glyph_set_hash(const glyph_set_t * set)
+{
+    uint32_t hash = 2166136261u;
+    uint32_t i;
+    for(i = 0; i < GLYPH_CNT; i++) {
+        const lv_draw_buf_t * buf = set->ref_bufs[i];
+        uint32_t y;
+        for(y = 0; y < buf->header.h; y++) {
+            const uint8_t * px = buf->data + y * buf->header.stride;
+            uint32_t x;
+            for(x = 0; x < buf->header.w; x++) {
+                hash = (hash ^ px[x]) * 16777619u;
+            }
+        }
+    }
+    return hash;
+}
+
+static bool glyph_equal(const lv_draw_buf_t * a, const lv_draw_buf_t * b)
+{
+    uint32_t y;
+    for(y = 0; y < a->header.h; y++) {
+        if(lv_memcmp(a->data + y * a->header.stride, b->data + y * b->header.stride, a->header.w) != 0) return false;
+    }
+    return true;
+}
+
+/*Decode all glyphs again and again and compare them with the ones decoded on the main thread.
+ *Doesn't allocate memory as the heap is not thread safe in every test configuration.*/
+static void * decode_thread(void * arg)
+{
+    thread_ctx_t * ctx = arg;
+    uint32_t loop;
+    for(loop = 0; loop < THREAD_LOOPS; loop++) {
+        uint32_t i;
+        for(i = 0; i < GLYPH_CNT; i++) {
+            lv_font_glyph_dsc_t dsc = ctx->set->dscs[i];
+            ctx->buf->header.w = dsc.box_w;
+            ctx->buf->header.h = dsc.box_h;
+            ctx->buf->header.stride = ctx->set->ref_bufs[i]->header.stride;
+            lv_memset(ctx->buf->data, 0xAA, ctx->buf->data_size);
+            lv_font_get_glyph_bitmap(&dsc, ctx->buf);
+            if(!glyph_equal(ctx->buf, ctx->set->ref_bufs[i])) ctx->mismatch_cnt++;
+        }
+    }
+
+    return NULL;
+}
+
+static void decode_parallel(const glyph_set_t * set)
+{
+    thread_ctx_t ctx[THREAD_CNT];
+    pthread_t threads[THREAD_CNT];
+    uint32_t i;
+    for(i = 0; i < THREAD_CNT; i++) {
+        ctx[i].set = set;
+        ctx[i].mismatch_cnt = 0;
+        ctx[i].buf = lv_draw_buf_create(64, 64, LV_COLOR_FORMAT_A8, LV_STRIDE_AUTO);
+        TEST_ASSERT_EQUAL_INT(0, pthread_create(&threads[i], NULL, decode_thread, &ctx[i]));
+    }
+
+    for(i = 0; i < THREAD_CNT; i++) {
+        pthread_join(threads[i], NULL);
+        TEST_ASSERT_EQUAL_UINT32(0, ctx[i].mismatch_cnt);
+        lv_draw_buf_destroy(ctx[i].buf);
+    }
+}
+
+void test_font_compressed_decode(void)
+{
+    /*The hashes of the pixels decoded by the original decoder*/
+    glyph_set_init(&glyph_set, &lv_font_montserrat_28_compressed);
+    TEST_ASSERT_EQUAL_HEX32(0x25af6c0a, glyph_set_hash(&glyph_set));
+    glyph_set_deinit(&glyph_set);
+
+    glyph_set_init(&glyph_set, &test_font_montserrat_ascii_3bpp_compressed);
+    TEST_ASSERT_EQUAL_HEX32(0x26637188, glyph_set_hash(&glyph_set));
+    glyph_set_deinit(&glyph_set);
+}
+
+void test_font_compressed_decode_parallel(void)
+{
+    glyph_set_init(&glyph_set, &lv_font_montserrat_28_compressed);
+    decode_parallel(&glyph_set);
+    glyph_set_deinit(&glyph_set);
+
+    glyph_set_init(&glyph_set, &test_font_montserrat_ascii_3bpp_compressed);
+    decode_parallel(&glyph_set);
+    glyph_set_deinit(&glyph_set);
+}
+
+#else
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_font_compressed_decode(void)
+{
+}
+
+#endif /*LV_USE_FONT_COMPRESSED && LV_FONT_MONTSERRAT_28_COMPRESSED*/
+
+#endif /*LV_BUILD_TEST*/
@@ -0,0 +1,167 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+/*Latin, Hebrew, CJK, a missing emoji and Latin again*/
+static const char * mixed_text = "Hello שלום 你好 \xF0\x9F\x98\x80 World";
+
+static lv_font_t font_latin;
+static lv_font_t font_hebrew;
+
+void setUp(void)
+{
+    /*Latin -> Hebrew -> CJK*/
+    lv_memcpy(&font_latin, &lv_font_montserrat_14, sizeof(lv_font_t));
+    lv_memcpy(&font_hebrew, &lv_font_dejavu_16_persian_hebrew, sizeof(lv_font_t));
+    font_latin.fallback = &font_hebrew;
+    font_hebrew.fallback = &lv_font_source_han_sans_sc_16_cjk;
+}
+
+void tearDown(void)
+{
+}
+
+static void compare_glyph_dsc(const lv_font_t * font, lv_font_fallback_cache_t * cache, const char * text)
+{
+    uint32_t i = 0;
+    while(text[i] != '\0') {
+        uint32_t letter;
+        uint32_t letter_next;
+        lv_text_encoded_letter_next_2(text, &letter, &letter_next, &i);
+
+        lv_font_glyph_dsc_t dsc_ref;
+        lv_font_glyph_dsc_t dsc;
+        bool found_ref = lv_font_get_glyph_dsc(font, &dsc_ref, letter, letter_next);
+        bool found = lv_font_get_glyph_dsc_cached(font, cache, &dsc, letter, letter_next);
+        TEST_ASSERT_EQUAL(found_ref, found);
+        TEST_ASSERT_EQUAL_PTR(dsc_ref.resolved_font, dsc.resolved_font);
+        TEST_ASSERT_EQUAL(dsc_ref.adv_w, dsc.adv_w);
+        TEST_ASSERT_EQUAL(dsc_ref.box_w, dsc.box_w);
+        TEST_ASSERT_EQUAL(dsc_ref.box_h, dsc.box_h);
+        TEST_ASSERT_EQUAL(dsc_ref.ofs_x, dsc.ofs_x);
+        TEST_ASSERT_EQUAL(dsc_ref.ofs_y, dsc.ofs_y);
+        TEST_ASSERT_EQUAL(dsc_ref.is_placeholder, dsc.is_placeholder);
+        TEST_ASSERT_EQUAL(dsc_ref.gid.index, dsc.gid.index);
+    }
+}
+
+static void assert_cached(const lv_font_fallback_cache_t * cache, uint32_t letter, const lv_font_t * font)
+{
+    uint32_t slot = letter & (LV_FONT_FALLBACK_CACHE_SIZE - 1);
+    TEST_ASSERT_EQUAL_UINT32(letter, cache->letters[slot]);
+    TEST_ASSERT_EQUAL_PTR(font, cache->resolved[slot]);
+}
+
+void test_font_fallback_cache_glyph_dsc(void)
+{
+    lv_font_fallback_cache_t cache;
+    lv_font_fallback_cache_init(&cache, &font_latin);
+
+    /*The first pass fills the cache, the second one uses it*/
+    compare_glyph_dsc(&font_latin, &cache, mixed_text);
+    compare_glyph_dsc(&font_latin, &cache, mixed_text);
+
+    /*Without fallback or cache it works as lv_font_get_glyph_dsc*/
+    compare_glyph_dsc(&lv_font_montserrat_14, &cache, mixed_text);
+    compare_glyph_dsc(&font_latin, NULL, mixed_text);
+}
+
+void test_font_fallback_cache_other_font(void)
+{
+    lv_font_fallback_cache_t cache;
+    lv_font_fallback_cache_init(&cache, &font_latin);
+    compare_glyph_dsc(&font_latin, &cache, mixed_text);
+
+    /*Using the cache with an other chain resets it*/
+    compare_glyph_dsc(&font_hebrew, &cache, mixed_text);
+    TEST_ASSERT_EQUAL_PTR(&font_hebrew, cache.font);
+}
+
+void test_font_fallback_cache_invalidate(void)
+{
+    lv_font_fallback_cache_t cache;
+    lv_font_fallback_cache_init(&cache, &font_latin);
+
+    lv_font_glyph_dsc_t dsc;
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc_cached(&font_latin, &cache, &dsc, 0x4F60, 0));
+    TEST_ASSERT_EQUAL_PTR(&lv_font_source_han_sans_sc_16_cjk, dsc.resolved_font);
+
+    /*Remove the CJK font from the chain*/
+    font_hebrew.fallback = NULL;
+    lv_font_fallback_cache_init(&cache, &font_latin);
+    TEST_ASSERT_FALSE(lv_font_get_glyph_dsc_cached(&font_latin, &cache, &dsc, 0x4F60, 0));
+    TEST_ASSERT_NULL(dsc.resolved_font);
+
+    compare_glyph_dsc(&font_latin, &cache, mixed_text);
+}
+
+void test_font_fallback_text_size(void)
+{
+    /*Measuring uses a fallback cache internally. The result must be the same as the sum of the glyphs*/
+    const char * text = "Hello שלום 你好";
+    int32_t w = 0;
+    uint32_t i = 0;
+    while(text[i] != '\0') {
+        uint32_t letter;
+        uint32_t letter_next;
+        lv_text_encoded_letter_next_2(text, &letter, &letter_next, &i);
+        w += lv_font_get_glyph_width(&font_latin, letter, letter_next);
+    }
+
+    lv_point_t size;
+    lv_text_get_size(&size, text, &font_latin, 0, 0, LV_COORD_MAX, LV_TEXT_FLAG_NONE);
+    TEST_ASSERT_EQUAL_INT32(w, size.x);
+    TEST_ASSERT_EQUAL_INT32(lv_font_get_line_height(&font_latin), size.y);
+
+    /*A cache passed in the attributes is used and kept*/
+    lv_font_fallback_cache_t cache;
+    lv_font_fallback_cache_init(&cache, &font_latin);
+
+    lv_text_attributes_t attributes;
+    lv_text_attributes_init(&attributes);
+    attributes.max_width = LV_COORD_MAX;
+    attributes.fallback_cache = &cache;
+    lv_text_get_size_attributes(&size, text, &font_latin, &attributes);
+    TEST_ASSERT_EQUAL_INT32(w, size.x);
+    TEST_ASSERT_EQUAL_PTR(&cache, attributes.fallback_cache);
+    assert_cached(&cache, 0x05E9, &font_hebrew);      /*ש*/
+    assert_cached(&cache, 0x4F60, &lv_font_source_han_sans_sc_16_cjk);    /*你*/
+}
+
+void test_font_fallback_label(void)
+{
+    lv_obj_t * label = lv_label_create(lv_screen_active());
+    lv_obj_set_style_text_font(label, &font_latin, 0);
+    lv_obj_set_width(label, 100);
+    lv_label_set_text(label, "Hello שלום 你好 World 你好 שלום");
+    lv_obj_center(label);
+
+    lv_refr_now(NULL);
+    TEST_ASSERT_GREATER_THAN(lv_font_get_line_height(&font_latin), lv_obj_get_height(label));
+
+    /*The label keeps the resolved fonts between measuring and drawing*/
+    lv_label_t * label_p = (lv_label_t *)label;
+    TEST_ASSERT_NOT_NULL(label_p->fallback_cache);
+    TEST_ASSERT_EQUAL_PTR(&font_latin, label_p->fallback_cache->font);
+    assert_cached(label_p->fallback_cache, 0x05E9, &font_hebrew);
+    assert_cached(label_p->fallback_cache, 0x4F60, &lv_font_source_han_sans_sc_16_cjk);
+
+    /*The cache is reset if the fallback chain changes*/
+    font_latin.fallback = &lv_font_source_han_sans_sc_16_cjk;
+    lv_obj_report_style_change(NULL);
+    lv_refr_now(NULL);
+    assert_cached(label_p->fallback_cache, 0x05E9, NULL);
+
+    /*No cache is needed without fallback*/
+    lv_obj_t * label_no_fallback = lv_label_create(lv_screen_active());
+    lv_label_set_text(label_no_fallback, "Hello");
+    lv_refr_now(NULL);
+    TEST_ASSERT_NULL(((lv_label_t *)label_no_fallback)->fallback_cache);
+
+    lv_obj_delete(label);
+    lv_obj_delete(label_no_fallback);
+}
+
+#endif
@@ -0,0 +1,271 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define KERN_TABLE_OFFSET_UNKNOWN   0xFFFFFFFF
+
+extern lv_font_t test_font_1;
+extern uint8_t const test_font_1_buf[6876];
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+/*The class mapping arrays are indexed by the glyph ids, so their length is the number of glyphs*/
+static uint32_t get_glyph_cnt(const lv_font_t * font)
+{
+    const lv_font_fmt_txt_dsc_t * fdsc = font->dsc;
+    uint32_t glyph_cnt = 0;
+    uint32_t i;
+    for(i = 0; i < fdsc->cmap_num; i++) {
+        const lv_font_fmt_txt_cmap_t * cmap = &fdsc->cmaps[i];
+        uint32_t len = cmap->unicode_list ? cmap->list_length : cmap->range_length;
+        glyph_cnt = LV_MAX(glyph_cnt, cmap->glyph_id_start + len);
+    }
+    return glyph_cnt;
+}
+
+/*Expand the kerning classes of a font to a sorted pair list, the way the font converter exports pairs*/
+static lv_font_fmt_txt_kern_pair_t * pairs_from_classes(const lv_font_t * font, uint32_t glyph_ids_size)
+{
+    const lv_font_fmt_txt_dsc_t * fdsc = font->dsc;
+    const lv_font_fmt_txt_kern_classes_t * kc = fdsc->kern_dsc;
+    uint32_t glyph_cnt = get_glyph_cnt(font);
+
+    uint32_t pair_cnt = 0;
+    uint32_t l, r;
+    for(l = 0; l < glyph_cnt; l++) {
+        for(r = 0; r < glyph_cnt; r++) {
+            uint8_t lc = kc->left_class_mapping[l];
+            uint8_t rc = kc->right_class_mapping[r];
+            if(lc && rc && kc->class_pair_values[(lc - 1) * kc->right_class_cnt + (rc - 1)]) pair_cnt++;
+        }
+    }
+
+    lv_font_fmt_txt_kern_pair_t * kp = lv_malloc_zeroed(sizeof(lv_font_fmt_txt_kern_pair_t));
+    uint8_t * ids8 = glyph_ids_size == 0 ? lv_malloc(pair_cnt * 2) : NULL;
+    uint16_t * ids16 = glyph_ids_size == 1 ? lv_malloc(pair_cnt * 2 * sizeof(uint16_t)) : NULL;
+    int8_t * values = lv_malloc(pair_cnt);
+
+    uint32_t i = 0;
+    for(l = 0; l < glyph_cnt; l++) {
+        for(r = 0; r < glyph_cnt; r++) {
+            uint8_t lc = kc->left_class_mapping[l];
+            uint8_t rc = kc->right_class_mapping[r];
+            if(lc == 0 || rc == 0) continue;
+            int8_t v = kc->class_pair_values[(lc - 1) * kc->right_class_cnt + (rc - 1)];
+            if(v == 0) continue;
+
+            if(ids8) {
+                ids8[i * 2] = (uint8_t)l;
+                ids8[i * 2 + 1] = (uint8_t)r;
+            }
+            else {
+                ids16[i * 2] = (uint16_t)l;
+                ids16[i * 2 + 1] = (uint16_t)r;
+            }
+            values[i] = v;
+            i++;
+        }
+    }
+
+    kp->glyph_ids = ids8 ? (const void *)ids8 : (const void *)ids16;
+    kp->values = values;
+    kp->pair_cnt = pair_cnt;
+    kp->glyph_ids_size = glyph_ids_size;
+    return kp;
+}
+
+static void pairs_free(lv_font_fmt_txt_kern_pair_t * kp)
+{
+    lv_free((void *)kp->glyph_ids);
+    lv_free((void *)kp->values);
+    lv_free(kp);
+}
+
+static void classes_free(lv_font_fmt_txt_kern_classes_t * kc)
+{
+    lv_free((void *)kc->class_pair_values);
+    lv_free((void *)kc->left_class_mapping);
+    lv_free((void *)kc->right_class_mapping);
+    lv_free(kc);
+}
+
+/*Create a copy of a font using other kerning data*/
+static void font_init_with_kern(lv_font_t * font, lv_font_fmt_txt_dsc_t * fdsc, const lv_font_t * ref,
+                                const void * kern_dsc, bool kern_classes)
+{
+    lv_memcpy(font, ref, sizeof(lv_font_t));
+    lv_memcpy(fdsc, ref->dsc, sizeof(lv_font_fmt_txt_dsc_t));
+    fdsc->kern_dsc = kern_dsc;
+    fdsc->kern_classes = kern_classes ? 1 : 0;
+    font->dsc = fdsc;
+}
+
+/*Compare the advance widths of all ASCII letter pairs and return the number of kerned pairs*/
+static uint32_t compare_kerning(const lv_font_t * font_ref, const lv_font_t * font)
+{
+    uint32_t kerned_cnt = 0;
+    uint32_t l, r;
+    for(l = 0x20; l < 0x7F; l++) {
+        for(r = 0x20; r < 0x7F; r++) {
+            lv_font_glyph_dsc_t dsc_ref;
+            lv_font_glyph_dsc_t dsc;
+            lv_font_glyph_dsc_t dsc_no_kern;
+            bool found_ref = lv_font_get_glyph_dsc(font_ref, &dsc_ref, l, r);
+            bool found = lv_font_get_glyph_dsc(font, &dsc, l, r);
+            TEST_ASSERT_EQUAL(found_ref, found);
+            if(!found) continue;
+
+            TEST_ASSERT_EQUAL_INT32(dsc_ref.adv_w, dsc.adv_w);
+
+            lv_font_get_glyph_dsc(font_ref, &dsc_no_kern, l, 0);
+            if(dsc_no_kern.adv_w != dsc_ref.adv_w) kerned_cnt++;
+        }
+    }
+
+    return kerned_cnt;
+}
+
+void test_font_kerning_pairs_8bit(void)
+{
+    lv_font_t font;
+    lv_font_fmt_txt_dsc_t fdsc;
+    lv_font_fmt_txt_kern_pair_t * kp = pairs_from_classes(&test_font_1, 0);
+    font_init_with_kern(&font, &fdsc, &test_font_1, kp, false);
+
+    TEST_ASSERT_GREATER_THAN(100, compare_kerning(&test_font_1, &font));
+
+    pairs_free(kp);
+}
+
+void test_font_kerning_pairs_16bit(void)
+{
+    lv_font_t font;
+    lv_font_fmt_txt_dsc_t fdsc;
+    lv_font_fmt_txt_kern_pair_t * kp = pairs_from_classes(&test_font_1, 1);
+    font_init_with_kern(&font, &fdsc, &test_font_1, kp, false);
+
+    TEST_ASSERT_GREATER_THAN(100, compare_kerning(&test_font_1, &font));
+
+    pairs_free(kp);
+}
+
+void test_font_kerning_pairs_to_classes(void)
+{
+    uint32_t glyph_cnt = get_glyph_cnt(&test_font_1);
+    const lv_font_fmt_txt_kern_classes_t * kc_ref = ((lv_font_fmt_txt_dsc_t *)test_font_1.dsc)->kern_dsc;
+
+    uint32_t glyph_ids_size;
+    for(glyph_ids_size = 0; glyph_ids_size <= 1; glyph_ids_size++) {
+        lv_font_fmt_txt_kern_pair_t * kp = pairs_from_classes(&test_font_1, glyph_ids_size);
+        lv_font_fmt_txt_kern_classes_t * kc = lv_font_fmt_txt_kern_pairs_to_classes(kp, glyph_cnt);
+        TEST_ASSERT_NOT_NULL(kc);
+
+        /*Identical classes of the converter are merged, so there can't be more of them*/
+        TEST_ASSERT_LESS_OR_EQUAL(kc_ref->left_class_cnt, kc->left_class_cnt);
+        TEST_ASSERT_LESS_OR_EQUAL(kc_ref->right_class_cnt, kc->right_class_cnt);
+
+        lv_font_t font;
+        lv_font_fmt_txt_dsc_t fdsc;
+        font_init_with_kern(&font, &fdsc, &test_font_1, kc, true);
+        TEST_ASSERT_GREATER_THAN(100, compare_kerning(&test_font_1, &font));
+
+        classes_free(kc);
+        pairs_free(kp);
+    }
+}
+
+void test_font_kerning_pairs_to_classes_invalid(void)
+{
+    uint32_t glyph_cnt = get_glyph_cnt(&test_font_1);
+    lv_font_fmt_txt_kern_pair_t * kp = pairs_from_classes(&test_font_1, 1);
+    uint16_t * ids = (uint16_t *)kp->glyph_ids;
+    int8_t * values = (int8_t *)kp->values;
+
+    /*A glyph id out of the glyph range*/
+    TEST_ASSERT_NULL(lv_font_fmt_txt_kern_pairs_to_classes(kp, ids[(kp->pair_cnt - 1) * 2]));
+
+    /*A pair without kerning*/
+    int8_t v = values[0];
+    values[0] = 0;
+    TEST_ASSERT_NULL(lv_font_fmt_txt_kern_pairs_to_classes(kp, glyph_cnt));
+    values[0] = v;
+
+    /*Unsorted pairs*/
+    uint16_t l = ids[0];
+    ids[0] = ids[(kp->pair_cnt - 1) * 2];
+    TEST_ASSERT_NULL(lv_font_fmt_txt_kern_pairs_to_classes(kp, glyph_cnt));
+    ids[0] = l;
+
+    lv_font_fmt_txt_kern_classes_t * kc = lv_font_fmt_txt_kern_pairs_to_classes(kp, glyph_cnt);
+    TEST_ASSERT_NOT_NULL(kc);
+    classes_free(kc);
+
+    pairs_free(kp);
+}
+
+/*Replace the class based kerning table of the binary font with sorted pairs*/
+static uint8_t * create_pair_kerned_binfont(uint32_t * size_out)
+{
+    /*Find the kerning table*/
+    uint32_t kern_ofs = KERN_TABLE_OFFSET_UNKNOWN;
+    uint32_t ofs = 0;
+    while(ofs < sizeof(test_font_1_buf)) {
+        uint32_t len;
+        lv_memcpy(&len, &test_font_1_buf[ofs], sizeof(len));
+        if(lv_memcmp(&test_font_1_buf[ofs + 4], "kern", 4) == 0) {
+            kern_ofs = ofs;
+            break;
+        }
+        ofs += len;
+    }
+    TEST_ASSERT_NOT_EQUAL(KERN_TABLE_OFFSET_UNKNOWN, kern_ofs);
+
+    /*The glyph id format of the header*/
+    TEST_ASSERT_EQUAL(0, test_font_1_buf[35]);
+    lv_font_fmt_txt_kern_pair_t * kp = pairs_from_classes(&test_font_1, 0);
+
+    uint32_t kern_len = 4 + 4 + 4 + 4 + kp->pair_cnt * 3;
+    uint32_t size = kern_ofs + kern_len;
+    uint8_t * buf = lv_malloc(size);
+    lv_memcpy(buf, test_font_1_buf, kern_ofs);
+
+    uint8_t * p = buf + kern_ofs;
+    lv_memcpy(p, &kern_len, 4);
+    lv_memcpy(p + 4, "kern", 4);
+    lv_memzero(p + 8, 4);   /*Format 0: sorted pairs*/
+    uint32_t pair_cnt = kp->pair_cnt;
+    lv_memcpy(p + 12, &pair_cnt, 4);
+    lv_memcpy(p + 16, kp->glyph_ids, pair_cnt * 2);
+    lv_memcpy(p + 16 + pair_cnt * 2, kp->values, pair_cnt);
+
+    pairs_free(kp);
+
+    *size_out = size;
+    return buf;
+}
+
+void test_font_kerning_binfont_pairs_loaded_as_classes(void)
+{
+    uint32_t size;
+    uint8_t * buf = create_pair_kerned_binfont(&size);
+
+    lv_font_t * font = lv_binfont_create_from_buffer(buf, size);
+    TEST_ASSERT_NOT_NULL(font);
+
+    const lv_font_fmt_txt_dsc_t * fdsc = font->dsc;
+    TEST_ASSERT_EQUAL(1, fdsc->kern_classes);
+    TEST_ASSERT_GREATER_THAN(100, compare_kerning(&test_font_1, font));
+
+    lv_binfont_destroy(font);
+    lv_free(buf);
+}
+
+#endif
@@ -12,6 +12,12 @@
 
 #include "unity/unity.h"
 
+#include <stdio.h>
+#include <stdlib.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
 /*********************
  *      DEFINES
  *********************/
@@ -25,9 +31,13 @@
  **********************/
 
 static int compare_fonts(lv_font_t * f1, lv_font_t * f2);
+static void * map_converted_font(const char * path, uint32_t * size);
 void test_font_loader_with_cache(void);
 void test_font_loader_no_cache(void);
 void test_font_loader_from_buffer(void);
+void test_font_loader_from_mapped(void);
+void test_font_loader_from_mapped_memory_usage(void);
+void test_font_loader_from_mapped_invalid(void);
 
 /**********************
  *  STATIC VARIABLES
@@ -145,6 +155,107 @@ void test_font_loader_from_buffer(void)
     common();
 }
 
+void test_font_loader_from_mapped(void)
+{
+    uint32_t size_1;
+    uint32_t size_2;
+    uint32_t size_3;
+    void * map_1 = map_converted_font("A:src/test_assets/test_font_1.fnt", &size_1);
+    void * map_2 = map_converted_font("A:src/test_assets/test_font_2.fnt", &size_2);
+    void * map_3 = map_converted_font("A:src/test_assets/test_font_3.fnt", &size_3);
+
+    font_1_bin = lv_binfont_create_from_mapped(map_1, size_1);
+    TEST_ASSERT_NOT_NULL(font_1_bin);
+
+    font_2_bin = lv_binfont_create_from_mapped(map_2, size_2);
+    TEST_ASSERT_NOT_NULL(font_2_bin);
+
+    font_3_bin = lv_binfont_create_from_mapped(map_3, size_3);
+    TEST_ASSERT_NOT_NULL(font_3_bin);
+
+    /*The glyphs should be used from the mapped file*/
+    const lv_font_fmt_txt_dsc_t * dsc = font_1_bin->dsc;
+    TEST_ASSERT_TRUE((const uint8_t *)dsc->glyph_bitmap > (const uint8_t *)map_1);
+    TEST_ASSERT_TRUE((const uint8_t *)dsc->glyph_bitmap < (const uint8_t *)map_1 + size_1);
+    TEST_ASSERT_TRUE((const uint8_t *)dsc->glyph_dsc > (const uint8_t *)map_1);
+    TEST_ASSERT_TRUE((const uint8_t *)dsc->glyph_dsc < (const uint8_t *)map_1 + size_1);
+
+    common();
+
+    munmap(map_1, size_1);
+    munmap(map_2, size_2);
+    munmap(map_3, size_3);
+}
+
+void test_font_loader_from_mapped_memory_usage(void)
+{
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN
+    uint32_t size;
+    void * map = map_converted_font("A:src/test_assets/test_font_1.fnt", &size);
+
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    size_t free_start = mon.free_size;
+
+    lv_font_t * font_copied = lv_binfont_create("A:src/test_assets/test_font_1.fnt");
+    lv_mem_monitor(&mon);
+    size_t copied_size = free_start - mon.free_size;
+    lv_binfont_destroy(font_copied);
+
+    lv_font_t * font_mapped = lv_binfont_create_from_mapped(map, size);
+    lv_mem_monitor(&mon);
+    size_t mapped_size = free_start - mon.free_size;
+    lv_binfont_destroy(font_mapped);
+
+    /*The ~6 kB of glyph data is not copied, only a few descriptors are allocated*/
+    TEST_ASSERT_LESS_THAN(512, mapped_size);
+    TEST_ASSERT_GREATER_THAN(size / 2, copied_size);
+
+    munmap(map, size);
+#endif
+}
+
+void test_font_loader_from_mapped_invalid(void)
+{
+    uint32_t size;
+    uint8_t * data = lv_binfont_convert_to_mapped("A:src/test_assets/test_font_1.fnt", &size);
+    TEST_ASSERT_NOT_NULL(data);
+
+    /*Truncated*/
+    TEST_ASSERT_NULL(lv_binfont_create_from_mapped(data, size - 4));
+
+    /*Not aligned*/
+    uint8_t * shifted = lv_malloc(size + 4);
+    lv_memcpy(shifted + 1, data, size);
+    TEST_ASSERT_NULL(lv_binfont_create_from_mapped(shifted + 1, size));
+    lv_free(shifted);
+
+    /*Not a mapped font*/
+    TEST_ASSERT_NULL(lv_binfont_create_from_mapped(test_font_1_buf, sizeof(test_font_1_buf)));
+
+    /*Offsets of `glyph_cnt` and `glyph_bitmap_size` in the header of the mapped font*/
+    uint32_t * glyph_cnt = (uint32_t *)(data + 28);
+    uint32_t * bitmap_size = (uint32_t *)(data + 40);
+
+    /*The character maps refer to non-existing glyphs*/
+    uint32_t glyph_cnt_ori = *glyph_cnt;
+    *glyph_cnt = 2;
+    TEST_ASSERT_NULL(lv_binfont_create_from_mapped(data, size));
+    *glyph_cnt = glyph_cnt_ori;
+
+    /*The glyphs point out of the bitmap table*/
+    uint32_t bitmap_size_ori = *bitmap_size;
+    *bitmap_size = 4;
+    TEST_ASSERT_NULL(lv_binfont_create_from_mapped(data, size));
+    *bitmap_size = bitmap_size_ori;
+
+    lv_font_t * font = lv_binfont_create_from_mapped(data, size);
+    TEST_ASSERT_NOT_NULL(font);
+    lv_binfont_destroy(font);
+
+    lv_free(data);
+}
+
 void test_font_loader_reload(void)
 {
     /*Reload a font which is being used by a label*/
@@ -322,4 +433,25 @@ static int compare_fonts(lv_font_t * f1, lv_font_t * f2)
  *   STATIC FUNCTIONS
  **********************/
 
+/*Convert a font, save it to a temporary file and map the file to the memory*/
+static void * map_converted_font(const char * path, uint32_t * size)
+{
+    uint8_t * data = lv_binfont_convert_to_mapped(path, size);
+    TEST_ASSERT_NOT_NULL(data);
+
+    char tmp_path[] = "/tmp/lv_test_font_XXXXXX";
+    int fd = mkstemp(tmp_path);
+    TEST_ASSERT_NOT_EQUAL(-1, fd);
+    TEST_ASSERT_EQUAL(*size, write(fd, data, *size));
+    lv_free(data);
+
+    void * map = mmap(NULL, *size, PROT_READ, MAP_PRIVATE, fd, 0);
+    TEST_ASSERT_TRUE(map != MAP_FAILED);
+
+    close(fd);
+    unlink(tmp_path);
+
+    return map;
+}
+
 #endif // LV_BUILD_TEST
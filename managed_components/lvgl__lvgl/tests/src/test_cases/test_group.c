@@ -58,4 +58,275 @@ void test_group_obj_by_index(void)
     TEST_ASSERT_EQUAL_PTR(lv_group_get_obj_by_index(group, 1), NULL);
 }
 
+static uint32_t edge_cnt;
+static bool edge_next;
+
+static void edge_cb(lv_group_t * group, bool next)
+{
+    LV_UNUSED(group);
+    edge_cnt++;
+    edge_next = next;
+}
+
+void test_group_focus_next_skips_not_focusable(void)
+{
+    lv_group_t * group = lv_group_create();
+
+    lv_obj_t * objs[5];
+    uint32_t i;
+    for(i = 0; i < 5; i++) {
+        lv_obj_t * cont = lv_obj_create(lv_screen_active());
+        objs[i] = lv_button_create(cont);
+        lv_group_add_obj(group, objs[i]);
+    }
+
+    TEST_ASSERT_EQUAL_PTR(objs[0], lv_group_get_focused(group));
+
+    /*Hide the parent of an object and disable an other one*/
+    lv_obj_add_flag(lv_obj_get_parent(objs[1]), LV_OBJ_FLAG_HIDDEN);
+    lv_obj_add_state(objs[2], LV_STATE_DISABLED);
+    lv_group_focus_next(group);
+    TEST_ASSERT_EQUAL_PTR(objs[3], lv_group_get_focused(group));
+    lv_group_focus_prev(group);
+    TEST_ASSERT_EQUAL_PTR(objs[0], lv_group_get_focused(group));
+
+    /*Show and enable them again*/
+    lv_obj_remove_flag(lv_obj_get_parent(objs[1]), LV_OBJ_FLAG_HIDDEN);
+    lv_obj_remove_state(objs[2], LV_STATE_DISABLED);
+    lv_group_focus_next(group);
+    TEST_ASSERT_EQUAL_PTR(objs[1], lv_group_get_focused(group));
+    lv_group_focus_next(group);
+    TEST_ASSERT_EQUAL_PTR(objs[2], lv_group_get_focused(group));
+
+    /*A hidden object moved to a visible parent is focusable*/
+    lv_obj_add_flag(lv_obj_get_parent(objs[3]), LV_OBJ_FLAG_HIDDEN);
+    lv_group_focus_next(group);
+    TEST_ASSERT_EQUAL_PTR(objs[4], lv_group_get_focused(group));
+    lv_obj_set_parent(objs[3], lv_screen_active());
+    lv_group_focus_prev(group);
+    TEST_ASSERT_EQUAL_PTR(objs[3], lv_group_get_focused(group));
+
+    lv_group_delete(group);
+    lv_obj_clean(lv_screen_active());
+}
+
+void test_group_remove_keeps_focus(void)
+{
+    lv_group_t * group = lv_group_create();
+
+    lv_obj_t * objs[4];
+    uint32_t i;
+    for(i = 0; i < 4; i++) {
+        objs[i] = lv_button_create(lv_screen_active());
+        lv_group_add_obj(group, objs[i]);
+    }
+
+    lv_group_focus_obj(objs[2]);
+
+    /*Removing an object before the focused one keeps the focus*/
+    lv_obj_delete(objs[0]);
+    TEST_ASSERT_EQUAL_PTR(objs[2], lv_group_get_focused(group));
+    TEST_ASSERT_EQUAL_UINT32(3, lv_group_get_obj_count(group));
+    TEST_ASSERT_EQUAL_PTR(objs[3], lv_group_get_obj_by_index(group, 2));
+
+    /*Removing the focused one moves the focus to the previous object*/
+    lv_group_remove_obj(objs[2]);
+    TEST_ASSERT_EQUAL_PTR(objs[1], lv_group_get_focused(group));
+    TEST_ASSERT_FALSE(lv_obj_has_state(objs[2], LV_STATE_FOCUSED));
+
+    lv_group_swap_obj(objs[1], objs[3]);
+    TEST_ASSERT_EQUAL_PTR(objs[1], lv_group_get_focused(group));
+    TEST_ASSERT_EQUAL_PTR(objs[3], lv_group_get_obj_by_index(group, 0));
+
+    lv_group_remove_all_objs(group);
+    TEST_ASSERT_NULL(lv_group_get_focused(group));
+    TEST_ASSERT_EQUAL_UINT32(0, lv_group_get_obj_count(group));
+
+    lv_group_delete(group);
+    lv_obj_clean(lv_screen_active());
+}
+
+/**
+ * Create a 3x3 grid of buttons and add them to the group in a mixed order
+ * @param mid_ofs   move the middle column down by this amount
+ */
+static void create_grid(lv_group_t * group, lv_obj_t * grid[3][3], int32_t mid_ofs)
+{
+    static const uint32_t order[9] = {4, 8, 0, 2, 6, 1, 7, 3, 5};
+    uint32_t i;
+    for(i = 0; i < 9; i++) {
+        uint32_t row = order[i] / 3;
+        uint32_t col = order[i] % 3;
+        lv_obj_t * btn = lv_button_create(lv_screen_active());
+        lv_obj_set_size(btn, 60, 40);
+        lv_obj_set_pos(btn, col * 100, row * 100 + (col == 1 ? mid_ofs : 0));
+        lv_group_add_obj(group, btn);
+        grid[row][col] = btn;
+    }
+}
+
+void test_group_spatial_focus_dir(void)
+{
+    lv_group_t * group = lv_group_create();
+    lv_group_set_edge_cb(group, edge_cb);
+    edge_cnt = 0;
+
+    lv_obj_t * grid[3][3];
+    create_grid(group, grid, 10);
+    lv_group_focus_obj(grid[1][1]);
+
+    lv_group_focus_dir(group, LV_DIR_RIGHT);
+    TEST_ASSERT_EQUAL_PTR(grid[1][2], lv_group_get_focused(group));
+    lv_group_focus_dir(group, LV_DIR_BOTTOM);
+    TEST_ASSERT_EQUAL_PTR(grid[2][2], lv_group_get_focused(group));
+    lv_group_focus_dir(group, LV_DIR_LEFT);
+    TEST_ASSERT_EQUAL_PTR(grid[2][1], lv_group_get_focused(group));
+    lv_group_focus_dir(group, LV_DIR_LEFT);
+    TEST_ASSERT_EQUAL_PTR(grid[2][0], lv_group_get_focused(group));
+    lv_group_focus_dir(group, LV_DIR_TOP);
+    TEST_ASSERT_EQUAL_PTR(grid[1][0], lv_group_get_focused(group));
+    TEST_ASSERT_EQUAL_UINT32(0, edge_cnt);
+
+    /*No more objects on the left*/
+    lv_group_focus_dir(group, LV_DIR_LEFT);
+    TEST_ASSERT_EQUAL_PTR(grid[1][0], lv_group_get_focused(group));
+    TEST_ASSERT_EQUAL_UINT32(1, edge_cnt);
+    TEST_ASSERT_FALSE(edge_next);
+
+    /*Hidden and disabled objects are skipped*/
+    lv_obj_add_flag(grid[1][1], LV_OBJ_FLAG_HIDDEN);
+    lv_obj_add_state(grid[1][2], LV_STATE_DISABLED);
+    lv_group_focus_dir(group, LV_DIR_RIGHT);
+    TEST_ASSERT_EQUAL_PTR(grid[0][1], lv_group_get_focused(group));
+
+    /*The index follows the objects' position*/
+    lv_obj_set_pos(grid[2][2], 100, 0);
+    lv_obj_set_pos(grid[0][1], 200, 0);
+    lv_group_focus_dir(group, LV_DIR_LEFT);
+    TEST_ASSERT_EQUAL_PTR(grid[2][2], lv_group_get_focused(group));
+    lv_group_focus_dir(group, LV_DIR_LEFT);
+    TEST_ASSERT_EQUAL_PTR(grid[0][0], lv_group_get_focused(group));
+
+    /*And objects removed from the group*/
+    lv_obj_delete(grid[2][2]);
+    lv_group_focus_dir(group, LV_DIR_RIGHT);
+    TEST_ASSERT_EQUAL_PTR(grid[0][1], lv_group_get_focused(group));
+
+    lv_group_delete(group);
+    lv_obj_clean(lv_screen_active());
+}
+
+void test_group_spatial_index_is_kept(void)
+{
+    lv_group_t * group = lv_group_create();
+    lv_obj_t * grid[3][3];
+    create_grid(group, grid, 0);
+    lv_group_focus_obj(grid[1][1]);
+
+    /*Focusing doesn't move the objects, so the index is not updated again*/
+    lv_group_focus_dir(group, LV_DIR_RIGHT);
+    TEST_ASSERT_EQUAL_UINT32(LV_GLOBAL_DEFAULT()->group_spatial_gen, group->spatial_gen);
+    lv_group_focus_dir(group, LV_DIR_TOP);
+    TEST_ASSERT_EQUAL_PTR(grid[0][2], lv_group_get_focused(group));
+    TEST_ASSERT_EQUAL_UINT32(LV_GLOBAL_DEFAULT()->group_spatial_gen, group->spatial_gen);
+
+    /*Moving, hiding and adding objects make it outdated*/
+    lv_obj_set_x(grid[1][0], 300);
+    lv_group_focus_dir(group, LV_DIR_BOTTOM);
+    TEST_ASSERT_EQUAL_PTR(grid[1][2], lv_group_get_focused(group));
+    lv_group_focus_dir(group, LV_DIR_RIGHT);
+    TEST_ASSERT_EQUAL_PTR(grid[1][0], lv_group_get_focused(group));
+
+    lv_obj_add_flag(grid[0][0], LV_OBJ_FLAG_HIDDEN);
+    TEST_ASSERT_NOT_EQUAL(LV_GLOBAL_DEFAULT()->group_spatial_gen, group->spatial_gen);
+
+    lv_group_focus_dir(group, LV_DIR_LEFT);
+    lv_obj_t * btn = lv_button_create(lv_screen_active());
+    lv_obj_set_size(btn, 60, 40);
+    lv_obj_set_pos(btn, 400, 100);
+    lv_obj_update_layout(btn);
+    lv_group_focus_dir(group, LV_DIR_LEFT);
+    lv_group_add_obj(group, btn);
+    TEST_ASSERT_EQUAL_UINT32(0, group->spatial_gen);
+    lv_group_focus_obj(grid[1][0]);
+    lv_group_focus_dir(group, LV_DIR_RIGHT);
+    TEST_ASSERT_EQUAL_PTR(btn, lv_group_get_focused(group));
+
+    lv_group_delete(group);
+    lv_obj_clean(lv_screen_active());
+}
+
+void test_group_spatial_focus_next_in_reading_order(void)
+{
+    lv_group_t * group = lv_group_create();
+    lv_obj_t * grid[3][3];
+    create_grid(group, grid, 0);
+
+    lv_group_set_spatial_nav(group, true);
+    TEST_ASSERT_TRUE(lv_group_get_spatial_nav(group));
+    lv_group_focus_obj(grid[0][0]);
+
+    uint32_t i;
+    for(i = 1; i < 9; i++) {
+        lv_group_focus_next(group);
+        TEST_ASSERT_EQUAL_PTR(grid[i / 3][i % 3], lv_group_get_focused(group));
+    }
+
+    /*Wrap around*/
+    lv_group_focus_next(group);
+    TEST_ASSERT_EQUAL_PTR(grid[0][0], lv_group_get_focused(group));
+    lv_group_focus_prev(group);
+    TEST_ASSERT_EQUAL_PTR(grid[2][2], lv_group_get_focused(group));
+
+    /*Without spatial navigation the order of adding is used*/
+    lv_group_set_spatial_nav(group, false);
+    lv_group_focus_next(group);
+    TEST_ASSERT_EQUAL_PTR(grid[0][0], lv_group_get_focused(group));
+    lv_group_focus_next(group);
+    TEST_ASSERT_EQUAL_PTR(grid[0][2], lv_group_get_focused(group));
+
+    lv_group_delete(group);
+    lv_obj_clean(lv_screen_active());
+}
+
+void test_group_spatial_keypad(void)
+{
+    lv_group_t * group = lv_group_create();
+    lv_indev_set_group(lv_test_indev_get_indev(LV_INDEV_TYPE_KEYPAD), group);
+
+    lv_obj_t * grid[3][3];
+    create_grid(group, grid, 10);
+    lv_obj_t * slider = lv_slider_create(lv_screen_active());
+    lv_obj_set_size(slider, 60, 10);
+    lv_obj_set_pos(slider, 0, 300);
+    lv_group_add_obj(group, slider);
+    lv_group_focus_obj(grid[0][0]);
+
+    /*Arrows are sent to the focused object without spatial navigation*/
+    lv_test_key_hit(LV_KEY_DOWN);
+    TEST_ASSERT_EQUAL_PTR(grid[0][0], lv_group_get_focused(group));
+
+    lv_group_set_spatial_nav(group, true);
+    lv_test_key_hit(LV_KEY_DOWN);
+    TEST_ASSERT_EQUAL_PTR(grid[1][0], lv_group_get_focused(group));
+    lv_test_key_hit(LV_KEY_RIGHT);
+    TEST_ASSERT_EQUAL_PTR(grid[1][1], lv_group_get_focused(group));
+    lv_test_key_hit(LV_KEY_UP);
+    TEST_ASSERT_EQUAL_PTR(grid[0][1], lv_group_get_focused(group));
+
+    /*In edit mode the arrows are sent to the focused object*/
+    lv_group_focus_obj(slider);
+    lv_group_set_editing(group, true);
+    lv_test_key_hit(LV_KEY_RIGHT);
+    TEST_ASSERT_EQUAL_PTR(slider, lv_group_get_focused(group));
+    TEST_ASSERT_EQUAL_INT32(1, lv_slider_get_value(slider));
+
+    lv_group_set_editing(group, false);
+    lv_test_key_hit(LV_KEY_UP);
+    TEST_ASSERT_EQUAL_PTR(grid[2][0], lv_group_get_focused(group));
+
+    lv_group_delete(group);
+    lv_obj_clean(lv_screen_active());
+}
+
 #endif
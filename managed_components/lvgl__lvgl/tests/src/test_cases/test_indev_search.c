@@ -0,0 +1,212 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+static lv_obj_t * cont;
+static uint32_t rnd_state;
+
+void setUp(void)
+{
+    rnd_state = 1234;
+    cont = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(cont, 400, 400);
+    lv_obj_set_pos(cont, 20, 30);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+static int32_t rnd(int32_t min, int32_t max)
+{
+    rnd_state = rnd_state * 1103515245 + 12345;
+    return min + (int32_t)((rnd_state >> 16) % (uint32_t)(max - min + 1));
+}
+
+/**
+ * The search without any index: check all the children from the top to the bottom
+ */
+static lv_obj_t * search_ref(lv_obj_t * obj, const lv_point_t * point)
+{
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return NULL;
+
+    lv_point_t p_trans = *point;
+    lv_obj_transform_point(obj, &p_trans, LV_OBJ_POINT_TRANSFORM_FLAG_INVERSE);
+
+    bool hit_test_ok = lv_obj_hit_test(obj, &p_trans);
+
+    lv_area_t obj_coords;
+    lv_obj_get_coords(obj, &obj_coords);
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_OVERFLOW_VISIBLE)) {
+        int32_t ext_draw_size = lv_obj_get_ext_draw_size(obj);
+        lv_area_increase(&obj_coords, ext_draw_size, ext_draw_size);
+    }
+
+    if(lv_area_is_point_on(&obj_coords, &p_trans, 0)) {
+        int32_t i;
+        for(i = (int32_t)lv_obj_get_child_count(obj) - 1; i >= 0; i--) {
+            lv_obj_t * found = search_ref(lv_obj_get_child(obj, i), &p_trans);
+            if(found) return found;
+        }
+    }
+
+    return hit_test_ok ? obj : NULL;
+}
+
+static void assert_same_as_ref(void)
+{
+    lv_obj_update_layout(lv_screen_active());
+
+    lv_point_t p;
+    for(p.y = 0; p.y < 480; p.y += 8) {
+        for(p.x = 0; p.x < 480; p.x += 8) {
+            lv_obj_t * ref = search_ref(lv_screen_active(), &p);
+            lv_obj_t * found = lv_indev_search_obj(lv_screen_active(), &p);
+            if(ref != found) {
+                char buf[64];
+                lv_snprintf(buf, sizeof(buf), "Different object found at %d;%d", (int)p.x, (int)p.y);
+                TEST_FAIL_MESSAGE(buf);
+            }
+        }
+    }
+}
+
+static void create_children(lv_obj_t * parent, uint32_t cnt)
+{
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        lv_obj_t * obj = lv_obj_create(parent);
+        lv_obj_set_pos(obj, rnd(-20, 560), rnd(-20, 560));
+        lv_obj_set_size(obj, rnd(5, 60), rnd(5, 60));
+
+        switch(rnd(0, 12)) {
+            case 0:
+                lv_obj_add_flag(obj, LV_OBJ_FLAG_HIDDEN);
+                break;
+            case 1:
+                lv_obj_remove_flag(obj, LV_OBJ_FLAG_CLICKABLE);
+                break;
+            case 2:
+                lv_obj_set_ext_click_area(obj, 10);
+                break;
+            case 3:
+                lv_obj_add_flag(obj, LV_OBJ_FLAG_FLOATING);
+                break;
+            case 4:
+                lv_obj_set_style_transform_rotation(obj, 450, 0);
+                break;
+            case 5: {
+                    /*A child sticking out*/
+                    lv_obj_add_flag(obj, LV_OBJ_FLAG_OVERFLOW_VISIBLE);
+                    lv_obj_set_style_shadow_width(obj, 20, 0);
+                    lv_obj_t * child = lv_obj_create(obj);
+                    lv_obj_set_size(child, 20, 20);
+                    lv_obj_set_pos(child, -15, -15);
+                    break;
+                }
+            case 6:
+                /*Large object covering many cells*/
+                lv_obj_set_size(obj, 300, 200);
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+void test_indev_search_many_children(void)
+{
+    create_children(cont, 80);
+    assert_same_as_ref();
+
+    /*Scroll the container*/
+    lv_obj_scroll_to(cont, 40, 70, LV_ANIM_OFF);
+    assert_same_as_ref();
+    lv_obj_scroll_by(cont, 13, -27, LV_ANIM_OFF);
+    assert_same_as_ref();
+
+    /*Move the container too*/
+    lv_obj_set_pos(cont, 50, 0);
+    assert_same_as_ref();
+}
+
+void test_indev_search_after_changes(void)
+{
+    create_children(cont, 80);
+    assert_same_as_ref();
+
+    uint32_t i;
+    for(i = 0; i < 20; i++) {
+        lv_obj_t * obj = lv_obj_get_child(cont, rnd(0, (int32_t)lv_obj_get_child_count(cont) - 1));
+        switch(rnd(0, 11)) {
+            case 0:
+                lv_obj_set_pos(obj, rnd(0, 400), rnd(0, 400));
+                break;
+            case 1:
+                lv_obj_set_size(obj, rnd(5, 100), rnd(5, 100));
+                break;
+            case 2:
+                lv_obj_set_flag(obj, LV_OBJ_FLAG_HIDDEN, !lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN));
+                break;
+            case 3:
+                lv_obj_set_flag(obj, LV_OBJ_FLAG_FLOATING, !lv_obj_has_flag(obj, LV_OBJ_FLAG_FLOATING));
+                break;
+            case 4:
+                lv_obj_move_to_index(obj, -1);
+                break;
+            case 5:
+                lv_obj_move_to_index(obj, 0);
+                break;
+            case 6:
+                lv_obj_delete(obj);
+                break;
+            case 7:
+                lv_obj_set_ext_click_area(obj, rnd(0, 20));
+                break;
+            case 8:
+                lv_obj_set_style_transform_scale(obj, lv_obj_get_style_transform_scale_x(obj, 0) == 256 ? 400 : 256, 0);
+                break;
+            case 9:
+                lv_obj_set_parent(obj, lv_screen_active());
+                break;
+            case 10:
+                lv_obj_swap(obj, lv_obj_get_child(cont, 0));
+                break;
+            default:
+                create_children(cont, 1);
+                break;
+        }
+
+        lv_obj_scroll_by(cont, rnd(-10, 10), rnd(-10, 10), LV_ANIM_OFF);
+        assert_same_as_ref();
+    }
+
+    /*Arrange the children by a layout*/
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_ROW_WRAP);
+    assert_same_as_ref();
+    lv_obj_set_style_pad_column(cont, 17, 0);
+    assert_same_as_ref();
+}
+
+void test_indev_search_nested_transformed(void)
+{
+    /*Children of a transformed container with many children*/
+    lv_obj_set_style_transform_rotation(cont, 200, 0);
+    lv_obj_set_style_transform_scale(cont, 300, 0);
+    create_children(cont, 50);
+    assert_same_as_ref();
+
+    /*Many children in a child too*/
+    lv_obj_t * sub = lv_obj_create(cont);
+    lv_obj_set_size(sub, 200, 200);
+    create_children(sub, 50);
+    assert_same_as_ref();
+
+    lv_obj_scroll_by(sub, 20, 30, LV_ANIM_OFF);
+    assert_same_as_ref();
+}
+
+#endif
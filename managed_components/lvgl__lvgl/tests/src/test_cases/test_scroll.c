@@ -0,0 +1,195 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+static lv_obj_t * cont;
+
+void setUp(void)
+{
+    cont = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(cont, 200, 200);
+    lv_obj_set_pos(cont, 10, 20);
+    lv_obj_set_style_pad_all(cont, 0, 0);
+    lv_obj_set_style_border_width(cont, 0, 0);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+static lv_obj_t * create_box(lv_obj_t * parent, int32_t x, int32_t y, int32_t size)
+{
+    lv_obj_t * obj = lv_obj_create(parent);
+    lv_obj_set_pos(obj, x, y);
+    lv_obj_set_size(obj, size, size);
+    lv_obj_set_style_pad_all(obj, 0, 0);
+    lv_obj_set_style_border_width(obj, 0, 0);
+    return obj;
+}
+
+static void assert_coords(const lv_obj_t * obj, int32_t x1, int32_t y1)
+{
+    lv_area_t a;
+    lv_obj_get_coords(obj, &a);
+    TEST_ASSERT_EQUAL_INT32(x1, a.x1);
+    TEST_ASSERT_EQUAL_INT32(y1, a.y1);
+}
+
+void test_scroll_moves_all_descendants(void)
+{
+    lv_obj_t * child = create_box(cont, 0, 0, 150);
+    lv_obj_t * grandchild = create_box(child, 10, 10, 50);
+    create_box(cont, 0, 400, 50);
+    lv_obj_update_layout(cont);
+
+    lv_obj_scroll_to_y(cont, 30, LV_ANIM_OFF);
+    assert_coords(child, 10, -10);
+    assert_coords(grandchild, 20, 0);
+    TEST_ASSERT_EQUAL_INT32(0, lv_obj_get_y(child));
+    TEST_ASSERT_EQUAL_INT32(30, lv_obj_get_scroll_y(cont));
+
+    lv_obj_scroll_by(cont, 0, -10, LV_ANIM_OFF);
+    lv_obj_scroll_by(cont, 0, -5, LV_ANIM_OFF);
+    assert_coords(grandchild, 20, -15);
+
+    lv_obj_scroll_to_y(cont, 0, LV_ANIM_OFF);
+    assert_coords(child, 10, 20);
+    assert_coords(grandchild, 20, 30);
+}
+
+void test_scroll_nested(void)
+{
+    lv_obj_t * inner = create_box(cont, 0, 0, 100);
+    create_box(cont, 0, 300, 50);
+    lv_obj_t * item = create_box(inner, 0, 0, 50);
+    create_box(inner, 0, 300, 50);
+    lv_obj_update_layout(cont);
+
+    lv_obj_scroll_to_y(inner, 40, LV_ANIM_OFF);
+    lv_obj_scroll_to_y(cont, 25, LV_ANIM_OFF);
+    assert_coords(inner, 10, -5);
+    assert_coords(item, 10, -45);
+
+    /*Scroll the outer first, then the inner again*/
+    lv_obj_scroll_to_y(cont, 5, LV_ANIM_OFF);
+    lv_obj_scroll_to_y(inner, 10, LV_ANIM_OFF);
+    assert_coords(item, 10, 5);
+
+    lv_refr_now(NULL);
+    assert_coords(item, 10, 5);
+}
+
+void test_scroll_floating_child_stays(void)
+{
+    lv_obj_t * floating = create_box(cont, 5, 5, 20);
+    lv_obj_add_flag(floating, LV_OBJ_FLAG_FLOATING);
+    lv_obj_t * child = create_box(cont, 0, 0, 20);
+    create_box(cont, 0, 400, 50);
+    lv_obj_update_layout(cont);
+
+    lv_obj_scroll_to_y(cont, 50, LV_ANIM_OFF);
+    assert_coords(floating, 15, 25);
+    assert_coords(child, 10, -30);
+
+    /*Make it a normal child while scrolled: it should keep its position until the next layout*/
+    lv_obj_remove_flag(floating, LV_OBJ_FLAG_FLOATING);
+    assert_coords(floating, 15, 25);
+    lv_obj_update_layout(cont);
+    assert_coords(floating, 15, -25);
+
+    lv_obj_scroll_to_y(cont, 0, LV_ANIM_OFF);
+    assert_coords(floating, 15, 25);
+    assert_coords(child, 10, 20);
+}
+
+void test_scroll_create_and_reparent(void)
+{
+    create_box(cont, 0, 400, 50);
+    lv_obj_t * other = create_box(lv_screen_active(), 300, 0, 100);
+    lv_obj_update_layout(cont);
+
+    lv_obj_scroll_to_y(cont, 100, LV_ANIM_OFF);
+
+    /*A new child is positioned in the scrolled content*/
+    lv_obj_t * child = create_box(cont, 0, 120, 20);
+    lv_obj_t * grandchild = create_box(child, 2, 2, 10);
+    lv_obj_update_layout(cont);
+    assert_coords(child, 10, 40);
+    assert_coords(grandchild, 12, 42);
+
+    /*Move it to a not scrolled parent*/
+    lv_obj_set_parent(child, other);
+    lv_obj_update_layout(other);
+    assert_coords(child, 300, 120);
+    assert_coords(grandchild, 302, 122);
+
+    lv_obj_set_parent(child, cont);
+    lv_obj_update_layout(cont);
+    assert_coords(grandchild, 12, 42);
+
+    /*Swap it with an object of an other parent*/
+    lv_obj_t * swapped = create_box(other, 0, 0, 20);
+    lv_obj_update_layout(other);
+    lv_obj_swap(child, swapped);
+    lv_obj_mark_layout_as_dirty(child);
+    lv_obj_mark_layout_as_dirty(swapped);
+    lv_obj_update_layout(lv_screen_active());
+    assert_coords(child, 300, 120);
+    assert_coords(grandchild, 302, 122);
+    assert_coords(swapped, 10, -80);
+}
+
+static void click_cb(lv_event_t * e)
+{
+    uint32_t * cnt = lv_event_get_user_data(e);
+    (*cnt)++;
+}
+
+void test_scroll_click_on_scrolled_child(void)
+{
+    uint32_t cnt = 0;
+    create_box(cont, 0, 400, 50);
+    lv_obj_t * child = create_box(cont, 0, 100, 50);
+    lv_obj_t * btn = create_box(child, 0, 0, 20);
+    lv_obj_add_event_cb(btn, click_cb, LV_EVENT_CLICKED, &cnt);
+    lv_refr_now(NULL);
+
+    /*Originally at y = 20 + 100*/
+    lv_obj_scroll_to_y(cont, 80, LV_ANIM_OFF);
+    lv_test_mouse_click_at(15, 45);
+    TEST_ASSERT_EQUAL_UINT32(1, cnt);
+
+    lv_test_mouse_click_at(15, 125);
+    TEST_ASSERT_EQUAL_UINT32(1, cnt);
+}
+
+
+void test_scroll_move_parent_while_scrolled(void)
+{
+    lv_obj_t * child = create_box(cont, 0, 0, 50);
+    lv_obj_t * grandchild = create_box(child, 5, 5, 20);
+    create_box(cont, 0, 400, 50);
+    lv_obj_update_layout(cont);
+
+    /*Move the parent of the scrolled children*/
+    lv_obj_scroll_to_y(cont, 30, LV_ANIM_OFF);
+    lv_obj_set_pos(cont, 60, 70);
+    lv_obj_update_layout(cont);
+    assert_coords(child, 60, 40);
+    assert_coords(grandchild, 65, 45);
+
+    /*Move it again without layout update, e.g. as a custom widget would do*/
+    lv_obj_scroll_to_y(cont, 10, LV_ANIM_OFF);
+    lv_obj_move_children_by(cont, 5, 5, false);
+    assert_coords(child, 65, 65);
+    assert_coords(grandchild, 70, 70);
+    TEST_ASSERT_EQUAL_INT32(5, lv_obj_get_x(child));
+
+    TEST_ASSERT_EQUAL_INT32(70, grandchild->coords.x1);
+    TEST_ASSERT_EQUAL_INT32(70, grandchild->coords.y1);
+}
+
+#endif
@@ -222,4 +222,215 @@ void test_style_has_prop(void)
     lv_style_reset(&style);
 }
 
+void test_style_add_style_list(void)
+{
+    /*Remove the objects of the other tests as they might refer to already freed styles*/
+    lv_obj_clean(lv_screen_active());
+
+    lv_style_t style1;
+    lv_style_t style2;
+    lv_style_t style3;
+    lv_style_init(&style1);
+    lv_style_init(&style2);
+    lv_style_init(&style3);
+    lv_style_set_bg_color(&style1, lv_color_hex(0xff0000));
+    lv_style_set_bg_color(&style2, lv_color_hex(0x00ff00));
+    lv_style_set_radius(&style3, 5);
+
+    lv_obj_t * obj_ref = lv_obj_create(lv_screen_active());
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_t * objs[2] = {obj_ref, obj};
+
+    uint32_t i;
+    for(i = 0; i < 2; i++) {
+        lv_obj_remove_style_all(objs[i]);
+        lv_obj_set_style_bg_opa(objs[i], LV_OPA_50, 0);
+        lv_obj_add_style(objs[i], &style1, 0);
+    }
+
+    /*`style1` is added again so it should be moved to the front*/
+    lv_obj_add_style(obj_ref, &style2, 0);
+    lv_obj_add_style(obj_ref, &style3, LV_PART_INDICATOR | LV_STATE_PRESSED);
+    lv_obj_add_style(obj_ref, &style1, 0);
+
+    const lv_obj_style_t list[3] = {
+        {.style = &style2, .selector = 0},
+        {.style = &style3, .selector = LV_PART_INDICATOR | LV_STATE_PRESSED},
+        {.style = &style1, .selector = 0},
+    };
+    lv_obj_add_style_list(obj, list, 3);
+
+    TEST_ASSERT_EQUAL_UINT32(4, obj->style_cnt);
+    TEST_ASSERT_EQUAL_UINT32(obj_ref->style_cnt, obj->style_cnt);
+    TEST_ASSERT_TRUE(obj->styles[0].is_local);
+    for(i = 1; i < obj->style_cnt; i++) {
+        TEST_ASSERT_EQUAL_PTR(obj_ref->styles[i].style, obj->styles[i].style);
+        TEST_ASSERT_EQUAL_UINT32(obj_ref->styles[i].selector, obj->styles[i].selector);
+    }
+
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0xff0000), lv_obj_get_style_bg_color(obj, 0));
+    TEST_ASSERT_EQUAL_UINT8(LV_OPA_50, lv_obj_get_style_bg_opa(obj, 0));
+    TEST_ASSERT_EQUAL_INT32(0, lv_obj_get_style_radius(obj, LV_PART_INDICATOR));
+    lv_obj_add_state(obj, LV_STATE_PRESSED);
+    TEST_ASSERT_EQUAL_INT32(5, lv_obj_get_style_radius(obj, LV_PART_INDICATOR));
+
+    lv_obj_delete(obj_ref);
+    lv_obj_delete(obj);
+    lv_style_reset(&style1);
+    lv_style_reset(&style2);
+    lv_style_reset(&style3);
+}
+
+static uint32_t get_theme_style_cnt(lv_obj_t * obj)
+{
+    uint32_t cnt = 0;
+    uint32_t i;
+    for(i = 0; i < obj->style_cnt; i++) {
+        if(!obj->styles[i].is_local && !obj->styles[i].is_trans) cnt++;
+    }
+    return cnt;
+}
+
+void test_style_theme_depends_on_parent(void)
+{
+    /*A label gets styles from the default theme only in a text area*/
+    lv_obj_t * label = lv_label_create(lv_screen_active());
+    TEST_ASSERT_EQUAL_UINT32(0, get_theme_style_cnt(label));
+
+    lv_obj_t * ta = lv_textarea_create(lv_screen_active());
+    lv_obj_t * ta_label = lv_obj_get_child(ta, 0);
+    TEST_ASSERT_EQUAL_PTR(&lv_label_class, lv_obj_get_class(ta_label));
+    TEST_ASSERT_EQUAL_UINT32(1, get_theme_style_cnt(ta_label));
+    TEST_ASSERT_EQUAL_UINT32(LV_PART_SELECTED, ta_label->styles[ta_label->style_cnt - 1].selector);
+
+    /*The content area of the tab view has no styles, but the normal objects have*/
+    lv_obj_t * tv = lv_tabview_create(lv_screen_active());
+    TEST_ASSERT_EQUAL_UINT32(0, get_theme_style_cnt(lv_tabview_get_content(tv)));
+    TEST_ASSERT_EQUAL_UINT32(3, get_theme_style_cnt(lv_obj_create(lv_screen_active())));
+
+    /*The buttons of the tab view are styled differently than the normal buttons*/
+    lv_tabview_add_tab(tv, "Tab");
+    lv_obj_t * tab_btn = lv_obj_get_child(lv_tabview_get_tab_bar(tv), 0);
+    lv_obj_t * btn = lv_button_create(lv_screen_active());
+    TEST_ASSERT_EQUAL_PTR(&lv_button_class, lv_obj_get_class(tab_btn));
+    TEST_ASSERT_NOT_EQUAL(get_theme_style_cnt(btn), get_theme_style_cnt(tab_btn));
+
+    lv_obj_clean(lv_screen_active());
+}
+
+#if LV_OBJ_STYLE_DEFERRED_REFRESH
+
+static uint32_t style_changed_cnt;
+
+static void style_changed_event_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    style_changed_cnt++;
+}
+
+static lv_obj_t * create_style_test_cont(void)
+{
+    lv_obj_t * cont = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(cont, 400, LV_SIZE_CONTENT);
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_ROW_WRAP);
+
+    uint32_t i;
+    for(i = 0; i < 20; i++) {
+        lv_obj_t * label = lv_label_create(cont);
+        lv_label_set_text_fmt(label, "Label %d", (int)i);
+        lv_obj_add_event_cb(label, style_changed_event_cb, LV_EVENT_STYLE_CHANGED, NULL);
+    }
+
+    lv_obj_update_layout(cont);
+    return cont;
+}
+
+static void set_many_styles(lv_obj_t * cont)
+{
+    lv_obj_set_style_text_letter_space(cont, 3, 0);
+    lv_obj_set_style_text_line_space(cont, 5, 0);
+    lv_obj_set_style_text_font(cont, &lv_font_montserrat_24, 0);
+    lv_obj_set_style_pad_all(cont, 7, 0);
+    lv_obj_set_style_pad_column(cont, 11, 0);
+    lv_obj_set_style_border_width(cont, 4, 0);
+    lv_obj_set_style_shadow_width(cont, 20, 0);
+    lv_obj_set_style_bg_color(cont, lv_color_hex(0x336699), 0);
+}
+
+void test_style_deferred_refresh_batches_children(void)
+{
+    lv_obj_clean(lv_screen_active());
+    lv_obj_t * cont = create_style_test_cont();
+    int32_t h_before = lv_obj_get_height(cont);
+
+    style_changed_cnt = 0;
+    set_many_styles(cont);
+
+    /*Nothing is refreshed yet, only marked*/
+    TEST_ASSERT_EQUAL_UINT32(0, style_changed_cnt);
+    TEST_ASSERT_NOT_EQUAL(0, cont->style_dirty);
+
+    /*The children are notified only once about all the inherited changes*/
+    lv_obj_update_layout(cont);
+    TEST_ASSERT_EQUAL_UINT32(20, style_changed_cnt);
+    TEST_ASSERT_EQUAL(0, cont->style_dirty);
+
+    /*The larger font and paddings are applied*/
+    TEST_ASSERT_GREATER_THAN_INT32(h_before, lv_obj_get_height(cont));
+    TEST_ASSERT_EQUAL_INT32(lv_font_montserrat_24.line_height, lv_obj_get_height(lv_obj_get_child(cont, 0)));
+    TEST_ASSERT_GREATER_OR_EQUAL_INT32(lv_obj_get_style_shadow_width(cont, 0) / 2, lv_obj_get_ext_draw_size(cont));
+
+    lv_obj_delete(cont);
+}
+
+void test_style_deferred_refresh_same_result(void)
+{
+    lv_obj_clean(lv_screen_active());
+    lv_obj_t * cont = create_style_test_cont();
+    set_many_styles(cont);
+
+    /*`lv_snapshot_take` updates the layout*/
+    lv_draw_buf_t * snapshot_deferred = lv_snapshot_take(cont, LV_COLOR_FORMAT_ARGB8888);
+    TEST_ASSERT_NOT_NULL(snapshot_deferred);
+
+    /*Refresh everything immediately as without the deferred refresh*/
+    lv_obj_report_style_change(NULL);
+    lv_draw_buf_t * snapshot_full = lv_snapshot_take(cont, LV_COLOR_FORMAT_ARGB8888);
+    TEST_ASSERT_NOT_NULL(snapshot_full);
+
+    TEST_ASSERT_EQUAL_UINT32(snapshot_full->header.w, snapshot_deferred->header.w);
+    TEST_ASSERT_EQUAL_UINT32(snapshot_full->header.h, snapshot_deferred->header.h);
+    TEST_ASSERT_EQUAL_MEMORY(snapshot_full->data, snapshot_deferred->data, snapshot_full->data_size);
+
+    lv_draw_buf_destroy(snapshot_deferred);
+    lv_draw_buf_destroy(snapshot_full);
+    lv_obj_delete(cont);
+}
+
+void test_style_deferred_refresh_delete_marked(void)
+{
+    lv_obj_clean(lv_screen_active());
+    lv_obj_t * cont = create_style_test_cont();
+    lv_obj_t * label = lv_obj_get_child(cont, 0);
+    lv_obj_set_style_width(label, 100, 0);
+    set_many_styles(cont);
+
+    lv_array_t * dirty_objs = &LV_GLOBAL_DEFAULT()->style_dirty_objs;
+    TEST_ASSERT_EQUAL_UINT32(2, lv_array_size(dirty_objs));
+    TEST_ASSERT_EQUAL_UINT32(0, label->style_dirty_idx);
+    TEST_ASSERT_EQUAL_UINT32(1, cont->style_dirty_idx);
+
+    /*Deleting marked objects shouldn't leave dangling pointers. The last one takes the place of the deleted one*/
+    lv_obj_delete(label);
+    TEST_ASSERT_EQUAL_UINT32(1, lv_array_size(dirty_objs));
+    TEST_ASSERT_EQUAL_UINT32(0, cont->style_dirty_idx);
+    TEST_ASSERT_EQUAL_PTR(cont, *(lv_obj_t **)lv_array_at(dirty_objs, 0));
+
+    lv_obj_delete(cont);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_array_size(dirty_objs));
+    lv_obj_update_layout(lv_screen_active());
+}
+
+#endif
+
 #endif
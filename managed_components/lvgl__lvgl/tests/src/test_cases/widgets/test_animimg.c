@@ -26,6 +26,12 @@ void test_animimg_get_src_count(void);
 void test_animimg_set_duration(void);
 void test_animimg_set_repeat_count_infinite(void);
 void test_animimg_start(void);
+void test_animimg_atlas(void);
+void test_animimg_atlas_compact_color_format(void);
+void test_animimg_atlas_too_large(void);
+void test_animimg_atlas_different_sizes(void);
+void test_animimg_atlas_deleted_on_new_src(void);
+void test_animimg_atlas_color_formats(void);
 
 void setUp(void)
 {
@@ -140,4 +146,139 @@ void test_animimg_property(void)
 #endif
 }
 
+static void play_to_second_picture(void)
+{
+    lv_animimg_set_src(animimg, (const void **) anim_imgs, 3);
+    lv_animimg_set_duration(animimg, 300);
+    lv_animimg_start(animimg);
+    lv_test_wait(150);
+    lv_animimg_delete(animimg);
+}
+
+void test_animimg_atlas(void)
+{
+    lv_obj_set_style_bg_color(active_screen, lv_color_hex(0x303040), 0);
+    lv_obj_center(animimg);
+    play_to_second_picture();
+    TEST_ASSERT_EQUAL_PTR(anim_imgs[1], lv_image_get_src(animimg));
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/animimg_picture.png");
+
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_animimg_create_atlas(animimg, LV_COLOR_FORMAT_ARGB8888, 1024 * 1024));
+    uint32_t stride = lv_draw_buf_width_to_stride(test_animimg001.header.w, LV_COLOR_FORMAT_ARGB8888);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(3 * stride * test_animimg001.header.h, lv_animimg_get_atlas_size(animimg));
+
+    /*The current picture is shown from the atlas immediately*/
+    const lv_image_dsc_t * src = lv_image_get_src(animimg);
+    lv_animimg_t * animimg_p = (lv_animimg_t *)animimg;
+    TEST_ASSERT_EQUAL_PTR(&animimg_p->atlas_frames[1], src);
+    TEST_ASSERT_EQUAL_UINT32(test_animimg001.header.w, src->header.w);
+    TEST_ASSERT_EQUAL_UINT32(test_animimg001.header.h, src->header.h);
+
+    /*The same as the original picture except for the rounding of the blending*/
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/animimg_atlas.png");
+
+    /*Playing uses the atlas*/
+    lv_animimg_start(animimg);
+    lv_test_wait(100);
+    src = lv_image_get_src(animimg);
+    TEST_ASSERT_TRUE(src >= &animimg_p->atlas_frames[0] && src <= &animimg_p->atlas_frames[2]);
+    lv_animimg_delete(animimg);
+
+    lv_animimg_delete_atlas(animimg);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_animimg_get_atlas_size(animimg));
+    TEST_ASSERT_EQUAL_PTR(anim_imgs[animimg_p->pic_idx], lv_image_get_src(animimg));
+
+    lv_obj_remove_local_style_prop(active_screen, LV_STYLE_BG_COLOR, 0);
+}
+
+void test_animimg_atlas_compact_color_format(void)
+{
+    play_to_second_picture();
+
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_animimg_create_atlas(animimg, LV_COLOR_FORMAT_RGB565, 1024 * 1024));
+    uint32_t size_565 = lv_animimg_get_atlas_size(animimg);
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_animimg_create_atlas(animimg, LV_COLOR_FORMAT_ARGB8888, 1024 * 1024));
+    uint32_t size_8888 = lv_animimg_get_atlas_size(animimg);
+    TEST_ASSERT_LESS_THAN_UINT32(size_8888, size_565);
+
+    const lv_image_dsc_t * src = lv_image_get_src(animimg);
+    TEST_ASSERT_EQUAL(LV_COLOR_FORMAT_ARGB8888, src->header.cf);
+
+    /*Not supported color format*/
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_animimg_create_atlas(animimg, LV_COLOR_FORMAT_I4, 1024 * 1024));
+    TEST_ASSERT_EQUAL_UINT32(0, lv_animimg_get_atlas_size(animimg));
+}
+
+void test_animimg_atlas_color_formats(void)
+{
+    static const lv_color_format_t cfs[] = {
+        LV_COLOR_FORMAT_RGB565,
+        LV_COLOR_FORMAT_RGB888,
+        LV_COLOR_FORMAT_XRGB8888,
+        LV_COLOR_FORMAT_ARGB8888,
+        LV_COLOR_FORMAT_L8,
+    };
+
+    lv_obj_center(animimg);
+    play_to_second_picture();
+
+    uint32_t i;
+    for(i = 0; i < sizeof(cfs) / sizeof(cfs[0]); i++) {
+        TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_animimg_create_atlas(animimg, cfs[i], 1024 * 1024));
+
+        /*The pictures are really drawn into the atlas*/
+        const lv_image_dsc_t * src = lv_image_get_src(animimg);
+        TEST_ASSERT_EQUAL(cfs[i], src->header.cf);
+        uint32_t j;
+        uint32_t set_cnt = 0;
+        for(j = 0; j < src->data_size; j++) {
+            if(src->data[j] != 0) set_cnt++;
+        }
+        TEST_ASSERT_GREATER_THAN_UINT32(src->data_size / 4, set_cnt);
+
+        lv_refr_now(NULL);
+    }
+
+    /*No layer can be drawn with these formats*/
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_animimg_create_atlas(animimg, LV_COLOR_FORMAT_ARGB8565, 1024 * 1024));
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_animimg_create_atlas(animimg, LV_COLOR_FORMAT_A8, 1024 * 1024));
+    TEST_ASSERT_EQUAL_UINT32(0, lv_animimg_get_atlas_size(animimg));
+}
+
+void test_animimg_atlas_too_large(void)
+{
+    play_to_second_picture();
+
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_animimg_create_atlas(animimg, LV_COLOR_FORMAT_ARGB8888, 10 * 1024));
+    TEST_ASSERT_EQUAL_UINT32(0, lv_animimg_get_atlas_size(animimg));
+    TEST_ASSERT_EQUAL_PTR(anim_imgs[1], lv_image_get_src(animimg));
+}
+
+void test_animimg_atlas_different_sizes(void)
+{
+    LV_IMAGE_DECLARE(test_image_cogwheel_argb8888);
+    static const void * mixed_imgs[2] = {
+        &test_animimg001,
+        &test_image_cogwheel_argb8888,
+    };
+
+    lv_animimg_set_src(animimg, mixed_imgs, 2);
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_animimg_create_atlas(animimg, LV_COLOR_FORMAT_ARGB8888, 1024 * 1024));
+    TEST_ASSERT_EQUAL_UINT32(0, lv_animimg_get_atlas_size(animimg));
+}
+
+void test_animimg_atlas_deleted_on_new_src(void)
+{
+    play_to_second_picture();
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_animimg_create_atlas(animimg, LV_COLOR_FORMAT_ARGB8888, 1024 * 1024));
+
+    lv_animimg_set_src(animimg, (const void **) anim_imgs, 2);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_animimg_get_atlas_size(animimg));
+    TEST_ASSERT_EQUAL_PTR(anim_imgs[1], lv_image_get_src(animimg));
+
+    /*Deleting the widget frees the atlas too*/
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_animimg_create_atlas(animimg, LV_COLOR_FORMAT_RGB565, 1024 * 1024));
+    lv_obj_delete(animimg);
+}
+
 #endif
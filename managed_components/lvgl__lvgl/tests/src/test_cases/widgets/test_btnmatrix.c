@@ -456,4 +456,112 @@ void test_button_matrix_focused_event_works(void)
     TEST_ASSERT_TRUE(event_triggered);
 }
 
+
+static void check_only_button_invalidated(uint32_t btn_id)
+{
+    lv_display_t * disp = lv_display_get_default();
+    lv_buttonmatrix_t * btnm_p = (lv_buttonmatrix_t *)btnm;
+
+    lv_area_t btn_area = btnm_p->button_areas[btn_id];
+    lv_area_move(&btn_area, btnm->coords.x1, btnm->coords.y1);
+
+    TEST_ASSERT_GREATER_THAN_UINT32(0, disp->inv_p);
+    uint32_t i;
+    bool btn_covered = false;
+    for(i = 0; i < disp->inv_p; i++) {
+        /*The whole matrix shouldn't be redrawn*/
+        TEST_ASSERT_FALSE(lv_area_is_in(&btnm->coords, &disp->inv_areas[i], 0));
+        if(lv_area_is_in(&btn_area, &disp->inv_areas[i], 0)) btn_covered = true;
+    }
+    TEST_ASSERT_TRUE(btn_covered);
+}
+
+void test_button_matrix_press_invalidates_only_the_button(void)
+{
+    static const char * btn_map[] = {"A", "B", "C", "\n", "D", "E", "F", "\n", "G", "H", "I", ""};
+    lv_obj_set_size(btnm, 300, 300);
+    lv_buttonmatrix_set_map(btnm, btn_map);
+    lv_refr_now(NULL);
+
+    lv_buttonmatrix_t * btnm_p = (lv_buttonmatrix_t *)btnm;
+    lv_indev_t * indev = lv_test_indev_get_indev(LV_INDEV_TYPE_POINTER);
+    lv_area_t btn_area = btnm_p->button_areas[4];
+    lv_area_move(&btn_area, btnm->coords.x1, btnm->coords.y1);
+
+    lv_test_mouse_move_to((btn_area.x1 + btn_area.x2) / 2, (btn_area.y1 + btn_area.y2) / 2);
+    lv_test_mouse_press();
+    lv_indev_read(indev);
+    TEST_ASSERT_EQUAL_UINT32(4, lv_buttonmatrix_get_selected_button(btnm));
+    check_only_button_invalidated(4);
+    lv_refr_now(NULL);
+
+    lv_test_mouse_release();
+    lv_indev_read(indev);
+    check_only_button_invalidated(4);
+    lv_refr_now(NULL);
+}
+
+static bool whole_matrix_invalidated(void)
+{
+    lv_display_t * disp = lv_display_get_default();
+    uint32_t i;
+    for(i = 0; i < disp->inv_p; i++) {
+        if(lv_area_is_in(&btnm->coords, &disp->inv_areas[i], 0)) return true;
+    }
+    return false;
+}
+
+void test_button_matrix_press_with_item_shadow_redraws_the_matrix(void)
+{
+    static const char * btn_map[] = {"A", "B", ""};
+    lv_obj_set_size(btnm, 300, 100);
+    lv_buttonmatrix_set_map(btnm, btn_map);
+    lv_refr_now(NULL);
+
+    /*Without extra draw size difference only the button is redrawn*/
+    lv_obj_add_state(btnm, LV_STATE_PRESSED);
+    TEST_ASSERT_FALSE(whole_matrix_invalidated());
+    lv_obj_remove_state(btnm, LV_STATE_PRESSED);
+    lv_refr_now(NULL);
+
+    /*The shadow of the pressed buttons can be larger than the gaps between them*/
+    lv_obj_set_style_shadow_width(btnm, 0, LV_PART_ITEMS);
+    lv_obj_set_style_shadow_width(btnm, 40, LV_PART_ITEMS | LV_STATE_PRESSED);
+    lv_refr_now(NULL);
+    lv_obj_add_state(btnm, LV_STATE_PRESSED);
+    TEST_ASSERT_TRUE(whole_matrix_invalidated());
+    lv_refr_now(NULL);
+
+    lv_obj_remove_state(btnm, LV_STATE_PRESSED);
+    TEST_ASSERT_TRUE(whole_matrix_invalidated());
+    lv_refr_now(NULL);
+}
+
+void test_button_matrix_text_size_cache(void)
+{
+    static const char * btn_map[] = {"A", "#ff0000 Red#", ""};
+    lv_obj_set_size(btnm, 300, 100);
+    lv_buttonmatrix_set_map(btnm, btn_map);
+    lv_refr_now(NULL);
+
+    lv_buttonmatrix_t * btnm_p = (lv_buttonmatrix_t *)btnm;
+    TEST_ASSERT_GREATER_OR_EQUAL_INT32(0, btnm_p->text_sizes[1].x);
+    int32_t w_plain = btnm_p->text_sizes[1].x;
+
+    /*Recoloring removes the command characters so the size has to be measured again*/
+    lv_buttonmatrix_set_button_ctrl(btnm, 1, LV_BUTTONMATRIX_CTRL_RECOLOR);
+    TEST_ASSERT_LESS_THAN_INT32(0, btnm_p->text_sizes[1].x);
+    lv_refr_now(NULL);
+    TEST_ASSERT_LESS_THAN_INT32(w_plain, btnm_p->text_sizes[1].x);
+
+    /*Style changes invalidate the cache*/
+    int32_t w_red = btnm_p->text_sizes[1].x;
+    lv_obj_set_style_text_letter_space(btnm, 10, LV_PART_ITEMS);
+    lv_refr_now(NULL);
+    TEST_ASSERT_GREATER_THAN_INT32(w_red, btnm_p->text_sizes[1].x);
+    lv_obj_set_style_text_letter_space(btnm, 0, LV_PART_ITEMS);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_INT32(w_red, btnm_p->text_sizes[1].x);
+}
+
 #endif
@@ -255,4 +255,85 @@ void test_calendar_chinese_calendar(void)
     TEST_ASSERT_EQUAL_SCREENSHOT("widgets/calendar_09.png");
 }
 
+static lv_area_t get_cell_area(uint32_t cell)
+{
+    lv_obj_t * btnm = lv_calendar_get_btnmatrix(g_calendar);
+    lv_area_t area = ((lv_buttonmatrix_t *)btnm)->button_areas[cell + 7];
+    lv_area_move(&area, btnm->coords.x1, btnm->coords.y1);
+    return area;
+}
+
+void test_calendar_highlight_invalidates_only_changed_cells(void)
+{
+    static lv_calendar_date_t highlighted_days[2];
+    highlighted_days[0].year = 2022;
+    highlighted_days[0].month = 2;
+    highlighted_days[0].day = 11;
+    highlighted_days[1].year = 2022;
+    highlighted_days[1].month = 3;
+    highlighted_days[1].day = 11;
+
+    lv_obj_set_size(g_calendar, 400, 400);
+    lv_calendar_set_month_shown(g_calendar, 2022, 2);
+    lv_refr_now(NULL);
+
+    lv_calendar_set_highlighted_dates(g_calendar, highlighted_days, 2);
+
+    lv_display_t * disp = lv_display_get_default();
+    lv_obj_t * btnm = lv_calendar_get_btnmatrix(g_calendar);
+    lv_area_t cell_area = get_cell_area(lv_calendar_get_day_of_week(2022, 2, 1) + 10);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, disp->inv_p);
+    uint32_t i;
+    bool cell_covered = false;
+    for(i = 0; i < disp->inv_p; i++) {
+        TEST_ASSERT_FALSE(lv_area_is_in(&btnm->coords, &disp->inv_areas[i], 0));
+        if(lv_area_is_in(&cell_area, &disp->inv_areas[i], 0)) cell_covered = true;
+    }
+    TEST_ASSERT_TRUE(cell_covered);
+    lv_refr_now(NULL);
+
+    /*Setting the same dates again changes nothing*/
+    lv_calendar_set_highlighted_dates(g_calendar, highlighted_days, 2);
+    TEST_ASSERT_EQUAL_UINT32(0, disp->inv_p);
+}
+
+void test_calendar_month_flip_reuses_unchanged_cells(void)
+{
+    lv_calendar_t * calendar = (lv_calendar_t *)g_calendar;
+    lv_display_t * disp = lv_display_get_default();
+
+    /*2023 January and October both start on Sunday and have 31 days*/
+    lv_calendar_set_month_shown(g_calendar, 2023, 1);
+    const char * cell_txt = calendar->map[7 + 10];
+    lv_refr_now(NULL);
+
+    lv_calendar_set_month_shown(g_calendar, 2023, 10);
+    TEST_ASSERT_EQUAL_UINT32(0, disp->inv_p);
+    TEST_ASSERT_EQUAL_PTR(cell_txt, calendar->map[7 + 10]);
+    TEST_ASSERT_EQUAL_UINT16(2023, lv_calendar_get_showed_date(g_calendar)->year);
+    TEST_ASSERT_EQUAL_UINT8(10, lv_calendar_get_showed_date(g_calendar)->month);
+
+    /*2023 November has different days in every cell*/
+    lv_calendar_set_month_shown(g_calendar, 2023, 11);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, disp->inv_p);
+    TEST_ASSERT_EQUAL_STRING("1", calendar->nums[lv_calendar_get_day_of_week(2023, 11, 1)]);
+}
+
+void test_calendar_get_pressed_date(void)
+{
+    lv_calendar_set_month_shown(g_calendar, 2024, 2);
+    lv_obj_t * btnm = lv_calendar_get_btnmatrix(g_calendar);
+    lv_buttonmatrix_set_selected_button(btnm, 7 + lv_calendar_get_day_of_week(2024, 2, 1) + 28);
+
+    lv_calendar_date_t date;
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_calendar_get_pressed_date(g_calendar, &date));
+    TEST_ASSERT_EQUAL_UINT16(2024, date.year);
+    TEST_ASSERT_EQUAL_UINT8(2, date.month);
+    TEST_ASSERT_EQUAL_UINT8(29, date.day);
+
+    /*Day names are not dates*/
+    lv_buttonmatrix_set_selected_button(btnm, 3);
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_calendar_get_pressed_date(g_calendar, &date));
+}
+
 #endif  /* LV_BUILD_TEST */
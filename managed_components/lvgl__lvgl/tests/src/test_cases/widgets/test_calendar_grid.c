@@ -0,0 +1,125 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+
+#include "unity/unity.h"
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_calendar_grid_leap_year(void)
+{
+    TEST_ASSERT_TRUE(lv_calendar_is_leap_year(2024));
+    TEST_ASSERT_TRUE(lv_calendar_is_leap_year(2000));
+    TEST_ASSERT_FALSE(lv_calendar_is_leap_year(1900));
+    TEST_ASSERT_FALSE(lv_calendar_is_leap_year(2023));
+}
+
+void test_calendar_grid_month_length(void)
+{
+    static const uint8_t lengths[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    int32_t m;
+    for(m = 1; m <= 12; m++) {
+        TEST_ASSERT_EQUAL_UINT8(lengths[m - 1], lv_calendar_get_month_length(2023, m));
+    }
+
+    TEST_ASSERT_EQUAL_UINT8(29, lv_calendar_get_month_length(2024, 2));
+
+    /*Months out of range step into the adjacent years*/
+    TEST_ASSERT_EQUAL_UINT8(31, lv_calendar_get_month_length(2024, 0));    /*2023 December*/
+    TEST_ASSERT_EQUAL_UINT8(29, lv_calendar_get_month_length(2023, 14));   /*2024 February*/
+}
+
+void test_calendar_grid_day_of_week(void)
+{
+#if LV_CALENDAR_WEEK_STARTS_MONDAY
+    const uint8_t monday = 0;
+#else
+    const uint8_t monday = 1;
+#endif
+    TEST_ASSERT_EQUAL_UINT8(monday, lv_calendar_get_day_of_week(2024, 1, 1));
+    TEST_ASSERT_EQUAL_UINT8((monday + 3) % 7, lv_calendar_get_day_of_week(2024, 2, 29));   /*Thursday*/
+    TEST_ASSERT_EQUAL_UINT8((monday + 6) % 7, lv_calendar_get_day_of_week(2023, 1, 1));    /*Sunday*/
+}
+
+void test_calendar_grid_layout(void)
+{
+    lv_calendar_grid_t grid;
+    lv_calendar_date_t date;
+
+    /*2024 March starts on a Friday*/
+    lv_calendar_grid_init(&grid, 2024, 3);
+    TEST_ASSERT_EQUAL_UINT8(lv_calendar_get_day_of_week(2024, 3, 1), grid.first_cell);
+    TEST_ASSERT_EQUAL_UINT8(31, grid.month_len);
+    TEST_ASSERT_EQUAL_UINT8(29, grid.prev_month_len);
+
+    lv_calendar_grid_get_date(&grid, 0, &date);
+    TEST_ASSERT_EQUAL_UINT16(2024, date.year);
+    TEST_ASSERT_EQUAL_UINT8(2, date.month);
+    TEST_ASSERT_EQUAL_UINT8(29 - grid.first_cell + 1, date.day);
+    TEST_ASSERT_FALSE(lv_calendar_grid_is_in_month(&grid, 0));
+
+    lv_calendar_grid_get_date(&grid, grid.first_cell, &date);
+    TEST_ASSERT_EQUAL_UINT8(3, date.month);
+    TEST_ASSERT_EQUAL_UINT8(1, date.day);
+    TEST_ASSERT_TRUE(lv_calendar_grid_is_in_month(&grid, grid.first_cell));
+
+    lv_calendar_grid_get_date(&grid, grid.first_cell + 31, &date);
+    TEST_ASSERT_EQUAL_UINT8(4, date.month);
+    TEST_ASSERT_EQUAL_UINT8(1, date.day);
+    TEST_ASSERT_FALSE(lv_calendar_grid_is_in_month(&grid, grid.first_cell + 31));
+
+    lv_calendar_grid_get_date(&grid, LV_CALENDAR_GRID_CELL_CNT - 1, &date);
+    TEST_ASSERT_EQUAL_UINT8(4, date.month);
+    TEST_ASSERT_EQUAL_UINT8(LV_CALENDAR_GRID_CELL_CNT - grid.first_cell - 31, date.day);
+}
+
+void test_calendar_grid_year_boundaries(void)
+{
+    lv_calendar_grid_t grid;
+    lv_calendar_date_t date;
+
+    lv_calendar_grid_init(&grid, 2025, 1);
+    TEST_ASSERT_EQUAL_UINT8(31, grid.prev_month_len);
+    lv_calendar_grid_get_date(&grid, 0, &date);
+    if(grid.first_cell > 0) {
+        TEST_ASSERT_EQUAL_UINT16(2024, date.year);
+        TEST_ASSERT_EQUAL_UINT8(12, date.month);
+    }
+
+    lv_calendar_grid_init(&grid, 2024, 12);
+    lv_calendar_grid_get_date(&grid, LV_CALENDAR_GRID_CELL_CNT - 1, &date);
+    TEST_ASSERT_EQUAL_UINT16(2025, date.year);
+    TEST_ASSERT_EQUAL_UINT8(1, date.month);
+}
+
+void test_calendar_grid_find_date(void)
+{
+    lv_calendar_grid_t grid;
+    lv_calendar_grid_init(&grid, 2024, 2);
+
+    lv_calendar_date_t date = {2024, 2, 29};
+    int32_t cell = lv_calendar_grid_find_date(&grid, &date);
+    TEST_ASSERT_EQUAL_INT32(grid.first_cell + 28, cell);
+
+    lv_calendar_date_t found;
+    lv_calendar_grid_get_date(&grid, cell, &found);
+    TEST_ASSERT_EQUAL_UINT16(date.year, found.year);
+    TEST_ASSERT_EQUAL_UINT8(date.month, found.month);
+    TEST_ASSERT_EQUAL_UINT8(date.day, found.day);
+
+    /*Other months and invalid days are not found even if they are visible*/
+    date.day = 30;
+    TEST_ASSERT_EQUAL_INT32(-1, lv_calendar_grid_find_date(&grid, &date));
+    date.day = 0;
+    TEST_ASSERT_EQUAL_INT32(-1, lv_calendar_grid_find_date(&grid, &date));
+    date.month = 3;
+    date.day = 1;
+    TEST_ASSERT_EQUAL_INT32(-1, lv_calendar_grid_find_date(&grid, &date));
+}
+
+#endif
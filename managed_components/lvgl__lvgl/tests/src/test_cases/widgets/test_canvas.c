@@ -90,6 +90,135 @@ void test_canvas_functions_invalidate(void)
     TEST_ASSERT(draw_counter == 4);
 }
 
+void test_canvas_write_session_invalidates_only_dirty_areas(void)
+{
+    lv_obj_t * canvas = lv_canvas_create(g_screen_active);
+    lv_obj_set_pos(canvas, 10, 20);
+
+    LV_DRAW_BUF_DEFINE_STATIC(draw_buf, 100, 100, LV_COLOR_FORMAT_RGB888);
+    LV_DRAW_BUF_INIT_STATIC(draw_buf);
+    canvas_draw_buf_reshape(&draw_buf);
+    lv_canvas_set_draw_buf(canvas, &draw_buf);
+    lv_canvas_fill_bg(canvas, lv_color_white(), LV_OPA_COVER);
+    lv_refr_now(NULL);
+
+    lv_display_t * disp = lv_display_get_default();
+
+    lv_canvas_begin_write(canvas);
+    /*A horizontal run is merged into one area*/
+    int32_t x;
+    for(x = 5; x < 15; x++) lv_canvas_set_px(canvas, x, 5, lv_color_black(), LV_OPA_COVER);
+    lv_canvas_set_px(canvas, 90, 90, lv_color_black(), LV_OPA_COVER);
+
+    /*Nested session shouldn't invalidate on its end*/
+    lv_canvas_begin_write(canvas);
+    lv_canvas_set_px(canvas, 50, 50, lv_color_black(), LV_OPA_COVER);
+    lv_canvas_end_write(canvas);
+    TEST_ASSERT_EQUAL_UINT32(0, disp->inv_p);
+
+    lv_canvas_end_write(canvas);
+    TEST_ASSERT_EQUAL_UINT32(3, disp->inv_p);
+
+    lv_area_t a1 = {15, 25, 24, 25};
+    lv_area_t a2 = {100, 110, 100, 110};
+    lv_area_t a3 = {60, 70, 60, 70};
+    TEST_ASSERT_TRUE(lv_area_is_equal(&a1, &disp->inv_areas[0]));
+    TEST_ASSERT_TRUE(lv_area_is_equal(&a2, &disp->inv_areas[1]));
+    TEST_ASSERT_TRUE(lv_area_is_equal(&a3, &disp->inv_areas[2]));
+    lv_refr_now(NULL);
+
+    /*More scattered pixels than tracked areas are still covered*/
+    lv_canvas_begin_write(canvas);
+    int32_t i;
+    for(i = 0; i < 10; i++) lv_canvas_set_px(canvas, i * 10, i * 10, lv_color_black(), LV_OPA_COVER);
+    lv_canvas_end_write(canvas);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(LV_CANVAS_DIRTY_AREA_MAX, disp->inv_p);
+    for(i = 0; i < 10; i++) {
+        uint32_t j;
+        bool covered = false;
+        lv_point_t p = {10 + i * 10, 20 + i * 10};
+        for(j = 0; j < disp->inv_p; j++) covered |= lv_area_is_point_on(&disp->inv_areas[j], &p, 0);
+        TEST_ASSERT_TRUE(covered);
+    }
+    lv_refr_now(NULL);
+}
+
+void test_canvas_write_area(void)
+{
+    lv_obj_t * canvas = lv_canvas_create(g_screen_active);
+
+    LV_DRAW_BUF_DEFINE_STATIC(draw_buf, 40, 30, LV_COLOR_FORMAT_ARGB8888);
+    LV_DRAW_BUF_INIT_STATIC(draw_buf);
+    canvas_draw_buf_reshape(&draw_buf);
+    lv_canvas_set_draw_buf(canvas, &draw_buf);
+    lv_canvas_fill_bg(canvas, lv_color_white(), LV_OPA_COVER);
+    lv_refr_now(NULL);
+
+    uint32_t stride;
+    lv_area_t area = {30, 10, 49, 12};
+
+    /*Only allowed in a session*/
+    TEST_ASSERT_NULL(lv_canvas_get_write_area(canvas, &area, &stride));
+
+    lv_canvas_begin_write(canvas);
+    uint8_t * row = lv_canvas_get_write_area(canvas, &area, &stride);
+    TEST_ASSERT_NOT_NULL(row);
+    TEST_ASSERT_EQUAL_UINT32(draw_buf.header.stride, stride);
+
+    /*The area is clipped to the buffer: 10 px wide, 3 rows*/
+    int32_t x, y;
+    for(y = 0; y < 3; y++) {
+        lv_color32_t * px = (lv_color32_t *)row;
+        for(x = 0; x < 10; x++) px[x] = lv_color32_make(0xff, 0, 0, 0xff);
+        row += stride;
+    }
+    lv_canvas_end_write(canvas);
+
+    lv_display_t * disp = lv_display_get_default();
+    TEST_ASSERT_EQUAL_UINT32(1, disp->inv_p);
+    lv_area_t expected = {30, 10, 39, 12};
+    lv_area_move(&expected, canvas->coords.x1, canvas->coords.y1);
+    TEST_ASSERT_TRUE(lv_area_is_equal(&expected, &disp->inv_areas[0]));
+
+    TEST_ASSERT_EQUAL_UINT8(0xff, lv_canvas_get_px(canvas, 30, 10).red);
+    TEST_ASSERT_EQUAL_UINT8(0xff, lv_canvas_get_px(canvas, 39, 12).red);
+    TEST_ASSERT_EQUAL_UINT8(0xff, lv_canvas_get_px(canvas, 29, 10).blue);
+    TEST_ASSERT_EQUAL_UINT8(0xff, lv_canvas_get_px(canvas, 30, 13).blue);
+
+    lv_area_t out = {50, 50, 60, 60};
+    lv_canvas_begin_write(canvas);
+    TEST_ASSERT_NULL(lv_canvas_get_write_area(canvas, &out, &stride));
+    lv_canvas_end_write(canvas);
+    lv_refr_now(NULL);
+}
+
+void test_canvas_finish_layer_invalidates_drawn_area(void)
+{
+    lv_obj_t * canvas = lv_canvas_create(g_screen_active);
+
+    LV_DRAW_BUF_DEFINE_STATIC(draw_buf, 100, 100, LV_COLOR_FORMAT_NATIVE);
+    LV_DRAW_BUF_INIT_STATIC(draw_buf);
+    canvas_draw_buf_reshape(&draw_buf);
+    lv_canvas_set_draw_buf(canvas, &draw_buf);
+    lv_canvas_fill_bg(canvas, lv_color_white(), LV_OPA_COVER);
+    lv_refr_now(NULL);
+
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+    lv_draw_rect_dsc_t rect_dsc;
+    lv_draw_rect_dsc_init(&rect_dsc);
+    rect_dsc.bg_color = lv_color_black();
+    lv_area_t rect_area = {20, 30, 39, 49};
+    lv_draw_rect(&layer, &rect_dsc, &rect_area);
+    lv_canvas_finish_layer(canvas, &layer);
+
+    lv_display_t * disp = lv_display_get_default();
+    TEST_ASSERT_EQUAL_UINT32(1, disp->inv_p);
+    TEST_ASSERT_TRUE(lv_area_is_in(&disp->inv_areas[0], &canvas->coords, 0));
+    TEST_ASSERT_TRUE(lv_area_get_size(&disp->inv_areas[0]) < lv_area_get_size(&canvas->coords));
+    lv_refr_now(NULL);
+}
+
 void test_canvas_fill_and_set_px(void)
 {
     lv_obj_t * canvas = lv_canvas_create(lv_screen_active());
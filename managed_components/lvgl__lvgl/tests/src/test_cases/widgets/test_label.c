@@ -591,6 +591,125 @@ void test_label_rtl_dot_long_mode(void)
     TEST_ASSERT_EQUAL_SCREENSHOT("widgets/label_rtl_dot_long_mode.png");
 }
 
+#if LV_USE_BIDI
+static const char * bidi_text =
+    "מעבד, או בשמו המלא יחידת עיבוד מרכזית (באנגלית: CPU - Central Processing Unit).\n"
+    "The (קוד [מקור]) of 123 lines, שלום עולם 456!";
+
+static lv_obj_t * bidi_label_create(lv_base_dir_t base_dir)
+{
+    lv_obj_t * test_label = lv_label_create(lv_screen_active());
+    lv_obj_set_style_text_font(test_label, &lv_font_dejavu_16_persian_hebrew, 0);
+    lv_obj_set_style_base_dir(test_label, base_dir, 0);
+    lv_obj_set_width(test_label, 200);
+    lv_label_set_text(test_label, bidi_text);
+    return test_label;
+}
+#endif
+
+void test_label_bidi_text_maps_round_trip(void)
+{
+#if LV_USE_BIDI
+    lv_obj_t * test_label = bidi_label_create(LV_BASE_DIR_RTL);
+    lv_bidi_text_t * bidi = &((lv_label_t *)test_label)->bidi_text;
+    const char * txt = lv_label_get_text(test_label);
+
+    TEST_ASSERT_NOT_NULL(bidi->txt);
+    TEST_ASSERT_GREATER_THAN(2, bidi->line_cnt);
+    TEST_ASSERT_EQUAL_UINT32(lv_strlen(txt), bidi->lines[bidi->line_cnt].byte_start);
+    TEST_ASSERT_EQUAL_UINT32(lv_text_get_encoded_length(txt), bidi->lines[bidi->line_cnt].char_start);
+
+    uint32_t i;
+    for(i = 0; i < bidi->line_cnt; i++) {
+        const lv_bidi_text_line_t * line = &bidi->lines[i];
+        uint32_t line_len = line[1].byte_start - line->byte_start;
+        TEST_ASSERT_EQUAL_PTR(line, lv_bidi_text_find_line(bidi, line->byte_start, line[1].byte_start));
+        TEST_ASSERT_NULL(lv_bidi_text_find_line(bidi, line->byte_start, line[1].byte_start - 1));
+
+        /*The stored line is the same as processing it again*/
+        char visual[256];
+        lv_bidi_process_paragraph(&txt[line->byte_start], visual, line_len, LV_BASE_DIR_RTL, NULL, 0);
+        TEST_ASSERT_EQUAL_STRING(visual, lv_bidi_text_get_line_text(bidi, line, txt));
+
+        /*The maps are the inverse of each other and match the uncached functions*/
+        uint32_t c;
+        uint32_t char_cnt = line[1].char_start - line->char_start;
+        for(c = 0; c < char_cnt; c++) {
+            bool is_rtl;
+            bool is_rtl_ref;
+            uint32_t logical = lv_bidi_text_get_logical_pos(bidi, line, c, &is_rtl);
+            TEST_ASSERT_EQUAL_UINT32(c, lv_bidi_text_get_visual_pos(bidi, line, logical, NULL));
+            TEST_ASSERT_EQUAL_UINT32(lv_bidi_get_logical_pos(&txt[line->byte_start], NULL, line_len, LV_BASE_DIR_RTL, c,
+                                                             &is_rtl_ref), logical);
+            TEST_ASSERT_EQUAL(is_rtl_ref, is_rtl);
+        }
+    }
+
+    /*Left-to-right text needs only the lines*/
+    lv_obj_set_style_base_dir(test_label, LV_BASE_DIR_LTR, 0);
+    lv_label_set_text(test_label, long_text);
+    TEST_ASSERT_NULL(bidi->txt);
+    TEST_ASSERT_NULL(bidi->logical_pos);
+    TEST_ASSERT_NOT_NULL(bidi->lines);
+#endif
+}
+
+void test_label_bidi_text_cached_letter_pos(void)
+{
+#if LV_USE_BIDI
+    lv_obj_t * test_label = bidi_label_create(LV_BASE_DIR_RTL);
+    lv_label_t * label_p = (lv_label_t *)test_label;
+    uint32_t char_cnt = lv_text_get_encoded_length(lv_label_get_text(test_label));
+
+    /*The letter positions are the same with and without the stored Bidi text*/
+    uint32_t i;
+    for(i = 0; i <= char_cnt; i++) {
+        lv_point_t pos;
+        lv_point_t pos_ref;
+        lv_label_get_letter_pos(test_label, i, &pos);
+        uint32_t letter = lv_label_get_letter_on(test_label, &pos, true);
+
+        lv_bidi_text_t bidi = label_p->bidi_text;
+        lv_memzero(&label_p->bidi_text, sizeof(lv_bidi_text_t));
+        lv_label_get_letter_pos(test_label, i, &pos_ref);
+        uint32_t letter_ref = lv_label_get_letter_on(test_label, &pos_ref, true);
+        label_p->bidi_text = bidi;
+
+        TEST_ASSERT_EQUAL_INT32(pos_ref.x, pos.x);
+        TEST_ASSERT_EQUAL_INT32(pos_ref.y, pos.y);
+        TEST_ASSERT_EQUAL_UINT32(letter_ref, letter);
+    }
+#endif
+}
+
+void test_label_bidi_text_cached_draw(void)
+{
+#if LV_USE_BIDI
+    /*Labels sending draw task events process the lines while drawing, so compare to them*/
+    lv_base_dir_t dirs[] = {LV_BASE_DIR_RTL, LV_BASE_DIR_LTR, LV_BASE_DIR_AUTO};
+    uint32_t i;
+    for(i = 0; i < sizeof(dirs) / sizeof(dirs[0]); i++) {
+        lv_obj_t * test_label = bidi_label_create(dirs[i]);
+        lv_obj_t * ref_label = bidi_label_create(dirs[i]);
+        lv_obj_add_flag(ref_label, LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS);
+        lv_obj_set_style_text_decor(test_label, LV_TEXT_DECOR_UNDERLINE, 0);
+        lv_obj_set_style_text_decor(ref_label, LV_TEXT_DECOR_UNDERLINE, 0);
+
+        lv_draw_buf_t * snapshot = lv_snapshot_take(test_label, LV_COLOR_FORMAT_ARGB8888);
+        lv_draw_buf_t * snapshot_ref = lv_snapshot_take(ref_label, LV_COLOR_FORMAT_ARGB8888);
+        TEST_ASSERT_NOT_NULL(snapshot);
+        TEST_ASSERT_NOT_NULL(snapshot_ref);
+        TEST_ASSERT_EQUAL_UINT32(snapshot_ref->data_size, snapshot->data_size);
+        TEST_ASSERT_EQUAL_MEMORY(snapshot_ref->data, snapshot->data, snapshot->data_size);
+
+        lv_draw_buf_destroy(snapshot);
+        lv_draw_buf_destroy(snapshot_ref);
+        lv_obj_delete(test_label);
+        lv_obj_delete(ref_label);
+    }
+#endif
+}
+
 void test_label_max_width(void)
 {
     lv_obj_clean(lv_screen_active());
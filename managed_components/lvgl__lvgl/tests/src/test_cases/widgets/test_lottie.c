@@ -1,5 +1,6 @@
 #if LV_BUILD_TEST
 #include "../lvgl.h"
+#include "../../lvgl_private.h"
 
 #include "unity/unity.h"
 
@@ -171,4 +172,77 @@ void test_lottie_no_jump_when_visible_again(void)
 
 }
 
+void test_lottie_frame_cache(void)
+{
+    lv_obj_t * lottie = lv_lottie_create(lv_screen_active());
+    lv_lottie_set_frame_cache_size(lottie, 200 * 1024);
+    TEST_ASSERT_EQUAL_UINT32(200 * 1024, lv_lottie_get_frame_cache_size(lottie));
+    lv_lottie_set_buffer(lottie, 100, 100, lv_draw_buf_align(buf, LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED));
+    lv_lottie_set_src_data(lottie, test_lottie_approve, test_lottie_approve_size);
+    lv_obj_center(lottie);
+
+    lv_test_fast_forward(200);
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/lottie_2.png");
+    lv_test_fast_forward(750);
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/lottie_3.png");
+
+    lv_lottie_t * lottie_p = (lv_lottie_t *)lottie;
+    TEST_ASSERT_NOT_NULL(lottie_p->frame_cache);
+    TEST_ASSERT_GREATER_THAN(0, lv_cache_get_size(lottie_p->frame_cache, NULL));
+
+    /*Show the same frames again from the cache*/
+    lv_anim_t * a = lv_lottie_get_anim(lottie);
+    a->act_time = 0;
+    lv_test_fast_forward(200);
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/lottie_2.png");
+    lv_test_fast_forward(750);
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/lottie_3.png");
+
+    lv_lottie_set_frame_cache_size(lottie, 0);
+    TEST_ASSERT_NULL(lottie_p->frame_cache);
+}
+
+void test_lottie_invalidate_changed_area(void)
+{
+    lv_obj_t * lottie = lv_lottie_create(lv_screen_active());
+    lv_lottie_set_buffer(lottie, 100, 100, lv_draw_buf_align(buf, LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED));
+    lv_lottie_set_src_data(lottie, test_lottie_approve, test_lottie_approve_size);
+    lv_obj_center(lottie);
+    lv_refr_now(NULL);
+
+    lv_display_t * disp = lv_display_get_default();
+    lv_anim_t * a = lv_lottie_get_anim(lottie);
+    lv_lottie_t * lottie_p = (lv_lottie_t *)lottie;
+
+    /*Set the frames manually*/
+    lv_anim_pause(a);
+
+    /*The same frame again shouldn't invalidate anything*/
+    lv_tick_inc(100);
+    a->exec_cb(lottie, 0);
+    TEST_ASSERT_EQUAL_UINT32(0, disp->inv_p);
+
+    /*Only a part of the widget should be invalidated*/
+    lv_tick_inc(100);
+    a->exec_cb(lottie, 20);
+    TEST_ASSERT_EQUAL_INT32(20, lottie_p->rendered_frame);
+    TEST_ASSERT_EQUAL_UINT32(1, disp->inv_p);
+    TEST_ASSERT_TRUE(lv_area_is_in(&disp->inv_areas[0], &lottie->coords, 0));
+    TEST_ASSERT_LESS_THAN_INT32(lv_area_get_size(&lottie->coords), lv_area_get_size(&disp->inv_areas[0]));
+    lv_refr_now(NULL);
+
+    /*Don't render faster than the display refreshes but show the last skipped frame later*/
+    lv_tick_inc(100);
+    a->exec_cb(lottie, 30);
+    a->exec_cb(lottie, 31);
+    a->exec_cb(lottie, 32);
+    TEST_ASSERT_EQUAL_INT32(30, lottie_p->rendered_frame);
+    TEST_ASSERT_EQUAL_INT32(32, lottie_p->pending_frame);
+
+    lv_tick_inc(100);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_INT32(32, lottie_p->rendered_frame);
+    TEST_ASSERT_EQUAL_INT32(-1, lottie_p->pending_frame);
+}
+
 #endif
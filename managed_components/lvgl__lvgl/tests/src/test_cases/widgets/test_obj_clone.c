@@ -0,0 +1,187 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+static lv_style_t style;
+
+void setUp(void)
+{
+    lv_style_init(&style);
+    lv_style_set_bg_color(&style, lv_color_hex(0x112233));
+    lv_style_set_radius(&style, 7);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+    lv_style_reset(&style);
+}
+
+static lv_obj_t * create_row(lv_obj_t * parent)
+{
+    lv_obj_t * row = lv_obj_create(parent);
+    lv_obj_set_size(row, 300, 40);
+    lv_obj_set_flex_flow(row, LV_FLEX_FLOW_ROW);
+    lv_obj_add_style(row, &style, LV_PART_MAIN | LV_STATE_CHECKED);
+    lv_obj_remove_flag(row, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_add_flag(row, LV_OBJ_FLAG_CHECKABLE);
+    lv_obj_add_state(row, LV_STATE_CHECKED | LV_STATE_FOCUSED);
+    lv_obj_set_ext_click_area(row, 5);
+
+    lv_obj_t * label = lv_label_create(row);
+    lv_obj_set_style_text_color(label, lv_color_hex(0xff0000), 0);
+
+    lv_obj_t * sw = lv_switch_create(row);
+    lv_obj_set_style_bg_color(sw, lv_color_hex(0x00ff00), LV_PART_INDICATOR | LV_STATE_CHECKED);
+    lv_obj_add_state(sw, LV_STATE_CHECKED);
+
+    /*Let the style transitions complete as they are not copied*/
+    lv_test_wait(1000);
+
+    return row;
+}
+
+static void assert_same_styles(lv_obj_t * obj1, lv_obj_t * obj2)
+{
+    lv_obj_update_layout(lv_screen_active());
+
+    lv_area_t a1;
+    lv_area_t a2;
+    lv_obj_get_coords(obj1, &a1);
+    lv_obj_get_coords(obj2, &a2);
+    TEST_ASSERT_EQUAL_INT32(lv_area_get_width(&a1), lv_area_get_width(&a2));
+    TEST_ASSERT_EQUAL_INT32(lv_area_get_height(&a1), lv_area_get_height(&a2));
+
+    TEST_ASSERT_EQUAL_PTR(lv_obj_get_class(obj1), lv_obj_get_class(obj2));
+    TEST_ASSERT_EQUAL_UINT32(lv_obj_get_style_radius(obj1, 0), lv_obj_get_style_radius(obj2, 0));
+    TEST_ASSERT_EQUAL_COLOR(lv_obj_get_style_bg_color(obj1, 0), lv_obj_get_style_bg_color(obj2, 0));
+    TEST_ASSERT_EQUAL_COLOR(lv_obj_get_style_bg_color(obj1, LV_PART_INDICATOR),
+                            lv_obj_get_style_bg_color(obj2, LV_PART_INDICATOR));
+    TEST_ASSERT_EQUAL_COLOR(lv_obj_get_style_text_color(obj1, 0), lv_obj_get_style_text_color(obj2, 0));
+
+    uint32_t child_cnt = lv_obj_get_child_count(obj1);
+    TEST_ASSERT_EQUAL_UINT32(child_cnt, lv_obj_get_child_count(obj2));
+
+    uint32_t i;
+    for(i = 0; i < child_cnt; i++) {
+        assert_same_styles(lv_obj_get_child(obj1, i), lv_obj_get_child(obj2, i));
+    }
+}
+
+void test_obj_clone_styles_and_flags(void)
+{
+    lv_obj_t * row = create_row(lv_screen_active());
+    lv_obj_t * clone = lv_obj_clone(row, lv_screen_active());
+
+    TEST_ASSERT_NOT_NULL(clone);
+    TEST_ASSERT_EQUAL_PTR(lv_screen_active(), lv_obj_get_parent(clone));
+    assert_same_styles(row, clone);
+
+    TEST_ASSERT_TRUE(lv_obj_has_flag(clone, LV_OBJ_FLAG_CHECKABLE));
+    TEST_ASSERT_FALSE(lv_obj_has_flag(clone, LV_OBJ_FLAG_SCROLLABLE));
+    TEST_ASSERT_TRUE(lv_obj_has_state(clone, LV_STATE_CHECKED));
+    TEST_ASSERT_FALSE(lv_obj_has_state(clone, LV_STATE_FOCUSED));
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x112233), lv_obj_get_style_bg_color(clone, 0));
+    TEST_ASSERT_EQUAL_INT32(5, clone->spec_attr->ext_click_pad);
+    TEST_ASSERT_EQUAL(LV_FLEX_FLOW_ROW, lv_obj_get_style_flex_flow(clone, 0));
+
+    /*The switch's state is copied too*/
+    TEST_ASSERT_TRUE(lv_obj_has_state(lv_obj_get_child(clone, 1), LV_STATE_CHECKED));
+}
+
+void test_obj_clone_local_styles_are_independent(void)
+{
+    lv_obj_t * row = create_row(lv_screen_active());
+    lv_obj_t * clone = lv_obj_clone(row, lv_screen_active());
+
+    /*Changing a local style of the clone shouldn't affect the template and vice versa*/
+    lv_obj_set_width(clone, 123);
+    lv_obj_set_style_text_color(lv_obj_get_child(row, 0), lv_color_hex(0x0000ff), 0);
+    lv_obj_update_layout(lv_screen_active());
+
+    TEST_ASSERT_EQUAL_INT32(300, lv_obj_get_width(row));
+    TEST_ASSERT_EQUAL_INT32(123, lv_obj_get_width(clone));
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0xff0000), lv_obj_get_style_text_color(lv_obj_get_child(clone, 0), 0));
+
+    /*The shared styles can be removed independently*/
+    lv_obj_remove_style(clone, &style, LV_PART_MAIN | LV_STATE_CHECKED);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x112233), lv_obj_get_style_bg_color(row, 0));
+    TEST_ASSERT_NOT_EQUAL(7, lv_obj_get_style_radius(clone, 0));
+
+    /*Changing the shared style affects both*/
+    lv_style_set_radius(&style, 9);
+    lv_obj_report_style_change(&style);
+    TEST_ASSERT_EQUAL_INT32(9, lv_obj_get_style_radius(row, 0));
+
+    /*Deleting the template keeps the clone working*/
+    lv_obj_delete(row);
+    lv_obj_set_style_text_color(lv_obj_get_child(clone, 0), lv_color_hex(0x00ffff), 0);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x00ffff), lv_obj_get_style_text_color(lv_obj_get_child(clone, 0), 0));
+}
+
+void test_obj_clone_multiple(void)
+{
+    lv_obj_t * cont = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(cont, 400, 400);
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_COLUMN);
+
+    lv_obj_t * row = create_row(cont);
+    lv_obj_t * clones[20];
+    uint32_t cnt = lv_obj_clone_multiple(row, cont, 20, clones);
+    TEST_ASSERT_EQUAL_UINT32(20, cnt);
+    TEST_ASSERT_EQUAL_UINT32(21, lv_obj_get_child_count(cont));
+
+    lv_obj_update_layout(lv_screen_active());
+
+    /*Laid out below each other*/
+    uint32_t i;
+    for(i = 0; i < 20; i++) {
+        TEST_ASSERT_EQUAL_PTR(clones[i], lv_obj_get_child(cont, i + 1));
+        TEST_ASSERT_GREATER_THAN_INT32(lv_obj_get_y(lv_obj_get_child(cont, i)), lv_obj_get_y(clones[i]));
+        assert_same_styles(row, clones[i]);
+    }
+
+    /*Scrollable as the rows don't fit*/
+    TEST_ASSERT_GREATER_THAN_INT32(0, lv_obj_get_scroll_bottom(cont));
+}
+
+void test_obj_clone_widget_with_children(void)
+{
+    /*The list's items are not created by the constructor so they are copied*/
+    lv_obj_t * list = lv_list_create(lv_screen_active());
+    lv_list_add_text(list, "Text");
+    lv_list_add_button(list, NULL, "Button");
+
+    lv_obj_t * clone = lv_obj_clone(list, lv_screen_active());
+    TEST_ASSERT_EQUAL_UINT32(2, lv_obj_get_child_count(clone));
+    TEST_ASSERT_EQUAL_PTR(&lv_list_text_class, lv_obj_get_class(lv_obj_get_child(clone, 0)));
+    TEST_ASSERT_EQUAL_PTR(&lv_list_button_class, lv_obj_get_class(lv_obj_get_child(clone, 1)));
+    TEST_ASSERT_EQUAL_PTR(&lv_label_class, lv_obj_get_class(lv_obj_get_child(lv_obj_get_child(clone, 1), 0)));
+
+    /*The children created by the dropdown's constructor are not duplicated*/
+    lv_obj_t * dd = lv_dropdown_create(lv_screen_active());
+    lv_obj_t * dd_clone = lv_obj_clone(dd, lv_screen_active());
+    TEST_ASSERT_EQUAL_UINT32(lv_obj_get_child_count(dd), lv_obj_get_child_count(dd_clone));
+
+    /*The children created by the constructor are found even if they were moved*/
+    lv_obj_t * ta = lv_textarea_create(lv_screen_active());
+    lv_obj_t * btn = lv_button_create(ta);
+    lv_obj_move_to_index(btn, 0);
+    lv_obj_t * ta_clone = lv_obj_clone(ta, lv_screen_active());
+    TEST_ASSERT_EQUAL_UINT32(2, lv_obj_get_child_count(ta_clone));
+    TEST_ASSERT_EQUAL_PTR(&lv_label_class, lv_obj_get_class(lv_obj_get_child(ta_clone, 0)));
+    TEST_ASSERT_EQUAL_PTR(&lv_button_class, lv_obj_get_class(lv_obj_get_child(ta_clone, 1)));
+
+    /*Clone into itself*/
+    lv_obj_t * row = create_row(lv_screen_active());
+    lv_obj_t * clone2 = lv_obj_clone(row, row);
+    TEST_ASSERT_EQUAL_UINT32(3, lv_obj_get_child_count(row));
+    TEST_ASSERT_EQUAL_UINT32(2, lv_obj_get_child_count(clone2));
+
+    lv_obj_delete(list);
+    lv_obj_delete(clone);
+}
+
+#endif
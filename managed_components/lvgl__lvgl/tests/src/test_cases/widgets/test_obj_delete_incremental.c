@@ -0,0 +1,229 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define OBJ_MAX     64
+
+static lv_obj_t * deleted[OBJ_MAX * 2];
+static uint32_t deleted_cnt;
+static uint32_t fake_tick;
+static uint32_t event_cnt;
+
+void setUp(void)
+{
+    deleted_cnt = 0;
+    fake_tick = 0;
+}
+
+void tearDown(void)
+{
+    lv_tick_set_cb(NULL);
+    lv_obj_delete_incremental_flush();
+    lv_obj_clean(lv_screen_active());
+    lv_group_set_default(NULL);
+}
+
+static uint32_t fake_tick_cb(void)
+{
+    return fake_tick;
+}
+
+static void delete_event_cb(lv_event_t * e)
+{
+    lv_obj_t * obj = lv_event_get_target(e);
+
+    /*The children are deleted after the parent is notified*/
+    TEST_ASSERT_LESS_THAN_UINT32(OBJ_MAX * 2, deleted_cnt);
+    deleted[deleted_cnt] = obj;
+    deleted_cnt++;
+
+    /*Simulate that deleting an object takes 1 ms*/
+    fake_tick++;
+}
+
+static void count_event_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    event_cnt++;
+}
+
+static void anim_exec_cb(void * var, int32_t v)
+{
+    lv_obj_set_x(var, v);
+}
+
+/**
+ * Create a tree with `cnt` objects where each object is the child of an earlier one
+ */
+static lv_obj_t * create_tree(lv_obj_t * parent, uint32_t cnt, lv_obj_t ** objs)
+{
+    uint32_t rnd_state = 1234;
+    objs[0] = lv_obj_create(parent);
+    lv_obj_add_event_cb(objs[0], delete_event_cb, LV_EVENT_DELETE, NULL);
+
+    uint32_t i;
+    for(i = 1; i < cnt; i++) {
+        rnd_state = rnd_state * 1103515245 + 12345;
+        objs[i] = lv_obj_create(objs[(rnd_state >> 16) % i]);
+        lv_obj_add_event_cb(objs[i], delete_event_cb, LV_EVENT_DELETE, NULL);
+    }
+
+    return objs[0];
+}
+
+void test_obj_delete_incremental_same_order(void)
+{
+    lv_obj_t * objs[OBJ_MAX];
+
+    /*Get the order of the events with `lv_obj_delete`*/
+    lv_obj_delete(create_tree(lv_screen_active(), OBJ_MAX, objs));
+    TEST_ASSERT_EQUAL_UINT32(OBJ_MAX, deleted_cnt);
+
+    uint32_t ref_order[OBJ_MAX];
+    uint32_t i;
+    uint32_t j;
+    for(i = 0; i < OBJ_MAX; i++) {
+        for(j = 0; objs[j] != deleted[i]; j++) {}
+        ref_order[i] = j;
+    }
+
+    /*Repeat it in small steps. The objects are allocated again, so compare the indices*/
+    deleted_cnt = 0;
+    lv_tick_set_cb(fake_tick_cb);
+    lv_obj_delete_incremental(create_tree(lv_screen_active(), OBJ_MAX, objs));
+    TEST_ASSERT_EQUAL_UINT32(0, deleted_cnt);
+
+    uint32_t step_cnt = 0;
+    while(deleted_cnt < OBJ_MAX) {
+        uint32_t prev_cnt = deleted_cnt;
+        lv_timer_handler();
+        TEST_ASSERT_GREATER_THAN_UINT32(prev_cnt, deleted_cnt);
+        step_cnt++;
+    }
+    TEST_ASSERT_GREATER_THAN_UINT32(10, step_cnt);
+
+    for(i = 0; i < OBJ_MAX; i++) {
+        TEST_ASSERT_EQUAL_PTR(objs[ref_order[i]], deleted[i]);
+    }
+
+    /*The hidden queue is deleted when it becomes empty*/
+    lv_timer_handler();
+    TEST_ASSERT_NULL(lv_display_get_default()->delete_queue);
+}
+
+void test_obj_delete_incremental_detached(void)
+{
+    lv_obj_t * objs[OBJ_MAX];
+    lv_obj_t * cont = lv_obj_create(lv_screen_active());
+    lv_obj_t * root = create_tree(cont, OBJ_MAX, objs);
+    lv_obj_t * sibling = lv_obj_create(cont);
+    lv_refr_now(NULL);
+
+    lv_tick_set_cb(fake_tick_cb);
+    lv_obj_delete_incremental(root);
+
+    /*Removed from the parent and not visible anymore*/
+    TEST_ASSERT_EQUAL_UINT32(1, lv_obj_get_child_count(cont));
+    TEST_ASSERT_EQUAL_PTR(sibling, lv_obj_get_child(cont, 0));
+    TEST_ASSERT_FALSE(lv_obj_is_visible(root));
+    TEST_ASSERT_FALSE(lv_obj_is_visible(objs[OBJ_MAX - 1]));
+    TEST_ASSERT_EQUAL_UINT32(0, deleted_cnt);
+
+    /*Queueing again or deleting a queued object is safe*/
+    lv_obj_delete_incremental(root);
+    lv_obj_delete(objs[OBJ_MAX - 1]);
+    TEST_ASSERT_EQUAL_UINT32(1, deleted_cnt);
+
+    lv_timer_handler();
+    TEST_ASSERT_LESS_THAN_UINT32(OBJ_MAX, deleted_cnt);
+
+    lv_obj_delete_incremental_flush();
+    TEST_ASSERT_EQUAL_UINT32(OBJ_MAX, deleted_cnt);
+    TEST_ASSERT_NULL(lv_display_get_default()->delete_queue);
+}
+
+void test_obj_delete_incremental_screen(void)
+{
+    lv_obj_t * objs[OBJ_MAX];
+    lv_obj_t * scr = lv_obj_create(NULL);
+    lv_obj_t * root1 = create_tree(scr, OBJ_MAX / 2, objs);
+    lv_obj_t * root2 = create_tree(scr, OBJ_MAX / 2, objs);
+    uint32_t screen_cnt = lv_display_get_default()->screen_cnt;
+
+    lv_tick_set_cb(fake_tick_cb);
+    lv_obj_delete_incremental(scr);
+
+    /*The screen is replaced by the hidden queue*/
+    TEST_ASSERT_EQUAL_UINT32(screen_cnt, lv_display_get_default()->screen_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, deleted_cnt);
+
+    /*The children are moved in their order*/
+    lv_obj_t * queue = lv_display_get_default()->delete_queue;
+    TEST_ASSERT_EQUAL_UINT32(2, lv_obj_get_child_count(queue));
+    TEST_ASSERT_EQUAL_PTR(root1, lv_obj_get_child(queue, 0));
+    TEST_ASSERT_EQUAL_PTR(root2, lv_obj_get_child(queue, 1));
+    TEST_ASSERT_EQUAL_PTR(queue, lv_obj_get_parent(root2));
+
+    while(lv_display_get_default()->delete_queue) {
+        lv_timer_handler();
+    }
+    TEST_ASSERT_EQUAL_UINT32(OBJ_MAX, deleted_cnt);
+    TEST_ASSERT_EQUAL_UINT32(screen_cnt - 1, lv_display_get_default()->screen_cnt);
+}
+
+void test_obj_delete_incremental_stops_anims(void)
+{
+    lv_obj_t * objs[OBJ_MAX];
+    lv_obj_t * root = create_tree(lv_screen_active(), OBJ_MAX, objs);
+
+    uint32_t i;
+    for(i = 0; i < OBJ_MAX; i++) {
+        lv_anim_t a;
+        lv_anim_init(&a);
+        lv_anim_set_var(&a, objs[i]);
+        lv_anim_set_exec_cb(&a, anim_exec_cb);
+        lv_anim_set_values(&a, 0, 100);
+        lv_anim_set_duration(&a, 1000);
+        lv_anim_start(&a);
+        lv_obj_add_event_cb(objs[i], count_event_cb, LV_EVENT_ALL, NULL);
+    }
+
+    /*The queued objects get no events and their animations don't run anymore*/
+    event_cnt = 0;
+    lv_obj_delete_incremental(root);
+    TEST_ASSERT_EQUAL_UINT32(0, event_cnt);
+    for(i = 0; i < OBJ_MAX; i++) {
+        TEST_ASSERT_NULL(lv_anim_get(objs[i], NULL));
+    }
+
+    lv_obj_delete_incremental_flush();
+    TEST_ASSERT_EQUAL_UINT32(OBJ_MAX, deleted_cnt);
+}
+
+void test_obj_delete_incremental_focus(void)
+{
+    lv_group_t * g = lv_group_create();
+    lv_group_set_default(g);
+
+    lv_obj_t * cont = lv_obj_create(lv_screen_active());
+    lv_obj_t * btn1 = lv_button_create(cont);
+    lv_obj_t * btn2 = lv_button_create(lv_screen_active());
+    lv_group_focus_obj(btn1);
+    TEST_ASSERT_EQUAL_PTR(btn1, lv_group_get_focused(g));
+
+    /*The focus is moved to a visible object*/
+    lv_obj_delete_incremental(cont);
+    TEST_ASSERT_EQUAL_PTR(btn2, lv_group_get_focused(g));
+
+    lv_group_focus_next(g);
+    TEST_ASSERT_EQUAL_PTR(btn2, lv_group_get_focused(g));
+
+    lv_obj_delete_incremental_flush();
+    TEST_ASSERT_EQUAL_UINT32(1, lv_group_get_obj_count(g));
+
+    lv_group_delete(g);
+}
+
+#endif
@@ -0,0 +1,262 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define OBJ_MAX     64
+
+static lv_obj_t * objs[OBJ_MAX];
+static uint32_t obj_cnt;
+static uint32_t rnd_state;
+
+void setUp(void)
+{
+    rnd_state = 4321;
+    obj_cnt = 0;
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+static int32_t rnd(int32_t min, int32_t max)
+{
+    rnd_state = rnd_state * 1103515245 + 12345;
+    return min + (int32_t)((rnd_state >> 16) % (uint32_t)(max - min + 1));
+}
+
+/**
+ * Check the visibility by walking all the ancestors, i.e. without any caching
+ */
+static bool area_is_visible_ref(lv_obj_t * obj, lv_area_t * area)
+{
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return false;
+
+    lv_obj_t * scr = lv_obj_get_screen(obj);
+    if(scr != lv_screen_active() && scr != lv_display_get_screen_prev(NULL) &&
+       scr != lv_layer_top() && scr != lv_layer_sys() && scr != lv_layer_bottom()) {
+        return false;
+    }
+
+    lv_area_t obj_coords;
+    lv_obj_get_coords(obj, &obj_coords);
+    int32_t ext_size = lv_obj_get_ext_draw_size(obj);
+    lv_area_increase(&obj_coords, ext_size, ext_size);
+    if(!lv_area_intersect(area, area, &obj_coords)) return false;
+
+    bool transformed = false;
+    lv_obj_t * parent = obj;
+    while(parent) {
+        if(lv_obj_get_layer_type(parent) == LV_LAYER_TYPE_TRANSFORM) transformed = true;
+        parent = lv_obj_get_parent(parent);
+    }
+    if(transformed) lv_obj_get_transformed_area(obj, area, LV_OBJ_POINT_TRANSFORM_FLAG_RECURSIVE);
+
+    /*`transformed` is true if `parent` or any of its ancestors is transformed.
+     *Find it out again for each parent.*/
+    parent = lv_obj_get_parent(obj);
+    while(parent) {
+        if(lv_obj_has_flag(parent, LV_OBJ_FLAG_HIDDEN)) return false;
+
+        lv_area_t parent_coords;
+        lv_obj_get_coords(parent, &parent_coords);
+        if(lv_obj_has_flag(parent, LV_OBJ_FLAG_OVERFLOW_VISIBLE)) {
+            int32_t parent_ext_size = lv_obj_get_ext_draw_size(parent);
+            lv_area_increase(&parent_coords, parent_ext_size, parent_ext_size);
+        }
+
+        bool parent_transformed = false;
+        lv_obj_t * p = parent;
+        while(p) {
+            if(lv_obj_get_layer_type(p) == LV_LAYER_TYPE_TRANSFORM) parent_transformed = true;
+            p = lv_obj_get_parent(p);
+        }
+        if(parent_transformed) {
+            lv_obj_get_transformed_area(parent, &parent_coords, LV_OBJ_POINT_TRANSFORM_FLAG_RECURSIVE);
+        }
+
+        if(!lv_area_intersect(area, area, &parent_coords)) return false;
+        parent = lv_obj_get_parent(parent);
+    }
+
+    return true;
+}
+
+static void assert_same_as_ref(void)
+{
+    lv_obj_update_layout(lv_screen_active());
+
+    uint32_t i;
+    for(i = 0; i < obj_cnt; i++) {
+        lv_area_t a1;
+        lv_area_set(&a1, 0, 0, 479, 479);
+        lv_area_t a2 = a1;
+
+        bool ref = area_is_visible_ref(objs[i], &a1);
+        bool res = lv_obj_area_is_visible(objs[i], &a2);
+        TEST_ASSERT_EQUAL(ref, res);
+        if(ref) {
+            TEST_ASSERT_EQUAL_INT32(a1.x1, a2.x1);
+            TEST_ASSERT_EQUAL_INT32(a1.y1, a2.y1);
+            TEST_ASSERT_EQUAL_INT32(a1.x2, a2.x2);
+            TEST_ASSERT_EQUAL_INT32(a1.y2, a2.y2);
+        }
+
+        /*Check the whole object too*/
+        lv_obj_get_coords(objs[i], &a1);
+        lv_area_increase(&a1, lv_obj_get_ext_draw_size(objs[i]), lv_obj_get_ext_draw_size(objs[i]));
+        TEST_ASSERT_EQUAL(area_is_visible_ref(objs[i], &a1), lv_obj_is_visible(objs[i]));
+    }
+}
+
+/**
+ * Create a random tree where each object is the child of an earlier one
+ */
+static void create_tree(uint32_t cnt)
+{
+    objs[obj_cnt] = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(objs[obj_cnt], 300, 300);
+    obj_cnt++;
+
+    while(obj_cnt < cnt) {
+        lv_obj_t * parent = objs[rnd(0, (int32_t)obj_cnt - 1)];
+        lv_obj_t * obj = lv_obj_create(parent);
+        lv_obj_set_pos(obj, rnd(-30, 200), rnd(-30, 200));
+        lv_obj_set_size(obj, rnd(20, 150), rnd(20, 150));
+        objs[obj_cnt] = obj;
+        obj_cnt++;
+    }
+}
+
+static void change_random_obj(void)
+{
+    lv_obj_t * obj = objs[rnd(0, (int32_t)obj_cnt - 1)];
+    switch(rnd(0, 10)) {
+        case 0:
+            lv_obj_set_pos(obj, rnd(-30, 200), rnd(-30, 200));
+            break;
+        case 1:
+            lv_obj_set_size(obj, rnd(20, 150), rnd(20, 150));
+            break;
+        case 2:
+            lv_obj_set_flag(obj, LV_OBJ_FLAG_HIDDEN, !lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN));
+            break;
+        case 3:
+            lv_obj_set_flag(obj, LV_OBJ_FLAG_OVERFLOW_VISIBLE, !lv_obj_has_flag(obj, LV_OBJ_FLAG_OVERFLOW_VISIBLE));
+            break;
+        case 4:
+            lv_obj_set_style_shadow_width(obj, rnd(0, 30), 0);
+            break;
+        case 5:
+            lv_obj_scroll_to(obj, rnd(0, 50), rnd(0, 50), LV_ANIM_OFF);
+            break;
+        case 6:
+            lv_obj_set_style_transform_rotation(obj, rnd(0, 3) * 150, 0);
+            break;
+        case 7:
+            lv_obj_set_style_transform_scale(obj, rnd(200, 400), 0);
+            break;
+        case 8:
+            lv_obj_set_style_transform_pivot_x(obj, rnd(0, 100), 0);
+            break;
+        case 9: {
+                /*Move to the first object or an object created before it to avoid loops*/
+                uint32_t i;
+                for(i = 0; objs[i] != obj; i++) {}
+                if(i > 0) lv_obj_set_parent(obj, objs[rnd(0, (int32_t)i - 1)]);
+                break;
+            }
+        default:
+            lv_obj_set_flag(obj, LV_OBJ_FLAG_FLOATING, !lv_obj_has_flag(obj, LV_OBJ_FLAG_FLOATING));
+            break;
+    }
+}
+
+void test_obj_visibility_nested(void)
+{
+    create_tree(OBJ_MAX);
+    assert_same_as_ref();
+
+    lv_obj_add_flag(objs[3], LV_OBJ_FLAG_HIDDEN);
+    assert_same_as_ref();
+
+    lv_obj_set_pos(objs[0], 100, 150);
+    assert_same_as_ref();
+
+    lv_obj_set_size(objs[0], 50, 400);
+    assert_same_as_ref();
+
+    lv_obj_remove_flag(objs[3], LV_OBJ_FLAG_HIDDEN);
+    lv_obj_add_flag(objs[0], LV_OBJ_FLAG_OVERFLOW_VISIBLE);
+    assert_same_as_ref();
+}
+
+void test_obj_visibility_scroll(void)
+{
+    create_tree(OBJ_MAX);
+
+    uint32_t i;
+    for(i = 0; i < 20; i++) {
+        lv_obj_scroll_by(objs[rnd(0, (int32_t)obj_cnt - 1)], rnd(-30, 30), rnd(-30, 30), LV_ANIM_OFF);
+        assert_same_as_ref();
+    }
+
+    /*Arrange the children of the first object with a layout*/
+    lv_obj_set_flex_flow(objs[0], LV_FLEX_FLOW_COLUMN);
+    assert_same_as_ref();
+    lv_obj_scroll_to_y(objs[0], 100, LV_ANIM_OFF);
+    assert_same_as_ref();
+}
+
+void test_obj_visibility_transform(void)
+{
+    create_tree(OBJ_MAX);
+
+    lv_obj_set_style_transform_rotation(objs[0], 300, 0);
+    assert_same_as_ref();
+
+    lv_obj_set_style_transform_scale(objs[1], 150, 0);
+    assert_same_as_ref();
+
+    lv_obj_set_style_transform_pivot_y(objs[0], 200, 0);
+    assert_same_as_ref();
+
+    lv_obj_set_style_transform_rotation(objs[0], 0, 0);
+    assert_same_as_ref();
+}
+
+void test_obj_visibility_random_changes(void)
+{
+    create_tree(OBJ_MAX);
+    assert_same_as_ref();
+
+    uint32_t i;
+    for(i = 0; i < 100; i++) {
+        change_random_obj();
+        assert_same_as_ref();
+    }
+}
+
+void test_obj_visibility_screen_load(void)
+{
+    create_tree(OBJ_MAX);
+    assert_same_as_ref();
+
+    lv_obj_t * scr_old = lv_screen_active();
+    lv_obj_t * scr = lv_obj_create(NULL);
+    lv_screen_load(scr);
+    assert_same_as_ref();
+
+    /*Move an object to the new screen*/
+    lv_obj_set_parent(objs[5], scr);
+    assert_same_as_ref();
+
+    lv_obj_set_parent(objs[5], scr_old);
+    lv_screen_load(scr_old);
+    lv_obj_delete(scr);
+    assert_same_as_ref();
+}
+
+#endif
@@ -22,6 +22,12 @@ void test_tabview_get_tab_bar(void);
 void test_tabview_set_act_non_existent(void);
 void test_tabview_tab2_selected_event(void);
 void test_tabview_update_on_external_scroll(void);
+void test_tabview_cached_transition(void);
+void test_tabview_cache_dropped_on_change(void);
+void test_tabview_cache_outdated_during_transition(void);
+void test_tabview_cached_transition_keeps_opa_layered(void);
+void test_tabview_cache_too_small(void);
+void test_tabview_cache_page_deleted(void);
 
 static lv_obj_t * active_screen = NULL;
 static lv_obj_t * tabview = NULL;
@@ -285,4 +291,155 @@ void test_tabview_update_on_external_scroll(void)
     TEST_ASSERT_EQUAL_UINT16(2, lv_tabview_get_tab_active(tabview));
 }
 
+static lv_obj_t * create_cached_tabview(uint32_t cache_size)
+{
+    tabview = lv_tabview_create(active_screen);
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        lv_obj_t * tab = lv_tabview_add_tab(tabview, "Tab");
+        lv_obj_t * label = lv_label_create(tab);
+        lv_label_set_text_fmt(label, "Content of tab %d", (int)i);
+    }
+    lv_tabview_set_tab_cache_size(tabview, cache_size);
+    lv_refr_now(NULL);
+    return tabview;
+}
+
+void test_tabview_cached_transition(void)
+{
+    create_cached_tabview(4 * 1024 * 1024);
+    lv_tabview_t * tabview_p = (lv_tabview_t *)tabview;
+    lv_obj_t * cont = lv_tabview_get_content(tabview);
+    TEST_ASSERT_EQUAL_UINT32(4 * 1024 * 1024, lv_tabview_get_tab_cache_size(tabview));
+
+    lv_tabview_set_active(tabview, 1, LV_ANIM_ON);
+    TEST_ASSERT_TRUE(tabview_p->in_transition);
+    TEST_ASSERT_EQUAL_UINT8(LV_OPA_TRANSP, lv_obj_get_style_opa_layered(cont, LV_PART_MAIN));
+    TEST_ASSERT_GREATER_THAN_UINT32(0, tabview_p->tab_cache_used);
+    TEST_ASSERT_EQUAL_UINT32(2, lv_ll_get_len(&tabview_p->tab_cache_ll));
+    TEST_ASSERT_EQUAL_UINT32(2, LV_GLOBAL_DEFAULT()->obj_watch_inv_cnt);
+
+    lv_test_wait(100);
+    TEST_ASSERT_TRUE(tabview_p->in_transition);
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/tabview_cached_transition.png");
+
+    lv_test_wait(500);
+    TEST_ASSERT_FALSE(tabview_p->in_transition);
+    TEST_ASSERT_EQUAL_UINT8(LV_OPA_COVER, lv_obj_get_style_opa_layered(cont, LV_PART_MAIN));
+    TEST_ASSERT_EQUAL_INT32(lv_obj_get_content_width(cont) + lv_obj_get_style_pad_column(cont, LV_PART_MAIN),
+                            lv_obj_get_scroll_x(cont));
+    TEST_ASSERT_EQUAL_UINT32(1, lv_tabview_get_tab_active(tabview));
+
+    /*Going back uses the cached images*/
+    uint32_t used = tabview_p->tab_cache_used;
+    lv_tabview_set_active(tabview, 0, LV_ANIM_ON);
+    TEST_ASSERT_TRUE(tabview_p->in_transition);
+    TEST_ASSERT_EQUAL_UINT32(used, tabview_p->tab_cache_used);
+    lv_test_wait(500);
+    TEST_ASSERT_EQUAL_INT32(0, lv_obj_get_scroll_x(cont));
+
+    lv_tabview_set_tab_cache_size(tabview, 0);
+    TEST_ASSERT_EQUAL_UINT32(0, tabview_p->tab_cache_used);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_ll_get_len(&tabview_p->tab_cache_ll));
+    TEST_ASSERT_EQUAL_UINT32(0, LV_GLOBAL_DEFAULT()->obj_watch_inv_cnt);
+}
+
+void test_tabview_cache_dropped_on_change(void)
+{
+    create_cached_tabview(4 * 1024 * 1024);
+    lv_tabview_t * tabview_p = (lv_tabview_t *)tabview;
+
+    lv_tabview_set_active(tabview, 1, LV_ANIM_ON);
+    lv_test_wait(500);
+    uint32_t used = tabview_p->tab_cache_used;
+
+    /*Tab 0 is not visible but its image should be dropped*/
+    lv_obj_t * tab0 = lv_obj_get_child(lv_tabview_get_content(tabview), 0);
+    lv_label_set_text(lv_obj_get_child(tab0, 0), "Changed");
+    TEST_ASSERT_LESS_THAN_UINT32(used, tabview_p->tab_cache_used);
+
+    lv_tabview_set_active(tabview, 0, LV_ANIM_ON);
+    TEST_ASSERT_EQUAL_UINT32(used, tabview_p->tab_cache_used);
+    lv_test_wait(500);
+}
+
+void test_tabview_cache_outdated_during_transition(void)
+{
+    create_cached_tabview(4 * 1024 * 1024);
+    lv_tabview_t * tabview_p = (lv_tabview_t *)tabview;
+    lv_obj_t * cont = lv_tabview_get_content(tabview);
+
+    lv_tabview_set_active(tabview, 1, LV_ANIM_ON);
+    lv_test_wait(50);
+    TEST_ASSERT_TRUE(tabview_p->in_transition);
+
+    /*Continue with the real widgets from the current position*/
+    lv_obj_t * tab1 = lv_obj_get_child(cont, 1);
+    lv_label_set_text(lv_obj_get_child(tab1, 0), "Changed");
+    lv_test_wait(50);
+    TEST_ASSERT_FALSE(tabview_p->in_transition);
+    TEST_ASSERT_EQUAL_UINT8(LV_OPA_COVER, lv_obj_get_style_opa_layered(cont, LV_PART_MAIN));
+    TEST_ASSERT_GREATER_THAN_INT32(0, lv_obj_get_scroll_x(cont));
+
+    lv_test_wait(500);
+    TEST_ASSERT_EQUAL_INT32(lv_obj_get_content_width(cont) + lv_obj_get_style_pad_column(cont, LV_PART_MAIN),
+                            lv_obj_get_scroll_x(cont));
+    TEST_ASSERT_EQUAL_UINT32(1, lv_tabview_get_tab_active(tabview));
+}
+
+void test_tabview_cached_transition_keeps_opa_layered(void)
+{
+    create_cached_tabview(4 * 1024 * 1024);
+    lv_tabview_t * tabview_p = (lv_tabview_t *)tabview;
+    lv_obj_t * cont = lv_tabview_get_content(tabview);
+    lv_obj_set_style_opa_layered(cont, LV_OPA_50, LV_PART_MAIN);
+    lv_refr_now(NULL);
+
+    lv_tabview_set_active(tabview, 1, LV_ANIM_ON);
+    TEST_ASSERT_TRUE(tabview_p->in_transition);
+    TEST_ASSERT_EQUAL_UINT8(LV_OPA_TRANSP, lv_obj_get_style_opa_layered(cont, LV_PART_MAIN));
+    lv_test_wait(500);
+    TEST_ASSERT_FALSE(tabview_p->in_transition);
+    TEST_ASSERT_EQUAL_UINT8(LV_OPA_50, lv_obj_get_style_opa_layered(cont, LV_PART_MAIN));
+
+    /*Also when the transition is stopped by changing a tab*/
+    lv_tabview_set_active(tabview, 0, LV_ANIM_ON);
+    TEST_ASSERT_TRUE(tabview_p->in_transition);
+    lv_label_set_text(lv_obj_get_child(lv_obj_get_child(cont, 0), 0), "Changed");
+    lv_test_wait(50);
+    TEST_ASSERT_FALSE(tabview_p->in_transition);
+    TEST_ASSERT_EQUAL_UINT8(LV_OPA_50, lv_obj_get_style_opa_layered(cont, LV_PART_MAIN));
+    lv_test_wait(500);
+}
+
+void test_tabview_cache_too_small(void)
+{
+    create_cached_tabview(1024);
+    lv_tabview_t * tabview_p = (lv_tabview_t *)tabview;
+
+    lv_tabview_set_active(tabview, 1, LV_ANIM_ON);
+    TEST_ASSERT_FALSE(tabview_p->in_transition);
+    TEST_ASSERT_EQUAL_UINT32(0, tabview_p->tab_cache_used);
+    lv_test_wait(500);
+    TEST_ASSERT_EQUAL_UINT32(1, lv_tabview_get_tab_active(tabview));
+}
+
+void test_tabview_cache_page_deleted(void)
+{
+    create_cached_tabview(4 * 1024 * 1024);
+    lv_tabview_t * tabview_p = (lv_tabview_t *)tabview;
+
+    lv_tabview_set_active(tabview, 1, LV_ANIM_ON);
+    lv_test_wait(500);
+    TEST_ASSERT_EQUAL_UINT32(2, lv_ll_get_len(&tabview_p->tab_cache_ll));
+
+    lv_obj_delete(lv_obj_get_child(lv_tabview_get_content(tabview), 0));
+    TEST_ASSERT_EQUAL_UINT32(1, lv_ll_get_len(&tabview_p->tab_cache_ll));
+    TEST_ASSERT_EQUAL_UINT32(1, LV_GLOBAL_DEFAULT()->obj_watch_inv_cnt);
+
+    /*The watched pages are deleted with the tabview*/
+    lv_obj_delete(tabview);
+    TEST_ASSERT_EQUAL_UINT32(0, LV_GLOBAL_DEFAULT()->obj_watch_inv_cnt);
+}
+
 #endif
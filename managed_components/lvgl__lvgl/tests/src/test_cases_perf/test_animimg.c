@@ -0,0 +1,71 @@
+#if LV_BUILD_TEST_PERF
+#include "unity/unity.h"
+
+#define FRAME_CNT   4
+#define FRAME_SIZE  200
+
+static lv_obj_t * animimg = NULL;
+static lv_draw_buf_t * frames[FRAME_CNT];
+
+void setUp(void)
+{
+    /*Indexed pictures need to be decoded (converted) every time they are drawn*/
+    uint32_t i;
+    for(i = 0; i < FRAME_CNT; i++) {
+        frames[i] = lv_draw_buf_create(FRAME_SIZE, FRAME_SIZE, LV_COLOR_FORMAT_I8, LV_STRIDE_AUTO);
+        uint32_t c;
+        for(c = 0; c < 256; c++) {
+            lv_draw_buf_set_palette(frames[i], c, lv_color32_make(c, 255 - c, (c + i * 64) & 0xff, 255));
+        }
+
+        uint8_t * indices = frames[i]->data + 256 * sizeof(lv_color32_t);
+        uint32_t y;
+        for(y = 0; y < FRAME_SIZE; y++) {
+            uint32_t x;
+            for(x = 0; x < FRAME_SIZE; x++) {
+                indices[y * frames[i]->header.stride + x] = (x + y + i * 16) & 0xff;
+            }
+        }
+    }
+
+    animimg = lv_animimg_create(lv_screen_active());
+    lv_obj_center(animimg);
+    lv_animimg_set_src(animimg, (const void **) frames, FRAME_CNT);
+    lv_animimg_set_duration(animimg, FRAME_CNT * 30);
+    lv_animimg_set_repeat_count(animimg, LV_ANIM_REPEAT_INFINITE);
+    lv_animimg_start(animimg);
+}
+
+void tearDown(void)
+{
+    lv_obj_delete(animimg);
+
+    uint32_t i;
+    for(i = 0; i < FRAME_CNT; i++) {
+        lv_draw_buf_destroy(frames[i]);
+    }
+}
+
+static void play_frame(void)
+{
+    /*Every call shows the next picture*/
+    lv_test_wait(30);
+}
+
+void test_animimg_play_decoded(void)
+{
+    TEST_ASSERT_MAX_TIME_ITER(play_frame, 20, 40);
+}
+
+void test_animimg_play_atlas(void)
+{
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_animimg_create_atlas(animimg, LV_COLOR_FORMAT_ARGB8888, 1024 * 1024));
+    TEST_ASSERT_MAX_TIME_ITER(play_frame, 10, 40);
+}
+
+void test_animimg_play_atlas_rgb565(void)
+{
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_animimg_create_atlas(animimg, LV_COLOR_FORMAT_RGB565, 1024 * 1024));
+    TEST_ASSERT_MAX_TIME_ITER(play_frame, 10, 40);
+}
+#endif
@@ -0,0 +1,56 @@
+#if LV_BUILD_TEST_PERF
+#include "unity/unity.h"
+
+static lv_obj_t * active_screen = NULL;
+static lv_obj_t * calendar = NULL;
+static uint32_t month_idx;
+static lv_calendar_date_t highlighted_days[8];
+
+void setUp(void)
+{
+    active_screen = lv_screen_active();
+    calendar = lv_calendar_create(active_screen);
+    lv_obj_set_size(calendar, 400, 400);
+    lv_calendar_header_arrow_create(calendar);
+    lv_calendar_set_today_date(calendar, 2024, 3, 22);
+    lv_calendar_set_month_shown(calendar, 2024, 1);
+    lv_refr_now(NULL);
+    month_idx = 0;
+}
+
+void tearDown(void)
+{
+    lv_obj_delete(calendar);
+}
+
+static void flip_month(void)
+{
+    month_idx++;
+    lv_calendar_set_month_shown(calendar, 2024 + month_idx / 12, month_idx % 12 + 1);
+    lv_refr_now(NULL);
+}
+
+static void update_highlights(void)
+{
+    /*Move a week of highlighted days by one day*/
+    month_idx++;
+    uint32_t i;
+    for(i = 0; i < 7; i++) {
+        highlighted_days[i].year = 2024;
+        highlighted_days[i].month = 1;
+        highlighted_days[i].day = (month_idx + i) % 31 + 1;
+    }
+    lv_calendar_set_highlighted_dates(calendar, highlighted_days, 7);
+    lv_refr_now(NULL);
+}
+
+void test_calendar_flip_month(void)
+{
+    TEST_ASSERT_MAX_TIME_ITER(flip_month, 150, 24);
+}
+
+void test_calendar_update_highlights(void)
+{
+    TEST_ASSERT_MAX_TIME_ITER(update_highlights, 60, 31);
+}
+#endif
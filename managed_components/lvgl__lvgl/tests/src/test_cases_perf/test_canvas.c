@@ -0,0 +1,71 @@
+#if LV_BUILD_TEST_PERF
+#include "unity/unity.h"
+
+#define POINT_CNT 4000
+
+static lv_obj_t * active_screen = NULL;
+static lv_obj_t * canvas = NULL;
+static uint8_t canvas_buf[LV_CANVAS_BUF_SIZE(452, 300, 24, LV_DRAW_BUF_STRIDE_ALIGN)];
+
+void setUp(void)
+{
+    active_screen = lv_screen_active();
+    canvas = lv_canvas_create(active_screen);
+    lv_canvas_set_buffer(canvas, canvas_buf, 452, 300, LV_COLOR_FORMAT_RGB888);
+    lv_canvas_fill_bg(canvas, lv_color_white(), LV_OPA_COVER);
+}
+
+void tearDown(void)
+{
+    lv_obj_delete(canvas);
+}
+
+static void plot_wave(lv_obj_t * obj)
+{
+    int32_t i;
+    for(i = 0; i < POINT_CNT; i++) {
+        int32_t x = i % 452;
+        int32_t y = 150 + lv_trigo_sin((int16_t)(i * 3)) * 140 / LV_TRIGO_SIN_MAX;
+        lv_canvas_set_px(obj, x, y, lv_color_black(), LV_OPA_COVER);
+    }
+}
+
+static void plot_wave_in_session(lv_obj_t * obj)
+{
+    lv_canvas_begin_write(obj);
+    plot_wave(obj);
+    lv_canvas_end_write(obj);
+}
+
+static void fill_rows_in_session(lv_obj_t * obj)
+{
+    lv_area_t area = {0, 100, 451, 199};
+    uint32_t stride;
+    lv_canvas_begin_write(obj);
+    uint8_t * row = lv_canvas_get_write_area(obj, &area, &stride);
+    int32_t y;
+    for(y = area.y1; y <= area.y2; y++) {
+        lv_memset(row, 0x40, 452 * 3);
+        row += stride;
+    }
+    lv_canvas_end_write(obj);
+}
+
+void test_canvas_set_px(void)
+{
+    TEST_ASSERT_MAX_TIME(plot_wave, 20, canvas);
+    lv_refr_now(NULL);
+}
+
+void test_canvas_set_px_write_session(void)
+{
+    TEST_ASSERT_MAX_TIME(plot_wave_in_session, 5, canvas);
+    lv_refr_now(NULL);
+}
+
+void test_canvas_write_area(void)
+{
+    TEST_ASSERT_MAX_TIME(fill_rows_in_session, 1, canvas);
+    lv_refr_now(NULL);
+}
+#endif
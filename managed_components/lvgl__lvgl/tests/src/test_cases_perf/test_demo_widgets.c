@@ -0,0 +1,47 @@
+#if LV_BUILD_TEST_PERF
+#include "../lvgl.h"
+#include "../demos/lv_demos.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_DEMO_WIDGETS
+
+static lv_obj_t * tabview = NULL;
+static uint32_t tab_idx;
+
+void setUp(void)
+{
+    lv_demo_widgets();
+    tabview = lv_obj_get_child_by_type(lv_screen_active(), 0, &lv_tabview_class);
+    lv_refr_now(NULL);
+    tab_idx = 0;
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+static void switch_tab(void)
+{
+    /*Go back and forth between the first two tabs and play the whole animation*/
+    tab_idx = tab_idx == 0 ? 1 : 0;
+    lv_tabview_set_active(tabview, tab_idx, LV_ANIM_ON);
+    lv_test_wait(450);
+}
+
+void test_demo_widgets_switch_tab_live(void)
+{
+    lv_tabview_set_tab_cache_size(tabview, 0);
+    TEST_ASSERT_MAX_TIME_ITER(switch_tab, 2000, 6);
+}
+
+void test_demo_widgets_switch_tab_cached(void)
+{
+    lv_tabview_set_tab_cache_size(tabview, 8 * 1024 * 1024);
+    TEST_ASSERT_MAX_TIME_ITER(switch_tab, 1000, 6);
+}
+
+#endif
+
+#endif
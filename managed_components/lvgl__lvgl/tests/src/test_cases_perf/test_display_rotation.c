@@ -0,0 +1,50 @@
+#if LV_BUILD_TEST_PERF
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define WIDGET_CNT  300
+
+void setUp(void)
+{
+    lv_obj_t * cont = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(cont, lv_pct(100), lv_pct(100));
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_ROW_WRAP);
+
+    uint32_t i;
+    for(i = 0; i < WIDGET_CNT; i++) {
+        lv_obj_t * btn = lv_button_create(cont);
+        lv_obj_t * label = lv_label_create(btn);
+        lv_label_set_text_fmt(label, "%"LV_PRIu32, i);
+    }
+    lv_refr_now(NULL);
+}
+
+void tearDown(void)
+{
+    lv_display_set_rotation(NULL, LV_DISPLAY_ROTATION_0);
+    lv_test_fast_forward(1000);
+    lv_obj_clean(lv_screen_active());
+}
+
+/*The time from changing the rotation until the first frame of the new orientation is flushed*/
+static void rotate(uint32_t anim_time)
+{
+    lv_display_rotation_t rotation = lv_display_get_rotation(NULL);
+    lv_display_set_rotation_anim(NULL, (rotation + 1) % 4, anim_time);
+    lv_refr_now(NULL);
+}
+
+void test_display_rotation_switch_latency(void)
+{
+    TEST_ASSERT_MAX_TIME_ITER(rotate, 40, 8, 0);
+}
+
+void test_display_rotation_anim_switch_latency(void)
+{
+    /*Snapshot + the first frame*/
+    TEST_ASSERT_MAX_TIME_ITER(rotate, 50, 8, 300);
+}
+
+#endif
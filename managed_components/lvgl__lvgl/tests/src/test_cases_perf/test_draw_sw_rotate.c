@@ -0,0 +1,58 @@
+#if LV_BUILD_TEST_PERF
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define HOR_RES     800
+#define VER_RES     480
+
+/*Large enough for a full frame in any of the tested color formats*/
+static uint8_t src_buf[HOR_RES * VER_RES * 4];
+static uint8_t dst_buf[HOR_RES * VER_RES * 4];
+
+void setUp(void)
+{
+    uint32_t i;
+    for(i = 0; i < sizeof(src_buf); i++) {
+        src_buf[i] = (uint8_t)(i * 7);
+    }
+}
+
+void tearDown(void)
+{
+}
+
+static void rotate(int32_t w, int32_t h, lv_display_rotation_t rotation, lv_color_format_t cf)
+{
+    uint32_t px_size = lv_color_format_get_size(cf);
+    lv_draw_sw_rotate(src_buf, dst_buf, w, h, w * px_size, h * px_size, rotation, cf);
+}
+
+void test_rotate_full_frame_rgb565(void)
+{
+    TEST_ASSERT_MAX_TIME_ITER(rotate, 10, 10, HOR_RES, VER_RES, LV_DISPLAY_ROTATION_90, LV_COLOR_FORMAT_RGB565);
+    TEST_ASSERT_MAX_TIME_ITER(rotate, 10, 10, HOR_RES, VER_RES, LV_DISPLAY_ROTATION_270, LV_COLOR_FORMAT_RGB565);
+}
+
+void test_rotate_full_frame_rgb888(void)
+{
+    TEST_ASSERT_MAX_TIME_ITER(rotate, 15, 10, HOR_RES, VER_RES, LV_DISPLAY_ROTATION_90, LV_COLOR_FORMAT_RGB888);
+    TEST_ASSERT_MAX_TIME_ITER(rotate, 15, 10, HOR_RES, VER_RES, LV_DISPLAY_ROTATION_270, LV_COLOR_FORMAT_RGB888);
+}
+
+void test_rotate_full_frame_argb8888(void)
+{
+    TEST_ASSERT_MAX_TIME_ITER(rotate, 15, 10, HOR_RES, VER_RES, LV_DISPLAY_ROTATION_90, LV_COLOR_FORMAT_ARGB8888);
+    TEST_ASSERT_MAX_TIME_ITER(rotate, 15, 10, HOR_RES, VER_RES, LV_DISPLAY_ROTATION_270, LV_COLOR_FORMAT_ARGB8888);
+}
+
+/*A partial render buffer with 1/10 of the screen and an odd sized invalidated area*/
+void test_rotate_partial_area(void)
+{
+    TEST_ASSERT_MAX_TIME_ITER(rotate, 5, 50, HOR_RES, VER_RES / 10, LV_DISPLAY_ROTATION_90, LV_COLOR_FORMAT_RGB565);
+    TEST_ASSERT_MAX_TIME_ITER(rotate, 5, 50, HOR_RES, VER_RES / 10, LV_DISPLAY_ROTATION_90, LV_COLOR_FORMAT_RGB888);
+    TEST_ASSERT_MAX_TIME_ITER(rotate, 5, 50, 123, 57, LV_DISPLAY_ROTATION_270, LV_COLOR_FORMAT_RGB888);
+}
+
+#endif
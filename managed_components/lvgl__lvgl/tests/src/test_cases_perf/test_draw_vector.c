@@ -0,0 +1,189 @@
+#if LV_BUILD_TEST_PERF
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define GAUGE_CNT   12
+#define ICON_CNT    60
+
+static lv_obj_t * canvas = NULL;
+static uint8_t canvas_buf[LV_CANVAS_BUF_SIZE(452, 300, 32, LV_DRAW_BUF_STRIDE_ALIGN)];
+
+void setUp(void)
+{
+    canvas = lv_canvas_create(lv_screen_active());
+    lv_canvas_set_buffer(canvas, canvas_buf, 452, 300, LV_COLOR_FORMAT_ARGB8888);
+    lv_canvas_fill_bg(canvas, lv_color_white(), LV_OPA_COVER);
+}
+
+void tearDown(void)
+{
+    lv_obj_delete(canvas);
+}
+
+static void draw_gauge(lv_draw_vector_dsc_t * dsc, lv_vector_path_t * path, float cx, float cy, float value)
+{
+    lv_fpoint_t c = {cx, cy};
+
+    /*Background with a radial gradient*/
+    lv_grad_stop_t stops[2];
+    lv_memzero(stops, sizeof(stops));
+    stops[0].color = lv_color_hex(0x404858);
+    stops[0].opa = LV_OPA_COVER;
+    stops[0].frac = 0;
+    stops[1].color = lv_color_hex(0x101418);
+    stops[1].opa = LV_OPA_COVER;
+    stops[1].frac = 255;
+
+    lv_vector_path_clear(path);
+    lv_vector_path_append_circle(path, &c, 34, 34);
+    lv_draw_vector_dsc_set_fill_radial_gradient(dsc, cx, cy, 34);
+    lv_draw_vector_dsc_set_fill_gradient_color_stops(dsc, stops, 2);
+    lv_draw_vector_dsc_set_stroke_opa(dsc, LV_OPA_TRANSP);
+    lv_draw_vector_dsc_add_path(dsc, path);
+
+    /*Track and indicator arcs with round caps*/
+    lv_draw_vector_dsc_set_fill_opa(dsc, LV_OPA_TRANSP);
+    lv_draw_vector_dsc_set_stroke_opa(dsc, LV_OPA_COVER);
+    lv_draw_vector_dsc_set_stroke_width(dsc, 6);
+    lv_draw_vector_dsc_set_stroke_cap(dsc, LV_VECTOR_STROKE_CAP_ROUND);
+    lv_draw_vector_dsc_set_stroke_dash(dsc, NULL, 0);
+
+    lv_vector_path_clear(path);
+    lv_vector_path_append_arc(path, &c, 28, 135, 270, false);
+    lv_draw_vector_dsc_set_stroke_color(dsc, lv_color_hex(0x606870));
+    lv_draw_vector_dsc_add_path(dsc, path);
+
+    lv_vector_path_clear(path);
+    lv_vector_path_append_arc(path, &c, 28, 135, 270 * value, false);
+    lv_draw_vector_dsc_set_stroke_color(dsc, lv_color_hex(0x40c0ff));
+    lv_draw_vector_dsc_add_path(dsc, path);
+
+    /*Dashed scale ring*/
+    float dashes[2] = {2, 4};
+    lv_vector_path_clear(path);
+    lv_vector_path_append_circle(path, &c, 20, 20);
+    lv_draw_vector_dsc_set_stroke_width(dsc, 3);
+    lv_draw_vector_dsc_set_stroke_cap(dsc, LV_VECTOR_STROKE_CAP_BUTT);
+    lv_draw_vector_dsc_set_stroke_dash(dsc, dashes, 2);
+    lv_draw_vector_dsc_set_stroke_color(dsc, lv_color_white());
+    lv_draw_vector_dsc_add_path(dsc, path);
+
+    /*Needle*/
+    lv_fpoint_t p;
+    lv_vector_path_clear(path);
+    p.x = -3;
+    p.y = 0;
+    lv_vector_path_move_to(path, &p);
+    p.x = 0;
+    p.y = -26;
+    lv_vector_path_line_to(path, &p);
+    p.x = 3;
+    p.y = 0;
+    lv_vector_path_line_to(path, &p);
+    lv_vector_path_close(path);
+
+    lv_draw_vector_dsc_identity(dsc);
+    lv_draw_vector_dsc_translate(dsc, cx, cy);
+    lv_draw_vector_dsc_rotate(dsc, -135 + 270 * value);
+    lv_draw_vector_dsc_set_fill_color(dsc, lv_color_hex(0xff4040));
+    lv_draw_vector_dsc_set_fill_opa(dsc, LV_OPA_COVER);
+    lv_draw_vector_dsc_set_stroke_opa(dsc, LV_OPA_TRANSP);
+    lv_draw_vector_dsc_add_path(dsc, path);
+    lv_draw_vector_dsc_identity(dsc);
+}
+
+static void draw_gauges(uint32_t cnt)
+{
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+
+    lv_vector_path_t * path = lv_vector_path_create(LV_VECTOR_PATH_QUALITY_MEDIUM);
+    lv_draw_vector_dsc_t * dsc = lv_draw_vector_dsc_create(&layer);
+
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        float cx = 40 + (float)(i % 6) * 74;
+        float cy = 40 + (float)(i / 6 % 4) * 74;
+        draw_gauge(dsc, path, cx, cy, (float)(i % 10) / 10);
+    }
+
+    lv_draw_vector(dsc);
+    lv_canvas_finish_layer(canvas, &layer);
+
+    lv_draw_vector_dsc_delete(dsc);
+    lv_vector_path_delete(path);
+}
+
+void test_draw_vector_gauges(void)
+{
+    TEST_ASSERT_MAX_TIME_ITER(draw_gauges, 20, 10, GAUGE_CNT);
+}
+
+static void draw_icon(lv_draw_vector_dsc_t * dsc, lv_vector_path_t * path, float x, float y, lv_color_t color)
+{
+    lv_draw_vector_dsc_identity(dsc);
+    lv_draw_vector_dsc_translate(dsc, x, y);
+
+    /*Rounded frame*/
+    lv_area_t rect = {0, 0, 39, 39};
+    lv_vector_path_clear(path);
+    lv_vector_path_append_rect(path, &rect, 8, 8);
+    lv_draw_vector_dsc_set_fill_color(dsc, lv_color_hex(0xe0e0e0));
+    lv_draw_vector_dsc_set_fill_opa(dsc, LV_OPA_COVER);
+    lv_draw_vector_dsc_set_stroke_color(dsc, color);
+    lv_draw_vector_dsc_set_stroke_opa(dsc, LV_OPA_COVER);
+    lv_draw_vector_dsc_set_stroke_width(dsc, 2);
+    lv_draw_vector_dsc_add_path(dsc, path);
+
+    /*Bell like glyph with curves*/
+    lv_fpoint_t p[] = {{8, 30}, {12, 26}, {12, 10}, {20, 6}, {28, 10}, {28, 26}, {32, 30}};
+    lv_vector_path_clear(path);
+    lv_vector_path_move_to(path, &p[0]);
+    lv_vector_path_quad_to(path, &p[1], &p[2]);
+    lv_vector_path_cubic_to(path, &p[3], &p[3], &p[4]);
+    lv_vector_path_quad_to(path, &p[5], &p[6]);
+    lv_vector_path_close(path);
+    lv_draw_vector_dsc_set_fill_color(dsc, color);
+    lv_draw_vector_dsc_set_stroke_opa(dsc, LV_OPA_TRANSP);
+    lv_draw_vector_dsc_add_path(dsc, path);
+
+    lv_fpoint_t c = {20, 33};
+    lv_vector_path_clear(path);
+    lv_vector_path_append_circle(path, &c, 3, 3);
+    lv_draw_vector_dsc_add_path(dsc, path);
+}
+
+/*The same icons are drawn at different positions with different colors, as in a scrolled list*/
+static void draw_icons(uint32_t cnt)
+{
+    static uint32_t frame = 0;
+    frame++;
+
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+
+    lv_vector_path_t * path = lv_vector_path_create(LV_VECTOR_PATH_QUALITY_MEDIUM);
+    lv_draw_vector_dsc_t * dsc = lv_draw_vector_dsc_create(&layer);
+
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        float x = (float)(4 + (i % 10) * 44);
+        float y = (float)((i / 10) * 44 + frame % 8);
+        draw_icon(dsc, path, x, y, lv_color_hex(0x204080 + (i + frame) * 0x102030));
+    }
+
+    lv_draw_vector(dsc);
+    lv_canvas_finish_layer(canvas, &layer);
+
+    lv_draw_vector_dsc_delete(dsc);
+    lv_vector_path_delete(path);
+}
+
+void test_draw_vector_icons(void)
+{
+    TEST_ASSERT_MAX_TIME_ITER(draw_icons, 15, 10, ICON_CNT);
+}
+
+#endif
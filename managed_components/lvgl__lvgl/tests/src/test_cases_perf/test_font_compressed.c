@@ -0,0 +1,49 @@
+#if LV_BUILD_TEST_PERF
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define GLYPH_FIRST     0x21
+#define GLYPH_CNT       (0x7F - GLYPH_FIRST)
+
+static lv_font_glyph_dsc_t glyph_dscs[GLYPH_CNT];
+static lv_draw_buf_t * glyph_buf;
+
+void setUp(void)
+{
+    glyph_buf = lv_draw_buf_create(64, 64, LV_COLOR_FORMAT_A8, LV_STRIDE_AUTO);
+}
+
+void tearDown(void)
+{
+    lv_draw_buf_destroy(glyph_buf);
+}
+
+static void decode_glyphs(const lv_font_t * font, uint32_t loops)
+{
+    uint32_t i;
+    for(i = 0; i < GLYPH_CNT; i++) {
+        lv_font_get_glyph_dsc(font, &glyph_dscs[i], GLYPH_FIRST + i, 0);
+    }
+
+    uint32_t loop;
+    for(loop = 0; loop < loops; loop++) {
+        for(i = 0; i < GLYPH_CNT; i++) {
+            lv_font_get_glyph_bitmap(&glyph_dscs[i], glyph_buf);
+        }
+    }
+}
+
+void test_font_compressed_decode_28(void)
+{
+    TEST_ASSERT_MAX_TIME_ITER(decode_glyphs, 15, 10, &lv_font_montserrat_28_compressed, 20);
+}
+
+void test_font_compressed_decode_ascii(void)
+{
+    LV_FONT_DECLARE(test_font_montserrat_ascii_3bpp_compressed);
+    TEST_ASSERT_MAX_TIME_ITER(decode_glyphs, 10, 10, &test_font_montserrat_ascii_3bpp_compressed, 20);
+}
+
+#endif
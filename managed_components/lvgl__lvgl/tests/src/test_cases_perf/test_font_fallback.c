@@ -0,0 +1,116 @@
+#if LV_BUILD_TEST_PERF
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+/*Latin UI text with Hebrew and CJK names*/
+static const char * paragraph =
+    "Messages from 王小明, 李华 and דוד were received. Shared with 张伟 and שרה: photos, 文件 and notes. "
+    "Call with 刘洋 at 10:30, meeting with משה and 陈静 tomorrow. Contacts: 王芳, 李娜, רחל, 杨军 and 赵磊. "
+    "Last seen: 周杰 today, 吴敏 yesterday, יוסף last week. Groups: 朋友 (12), 家人 (5), עבודה (30).";
+
+static lv_font_t font_latin;
+static lv_font_t font_hebrew;
+
+void setUp(void)
+{
+    /*3 level fallback chain: Latin -> Hebrew -> CJK*/
+    lv_memcpy(&font_latin, &lv_font_montserrat_14, sizeof(lv_font_t));
+    lv_memcpy(&font_hebrew, &lv_font_dejavu_16_persian_hebrew, sizeof(lv_font_t));
+    font_latin.fallback = &font_hebrew;
+    font_hebrew.fallback = &lv_font_source_han_sans_sc_16_cjk;
+}
+
+void tearDown(void)
+{
+}
+
+static void measure_paragraph(uint32_t loops)
+{
+    uint32_t i;
+    for(i = 0; i < loops; i++) {
+        lv_point_t size;
+        lv_text_get_size(&size, paragraph, &font_latin, 0, 0, 300, LV_TEXT_FLAG_NONE);
+    }
+}
+
+static void get_glyph_dsc(lv_font_fallback_cache_t * cache, uint32_t loops)
+{
+    uint32_t i;
+    for(i = 0; i < loops; i++) {
+        uint32_t ofs = 0;
+        while(paragraph[ofs] != '\0') {
+            uint32_t letter;
+            uint32_t letter_next;
+            lv_text_encoded_letter_next_2(paragraph, &letter, &letter_next, &ofs);
+
+            lv_font_glyph_dsc_t g;
+            lv_font_get_glyph_dsc_cached(&font_latin, cache, &g, letter, letter_next);
+        }
+    }
+}
+
+static void refresh_label(lv_obj_t * label, uint32_t loops)
+{
+    uint32_t i;
+    for(i = 0; i < loops; i++) {
+        lv_obj_invalidate(label);
+        lv_refr_now(NULL);
+    }
+}
+
+static void set_text_label(lv_obj_t * label, uint32_t loops)
+{
+    /*Measure and draw the text again. The label keeps the resolved fonts in its cache*/
+    uint32_t i;
+    for(i = 0; i < loops; i++) {
+        lv_label_set_text_static(label, paragraph);
+        lv_refr_now(NULL);
+    }
+}
+
+void test_font_fallback_measure(void)
+{
+    TEST_ASSERT_MAX_TIME_ITER(measure_paragraph, 60, 10, 100);
+}
+
+void test_font_fallback_glyph_dsc_no_cache(void)
+{
+    TEST_ASSERT_MAX_TIME_ITER(get_glyph_dsc, 30, 10, NULL, 100);
+}
+
+void test_font_fallback_glyph_dsc_cached(void)
+{
+    lv_font_fallback_cache_t cache;
+    lv_font_fallback_cache_init(&cache, &font_latin);
+    TEST_ASSERT_MAX_TIME_ITER(get_glyph_dsc, 30, 10, &cache, 100);
+}
+
+void test_font_fallback_label_draw(void)
+{
+    lv_obj_t * label = lv_label_create(lv_screen_active());
+    lv_obj_set_style_text_font(label, &font_latin, 0);
+    lv_obj_set_width(label, 300);
+    lv_label_set_text_static(label, paragraph);
+    lv_refr_now(NULL);
+
+    TEST_ASSERT_MAX_TIME_ITER(refresh_label, 20, 10, label, 10);
+
+    lv_obj_delete(label);
+}
+
+void test_font_fallback_label_set_text(void)
+{
+    lv_obj_t * label = lv_label_create(lv_screen_active());
+    lv_obj_set_style_text_font(label, &font_latin, 0);
+    lv_obj_set_width(label, 300);
+    lv_label_set_text_static(label, paragraph);
+    lv_refr_now(NULL);
+
+    TEST_ASSERT_MAX_TIME_ITER(set_text_label, 25, 10, label, 10);
+
+    lv_obj_delete(label);
+}
+
+#endif
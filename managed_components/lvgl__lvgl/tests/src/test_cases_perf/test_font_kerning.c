@@ -0,0 +1,104 @@
+#if LV_BUILD_TEST_PERF
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define GLYPH_CNT   155     /*Number of glyphs in `test_font_1`*/
+
+static const char * paragraph =
+    "Typography is the art and technique of arranging type to make written language legible, "
+    "readable and appealing when displayed. The arrangement of type involves selecting typefaces, "
+    "point sizes, line lengths, line-spacing (leading), and letter-spacing (tracking), as well as "
+    "adjusting the space between pairs of letters (kerning). AVATAR, WAVE, Yours, LT, Vo, Te, P. "
+    "Kerning adjusts the spacing between two specific characters, such as 'AV' or 'To', so that the "
+    "text looks evenly spaced. Without it, a long paragraph of text has visible gaps and clusters.";
+
+static lv_font_t font_pairs;
+static lv_font_fmt_txt_dsc_t fdsc_pairs;
+static lv_font_fmt_txt_kern_pair_t kern_pairs;
+static uint8_t kern_pair_ids[GLYPH_CNT * GLYPH_CNT * 2];
+static int8_t kern_pair_values[GLYPH_CNT * GLYPH_CNT];
+
+void setUp(void)
+{
+    LV_FONT_DECLARE(test_font_1);
+
+    /*Create a copy of the class kerned font with the same kerning stored as sorted pairs*/
+    const lv_font_fmt_txt_dsc_t * fdsc = test_font_1.dsc;
+    const lv_font_fmt_txt_kern_classes_t * kc = fdsc->kern_dsc;
+    uint32_t pair_cnt = 0;
+    uint32_t l, r;
+    for(l = 0; l < GLYPH_CNT; l++) {
+        for(r = 0; r < GLYPH_CNT; r++) {
+            uint8_t lc = kc->left_class_mapping[l];
+            uint8_t rc = kc->right_class_mapping[r];
+            if(lc == 0 || rc == 0) continue;
+            int8_t v = kc->class_pair_values[(lc - 1) * kc->right_class_cnt + (rc - 1)];
+            if(v == 0) continue;
+
+            kern_pair_ids[pair_cnt * 2] = (uint8_t)l;
+            kern_pair_ids[pair_cnt * 2 + 1] = (uint8_t)r;
+            kern_pair_values[pair_cnt] = v;
+            pair_cnt++;
+        }
+    }
+
+    kern_pairs.glyph_ids = kern_pair_ids;
+    kern_pairs.values = kern_pair_values;
+    kern_pairs.pair_cnt = pair_cnt;
+    kern_pairs.glyph_ids_size = 0;
+
+    lv_memcpy(&font_pairs, &test_font_1, sizeof(lv_font_t));
+    lv_memcpy(&fdsc_pairs, fdsc, sizeof(lv_font_fmt_txt_dsc_t));
+    fdsc_pairs.kern_dsc = &kern_pairs;
+    fdsc_pairs.kern_classes = 0;
+    font_pairs.dsc = &fdsc_pairs;
+}
+
+void tearDown(void)
+{
+}
+
+static void measure_paragraph(const lv_font_t * font, uint32_t loops)
+{
+    uint32_t i;
+    for(i = 0; i < loops; i++) {
+        lv_point_t size;
+        lv_text_get_size(&size, paragraph, font, 0, 0, 300, LV_TEXT_FLAG_NONE);
+    }
+}
+
+void test_font_kerning_classes_measure(void)
+{
+    LV_FONT_DECLARE(test_font_1);
+    TEST_ASSERT_MAX_TIME_ITER(measure_paragraph, 15, 10, &test_font_1, 100);
+}
+
+void test_font_kerning_pairs_measure(void)
+{
+    TEST_ASSERT_MAX_TIME_ITER(measure_paragraph, 20, 10, &font_pairs, 100);
+}
+
+void test_font_kerning_pairs_to_classes_measure(void)
+{
+    lv_font_fmt_txt_kern_classes_t * kc = lv_font_fmt_txt_kern_pairs_to_classes(&kern_pairs, GLYPH_CNT);
+    TEST_ASSERT_NOT_NULL(kc);
+
+    lv_font_t font;
+    lv_font_fmt_txt_dsc_t fdsc;
+    lv_memcpy(&font, &font_pairs, sizeof(lv_font_t));
+    lv_memcpy(&fdsc, &fdsc_pairs, sizeof(lv_font_fmt_txt_dsc_t));
+    fdsc.kern_dsc = kc;
+    fdsc.kern_classes = 1;
+    font.dsc = &fdsc;
+
+    TEST_ASSERT_MAX_TIME_ITER(measure_paragraph, 15, 10, &font, 100);
+
+    lv_free((void *)kc->class_pair_values);
+    lv_free((void *)kc->left_class_mapping);
+    lv_free((void *)kc->right_class_mapping);
+    lv_free(kc);
+}
+
+#endif
@@ -0,0 +1,67 @@
+#if LV_BUILD_TEST_PERF
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+extern uint8_t const test_font_1_buf[6876];
+
+static uint8_t * mapped_font;
+static uint32_t mapped_font_size;
+
+void setUp(void)
+{
+    lv_fs_path_ex_t mempath;
+    lv_fs_make_path_from_buffer(&mempath, LV_FS_MEMFS_LETTER, test_font_1_buf, sizeof(test_font_1_buf), "bin");
+    mapped_font = lv_binfont_convert_to_mapped((const char *)&mempath, &mapped_font_size);
+    TEST_ASSERT_NOT_NULL(mapped_font);
+}
+
+void tearDown(void)
+{
+    lv_free(mapped_font);
+}
+
+static void load_from_buffer(uint32_t loops)
+{
+    uint32_t i;
+    for(i = 0; i < loops; i++) {
+        lv_font_t * font = lv_binfont_create_from_buffer((void *)test_font_1_buf, sizeof(test_font_1_buf));
+        lv_binfont_destroy(font);
+    }
+}
+
+static void load_from_mapped(uint32_t loops)
+{
+    uint32_t i;
+    for(i = 0; i < loops; i++) {
+        lv_font_t * font = lv_binfont_create_from_mapped(mapped_font, mapped_font_size);
+        lv_binfont_destroy(font);
+    }
+}
+
+void test_font_loader_from_buffer_load(void)
+{
+    TEST_ASSERT_MAX_TIME_ITER(load_from_buffer, 40, 10, 10);
+}
+
+void test_font_loader_from_mapped_load(void)
+{
+    TEST_ASSERT_MAX_TIME_ITER(load_from_mapped, 2, 10, 100);
+}
+
+void test_font_loader_from_mapped_memory(void)
+{
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    size_t free_start = mon.free_size;
+
+    lv_font_t * font = lv_binfont_create_from_mapped(mapped_font, mapped_font_size);
+    lv_mem_monitor(&mon);
+    lv_binfont_destroy(font);
+
+    /*Only the descriptors are allocated, the glyphs are used from the mapped font*/
+    TEST_ASSERT_LESS_THAN(512, free_start - mon.free_size);
+}
+
+#endif
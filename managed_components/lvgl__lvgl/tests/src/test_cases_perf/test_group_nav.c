@@ -0,0 +1,64 @@
+#if LV_BUILD_TEST_PERF
+#include "unity/unity.h"
+
+#define ROW_CNT     300
+
+static lv_group_t * group;
+
+void setUp(void)
+{
+    group = lv_group_create();
+
+    /*A tall settings list where every 3rd row is in a collapsed (hidden) section*/
+    lv_obj_t * cont = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(cont, 452, lv_pct(100));
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_COLUMN);
+
+    uint32_t i;
+    for(i = 0; i < ROW_CNT; i++) {
+        lv_obj_t * section = lv_obj_create(cont);
+        lv_obj_set_size(section, lv_pct(100), LV_SIZE_CONTENT);
+        lv_obj_set_flex_flow(section, LV_FLEX_FLOW_ROW);
+        if(i % 3 == 2) lv_obj_add_flag(section, LV_OBJ_FLAG_HIDDEN);
+
+        lv_obj_t * btn = lv_button_create(section);
+        lv_group_add_obj(group, btn);
+        lv_obj_t * sw = lv_switch_create(section);
+        lv_group_add_obj(group, sw);
+    }
+
+    lv_obj_update_layout(cont);
+}
+
+void tearDown(void)
+{
+    lv_group_delete(group);
+    lv_obj_clean(lv_screen_active());
+}
+
+static void focus_next(void)
+{
+    lv_group_focus_next(group);
+}
+
+static void focus_down(void)
+{
+    /*Start again from the top at the bottom*/
+    lv_obj_t * focused = lv_group_get_focused(group);
+    lv_group_focus_dir(group, LV_DIR_BOTTOM);
+    if(lv_group_get_focused(group) == focused) {
+        lv_group_focus_obj(lv_group_get_obj_by_index(group, 0));
+    }
+}
+
+void test_group_focus_next(void)
+{
+    TEST_ASSERT_MAX_TIME_ITER(focus_next, 100, 1000);
+}
+
+void test_group_focus_dir(void)
+{
+    TEST_ASSERT_MAX_TIME_ITER(focus_down, 200, 1000);
+}
+
+#endif
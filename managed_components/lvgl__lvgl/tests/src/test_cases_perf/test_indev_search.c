@@ -0,0 +1,62 @@
+#if LV_BUILD_TEST_PERF
+#include "unity/unity.h"
+
+static lv_obj_t * cont = NULL;
+static uint32_t point_idx;
+
+void setUp(void)
+{
+    cont = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(cont, 440, 440);
+    lv_obj_set_style_pad_all(cont, 0, 0);
+    point_idx = 0;
+}
+
+void tearDown(void)
+{
+    lv_obj_delete(cont);
+}
+
+/**
+ * Create a dense grid of clickable objects, like a large button matrix made of real objects
+ * @param col_cnt   number of columns and rows
+ */
+static void create_grid(uint32_t col_cnt)
+{
+    int32_t size = 400 / col_cnt;
+    uint32_t i;
+    for(i = 0; i < col_cnt * col_cnt; i++) {
+        lv_obj_t * obj = lv_obj_create(cont);
+        lv_obj_remove_style_all(obj);
+        lv_obj_add_flag(obj, LV_OBJ_FLAG_CLICKABLE);
+        lv_obj_set_size(obj, size - 1, size - 1);
+        lv_obj_set_pos(obj, (i % col_cnt) * size, (i / col_cnt) * size);
+    }
+
+    lv_obj_update_layout(cont);
+}
+
+static void search_obj(void)
+{
+    /*Visit the points of the grid in a scattered order*/
+    lv_point_t p;
+    p.x = 20 + (point_idx * 37) % 400;
+    p.y = 20 + (point_idx * 53) % 400;
+    point_idx++;
+
+    lv_indev_search_obj(lv_screen_active(), &p);
+}
+
+/*With LV_INDEV_HIT_INDEX only the children around the point are checked, so the two tests should take similar time*/
+void test_indev_search_1k_objects(void)
+{
+    create_grid(32);
+    TEST_ASSERT_MAX_TIME_ITER(search_obj, 10, 1000);
+}
+
+void test_indev_search_10k_objects(void)
+{
+    create_grid(100);
+    TEST_ASSERT_MAX_TIME_ITER(search_obj, 10, 1000);
+}
+#endif
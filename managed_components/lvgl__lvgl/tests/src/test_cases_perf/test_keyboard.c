@@ -0,0 +1,54 @@
+#if LV_BUILD_TEST_PERF
+#include "unity/unity.h"
+
+static lv_obj_t * active_screen = NULL;
+static lv_obj_t * kb = NULL;
+static lv_point_t key_center;
+
+void setUp(void)
+{
+    active_screen = lv_screen_active();
+    kb = lv_keyboard_create(active_screen);
+    lv_obj_set_size(kb, 452, 500);
+    lv_obj_align(kb, LV_ALIGN_TOP_LEFT, 0, 0);
+    lv_refr_now(NULL);
+
+    /*Somewhere in the middle of the second row*/
+    key_center.x = 452 / 2;
+    key_center.y = 500 * 3 / 8;
+}
+
+void tearDown(void)
+{
+    lv_obj_delete(kb);
+}
+
+static void keystroke(void)
+{
+    lv_indev_t * indev = lv_test_indev_get_indev(LV_INDEV_TYPE_POINTER);
+    lv_test_mouse_move_to(key_center.x, key_center.y);
+    lv_test_mouse_press();
+    lv_indev_read(indev);
+    lv_refr_now(NULL);
+
+    lv_test_mouse_release();
+    lv_indev_read(indev);
+    lv_refr_now(NULL);
+}
+
+static void full_redraw(void)
+{
+    lv_obj_invalidate(kb);
+    lv_refr_now(NULL);
+}
+
+void test_keyboard_keystroke(void)
+{
+    TEST_ASSERT_MAX_TIME(keystroke, 4);
+}
+
+void test_keyboard_full_redraw(void)
+{
+    TEST_ASSERT_MAX_TIME(full_redraw, 12);
+}
+#endif
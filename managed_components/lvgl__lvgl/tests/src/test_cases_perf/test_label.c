@@ -1,5 +1,8 @@
 /* Performance test for the lv_text and lv_font_* functions */
 #if LV_BUILD_TEST_PERF
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
 #include "unity/unity.h"
 
 static lv_obj_t * active_screen = NULL;
@@ -17,4 +20,59 @@ void test_label(void)
                          "Lorem ipsum dolor sit amet, consectetur adipiscing elit. Ut auctor sed dui interdum convallis. Proin in ante magna. Pellentesque placerat condimentum erat ac laoreet. Cras mi eros, convallis vitae massa ac, blandit sodales urna. Proin tincidunt fermentum leo a volutpat. Donec ut blandit tortor. Duis elementum nibh nec consequat sagittis. Lutrae sunt praeclarae");
 
 }
+
+#if LV_USE_BIDI
+static const char * rtl_text =
+    "מעבד, או בשמו המלא יחידת עיבוד מרכזית (באנגלית: CPU - Central Processing Unit), הוא רכיב "
+    "החומרה המבצע את הוראות התוכנית. המעבד מבצע פעולות חשבון, לוגיקה, בקרה וקלט ופלט (I/O) "
+    "לפי ההוראות שבתוכנית. מעבדים משמשים במחשבים אישיים, בטלפונים חכמים ובמערכות משובצות 2024.";
+
+static void rtl_label_init(void)
+{
+    lv_obj_set_width(label, 400);
+    lv_obj_set_style_text_font(label, &lv_font_dejavu_16_persian_hebrew, 0);
+    lv_obj_set_style_base_dir(label, LV_BASE_DIR_RTL, 0);
+    lv_label_set_text_static(label, rtl_text);
+    lv_refr_now(NULL);
+}
+
+static void refresh_label(uint32_t loops)
+{
+    uint32_t i;
+    for(i = 0; i < loops; i++) {
+        lv_obj_invalidate(label);
+        lv_refr_now(NULL);
+    }
+}
+
+static void get_letter_pos_and_on(uint32_t char_cnt)
+{
+    uint32_t i;
+    for(i = 0; i < char_cnt; i++) {
+        lv_point_t pos;
+        lv_label_get_letter_pos(label, i, &pos);
+        lv_label_get_letter_on(label, &pos, true);
+    }
+}
+
+void test_label_rtl_refresh(void)
+{
+    rtl_label_init();
+    TEST_ASSERT_MAX_TIME_ITER(refresh_label, 50, 10, 10);
+}
+
+void test_label_rtl_refresh_with_selection(void)
+{
+    rtl_label_init();
+    lv_label_set_text_selection_start(label, 10);
+    lv_label_set_text_selection_end(label, 200);
+    TEST_ASSERT_MAX_TIME_ITER(refresh_label, 50, 10, 10);
+}
+
+void test_label_rtl_letter_pos(void)
+{
+    rtl_label_init();
+    TEST_ASSERT_MAX_TIME_ITER(get_letter_pos_and_on, 300, 10, lv_text_get_encoded_length(rtl_text));
+}
+#endif
 #endif
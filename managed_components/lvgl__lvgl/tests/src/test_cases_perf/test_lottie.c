@@ -0,0 +1,67 @@
+#if LV_BUILD_TEST_PERF
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_LOTTIE
+
+static uint32_t buf[LV_TEST_WIDTH_TO_STRIDE(100, 4) * 100 + LV_DRAW_BUF_ALIGN];
+extern const uint8_t test_lottie_approve[];
+extern const size_t test_lottie_approve_size;
+
+static lv_obj_t * lottie;
+
+void setUp(void)
+{
+    lottie = lv_lottie_create(lv_screen_active());
+    lv_lottie_set_buffer(lottie, 100, 100, lv_draw_buf_align(buf, LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED));
+    lv_lottie_set_src_data(lottie, test_lottie_approve, test_lottie_approve_size);
+    lv_obj_center(lottie);
+    lv_refr_now(NULL);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+/*Play the looping animation the given times and refresh the display in every period*/
+static void play_loops(uint32_t loops)
+{
+    lv_anim_t * a = lv_lottie_get_anim(lottie);
+    uint32_t steps = loops * lv_anim_get_time(a) / LV_DEF_REFR_PERIOD;
+    uint32_t i;
+    for(i = 0; i < steps; i++) {
+        lv_test_fast_forward(LV_DEF_REFR_PERIOD);
+    }
+}
+
+void test_lottie_loop(void)
+{
+    TEST_ASSERT_MAX_TIME(play_loops, 100, 4);
+}
+
+void test_lottie_loop_frame_cache(void)
+{
+    lv_lottie_set_frame_cache_size(lottie, 400 * 1024);
+    TEST_ASSERT_MAX_TIME(play_loops, 80, 4);
+}
+
+#else
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_lottie_loop(void)
+{
+}
+
+#endif /* LV_USE_LOTTIE */
+
+#endif /* LV_BUILD_TEST_PERF */
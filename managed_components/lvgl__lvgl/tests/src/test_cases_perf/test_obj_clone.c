@@ -0,0 +1,73 @@
+#if LV_BUILD_TEST_PERF
+#include "unity/unity.h"
+
+#define ROW_CNT     50
+
+static lv_obj_t * cont = NULL;
+
+void setUp(void)
+{
+    cont = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(cont, 400, 400);
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_COLUMN);
+}
+
+void tearDown(void)
+{
+    lv_obj_delete(cont);
+}
+
+/**
+ * A typical settings row: a label, an icon and a switch
+ */
+static lv_obj_t * create_row(void)
+{
+    lv_obj_t * row = lv_obj_create(cont);
+    lv_obj_set_size(row, lv_pct(100), LV_SIZE_CONTENT);
+    lv_obj_set_flex_flow(row, LV_FLEX_FLOW_ROW);
+
+    lv_obj_t * label = lv_label_create(row);
+    lv_label_set_text(label, "Setting");
+    lv_obj_set_flex_grow(label, 1);
+
+    lv_obj_t * icon = lv_obj_create(row);
+    lv_obj_set_size(icon, 20, 20);
+
+    lv_switch_create(row);
+
+    return row;
+}
+
+static void build_by_create(void)
+{
+    lv_obj_clean(cont);
+
+    uint32_t i;
+    for(i = 0; i < ROW_CNT; i++) {
+        create_row();
+    }
+
+    lv_obj_update_layout(cont);
+}
+
+static void build_by_clone(void)
+{
+    lv_obj_clean(cont);
+
+    lv_obj_t * row = create_row();
+    lv_obj_clone_multiple(row, cont, ROW_CNT - 1, NULL);
+
+    lv_obj_update_layout(cont);
+}
+
+void test_obj_build_by_create(void)
+{
+    TEST_ASSERT_MAX_TIME_ITER(build_by_create, 100, 5);
+}
+
+/*Cloning skips the theme and copies the already created styles*/
+void test_obj_build_by_clone(void)
+{
+    TEST_ASSERT_MAX_TIME_ITER(build_by_clone, 70, 5);
+}
+#endif
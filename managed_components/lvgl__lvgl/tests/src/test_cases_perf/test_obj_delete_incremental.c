@@ -0,0 +1,65 @@
+#if LV_BUILD_TEST_PERF
+#include "unity/unity.h"
+
+#define ROW_CNT     500
+
+static lv_obj_t * scr_old = NULL;
+static lv_obj_t * scr_new = NULL;
+
+void setUp(void)
+{
+    /*A large screen with `ROW_CNT` settings rows*/
+    scr_old = lv_obj_create(NULL);
+    lv_obj_t * cont = lv_obj_create(scr_old);
+    lv_obj_set_size(cont, 400, 400);
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_COLUMN);
+
+    uint32_t i;
+    for(i = 0; i < ROW_CNT; i++) {
+        lv_obj_t * row = lv_obj_create(cont);
+        lv_obj_set_size(row, lv_pct(100), LV_SIZE_CONTENT);
+        lv_obj_set_flex_flow(row, LV_FLEX_FLOW_ROW);
+        lv_obj_t * label = lv_label_create(row);
+        lv_label_set_text(label, "Setting");
+        lv_obj_set_flex_grow(label, 1);
+        lv_switch_create(row);
+    }
+
+    lv_screen_load(scr_old);
+    lv_refr_now(NULL);
+
+    scr_new = lv_obj_create(NULL);
+}
+
+void tearDown(void)
+{
+    lv_obj_delete_incremental_flush();
+    lv_screen_load(lv_obj_create(NULL));
+    lv_obj_delete(scr_new);
+}
+
+static void switch_screen(void)
+{
+    lv_screen_load(scr_new);
+    lv_obj_delete(scr_old);
+    lv_timer_handler();
+}
+
+static void switch_screen_incremental(void)
+{
+    lv_screen_load(scr_new);
+    lv_obj_delete_incremental(scr_old);
+    lv_timer_handler();
+}
+
+void test_obj_delete_screen(void)
+{
+    TEST_ASSERT_MAX_TIME(switch_screen, 50);
+}
+
+/*Only a part of the old screen is deleted in the frame of the switch*/
+void test_obj_delete_screen_incremental(void)
+{
+    TEST_ASSERT_MAX_TIME(switch_screen_incremental, 20);
+}
+#endif
@@ -0,0 +1,64 @@
+#if LV_BUILD_TEST_PERF
+#include "unity/unity.h"
+
+#define LEAF_CNT    20
+
+static lv_obj_t * cont = NULL;
+static lv_obj_t * leaves[LEAF_CNT];
+static uint32_t step_cnt;
+
+void setUp(void)
+{
+    cont = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(cont, 400, 400);
+    step_cnt = 0;
+}
+
+void tearDown(void)
+{
+    lv_obj_delete(cont);
+}
+
+/**
+ * Create `depth` nested objects and `LEAF_CNT` small objects in the innermost one
+ */
+static void create_nested(uint32_t depth)
+{
+    lv_obj_t * parent = cont;
+    uint32_t i;
+    for(i = 0; i < depth; i++) {
+        lv_obj_t * obj = lv_obj_create(parent);
+        lv_obj_remove_style_all(obj);
+        lv_obj_set_size(obj, lv_pct(100), lv_pct(100));
+        parent = obj;
+    }
+
+    for(i = 0; i < LEAF_CNT; i++) {
+        leaves[i] = lv_obj_create(parent);
+        lv_obj_set_size(leaves[i], 20, 20);
+        lv_obj_set_pos(leaves[i], (i % 5) * 40, (i / 5) * 40);
+    }
+
+    lv_obj_update_layout(cont);
+}
+
+static void invalidate_leaf(void)
+{
+    /*An animation invalidates the objects in each step*/
+    lv_obj_invalidate(leaves[step_cnt % LEAF_CNT]);
+    step_cnt++;
+}
+
+/*With LV_OBJ_VISIBILITY_CACHE invalidating an object doesn't depend on its depth*/
+void test_obj_visibility_shallow(void)
+{
+    create_nested(2);
+    TEST_ASSERT_MAX_TIME_ITER(invalidate_leaf, 20, 1000);
+}
+
+void test_obj_visibility_deep(void)
+{
+    create_nested(50);
+    TEST_ASSERT_MAX_TIME_ITER(invalidate_leaf, 20, 1000);
+}
+#endif
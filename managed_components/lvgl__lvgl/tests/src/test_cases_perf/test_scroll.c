@@ -0,0 +1,59 @@
+#if LV_BUILD_TEST_PERF
+#include "unity/unity.h"
+
+static lv_obj_t * cont = NULL;
+static uint32_t step_cnt;
+
+void setUp(void)
+{
+    cont = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(cont, 200, 300);
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_COLUMN);
+    step_cnt = 0;
+}
+
+void tearDown(void)
+{
+    lv_obj_delete(cont);
+}
+
+/**
+ * Create 20 items in the scrollable container with `label_cnt` labels in each
+ */
+static void create_items(uint32_t label_cnt)
+{
+    uint32_t i;
+    for(i = 0; i < 20; i++) {
+        lv_obj_t * item = lv_obj_create(cont);
+        lv_obj_set_size(item, lv_pct(100), LV_SIZE_CONTENT);
+        lv_obj_set_flex_flow(item, LV_FLEX_FLOW_COLUMN);
+        uint32_t j;
+        for(j = 0; j < label_cnt; j++) {
+            lv_obj_t * label = lv_label_create(item);
+            lv_label_set_text_fmt(label, "Item %d.%d", (int)i, (int)j);
+        }
+    }
+
+    lv_obj_update_layout(cont);
+}
+
+static void scroll_step(void)
+{
+    /*Go up and down in 1 px steps, like a slow drag*/
+    lv_obj_scroll_by(cont, 0, (step_cnt / 100) % 2 ? 1 : -1, LV_ANIM_OFF);
+    step_cnt++;
+}
+
+/*Scrolling moves all the descendants, so compare a small and a large subtree*/
+void test_scroll_small_subtree(void)
+{
+    create_items(1);
+    TEST_ASSERT_MAX_TIME_ITER(scroll_step, 50, 1000);
+}
+
+void test_scroll_large_subtree(void)
+{
+    create_items(100);
+    TEST_ASSERT_MAX_TIME_ITER(scroll_step, 250, 1000);
+}
+#endif
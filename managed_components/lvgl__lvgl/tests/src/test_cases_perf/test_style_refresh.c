@@ -0,0 +1,52 @@
+#if LV_BUILD_TEST_PERF
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+static lv_obj_t * cont;
+
+void setUp(void)
+{
+    cont = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(cont, 400, LV_SIZE_CONTENT);
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_ROW_WRAP);
+
+    uint32_t i;
+    for(i = 0; i < 200; i++) {
+        lv_obj_t * label = lv_label_create(cont);
+        lv_label_set_text_fmt(label, "Item %d", (int)i);
+    }
+    lv_obj_update_layout(cont);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+static void set_styles(uint32_t cnt)
+{
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        lv_obj_set_style_text_letter_space(cont, i & 3, 0);
+        lv_obj_set_style_text_line_space(cont, i & 7, 0);
+        lv_obj_set_style_text_font(cont, (i & 1) ? &lv_font_montserrat_14 : &lv_font_montserrat_16, 0);
+        lv_obj_set_style_pad_all(cont, 5 + (i & 3), 0);
+        lv_obj_set_style_pad_row(cont, 2 + (i & 1), 0);
+        lv_obj_set_style_pad_column(cont, 3 + (i & 1), 0);
+        lv_obj_set_style_border_width(cont, 1 + (i & 1), 0);
+        lv_obj_set_style_text_opa(cont, 200 + (i & 31), 0);
+        lv_obj_set_style_width(cont, 400 + (i & 7), 0);
+        lv_obj_set_style_shadow_width(cont, 10 + (i & 3), 0);
+        lv_obj_update_layout(cont);
+    }
+}
+
+/*Set 10 local style properties on a container with 200 children and update the layout*/
+void test_style_refresh_bulk_update(void)
+{
+    TEST_ASSERT_MAX_TIME(set_styles, 300, 100);
+}
+
+#endif
@@ -0,0 +1,69 @@
+#if LV_BUILD_TEST_PERF
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define ICON_CNT    100
+
+static const char * icon_svgs[] = {
+    "<svg width=\"32\" height=\"32\" viewBox=\"0 0 24 24\"><path d=\"M12 2L2 22h20z\" fill=\"#f80\"/></svg>",
+    "<svg width=\"32\" height=\"32\" viewBox=\"0 0 24 24\"><circle cx=\"12\" cy=\"12\" r=\"9\" fill=\"none\" stroke=\"#08f\" stroke-width=\"2\"/></svg>",
+    "<svg width=\"32\" height=\"32\" viewBox=\"0 0 24 24\"><rect x=\"3\" y=\"3\" width=\"18\" height=\"18\" rx=\"4\" fill=\"#4a4\"/></svg>",
+    "<svg width=\"32\" height=\"32\" viewBox=\"0 0 24 24\"><path d=\"M4 12h16M12 4v16\" stroke=\"#222\" stroke-width=\"3\" stroke-linecap=\"round\"/></svg>",
+    "<svg width=\"32\" height=\"32\" viewBox=\"0 0 24 24\"><path d=\"M12 21C6 16 2 12 2 8a5 5 0 0 1 10-1 5 5 0 0 1 10 1c0 4-4 8-10 13z\" fill=\"#e22\"/></svg>",
+    "<svg width=\"32\" height=\"32\" viewBox=\"0 0 24 24\"><path d=\"M6 18c0-4 3-5 3-9a3 3 0 0 1 6 0c0 4 3 5 3 9z\" fill=\"#555\"/><circle cx=\"12\" cy=\"20\" r=\"2\"/></svg>",
+    "<svg width=\"32\" height=\"32\" viewBox=\"0 0 24 24\"><polygon points=\"12,2 15,9 22,9 16,14 18,21 12,17 6,21 8,14 2,9 9,9\" fill=\"#fc0\"/></svg>",
+    "<svg width=\"32\" height=\"32\" viewBox=\"0 0 24 24\"><g fill=\"none\" stroke=\"#333\" stroke-width=\"2\"><rect x=\"2\" y=\"6\" width=\"20\" height=\"12\" rx=\"2\"/><path d=\"M2 8l10 6 10-6\"/></g></svg>",
+    "<svg width=\"32\" height=\"32\" viewBox=\"0 0 24 24\"><ellipse cx=\"12\" cy=\"12\" rx=\"10\" ry=\"6\" fill=\"#0aa\"/><circle cx=\"12\" cy=\"12\" r=\"3\" fill=\"#fff\"/></svg>",
+    "<svg width=\"32\" height=\"32\" viewBox=\"0 0 24 24\"><path d=\"M3 17l6-6 4 4 8-8\" fill=\"none\" stroke=\"#a0f\" stroke-width=\"2\" stroke-linejoin=\"round\"/></svg>",
+};
+
+#define SVG_CNT (sizeof(icon_svgs) / sizeof(icon_svgs[0]))
+
+static lv_image_dsc_t icon_dscs[SVG_CNT];
+
+void setUp(void)
+{
+    uint32_t i;
+    for(i = 0; i < SVG_CNT; i++) {
+        lv_memzero(&icon_dscs[i], sizeof(lv_image_dsc_t));
+        icon_dscs[i].header.magic = LV_IMAGE_HEADER_MAGIC;
+        icon_dscs[i].header.w = 32;
+        icon_dscs[i].header.h = 32;
+        icon_dscs[i].data = (const uint8_t *)icon_svgs[i];
+        icon_dscs[i].data_size = lv_strlen(icon_svgs[i]);
+    }
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+/*Create a full screen grid of SVG icons, render it and delete it again*/
+static void load_icon_screen(uint32_t cnt)
+{
+    lv_obj_t * cont = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(cont, lv_pct(100), lv_pct(100));
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_ROW_WRAP);
+    lv_obj_set_style_pad_all(cont, 2, 0);
+    lv_obj_set_style_pad_gap(cont, 2, 0);
+
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        lv_obj_t * img = lv_image_create(cont);
+        lv_image_set_src(img, &icon_dscs[i % SVG_CNT]);
+    }
+
+    lv_refr_now(NULL);
+
+    lv_obj_delete(cont);
+}
+
+void test_svg_icons_screen_load(void)
+{
+    TEST_ASSERT_MAX_TIME_ITER(load_icon_screen, 20, 5, ICON_CNT);
+}
+
+#endif
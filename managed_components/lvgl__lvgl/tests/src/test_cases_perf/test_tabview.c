@@ -0,0 +1,54 @@
+#if LV_BUILD_TEST_PERF
+#include "unity/unity.h"
+
+static lv_obj_t * tabview = NULL;
+static uint32_t tab_idx;
+
+void setUp(void)
+{
+    tabview = lv_tabview_create(lv_screen_active());
+
+    /*Tabs with many widgets which are expensive to redraw in every frame*/
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        lv_obj_t * tab = lv_tabview_add_tab(tabview, "Tab");
+        lv_obj_set_flex_flow(tab, LV_FLEX_FLOW_ROW_WRAP);
+        uint32_t j;
+        for(j = 0; j < 24; j++) {
+            lv_obj_t * btn = lv_button_create(tab);
+            lv_obj_set_style_shadow_width(btn, 20, 0);
+            lv_obj_set_style_bg_grad_dir(btn, LV_GRAD_DIR_VER, 0);
+            lv_obj_t * label = lv_label_create(btn);
+            lv_label_set_text_fmt(label, "Button %d", (int)j);
+        }
+    }
+
+    lv_refr_now(NULL);
+    tab_idx = 0;
+}
+
+void tearDown(void)
+{
+    lv_obj_delete(tabview);
+}
+
+static void switch_tab(void)
+{
+    /*Go back and forth between the first two tabs and play the whole animation*/
+    tab_idx = tab_idx == 0 ? 1 : 0;
+    lv_tabview_set_active(tabview, tab_idx, LV_ANIM_ON);
+    lv_test_wait(450);
+}
+
+void test_tabview_switch_tab_live(void)
+{
+    lv_tabview_set_tab_cache_size(tabview, 0);
+    TEST_ASSERT_MAX_TIME_ITER(switch_tab, 1500, 6);
+}
+
+void test_tabview_switch_tab_cached(void)
+{
+    lv_tabview_set_tab_cache_size(tabview, 8 * 1024 * 1024);
+    TEST_ASSERT_MAX_TIME_ITER(switch_tab, 500, 6);
+}
+#endif
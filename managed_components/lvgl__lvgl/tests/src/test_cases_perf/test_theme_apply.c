@@ -0,0 +1,37 @@
+#if LV_BUILD_TEST_PERF
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define WIDGET_CNT  500
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+static void create_widgets(lv_obj_t * (*create_cb)(lv_obj_t *))
+{
+    lv_obj_t * cont = lv_obj_create(lv_screen_active());
+    uint32_t i;
+    for(i = 0; i < WIDGET_CNT; i++) {
+        create_cb(cont);
+    }
+    lv_obj_delete(cont);
+}
+
+void test_theme_apply_on_create(void)
+{
+    TEST_ASSERT_MAX_TIME_ITER(create_widgets, 20, 10, lv_obj_create);
+    TEST_ASSERT_MAX_TIME_ITER(create_widgets, 40, 10, lv_button_create);
+    TEST_ASSERT_MAX_TIME_ITER(create_widgets, 40, 10, lv_switch_create);
+    TEST_ASSERT_MAX_TIME_ITER(create_widgets, 40, 10, lv_slider_create);
+    TEST_ASSERT_MAX_TIME_ITER(create_widgets, 40, 10, lv_table_create);
+}
+
+#endif
@@ -0,0 +1,115 @@
+#if LV_BUILD_TEST_PERF
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+extern const uint8_t test_ubuntu_font[];
+extern size_t test_ubuntu_font_size;
+
+static const char * paragraph =
+    "Typography is the art and technique of arranging type to make written language legible, "
+    "readable and appealing when displayed. The arrangement of type involves selecting typefaces, "
+    "point sizes, line lengths, line-spacing (leading), and letter-spacing (tracking). 0123456789";
+
+static lv_obj_t * label;
+
+void setUp(void)
+{
+    label = lv_label_create(lv_screen_active());
+    lv_obj_set_width(label, 400);
+    lv_label_set_text_static(label, paragraph);
+}
+
+void tearDown(void)
+{
+    lv_obj_delete(label);
+}
+
+static void refresh_label(uint32_t loops)
+{
+    uint32_t i;
+    for(i = 0; i < loops; i++) {
+        lv_obj_invalidate(label);
+        lv_refr_now(NULL);
+    }
+}
+
+/*Create a font and draw the text with it, so every glyph is rendered*/
+static void first_render(uint32_t loops)
+{
+    uint32_t i;
+    for(i = 0; i < loops; i++) {
+        lv_font_t * font = lv_tiny_ttf_create_data(test_ubuntu_font, test_ubuntu_font_size, 24);
+        lv_obj_set_style_text_font(label, font, 0);
+        lv_refr_now(NULL);
+
+        lv_obj_set_style_text_font(label, LV_FONT_DEFAULT, 0);
+        lv_tiny_ttf_destroy(font);
+    }
+}
+
+static void prefetch(uint32_t loops)
+{
+    uint32_t i;
+    for(i = 0; i < loops; i++) {
+        lv_font_t * font = lv_tiny_ttf_create_data(test_ubuntu_font, test_ubuntu_font_size, 24);
+        lv_tiny_ttf_prefetch_text(font, paragraph);
+        lv_tiny_ttf_destroy(font);
+    }
+}
+
+/*Switch between two sizes, the glyphs of both sizes stay in the bitmap cache*/
+static void switch_size(lv_font_t * font, uint32_t loops)
+{
+    uint32_t i;
+    for(i = 0; i < loops; i++) {
+        lv_tiny_ttf_set_size(font, (i & 1) ? 24 : 20);
+        lv_obj_report_style_change(NULL);
+        lv_refr_now(NULL);
+    }
+}
+
+void test_tiny_ttf_first_render(void)
+{
+    TEST_ASSERT_MAX_TIME_ITER(first_render, 300, 10, 5);
+}
+
+void test_tiny_ttf_prefetch(void)
+{
+    TEST_ASSERT_MAX_TIME_ITER(prefetch, 200, 10, 5);
+}
+
+void test_tiny_ttf_steady_state(void)
+{
+    lv_font_t * font = lv_tiny_ttf_create_data(test_ubuntu_font, test_ubuntu_font_size, 24);
+    lv_obj_set_style_text_font(label, font, 0);
+    lv_refr_now(NULL);
+
+    TEST_ASSERT_MAX_TIME_ITER(refresh_label, 150, 10, 10);
+
+    lv_obj_set_style_text_font(label, LV_FONT_DEFAULT, 0);
+    lv_tiny_ttf_destroy(font);
+}
+
+void test_tiny_ttf_steady_state_fmt_txt_reference(void)
+{
+    lv_obj_set_style_text_font(label, &lv_font_montserrat_24, 0);
+    lv_refr_now(NULL);
+
+    TEST_ASSERT_MAX_TIME_ITER(refresh_label, 100, 10, 10);
+}
+
+void test_tiny_ttf_switch_size(void)
+{
+    lv_font_t * font = lv_tiny_ttf_create_data(test_ubuntu_font, test_ubuntu_font_size, 24);
+    lv_obj_set_style_text_font(label, font, 0);
+    lv_refr_now(NULL);
+
+    TEST_ASSERT_MAX_TIME_ITER(switch_size, 300, 10, font, 10);
+
+    lv_obj_set_style_text_font(label, LV_FONT_DEFAULT, 0);
+    lv_tiny_ttf_destroy(font);
+}
+
+#endif